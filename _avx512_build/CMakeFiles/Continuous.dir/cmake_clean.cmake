@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Continuous"
+  "install_manifest.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Continuous.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ContinuousBuild"
+  "install_manifest.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ContinuousBuild.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,382 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/CheckCCompilerFlag.cmake"
+  "/root/repo/cmake/CheckCXXCompilerFlag.cmake"
+  "/root/repo/cmake/FindPythonModule.cmake"
+  "/root/repo/cmake/FindSphinx.cmake"
+  "/root/repo/cmake/TestClangVersion.c"
+  "/root/repo/cmake/TestSchedAffinity.cmake"
+  "/root/repo/cmake/TestWinProcNum.c"
+  "/root/repo/cmake/ThreadMPI.cmake"
+  "/root/repo/cmake/VersionInfo.cmake.cmakein"
+  "/root/repo/cmake/cmake_uninstall.cmake.in"
+  "/root/repo/cmake/gmxBuildTypeASAN.cmake"
+  "/root/repo/cmake/gmxBuildTypeMSAN.cmake"
+  "/root/repo/cmake/gmxBuildTypeProfile.cmake"
+  "/root/repo/cmake/gmxBuildTypeReference.cmake"
+  "/root/repo/cmake/gmxBuildTypeReleaseWithAssert.cmake"
+  "/root/repo/cmake/gmxBuildTypeTSAN.cmake"
+  "/root/repo/cmake/gmxCFlags.cmake"
+  "/root/repo/cmake/gmxCPackUtilities.cmake"
+  "/root/repo/cmake/gmxCustomCommandUtilities.cmake"
+  "/root/repo/cmake/gmxDetectClang30.cmake"
+  "/root/repo/cmake/gmxDetectSimd.cmake"
+  "/root/repo/cmake/gmxDetectTargetArchitecture.cmake"
+  "/root/repo/cmake/gmxFindFlagsForSource.cmake"
+  "/root/repo/cmake/gmxGCC44O3BugWorkaround.cmake"
+  "/root/repo/cmake/gmxGetGmockTupleWorkaround.cmake"
+  "/root/repo/cmake/gmxManageFFTLibraries.cmake"
+  "/root/repo/cmake/gmxManageGPU.cmake"
+  "/root/repo/cmake/gmxManageLinearAlgebraLibraries.cmake"
+  "/root/repo/cmake/gmxManageMPI.cmake"
+  "/root/repo/cmake/gmxManageOpenMP.cmake"
+  "/root/repo/cmake/gmxManageSharedLibraries.cmake"
+  "/root/repo/cmake/gmxManageSimd.cmake"
+  "/root/repo/cmake/gmxManageSuffixes.cmake"
+  "/root/repo/cmake/gmxOptionUtilities.cmake"
+  "/root/repo/cmake/gmxSetBuildInformation.cmake"
+  "/root/repo/cmake/gmxTestAVXMaskload.cmake"
+  "/root/repo/cmake/gmxTestCXX11.cmake"
+  "/root/repo/cmake/gmxTestCompilerProblems.cmake"
+  "/root/repo/cmake/gmxTestFloatFormat.cmake"
+  "/root/repo/cmake/gmxTestInlineASM.cmake"
+  "/root/repo/cmake/gmxTestIsfinite.cmake"
+  "/root/repo/cmake/gmxTestLargeFiles.cmake"
+  "/root/repo/cmake/gmxTestLibXml2.cmake"
+  "/root/repo/cmake/gmxTestPipes.cmake"
+  "/root/repo/cmake/gmxTestSignal.cmake"
+  "/root/repo/cmake/gmxTestXDR.cmake"
+  "/root/repo/cmake/gmxTestZLib.cmake"
+  "/root/repo/cmake/gmxTestdlopen.cmake"
+  "/root/repo/cmake/gmxVersionInfo.cmake"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/docs/doxygen/CMakeLists.txt"
+  "/root/repo/docs/manual/CMakeLists.txt"
+  "/root/repo/scripts/CMakeLists.txt"
+  "/root/repo/scripts/GMXRC.bash.cmakein"
+  "/root/repo/scripts/GMXRC.cmakein"
+  "/root/repo/scripts/GMXRC.csh.cmakein"
+  "/root/repo/scripts/GMXRC.zsh.cmakein"
+  "/root/repo/share/CMakeLists.txt"
+  "/root/repo/share/template/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/GetCompilerInfo.cmake"
+  "/root/repo/src/buildinfo.h.cmakein"
+  "/root/repo/src/config.h.cmakein"
+  "/root/repo/src/contrib/CMakeLists.txt"
+  "/root/repo/src/external/gmock-1.7.0/CMakeLists.txt"
+  "/root/repo/src/external/tng_io/BuildTNG.cmake"
+  "/root/repo/src/external/tng_io/include/tng/version.h.in"
+  "/root/repo/src/gmxpre-config.h.cmakein"
+  "/root/repo/src/gromacs/CMakeLists.txt"
+  "/root/repo/src/gromacs/InstallLibInfo.cmake"
+  "/root/repo/src/gromacs/analysisdata/CMakeLists.txt"
+  "/root/repo/src/gromacs/analysisdata/modules/CMakeLists.txt"
+  "/root/repo/src/gromacs/analysisdata/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/commandline/CMakeLists.txt"
+  "/root/repo/src/gromacs/commandline/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/correlationfunctions/CMakeLists.txt"
+  "/root/repo/src/gromacs/correlationfunctions/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/domdec/CMakeLists.txt"
+  "/root/repo/src/gromacs/essentialdynamics/CMakeLists.txt"
+  "/root/repo/src/gromacs/ewald/CMakeLists.txt"
+  "/root/repo/src/gromacs/fft/CMakeLists.txt"
+  "/root/repo/src/gromacs/fft/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/fileio/CMakeLists.txt"
+  "/root/repo/src/gromacs/fileio/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxana/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxana/legacytests/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxlib/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxlib/gpu_utils/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxpreprocess/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxpreprocess/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/gromacs-config-version.cmake.cmakein"
+  "/root/repo/src/gromacs/gromacs-config.cmake.cmakein"
+  "/root/repo/src/gromacs/imd/CMakeLists.txt"
+  "/root/repo/src/gromacs/legacyheaders/CMakeLists.txt"
+  "/root/repo/src/gromacs/legacyheaders/types/CMakeLists.txt"
+  "/root/repo/src/gromacs/libgromacs.pc.cmakein"
+  "/root/repo/src/gromacs/linearalgebra/CMakeLists.txt"
+  "/root/repo/src/gromacs/listed-forces/CMakeLists.txt"
+  "/root/repo/src/gromacs/math/CMakeLists.txt"
+  "/root/repo/src/gromacs/math/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/mdlib/CMakeLists.txt"
+  "/root/repo/src/gromacs/mdlib/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/mdrunutility/CMakeLists.txt"
+  "/root/repo/src/gromacs/onlinehelp/CMakeLists.txt"
+  "/root/repo/src/gromacs/onlinehelp/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/options/CMakeLists.txt"
+  "/root/repo/src/gromacs/options/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/pbcutil/CMakeLists.txt"
+  "/root/repo/src/gromacs/pulling/CMakeLists.txt"
+  "/root/repo/src/gromacs/random/CMakeLists.txt"
+  "/root/repo/src/gromacs/random/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/selection/CMakeLists.txt"
+  "/root/repo/src/gromacs/selection/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/simd/CMakeLists.txt"
+  "/root/repo/src/gromacs/simd/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/statistics/CMakeLists.txt"
+  "/root/repo/src/gromacs/swap/CMakeLists.txt"
+  "/root/repo/src/gromacs/timing/CMakeLists.txt"
+  "/root/repo/src/gromacs/tools/CMakeLists.txt"
+  "/root/repo/src/gromacs/topology/CMakeLists.txt"
+  "/root/repo/src/gromacs/trajectoryanalysis/CMakeLists.txt"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/utility/CMakeLists.txt"
+  "/root/repo/src/gromacs/utility/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/version.h.cmakein"
+  "/root/repo/src/programs/CMakeLists.txt"
+  "/root/repo/src/programs/mdrun/tests/CMakeLists.txt"
+  "/root/repo/src/testutils/CMakeLists.txt"
+  "/root/repo/src/testutils/TestMacros.cmake"
+  "/root/repo/src/testutils/tests/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/CppCheck.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBLAS.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLAPACK.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "VersionInfo-partial.cmake.cmakein"
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "cmake/cmake_uninstall.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/doxygen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/manual/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "share/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "share/template/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scripts/GMXRC"
+  "scripts/GMXRC.bash"
+  "scripts/GMXRC.csh"
+  "scripts/GMXRC.zsh"
+  "scripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/config.h"
+  "src/gmxpre-config.h"
+  "src/buildinfo.h"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/external/gmock-1.7.0/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/testutils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/testutils/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/external/tng_io/include/tng/version.h"
+  "src/gromacs/version.h"
+  "src/gromacs/libgromacs.pc"
+  "src/gromacs/gromacs-config.cmake"
+  "src/gromacs/gromacs-config-version.cmake"
+  "src/gromacs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxlib/nonbonded/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxlib/gpu_utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/mdlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/mdlib/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/listed-forces/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/commandline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/commandline/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/domdec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/ewald/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/fft/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/fft/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/linearalgebra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/math/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/mdrunutility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/random/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/random/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/onlinehelp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/onlinehelp/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/options/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/options/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/pbcutil/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/timing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/utility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/utility/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/fileio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/fileio/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/swap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/essentialdynamics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/pulling/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/simd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/simd/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/imd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/legacyheaders/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/legacyheaders/types/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxana/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxana/legacytests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxpreprocess/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxpreprocess/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/correlationfunctions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/correlationfunctions/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/statistics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/analysisdata/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/analysisdata/modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/analysisdata/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/selection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/selection/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/trajectoryanalysis/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/trajectoryanalysis/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/mdrun/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/contrib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/git-version-info.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/tests.dir/DependInfo.cmake"
+  "CMakeFiles/run-ctest.dir/DependInfo.cmake"
+  "CMakeFiles/check.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "docs/CMakeFiles/webpage-sphinx.dir/DependInfo.cmake"
+  "docs/CMakeFiles/install-guide.dir/DependInfo.cmake"
+  "docs/CMakeFiles/man.dir/DependInfo.cmake"
+  "docs/CMakeFiles/webpage.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/doxygen-all.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/doxygen-all-fast.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/doxygen-xml.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/doxygen-user.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/doxygen-lib.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/doxygen-lib-fast.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/doxygen-full.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/doxygen-full-fast.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/check-source.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/check-source-fast.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/dep-graphs.dir/DependInfo.cmake"
+  "docs/doxygen/CMakeFiles/dep-graphs-fast.dir/DependInfo.cmake"
+  "docs/manual/CMakeFiles/manual.dir/DependInfo.cmake"
+  "share/template/CMakeFiles/template.dir/DependInfo.cmake"
+  "src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "src/testutils/tests/CMakeFiles/testutils-test.dir/DependInfo.cmake"
+  "src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/DependInfo.cmake"
+  "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/DependInfo.cmake"
+  "src/gromacs/fft/tests/CMakeFiles/fft-test.dir/DependInfo.cmake"
+  "src/gromacs/math/tests/CMakeFiles/math-test.dir/DependInfo.cmake"
+  "src/gromacs/random/tests/CMakeFiles/random-test.dir/DependInfo.cmake"
+  "src/gromacs/onlinehelp/tests/CMakeFiles/onlinehelp-test-shared.dir/DependInfo.cmake"
+  "src/gromacs/onlinehelp/tests/CMakeFiles/onlinehelp-test.dir/DependInfo.cmake"
+  "src/gromacs/options/tests/CMakeFiles/options-test.dir/DependInfo.cmake"
+  "src/gromacs/utility/tests/CMakeFiles/utility-test.dir/DependInfo.cmake"
+  "src/gromacs/fileio/tests/CMakeFiles/fileio-test.dir/DependInfo.cmake"
+  "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/DependInfo.cmake"
+  "src/gromacs/gmxana/legacytests/CMakeFiles/legacy-tools-test.dir/DependInfo.cmake"
+  "src/gromacs/gmxpreprocess/tests/CMakeFiles/gmxpreprocess-test.dir/DependInfo.cmake"
+  "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/DependInfo.cmake"
+  "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test-shared.dir/DependInfo.cmake"
+  "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/DependInfo.cmake"
+  "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/DependInfo.cmake"
+  "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/DependInfo.cmake"
+  "src/gromacs/trajectoryanalysis/tests/CMakeFiles/test_selection.dir/DependInfo.cmake"
+  "src/programs/CMakeFiles/mdrun_objlib.dir/DependInfo.cmake"
+  "src/programs/CMakeFiles/view_objlib.dir/DependInfo.cmake"
+  "src/programs/CMakeFiles/gmx.dir/DependInfo.cmake"
+  "src/programs/CMakeFiles/completion.dir/DependInfo.cmake"
+  "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/DependInfo.cmake"
+  "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/regressiontests-notice.dir/DependInfo.cmake"
+  "tests/CMakeFiles/cppcheck.dir/DependInfo.cmake"
+  )
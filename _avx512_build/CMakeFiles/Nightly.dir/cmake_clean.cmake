@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Nightly"
+  "install_manifest.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Nightly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
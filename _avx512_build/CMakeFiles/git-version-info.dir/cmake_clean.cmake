@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/git-version-info"
+  "install_manifest.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/git-version-info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
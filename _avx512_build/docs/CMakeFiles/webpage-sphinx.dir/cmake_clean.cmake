@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/webpage-sphinx"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/webpage-sphinx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/docs
+# Build directory: /root/repo/_avx512_build/docs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("doxygen")
+subdirs("manual")
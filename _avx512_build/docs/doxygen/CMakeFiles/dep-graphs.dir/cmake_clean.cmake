@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dep-graphs"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/dep-graphs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/doxygen-all"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/doxygen-all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
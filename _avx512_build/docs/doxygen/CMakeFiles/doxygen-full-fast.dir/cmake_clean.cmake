@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/doxygen-full-fast"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/doxygen-full-fast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
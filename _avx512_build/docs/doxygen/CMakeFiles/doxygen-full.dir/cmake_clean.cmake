@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/doxygen-full"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/doxygen-full.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/docs/doxygen
+# Build directory: /root/repo/_avx512_build/docs/doxygen
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/external/gmock-1.7.0/gtest/src/gtest-all.cc" "src/external/gmock-1.7.0/CMakeFiles/gmock.dir/gtest/src/gtest-all.cc.o" "gcc" "src/external/gmock-1.7.0/CMakeFiles/gmock.dir/gtest/src/gtest-all.cc.o.d"
+  "/root/repo/src/external/gmock-1.7.0/src/gmock-all.cc" "src/external/gmock-1.7.0/CMakeFiles/gmock.dir/src/gmock-all.cc.o" "gcc" "src/external/gmock-1.7.0/CMakeFiles/gmock.dir/src/gmock-all.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libgmock.a"
+  "../../../lib/libgmock.pdb"
+  "CMakeFiles/gmock.dir/gtest/src/gtest-all.cc.o"
+  "CMakeFiles/gmock.dir/gtest/src/gtest-all.cc.o.d"
+  "CMakeFiles/gmock.dir/src/gmock-all.cc.o"
+  "CMakeFiles/gmock.dir/src/gmock-all.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "libgromacs" for configuration "Release"
+set_property(TARGET libgromacs APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(libgromacs PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "dl;rt;m;/usr/lib/x86_64-linux-gnu/libz.so;/usr/lib/x86_64-linux-gnu/libopenblas.so;/usr/lib/x86_64-linux-gnu/libopenblas.so;-lm;-ldl;-fopenmp"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libgromacs.so.2.0.0"
+  IMPORTED_SONAME_RELEASE "libgromacs.so.2"
+  )
+
+list(APPEND _cmake_import_check_targets libgromacs )
+list(APPEND _cmake_import_check_files_for_libgromacs "${_IMPORT_PREFIX}/lib/libgromacs.so.2.0.0" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
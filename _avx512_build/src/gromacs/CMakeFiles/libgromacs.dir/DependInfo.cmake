@@ -0,0 +1,908 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/external/fftpack/fftpack.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/fftpack/fftpack.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/fftpack/fftpack.c.o.d"
+  "/root/repo/src/external/lmfit/lmcurve.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/lmfit/lmcurve.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/lmfit/lmcurve.c.o.d"
+  "/root/repo/src/external/lmfit/lmmin.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/lmfit/lmmin.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/lmfit/lmmin.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/alltoall.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/alltoall.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/alltoall.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/atomic.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/atomic.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/atomic.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/barrier.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/barrier.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/barrier.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/bcast.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/bcast.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/bcast.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/collective.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/collective.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/collective.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/comm.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/comm.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/comm.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/errhandler.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/errhandler.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/errhandler.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/event.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/event.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/event.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/gather.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/gather.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/gather.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/group.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/group.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/group.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/list.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/list.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/list.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/lock.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/lock.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/lock.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/numa_malloc.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/numa_malloc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/numa_malloc.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/once.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/once.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/once.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/p2p_protocol.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_protocol.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_protocol.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/p2p_send_recv.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_send_recv.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_send_recv.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/p2p_wait.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_wait.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_wait.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/profile.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/profile.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/profile.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/pthreads.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/pthreads.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/pthreads.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/reduce.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/reduce.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/reduce.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/reduce_fast.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/reduce_fast.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/reduce_fast.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/scan.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/scan.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/scan.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/scatter.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/scatter.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/scatter.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/tmpi_init.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/tmpi_init.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/tmpi_init.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/tmpi_malloc.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/tmpi_malloc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/tmpi_malloc.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/topology.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/topology.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/topology.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/type.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/type.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/type.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/bwlzh.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/bwlzh.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/bwlzh.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/bwt.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/bwt.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/bwt.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/coder.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/coder.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/coder.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/dict.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/dict.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/dict.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/fixpoint.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/fixpoint.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/fixpoint.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/huffman.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/huffman.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/huffman.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/huffmem.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/huffmem.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/huffmem.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/lz77.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/lz77.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/lz77.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/merge_sort.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/merge_sort.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/merge_sort.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/mtf.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/mtf.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/mtf.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/rle.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/rle.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/rle.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/tng_compress.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/tng_compress.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/tng_compress.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/vals16.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/vals16.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/vals16.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/warnmalloc.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/warnmalloc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/warnmalloc.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/widemuldiv.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/widemuldiv.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/widemuldiv.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/xtc2.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/xtc2.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/xtc2.c.o.d"
+  "/root/repo/src/external/tng_io/src/compression/xtc3.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/xtc3.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/xtc3.c.o.d"
+  "/root/repo/src/external/tng_io/src/lib/md5.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/lib/md5.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/lib/md5.c.o.d"
+  "/root/repo/src/external/tng_io/src/lib/tng_io.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/lib/tng_io.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/tng_io/src/lib/tng_io.c.o.d"
+  "/root/repo/src/external/vmd_molfile/vmddlopen.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/vmd_molfile/vmddlopen.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/vmd_molfile/vmddlopen.c.o.d"
+  "/root/repo/src/gromacs/essentialdynamics/edsam.c" "src/gromacs/CMakeFiles/libgromacs.dir/essentialdynamics/edsam.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/essentialdynamics/edsam.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_cpuid.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_cpuid.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_cpuid.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_free_energy.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_free_energy.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_free_energy.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_generic.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_generic_adress.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_adress.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_adress.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_generic_cg.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_cg.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_cg.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEwSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEwSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEwSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nonbonded.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nonbonded.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nonbonded.c.o.d"
+  "/root/repo/src/gromacs/imd/imd.c" "src/gromacs/CMakeFiles/libgromacs.dir/imd/imd.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/imd/imd.c.o.d"
+  "/root/repo/src/gromacs/imd/imdsocket.c" "src/gromacs/CMakeFiles/libgromacs.dir/imd/imdsocket.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/imd/imdsocket.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/eigensolver.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/eigensolver.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/eigensolver.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/gmx_arpack.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/gmx_arpack.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/gmx_arpack.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/matrix.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/matrix.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/matrix.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/nrjac.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/nrjac.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/nrjac.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/sparsematrix.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/sparsematrix.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/sparsematrix.c.o.d"
+  "/root/repo/src/gromacs/math/do_fit.c" "src/gromacs/CMakeFiles/libgromacs.dir/math/do_fit.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/math/do_fit.c.o.d"
+  "/root/repo/src/gromacs/math/invsqrt.c" "src/gromacs/CMakeFiles/libgromacs.dir/math/invsqrt.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/math/invsqrt.c.o.d"
+  "/root/repo/src/gromacs/math/units.c" "src/gromacs/CMakeFiles/libgromacs.dir/math/units.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/math/units.c.o.d"
+  "/root/repo/src/gromacs/math/utilities.c" "src/gromacs/CMakeFiles/libgromacs.dir/math/utilities.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/math/utilities.c.o.d"
+  "/root/repo/src/gromacs/mdlib/calc_verletbuf.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calc_verletbuf.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calc_verletbuf.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nb_verlet_offload_arena.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nb_verlet_offload_arena.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nb_verlet_offload_arena.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nb_verlet_offload_loopback.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nb_verlet_offload_loopback.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nb_verlet_offload_loopback.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nb_verlet_simd_offload.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nb_verlet_simd_offload.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nb_verlet_simd_offload.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_atomdata.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_atomdata.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_atomdata.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_common.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_common.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_common.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_fep.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_fep.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_fep.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_prune.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_prune.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_prune.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_F_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_F_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_F_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_prune.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_prune.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_prune.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_search.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_search.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_search.c.o.d"
+  "/root/repo/src/gromacs/mdlib/packdata.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/packdata.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/packdata.c.o.d"
+  "/root/repo/src/gromacs/mdlib/tables.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tables.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tables.c.o.d"
+  "/root/repo/src/gromacs/pbcutil/pbc.c" "src/gromacs/CMakeFiles/libgromacs.dir/pbcutil/pbc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/pbcutil/pbc.c.o.d"
+  "/root/repo/src/gromacs/topology/invblock.c" "src/gromacs/CMakeFiles/libgromacs.dir/topology/invblock.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/invblock.c.o.d"
+  "/root/repo/src/gromacs/topology/mtop_util.c" "src/gromacs/CMakeFiles/libgromacs.dir/topology/mtop_util.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/mtop_util.c.o.d"
+  "/root/repo/src/gromacs/topology/topsort.c" "src/gromacs/CMakeFiles/libgromacs.dir/topology/topsort.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/topsort.c.o.d"
+  "/root/repo/_avx512_build/src/gromacs/utility/baseversion-gen.c" "src/gromacs/CMakeFiles/libgromacs.dir/utility/baseversion-gen.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/baseversion-gen.c.o.d"
+  "/root/repo/src/external/thread_mpi/src/system_error.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/system_error.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/system_error.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/abstractdata.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/abstractdata.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/abstractdata.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/analysisdata.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/analysisdata.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/analysisdata.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/arraydata.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/arraydata.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/arraydata.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/dataframe.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/dataframe.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/dataframe.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/datamodule.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/datamodule.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/datamodule.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/datamodulemanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/datamodulemanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/datamodulemanager.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/dataproxy.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/dataproxy.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/dataproxy.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/datastorage.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/datastorage.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/datastorage.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/average.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/average.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/average.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/displacement.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/displacement.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/displacement.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/frameaverager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/frameaverager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/frameaverager.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/histogram.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/histogram.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/histogram.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/lifetime.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/lifetime.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/lifetime.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/plot.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/plot.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/plot.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlinehelpcontext.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinehelpcontext.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinehelpcontext.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlinehelpmodule.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinehelpmodule.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinehelpmodule.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlinehelpwriter.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinehelpwriter.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinehelpwriter.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlineinit.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineinit.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineinit.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlinemodule.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinemodule.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinemodule.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlinemodulemanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinemodulemanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinemodulemanager.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlineoptionsmodule.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineoptionsmodule.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineoptionsmodule.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlineparser.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineparser.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineparser.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlineprogramcontext.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineprogramcontext.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineprogramcontext.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/pargs.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/pargs.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/pargs.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/shellcompletions.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/shellcompletions.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/shellcompletions.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/autocorr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/autocorr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/autocorr.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/crosscorr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/crosscorr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/crosscorr.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/expfit.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/expfit.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/expfit.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/integrate.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/integrate.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/integrate.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/manyautocorrelation.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/manyautocorrelation.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/manyautocorrelation.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/polynomials.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/polynomials.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/correlationfunctions/polynomials.cpp.o.d"
+  "/root/repo/src/gromacs/domdec/domdec.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec.cpp.o.d"
+  "/root/repo/src/gromacs/domdec/domdec_box.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_box.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_box.cpp.o.d"
+  "/root/repo/src/gromacs/domdec/domdec_constraints.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_constraints.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_constraints.cpp.o.d"
+  "/root/repo/src/gromacs/domdec/domdec_network.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_network.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_network.cpp.o.d"
+  "/root/repo/src/gromacs/domdec/domdec_setup.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_setup.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_setup.cpp.o.d"
+  "/root/repo/src/gromacs/domdec/domdec_specatomcomm.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_specatomcomm.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_specatomcomm.cpp.o.d"
+  "/root/repo/src/gromacs/domdec/domdec_topology.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_topology.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_topology.cpp.o.d"
+  "/root/repo/src/gromacs/domdec/domdec_vsite.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_vsite.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/domdec/domdec_vsite.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/calculate-spline-moduli.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/calculate-spline-moduli.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/calculate-spline-moduli.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/ewald.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/ewald.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/ewald.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/long-range-correction.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/long-range-correction.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/long-range-correction.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-gather.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-gather.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-gather.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-grid.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-grid.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-grid.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-load-balancing.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-load-balancing.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-load-balancing.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-only.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-only.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-only.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-pp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-pp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-pp.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-redistribute.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-redistribute.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-redistribute.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-solve.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-solve.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-solve.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-spline-work.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-spline-work.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-spline-work.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-spread.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-spread.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-spread.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme-task.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-task.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme-task.cpp.o.d"
+  "/root/repo/src/gromacs/ewald/pme.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/ewald/pme.cpp.o.d"
+  "/root/repo/src/gromacs/fft/fft.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fft/fft.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fft/fft.cpp.o.d"
+  "/root/repo/src/gromacs/fft/fft5d.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fft/fft5d.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fft/fft5d.cpp.o.d"
+  "/root/repo/src/gromacs/fft/fft_fftpack.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fft/fft_fftpack.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fft/fft_fftpack.cpp.o.d"
+  "/root/repo/src/gromacs/fft/parallel_3dfft.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fft/parallel_3dfft.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fft/parallel_3dfft.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/confio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/confio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/confio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/enxio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/enxio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/enxio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/espio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/espio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/espio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/filenm.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/filenm.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/filenm.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/g96io.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/g96io.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/g96io.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/gmx_internal_xdr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/gmx_internal_xdr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/gmx_internal_xdr.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/gmxfio-xdr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/gmxfio-xdr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/gmxfio-xdr.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/gmxfio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/gmxfio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/gmxfio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/groio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/groio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/groio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/libxdrf.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/libxdrf.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/libxdrf.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/matio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/matio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/matio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/md5.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/md5.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/md5.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/mdoutf.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/mdoutf.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/mdoutf.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/mtxio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/mtxio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/mtxio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/pdbio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/pdbio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/pdbio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/strdb.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/strdb.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/strdb.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/timecontrol.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/timecontrol.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/timecontrol.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/tngio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/tngio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/tngio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/tngio_for_tools.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/tngio_for_tools.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/tngio_for_tools.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/tpxio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/tpxio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/tpxio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/trajectory_writing.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/trajectory_writing.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/trajectory_writing.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/trrio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/trrio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/trrio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/trxio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/trxio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/trxio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/vmdio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/vmdio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/vmdio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/writeps.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/writeps.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/writeps.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/xdrd.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/xdrd.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/xdrd.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/xtcio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/xtcio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/xtcio.cpp.o.d"
+  "/root/repo/src/gromacs/fileio/xvgr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/xvgr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/fileio/xvgr.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/anadih.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/anadih.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/anadih.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/binsearch.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/binsearch.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/binsearch.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/cmat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/cmat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/cmat.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/dens_filter.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/dens_filter.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/dens_filter.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/dlist.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/dlist.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/dlist.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/edittop.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/edittop.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/edittop.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/eigio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/eigio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/eigio.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/fitahx.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/fitahx.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/fitahx.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_anadock.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_anadock.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_anadock.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_anaeig.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_anaeig.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_anaeig.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_analyze.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_analyze.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_analyze.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_angle.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_angle.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_angle.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_bar.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_bar.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_bar.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_bundle.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_bundle.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_bundle.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_chi.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_chi.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_chi.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_cluster.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_cluster.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_cluster.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_clustsize.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_clustsize.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_clustsize.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_confrms.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_confrms.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_confrms.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_covar.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_covar.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_covar.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_current.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_current.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_current.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_density.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_density.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_density.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_densmap.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_densmap.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_densmap.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_densorder.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_densorder.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_densorder.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_dielectric.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dielectric.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dielectric.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_dipoles.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dipoles.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dipoles.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_disre.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_disre.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_disre.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_do_dssp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_do_dssp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_do_dssp.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_dos.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dos.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dos.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_dyecoupl.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dyecoupl.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dyecoupl.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_dyndom.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dyndom.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_dyndom.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_editconf.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_editconf.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_editconf.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_eneconv.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_eneconv.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_eneconv.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_enemat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_enemat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_enemat.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_energy.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_energy.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_energy.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_filter.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_filter.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_filter.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_genion.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_genion.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_genion.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_genpr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_genpr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_genpr.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_gyrate.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_gyrate.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_gyrate.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_h2order.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_h2order.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_h2order.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_hbond.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_hbond.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_hbond.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_helix.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_helix.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_helix.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_helixorient.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_helixorient.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_helixorient.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_hydorder.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_hydorder.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_hydorder.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_lie.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_lie.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_lie.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_make_edi.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_make_edi.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_make_edi.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_make_ndx.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_make_ndx.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_make_ndx.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_mdmat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_mdmat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_mdmat.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_mindist.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_mindist.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_mindist.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_mk_angndx.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_mk_angndx.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_mk_angndx.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_morph.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_morph.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_morph.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_msd.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_msd.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_msd.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_nmeig.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_nmeig.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_nmeig.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_nmens.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_nmens.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_nmens.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_nmtraj.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_nmtraj.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_nmtraj.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_order.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_order.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_order.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_pme_error.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_pme_error.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_pme_error.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_polystat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_polystat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_polystat.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_potential.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_potential.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_potential.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_principal.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_principal.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_principal.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_rama.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rama.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rama.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_rms.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rms.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rms.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_rmsdist.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rmsdist.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rmsdist.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_rmsf.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rmsf.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rmsf.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_rotacf.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rotacf.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rotacf.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_rotmat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rotmat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_rotmat.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_saltbr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_saltbr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_saltbr.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_sans.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_sans.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_sans.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_saxs.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_saxs.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_saxs.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_sham.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_sham.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_sham.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_sigeps.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_sigeps.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_sigeps.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_sorient.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_sorient.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_sorient.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_spatial.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_spatial.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_spatial.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_spol.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_spol.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_spol.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_tcaf.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_tcaf.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_tcaf.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_traj.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_traj.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_traj.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_trjcat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_trjcat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_trjcat.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_trjconv.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_trjconv.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_trjconv.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_trjorder.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_trjorder.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_trjorder.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_tune_pme.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_tune_pme.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_tune_pme.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_vanhove.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_vanhove.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_vanhove.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_velacc.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_velacc.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_velacc.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_wham.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_wham.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_wham.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_wheel.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_wheel.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_wheel.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/gmx_xpm2ps.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_xpm2ps.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/gmx_xpm2ps.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/hxprops.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/hxprops.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/hxprops.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/nrama.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/nrama.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/nrama.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/nsfactor.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/nsfactor.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/nsfactor.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/powerspect.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/powerspect.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/powerspect.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/pp2shift.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/pp2shift.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/pp2shift.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/princ.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/princ.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/princ.cpp.o.d"
+  "/root/repo/src/gromacs/gmxana/sfactor.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/sfactor.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxana/sfactor.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/calcgrid.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/calcgrid.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/calcgrid.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/chargegroup.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/chargegroup.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/chargegroup.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/checkpoint.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/checkpoint.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/checkpoint.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/conformation-utilities.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/conformation-utilities.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/conformation-utilities.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/copyrite.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/copyrite.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/copyrite.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/disre.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/disre.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/disre.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_detect_hardware.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_detect_hardware.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_detect_hardware.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_omp_nthreads.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_omp_nthreads.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_omp_nthreads.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_thread_affinity.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_thread_affinity.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_thread_affinity.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/gpu_utils/gpu_utils.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gpu_utils/gpu_utils.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gpu_utils/gpu_utils.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/ifunc.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/ifunc.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/ifunc.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/inputrec.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/inputrec.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/inputrec.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/main.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/main.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/main.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/md_logging.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/md_logging.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/md_logging.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/names.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/names.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/names.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/network.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/network.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/network.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/nrnb.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nrnb.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nrnb.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/oenv.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/oenv.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/oenv.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/orires.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/orires.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/orires.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/rbin.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/rbin.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/rbin.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/readinp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/readinp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/readinp.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/sighandler.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/sighandler.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/sighandler.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/splitter.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/splitter.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/splitter.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/txtdump.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/txtdump.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/txtdump.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/typedefs.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/typedefs.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/typedefs.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/viewit.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/viewit.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/viewit.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/warninp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/warninp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/warninp.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/add_par.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/add_par.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/add_par.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/calch.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/calch.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/calch.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/convparm.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/convparm.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/convparm.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/fflibutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/fflibutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/fflibutil.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gen_ad.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_ad.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_ad.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gen_maxwell_velocities.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_maxwell_velocities.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_maxwell_velocities.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gen_vsite.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_vsite.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_vsite.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/genconf.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/genconf.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/genconf.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/genhydro.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/genhydro.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/genhydro.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gmxcpp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gmxcpp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gmxcpp.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gpp_atomtype.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_atomtype.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_atomtype.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gpp_bond_atomtype.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_bond_atomtype.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_bond_atomtype.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gpp_nextnb.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_nextnb.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_nextnb.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/grompp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/grompp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/grompp.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/h_db.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/h_db.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/h_db.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/hackblock.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/hackblock.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/hackblock.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/hizzie.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/hizzie.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/hizzie.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/insert-molecules.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/insert-molecules.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/insert-molecules.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/nm2type.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/nm2type.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/nm2type.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/pdb2gmx.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2gmx.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2gmx.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/pdb2top.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2top.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2top.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/pgutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pgutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pgutil.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/read-conformation.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/read-conformation.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/read-conformation.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/readadress.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readadress.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readadress.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/readir.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readir.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readir.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/readpull.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readpull.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readpull.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/readrot.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readrot.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readrot.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/resall.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/resall.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/resall.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/solvate.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/solvate.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/solvate.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/sortwater.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/sortwater.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/sortwater.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/specbond.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/specbond.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/specbond.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/ter_db.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/ter_db.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/ter_db.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/tomorse.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/tomorse.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/tomorse.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/topdirs.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topdirs.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topdirs.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/topio.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topio.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topio.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/toppush.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/toppush.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/toppush.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/topshake.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topshake.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topshake.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/toputil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/toputil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/toputil.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/vsite_parm.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/vsite_parm.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/vsite_parm.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/x2top.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/x2top.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/x2top.cpp.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/xlate.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/xlate.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/xlate.cpp.o.d"
+  "/root/repo/src/gromacs/listed-forces/bonded.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/bonded.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/bonded.cpp.o.d"
+  "/root/repo/src/gromacs/listed-forces/listed-forces.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/listed-forces.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/listed-forces.cpp.o.d"
+  "/root/repo/src/gromacs/listed-forces/listed-internal.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/listed-internal.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/listed-internal.cpp.o.d"
+  "/root/repo/src/gromacs/listed-forces/manage-threading.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/manage-threading.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/manage-threading.cpp.o.d"
+  "/root/repo/src/gromacs/listed-forces/pairs.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/pairs.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/pairs.cpp.o.d"
+  "/root/repo/src/gromacs/listed-forces/position-restraints.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/position-restraints.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/position-restraints.cpp.o.d"
+  "/root/repo/src/gromacs/listed-forces/restcbt.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/restcbt.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/listed-forces/restcbt.cpp.o.d"
+  "/root/repo/src/gromacs/math/3dtransforms.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/math/3dtransforms.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/math/3dtransforms.cpp.o.d"
+  "/root/repo/src/gromacs/math/calculate-ewald-splitting-coefficient.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/math/calculate-ewald-splitting-coefficient.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/math/calculate-ewald-splitting-coefficient.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/adress.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/adress.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/adress.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/broadcaststructs.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/broadcaststructs.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/broadcaststructs.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/calcmu.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calcmu.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calcmu.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/calcvir.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calcvir.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calcvir.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/clincs.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/clincs.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/clincs.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/compute_io.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/compute_io.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/compute_io.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/constr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/constr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/constr.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/coupling.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/coupling.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/coupling.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/csettle.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/csettle.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/csettle.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/ebin.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ebin.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ebin.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/expanded.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/expanded.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/expanded.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/force.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/force.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/force.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/forcerec.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/forcerec.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/forcerec.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/genborn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/genborn_allvsall.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/groupcoord.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/groupcoord.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/groupcoord.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/md_support.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/md_support.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/md_support.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/mdatom.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdatom.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdatom.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/mdebin.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdebin.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdebin.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/mdebin_bar.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdebin_bar.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdebin_bar.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/mdrun_signalling.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdrun_signalling.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdrun_signalling.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/minimize.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/minimize.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/minimize.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/ns.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ns.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ns.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/nsgrid.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nsgrid.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nsgrid.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/perf_est.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/perf_est.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/perf_est.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_gamess.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_gamess.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_gamess.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_gaussian.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_gaussian.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_gaussian.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_mopac.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_mopac.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_mopac.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_orca.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_orca.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_orca.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/qmmm.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qmmm.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qmmm.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/rf_util.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/rf_util.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/rf_util.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/shakef.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/shakef.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/shakef.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/shellfc.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/shellfc.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/shellfc.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/sim_util.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/sim_util.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/sim_util.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/stat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/stat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/stat.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/tgroup.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tgroup.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tgroup.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/tpi.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tpi.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tpi.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/update.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/update.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/update.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/vcm.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/vcm.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/vcm.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/vsite.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/vsite.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/vsite.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/wall.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/wall.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/wall.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/wnblist.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/wnblist.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/wnblist.cpp.o.d"
+  "/root/repo/src/gromacs/mdrunutility/handlerestart.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdrunutility/handlerestart.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdrunutility/handlerestart.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/helpformat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpformat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpformat.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/helpmanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpmanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpmanager.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/helptopic.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helptopic.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helptopic.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/helpwritercontext.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpwritercontext.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpwritercontext.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/rstparser.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/rstparser.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/rstparser.cpp.o.d"
+  "/root/repo/src/gromacs/options/abstractoption.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/abstractoption.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/abstractoption.cpp.o.d"
+  "/root/repo/src/gromacs/options/basicoptions.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/basicoptions.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/basicoptions.cpp.o.d"
+  "/root/repo/src/gromacs/options/filenameoption.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/filenameoption.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/filenameoption.cpp.o.d"
+  "/root/repo/src/gromacs/options/filenameoptionmanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/filenameoptionmanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/filenameoptionmanager.cpp.o.d"
+  "/root/repo/src/gromacs/options/options.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/options.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/options.cpp.o.d"
+  "/root/repo/src/gromacs/options/optionsassigner.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/optionsassigner.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/optionsassigner.cpp.o.d"
+  "/root/repo/src/gromacs/options/optionsvisitor.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/optionsvisitor.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/optionsvisitor.cpp.o.d"
+  "/root/repo/src/gromacs/options/timeunitmanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/timeunitmanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/timeunitmanager.cpp.o.d"
+  "/root/repo/src/gromacs/pbcutil/mshift.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/pbcutil/mshift.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/pbcutil/mshift.cpp.o.d"
+  "/root/repo/src/gromacs/pbcutil/pbc-simd.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/pbcutil/pbc-simd.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/pbcutil/pbc-simd.cpp.o.d"
+  "/root/repo/src/gromacs/pbcutil/rmpbc.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/pbcutil/rmpbc.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/pbcutil/rmpbc.cpp.o.d"
+  "/root/repo/src/gromacs/pulling/pull.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/pulling/pull.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/pulling/pull.cpp.o.d"
+  "/root/repo/src/gromacs/pulling/pull_rotation.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/pulling/pull_rotation.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/pulling/pull_rotation.cpp.o.d"
+  "/root/repo/src/gromacs/pulling/pullutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/pulling/pullutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/pulling/pullutil.cpp.o.d"
+  "/root/repo/src/gromacs/random/random.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/random/random.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/random/random.cpp.o.d"
+  "/root/repo/src/gromacs/selection/centerofmass.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/centerofmass.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/centerofmass.cpp.o.d"
+  "/root/repo/src/gromacs/selection/compiler.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/compiler.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/compiler.cpp.o.d"
+  "/root/repo/src/gromacs/selection/evaluate.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/evaluate.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/evaluate.cpp.o.d"
+  "/root/repo/src/gromacs/selection/indexutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/indexutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/indexutil.cpp.o.d"
+  "/root/repo/src/gromacs/selection/mempool.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/mempool.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/mempool.cpp.o.d"
+  "/root/repo/src/gromacs/selection/nbsearch.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/nbsearch.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/nbsearch.cpp.o.d"
+  "/root/repo/src/gromacs/selection/params.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/params.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/params.cpp.o.d"
+  "/root/repo/src/gromacs/selection/parser.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/parser.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/parser.cpp.o.d"
+  "/root/repo/src/gromacs/selection/parsetree.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/parsetree.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/parsetree.cpp.o.d"
+  "/root/repo/src/gromacs/selection/poscalc.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/poscalc.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/poscalc.cpp.o.d"
+  "/root/repo/src/gromacs/selection/position.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/position.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/position.cpp.o.d"
+  "/root/repo/src/gromacs/selection/scanner.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/scanner.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/scanner.cpp.o.d"
+  "/root/repo/src/gromacs/selection/scanner_internal.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/scanner_internal.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/scanner_internal.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selection.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selection.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selection.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selectioncollection.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectioncollection.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectioncollection.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selectionoption.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectionoption.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectionoption.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selectionoptionmanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectionoptionmanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectionoptionmanager.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selelem.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selelem.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selelem.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selhelp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selhelp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selhelp.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selmethod.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selmethod.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selmethod.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selvalue.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selvalue.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selvalue.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_compare.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_compare.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_compare.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_distance.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_distance.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_distance.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_insolidangle.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_insolidangle.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_insolidangle.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_keywords.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_keywords.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_keywords.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_merge.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_merge.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_merge.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_permute.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_permute.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_permute.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_position.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_position.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_position.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_same.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_same.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_same.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_simple.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_simple.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_simple.cpp.o.d"
+  "/root/repo/src/gromacs/selection/symrec.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/symrec.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/symrec.cpp.o.d"
+  "/root/repo/src/gromacs/statistics/statistics.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/statistics/statistics.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/statistics/statistics.cpp.o.d"
+  "/root/repo/src/gromacs/swap/swapcoords.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/swap/swapcoords.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/swap/swapcoords.cpp.o.d"
+  "/root/repo/src/gromacs/timing/cyclecounter.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/timing/cyclecounter.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/timing/cyclecounter.cpp.o.d"
+  "/root/repo/src/gromacs/timing/wallcycle.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/timing/wallcycle.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/timing/wallcycle.cpp.o.d"
+  "/root/repo/src/gromacs/timing/walltime_accounting.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/timing/walltime_accounting.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/timing/walltime_accounting.cpp.o.d"
+  "/root/repo/src/gromacs/tools/check.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/tools/check.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/tools/check.cpp.o.d"
+  "/root/repo/src/gromacs/tools/compare.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/tools/compare.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/tools/compare.cpp.o.d"
+  "/root/repo/src/gromacs/tools/convert_tpr.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/tools/convert_tpr.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/tools/convert_tpr.cpp.o.d"
+  "/root/repo/src/gromacs/tools/dump.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/tools/dump.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/tools/dump.cpp.o.d"
+  "/root/repo/src/gromacs/topology/atomprop.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/topology/atomprop.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/atomprop.cpp.o.d"
+  "/root/repo/src/gromacs/topology/atoms.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/topology/atoms.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/atoms.cpp.o.d"
+  "/root/repo/src/gromacs/topology/atomsbuilder.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/topology/atomsbuilder.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/atomsbuilder.cpp.o.d"
+  "/root/repo/src/gromacs/topology/block.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/topology/block.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/block.cpp.o.d"
+  "/root/repo/src/gromacs/topology/index.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/topology/index.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/index.cpp.o.d"
+  "/root/repo/src/gromacs/topology/residuetypes.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/topology/residuetypes.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/residuetypes.cpp.o.d"
+  "/root/repo/src/gromacs/topology/symtab.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/topology/symtab.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/symtab.cpp.o.d"
+  "/root/repo/src/gromacs/topology/topology.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/topology/topology.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/topology/topology.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/analysismodule.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/analysismodule.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/analysismodule.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/analysissettings.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/analysissettings.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/analysissettings.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/cmdlinerunner.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/cmdlinerunner.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/cmdlinerunner.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/angle.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/angle.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/angle.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/distance.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/distance.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/distance.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/freevolume.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/freevolume.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/freevolume.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/pairdist.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/pairdist.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/pairdist.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/rdf.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/rdf.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/rdf.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/sasa.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/sasa.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/sasa.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/select.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/select.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/select.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/surfacearea.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/surfacearea.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/surfacearea.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/runnercommon.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/runnercommon.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/runnercommon.cpp.o.d"
+  "/root/repo/src/gromacs/utility/basenetwork.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/basenetwork.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/basenetwork.cpp.o.d"
+  "/root/repo/src/gromacs/utility/baseversion.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/baseversion.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/baseversion.cpp.o.d"
+  "/root/repo/src/gromacs/utility/cstringutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/cstringutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/cstringutil.cpp.o.d"
+  "/root/repo/src/gromacs/utility/datafilefinder.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/datafilefinder.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/datafilefinder.cpp.o.d"
+  "/root/repo/src/gromacs/utility/directoryenumerator.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/directoryenumerator.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/directoryenumerator.cpp.o.d"
+  "/root/repo/src/gromacs/utility/errorcodes.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/errorcodes.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/errorcodes.cpp.o.d"
+  "/root/repo/src/gromacs/utility/errorformat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/errorformat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/errorformat.cpp.o.d"
+  "/root/repo/src/gromacs/utility/exceptions.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/exceptions.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/exceptions.cpp.o.d"
+  "/root/repo/src/gromacs/utility/fatalerror.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/fatalerror.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/fatalerror.cpp.o.d"
+  "/root/repo/src/gromacs/utility/fileredirector.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/fileredirector.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/fileredirector.cpp.o.d"
+  "/root/repo/src/gromacs/utility/filestream.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/filestream.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/filestream.cpp.o.d"
+  "/root/repo/src/gromacs/utility/futil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/futil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/futil.cpp.o.d"
+  "/root/repo/src/gromacs/utility/gmxassert.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxassert.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxassert.cpp.o.d"
+  "/root/repo/src/gromacs/utility/gmxomp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxomp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxomp.cpp.o.d"
+  "/root/repo/src/gromacs/utility/gmxregex.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxregex.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxregex.cpp.o.d"
+  "/root/repo/src/gromacs/utility/init.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/init.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/init.cpp.o.d"
+  "/root/repo/src/gromacs/utility/messagestringcollector.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/messagestringcollector.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/messagestringcollector.cpp.o.d"
+  "/root/repo/src/gromacs/utility/path.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/path.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/path.cpp.o.d"
+  "/root/repo/src/gromacs/utility/programcontext.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/programcontext.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/programcontext.cpp.o.d"
+  "/root/repo/src/gromacs/utility/qsort_threadsafe.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/qsort_threadsafe.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/qsort_threadsafe.cpp.o.d"
+  "/root/repo/src/gromacs/utility/smalloc.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/smalloc.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/smalloc.cpp.o.d"
+  "/root/repo/src/gromacs/utility/stringstream.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/stringstream.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/stringstream.cpp.o.d"
+  "/root/repo/src/gromacs/utility/stringutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/stringutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/stringutil.cpp.o.d"
+  "/root/repo/src/gromacs/utility/sysinfo.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/sysinfo.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/sysinfo.cpp.o.d"
+  "/root/repo/src/gromacs/utility/textreader.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/textreader.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/textreader.cpp.o.d"
+  "/root/repo/src/gromacs/utility/textwriter.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/textwriter.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/textwriter.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_avx512_build/lib/libgromacs.so" "/root/repo/_avx512_build/lib/libgromacs.so.2.0.0"
+  "/root/repo/_avx512_build/lib/libgromacs.so.2" "/root/repo/_avx512_build/lib/libgromacs.so.2.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
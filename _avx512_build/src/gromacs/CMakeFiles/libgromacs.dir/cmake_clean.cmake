@@ -0,0 +1,1778 @@
+file(REMOVE_RECURSE
+  "../../lib/libgromacs.pdb"
+  "../../lib/libgromacs.so"
+  "../../lib/libgromacs.so.2"
+  "../../lib/libgromacs.so.2.0.0"
+  "CMakeFiles/libgromacs.dir/__/external/fftpack/fftpack.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/fftpack/fftpack.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/lmfit/lmcurve.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/lmfit/lmcurve.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/lmfit/lmmin.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/lmfit/lmmin.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/alltoall.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/alltoall.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/atomic.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/atomic.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/barrier.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/barrier.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/bcast.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/bcast.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/collective.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/collective.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/comm.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/comm.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/errhandler.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/errhandler.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/event.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/event.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/gather.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/gather.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/group.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/group.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/list.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/list.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/lock.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/lock.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/numa_malloc.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/numa_malloc.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/once.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/once.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_protocol.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_protocol.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_send_recv.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_send_recv.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_wait.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/p2p_wait.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/profile.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/profile.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/pthreads.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/pthreads.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/reduce.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/reduce.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/reduce_fast.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/reduce_fast.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/scan.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/scan.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/scatter.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/scatter.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/system_error.cpp.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/system_error.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/tmpi_init.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/tmpi_init.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/tmpi_malloc.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/tmpi_malloc.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/topology.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/topology.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/type.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/thread_mpi/src/type.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/bwlzh.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/bwlzh.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/bwt.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/bwt.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/coder.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/coder.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/dict.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/dict.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/fixpoint.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/fixpoint.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/huffman.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/huffman.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/huffmem.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/huffmem.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/lz77.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/lz77.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/merge_sort.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/merge_sort.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/mtf.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/mtf.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/rle.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/rle.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/tng_compress.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/tng_compress.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/vals16.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/vals16.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/warnmalloc.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/warnmalloc.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/widemuldiv.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/widemuldiv.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/xtc2.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/xtc2.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/xtc3.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/compression/xtc3.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/lib/md5.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/lib/md5.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/lib/tng_io.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/tng_io/src/lib/tng_io.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/vmd_molfile/vmddlopen.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/vmd_molfile/vmddlopen.c.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/abstractdata.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/abstractdata.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/analysisdata.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/analysisdata.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/arraydata.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/arraydata.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/dataframe.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/dataframe.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/datamodule.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/datamodule.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/datamodulemanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/datamodulemanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/dataproxy.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/dataproxy.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/datastorage.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/datastorage.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/average.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/average.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/displacement.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/displacement.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/frameaverager.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/frameaverager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/histogram.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/histogram.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/lifetime.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/lifetime.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/plot.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/plot.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinehelpcontext.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinehelpcontext.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinehelpmodule.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinehelpmodule.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinehelpwriter.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinehelpwriter.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineinit.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineinit.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinemodule.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinemodule.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinemodulemanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinemodulemanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineoptionsmodule.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineoptionsmodule.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineparser.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineparser.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineprogramcontext.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineprogramcontext.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/pargs.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/pargs.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/shellcompletions.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/shellcompletions.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/autocorr.cpp.o"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/autocorr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/crosscorr.cpp.o"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/crosscorr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/expfit.cpp.o"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/expfit.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/integrate.cpp.o"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/integrate.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/manyautocorrelation.cpp.o"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/manyautocorrelation.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/polynomials.cpp.o"
+  "CMakeFiles/libgromacs.dir/correlationfunctions/polynomials.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/domdec/domdec.cpp.o"
+  "CMakeFiles/libgromacs.dir/domdec/domdec.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_box.cpp.o"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_box.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_constraints.cpp.o"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_constraints.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_network.cpp.o"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_network.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_setup.cpp.o"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_setup.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_specatomcomm.cpp.o"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_specatomcomm.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_topology.cpp.o"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_topology.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_vsite.cpp.o"
+  "CMakeFiles/libgromacs.dir/domdec/domdec_vsite.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/essentialdynamics/edsam.c.o"
+  "CMakeFiles/libgromacs.dir/essentialdynamics/edsam.c.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/calculate-spline-moduli.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/calculate-spline-moduli.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/ewald.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/ewald.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/long-range-correction.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/long-range-correction.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-gather.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-gather.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-grid.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-grid.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-load-balancing.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-load-balancing.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-only.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-only.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-pp.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-pp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-redistribute.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-redistribute.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-solve.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-solve.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-spline-work.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-spline-work.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-spread.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-spread.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme-task.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme-task.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/ewald/pme.cpp.o"
+  "CMakeFiles/libgromacs.dir/ewald/pme.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fft/fft.cpp.o"
+  "CMakeFiles/libgromacs.dir/fft/fft.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fft/fft5d.cpp.o"
+  "CMakeFiles/libgromacs.dir/fft/fft5d.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fft/fft_fftpack.cpp.o"
+  "CMakeFiles/libgromacs.dir/fft/fft_fftpack.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fft/parallel_3dfft.cpp.o"
+  "CMakeFiles/libgromacs.dir/fft/parallel_3dfft.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/confio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/confio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/enxio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/enxio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/espio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/espio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/filenm.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/filenm.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/g96io.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/g96io.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/gmx_internal_xdr.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/gmx_internal_xdr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/gmxfio-xdr.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/gmxfio-xdr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/gmxfio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/gmxfio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/groio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/groio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/libxdrf.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/libxdrf.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/matio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/matio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/md5.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/md5.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/mdoutf.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/mdoutf.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/mtxio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/mtxio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/pdbio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/pdbio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/strdb.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/strdb.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/timecontrol.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/timecontrol.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/tngio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/tngio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/tngio_for_tools.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/tngio_for_tools.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/tpxio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/tpxio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/trajectory_writing.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/trajectory_writing.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/trrio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/trrio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/trxio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/trxio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/vmdio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/vmdio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/writeps.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/writeps.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/xdrd.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/xdrd.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/xtcio.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/xtcio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/fileio/xvgr.cpp.o"
+  "CMakeFiles/libgromacs.dir/fileio/xvgr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/anadih.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/anadih.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/binsearch.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/binsearch.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/cmat.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/cmat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/dens_filter.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/dens_filter.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/dlist.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/dlist.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/edittop.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/edittop.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/eigio.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/eigio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/fitahx.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/fitahx.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_anadock.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_anadock.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_anaeig.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_anaeig.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_analyze.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_analyze.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_angle.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_angle.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_bar.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_bar.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_bundle.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_bundle.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_chi.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_chi.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_cluster.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_cluster.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_clustsize.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_clustsize.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_confrms.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_confrms.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_covar.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_covar.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_current.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_current.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_density.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_density.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_densmap.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_densmap.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_densorder.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_densorder.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dielectric.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dielectric.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dipoles.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dipoles.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_disre.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_disre.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_do_dssp.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_do_dssp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dos.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dos.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dyecoupl.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dyecoupl.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dyndom.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_dyndom.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_editconf.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_editconf.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_eneconv.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_eneconv.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_enemat.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_enemat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_energy.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_energy.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_filter.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_filter.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_genion.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_genion.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_genpr.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_genpr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_gyrate.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_gyrate.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_h2order.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_h2order.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_hbond.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_hbond.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_helix.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_helix.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_helixorient.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_helixorient.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_hydorder.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_hydorder.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_lie.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_lie.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_make_edi.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_make_edi.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_make_ndx.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_make_ndx.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_mdmat.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_mdmat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_mindist.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_mindist.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_mk_angndx.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_mk_angndx.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_morph.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_morph.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_msd.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_msd.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_nmeig.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_nmeig.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_nmens.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_nmens.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_nmtraj.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_nmtraj.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_order.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_order.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_pme_error.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_pme_error.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_polystat.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_polystat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_potential.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_potential.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_principal.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_principal.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rama.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rama.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rms.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rms.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rmsdist.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rmsdist.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rmsf.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rmsf.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rotacf.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rotacf.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rotmat.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_rotmat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_saltbr.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_saltbr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_sans.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_sans.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_saxs.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_saxs.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_sham.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_sham.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_sigeps.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_sigeps.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_sorient.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_sorient.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_spatial.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_spatial.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_spol.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_spol.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_tcaf.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_tcaf.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_traj.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_traj.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_trjcat.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_trjcat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_trjconv.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_trjconv.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_trjorder.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_trjorder.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_tune_pme.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_tune_pme.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_vanhove.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_vanhove.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_velacc.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_velacc.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_wham.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_wham.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_wheel.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_wheel.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_xpm2ps.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/gmx_xpm2ps.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/hxprops.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/hxprops.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/nrama.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/nrama.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/nsfactor.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/nsfactor.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/powerspect.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/powerspect.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/pp2shift.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/pp2shift.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/princ.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/princ.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxana/sfactor.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxana/sfactor.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/calcgrid.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/calcgrid.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/chargegroup.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/chargegroup.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/checkpoint.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/checkpoint.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/conformation-utilities.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/conformation-utilities.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/copyrite.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/copyrite.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/disre.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/disre.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_cpuid.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_cpuid.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_detect_hardware.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_detect_hardware.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_omp_nthreads.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_omp_nthreads.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_thread_affinity.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_thread_affinity.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gpu_utils/gpu_utils.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gpu_utils/gpu_utils.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/ifunc.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/ifunc.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/inputrec.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/inputrec.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/main.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/main.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/md_logging.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/md_logging.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/names.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/names.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/network.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/network.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_free_energy.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_free_energy.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_adress.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_adress.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_cg.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_cg.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJEwSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJEw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEwSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEwSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJEw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nonbonded.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nonbonded.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nrnb.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nrnb.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/oenv.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/oenv.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/orires.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/orires.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/rbin.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/rbin.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/readinp.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/readinp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/sighandler.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/sighandler.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/splitter.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/splitter.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/txtdump.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/txtdump.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/typedefs.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/typedefs.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/viewit.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/viewit.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/warninp.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/warninp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/add_par.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/add_par.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/calch.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/calch.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/convparm.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/convparm.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/fflibutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/fflibutil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_ad.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_ad.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_maxwell_velocities.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_maxwell_velocities.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_vsite.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_vsite.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/genconf.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/genconf.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/genhydro.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/genhydro.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gmxcpp.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gmxcpp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_atomtype.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_atomtype.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_bond_atomtype.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_bond_atomtype.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_nextnb.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_nextnb.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/grompp.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/grompp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/h_db.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/h_db.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/hackblock.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/hackblock.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/hizzie.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/hizzie.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/insert-molecules.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/insert-molecules.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/nm2type.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/nm2type.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2gmx.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2gmx.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2top.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2top.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pgutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pgutil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/read-conformation.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/read-conformation.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readadress.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readadress.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readir.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readir.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readpull.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readpull.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readrot.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readrot.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/resall.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/resall.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/solvate.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/solvate.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/sortwater.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/sortwater.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/specbond.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/specbond.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/ter_db.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/ter_db.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/tomorse.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/tomorse.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topdirs.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topdirs.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topio.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topio.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/toppush.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/toppush.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topshake.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topshake.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/toputil.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/toputil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/vsite_parm.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/vsite_parm.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/x2top.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/x2top.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/xlate.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/xlate.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/imd/imd.c.o"
+  "CMakeFiles/libgromacs.dir/imd/imd.c.o.d"
+  "CMakeFiles/libgromacs.dir/imd/imdsocket.c.o"
+  "CMakeFiles/libgromacs.dir/imd/imdsocket.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/eigensolver.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/eigensolver.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/gmx_arpack.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/gmx_arpack.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/matrix.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/matrix.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/nrjac.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/nrjac.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/sparsematrix.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/sparsematrix.c.o.d"
+  "CMakeFiles/libgromacs.dir/listed-forces/bonded.cpp.o"
+  "CMakeFiles/libgromacs.dir/listed-forces/bonded.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/listed-forces/listed-forces.cpp.o"
+  "CMakeFiles/libgromacs.dir/listed-forces/listed-forces.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/listed-forces/listed-internal.cpp.o"
+  "CMakeFiles/libgromacs.dir/listed-forces/listed-internal.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/listed-forces/manage-threading.cpp.o"
+  "CMakeFiles/libgromacs.dir/listed-forces/manage-threading.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/listed-forces/pairs.cpp.o"
+  "CMakeFiles/libgromacs.dir/listed-forces/pairs.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/listed-forces/position-restraints.cpp.o"
+  "CMakeFiles/libgromacs.dir/listed-forces/position-restraints.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/listed-forces/restcbt.cpp.o"
+  "CMakeFiles/libgromacs.dir/listed-forces/restcbt.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/math/3dtransforms.cpp.o"
+  "CMakeFiles/libgromacs.dir/math/3dtransforms.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/math/calculate-ewald-splitting-coefficient.cpp.o"
+  "CMakeFiles/libgromacs.dir/math/calculate-ewald-splitting-coefficient.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/math/do_fit.c.o"
+  "CMakeFiles/libgromacs.dir/math/do_fit.c.o.d"
+  "CMakeFiles/libgromacs.dir/math/invsqrt.c.o"
+  "CMakeFiles/libgromacs.dir/math/invsqrt.c.o.d"
+  "CMakeFiles/libgromacs.dir/math/units.c.o"
+  "CMakeFiles/libgromacs.dir/math/units.c.o.d"
+  "CMakeFiles/libgromacs.dir/math/utilities.c.o"
+  "CMakeFiles/libgromacs.dir/math/utilities.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/adress.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/adress.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/broadcaststructs.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/broadcaststructs.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/calc_verletbuf.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/calc_verletbuf.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/calcmu.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/calcmu.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/calcvir.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/calcvir.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/clincs.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/clincs.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/compute_io.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/compute_io.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/constr.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/constr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/coupling.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/coupling.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/csettle.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/csettle.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/ebin.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/ebin.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/expanded.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/expanded.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/force.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/force.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/forcerec.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/forcerec.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/groupcoord.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/groupcoord.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/md_support.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/md_support.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/mdatom.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/mdatom.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/mdebin.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/mdebin.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/mdebin_bar.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/mdebin_bar.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/mdrun_signalling.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/mdrun_signalling.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/minimize.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/minimize.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nb_verlet_offload_arena.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nb_verlet_offload_arena.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nb_verlet_offload_loopback.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nb_verlet_offload_loopback.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nb_verlet_simd_offload.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nb_verlet_simd_offload.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_atomdata.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_atomdata.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_common.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_common.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_fep.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_fep.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_prune.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_prune.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_F_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecEw_VdwLJ_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTabTwinCut_VdwLJ_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecQSTab_VdwLJ_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJCombLB_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJFSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJPSw_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_F_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_F_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_ElecRF_VdwLJ_VgrpF_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_prune.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_prune.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_search.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_search.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/ns.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/ns.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nsgrid.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nsgrid.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/packdata.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/packdata.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/perf_est.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/perf_est.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_gamess.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_gamess.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_gaussian.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_gaussian.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_mopac.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_mopac.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_orca.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_orca.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qmmm.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qmmm.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/rf_util.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/rf_util.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/shakef.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/shakef.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/shellfc.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/shellfc.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/sim_util.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/sim_util.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/stat.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/stat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/tables.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/tables.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/tgroup.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/tgroup.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/tpi.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/tpi.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/update.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/update.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/vcm.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/vcm.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/vsite.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/vsite.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/wall.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/wall.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/wnblist.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/wnblist.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdrunutility/handlerestart.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdrunutility/handlerestart.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpformat.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpformat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpmanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpmanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helptopic.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helptopic.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpwritercontext.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpwritercontext.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/rstparser.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/rstparser.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/abstractoption.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/abstractoption.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/basicoptions.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/basicoptions.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/filenameoption.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/filenameoption.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/filenameoptionmanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/filenameoptionmanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/options.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/options.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/optionsassigner.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/optionsassigner.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/optionsvisitor.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/optionsvisitor.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/timeunitmanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/timeunitmanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/pbcutil/mshift.cpp.o"
+  "CMakeFiles/libgromacs.dir/pbcutil/mshift.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/pbcutil/pbc-simd.cpp.o"
+  "CMakeFiles/libgromacs.dir/pbcutil/pbc-simd.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/pbcutil/pbc.c.o"
+  "CMakeFiles/libgromacs.dir/pbcutil/pbc.c.o.d"
+  "CMakeFiles/libgromacs.dir/pbcutil/rmpbc.cpp.o"
+  "CMakeFiles/libgromacs.dir/pbcutil/rmpbc.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/pulling/pull.cpp.o"
+  "CMakeFiles/libgromacs.dir/pulling/pull.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/pulling/pull_rotation.cpp.o"
+  "CMakeFiles/libgromacs.dir/pulling/pull_rotation.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/pulling/pullutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/pulling/pullutil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/random/random.cpp.o"
+  "CMakeFiles/libgromacs.dir/random/random.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/centerofmass.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/centerofmass.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/compiler.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/compiler.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/evaluate.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/evaluate.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/indexutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/indexutil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/mempool.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/mempool.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/nbsearch.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/nbsearch.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/params.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/params.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/parser.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/parser.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/parsetree.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/parsetree.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/poscalc.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/poscalc.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/position.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/position.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/scanner.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/scanner.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/scanner_internal.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/scanner_internal.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selection.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selection.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selectioncollection.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selectioncollection.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selectionoption.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selectionoption.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selectionoptionmanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selectionoptionmanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selelem.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selelem.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selhelp.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selhelp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selmethod.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selmethod.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selvalue.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selvalue.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_compare.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_compare.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_distance.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_distance.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_insolidangle.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_insolidangle.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_keywords.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_keywords.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_merge.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_merge.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_permute.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_permute.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_position.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_position.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_same.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_same.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_simple.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_simple.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/symrec.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/symrec.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/statistics/statistics.cpp.o"
+  "CMakeFiles/libgromacs.dir/statistics/statistics.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/swap/swapcoords.cpp.o"
+  "CMakeFiles/libgromacs.dir/swap/swapcoords.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/timing/cyclecounter.cpp.o"
+  "CMakeFiles/libgromacs.dir/timing/cyclecounter.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/timing/wallcycle.cpp.o"
+  "CMakeFiles/libgromacs.dir/timing/wallcycle.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/timing/walltime_accounting.cpp.o"
+  "CMakeFiles/libgromacs.dir/timing/walltime_accounting.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/tools/check.cpp.o"
+  "CMakeFiles/libgromacs.dir/tools/check.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/tools/compare.cpp.o"
+  "CMakeFiles/libgromacs.dir/tools/compare.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/tools/convert_tpr.cpp.o"
+  "CMakeFiles/libgromacs.dir/tools/convert_tpr.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/tools/dump.cpp.o"
+  "CMakeFiles/libgromacs.dir/tools/dump.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/atomprop.cpp.o"
+  "CMakeFiles/libgromacs.dir/topology/atomprop.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/atoms.cpp.o"
+  "CMakeFiles/libgromacs.dir/topology/atoms.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/atomsbuilder.cpp.o"
+  "CMakeFiles/libgromacs.dir/topology/atomsbuilder.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/block.cpp.o"
+  "CMakeFiles/libgromacs.dir/topology/block.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/index.cpp.o"
+  "CMakeFiles/libgromacs.dir/topology/index.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/invblock.c.o"
+  "CMakeFiles/libgromacs.dir/topology/invblock.c.o.d"
+  "CMakeFiles/libgromacs.dir/topology/mtop_util.c.o"
+  "CMakeFiles/libgromacs.dir/topology/mtop_util.c.o.d"
+  "CMakeFiles/libgromacs.dir/topology/residuetypes.cpp.o"
+  "CMakeFiles/libgromacs.dir/topology/residuetypes.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/symtab.cpp.o"
+  "CMakeFiles/libgromacs.dir/topology/symtab.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/topology.cpp.o"
+  "CMakeFiles/libgromacs.dir/topology/topology.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/topology/topsort.c.o"
+  "CMakeFiles/libgromacs.dir/topology/topsort.c.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/analysismodule.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/analysismodule.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/analysissettings.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/analysissettings.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/cmdlinerunner.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/cmdlinerunner.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/angle.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/angle.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/distance.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/distance.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/freevolume.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/freevolume.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/pairdist.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/pairdist.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/rdf.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/rdf.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/sasa.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/sasa.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/select.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/select.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/surfacearea.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/surfacearea.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/runnercommon.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/runnercommon.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/basenetwork.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/basenetwork.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/baseversion-gen.c.o"
+  "CMakeFiles/libgromacs.dir/utility/baseversion-gen.c.o.d"
+  "CMakeFiles/libgromacs.dir/utility/baseversion.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/baseversion.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/cstringutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/cstringutil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/datafilefinder.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/datafilefinder.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/directoryenumerator.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/directoryenumerator.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/errorcodes.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/errorcodes.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/errorformat.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/errorformat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/exceptions.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/exceptions.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/fatalerror.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/fatalerror.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/fileredirector.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/fileredirector.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/filestream.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/filestream.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/futil.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/futil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/gmxassert.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/gmxassert.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/gmxomp.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/gmxomp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/gmxregex.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/gmxregex.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/init.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/init.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/messagestringcollector.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/messagestringcollector.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/path.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/path.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/programcontext.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/programcontext.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/qsort_threadsafe.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/qsort_threadsafe.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/smalloc.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/smalloc.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/stringstream.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/stringstream.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/stringutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/stringutil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/sysinfo.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/sysinfo.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/textreader.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/textreader.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/textwriter.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/textwriter.cpp.o.d"
+  "utility/baseversion-gen.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libgromacs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
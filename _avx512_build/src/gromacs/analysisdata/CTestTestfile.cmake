@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/analysisdata
+# Build directory: /root/repo/_avx512_build/src/gromacs/analysisdata
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("modules")
+subdirs("tests")
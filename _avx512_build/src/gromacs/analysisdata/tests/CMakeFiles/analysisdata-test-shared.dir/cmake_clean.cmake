@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/analysisdata-test-shared.dir/datatest.cpp.o"
+  "CMakeFiles/analysisdata-test-shared.dir/datatest.cpp.o.d"
+  "CMakeFiles/analysisdata-test-shared.dir/mock_datamodule.cpp.o"
+  "CMakeFiles/analysisdata-test-shared.dir/mock_datamodule.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/analysisdata-test-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,156 @@
+# Install script for directory: /root/repo/src/gromacs
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local/gromacs")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/gromacs" TYPE FILE FILES
+    "/root/repo/src/gromacs/analysisdata.h"
+    "/root/repo/src/gromacs/commandline.h"
+    "/root/repo/src/gromacs/options.h"
+    "/root/repo/src/gromacs/selection.h"
+    "/root/repo/src/gromacs/trajectoryanalysis.h"
+    "/root/repo/src/gromacs/utility.h"
+    "/root/repo/_avx512_build/src/gromacs/version.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_avx512_build/lib/libgromacs.so.2.0.0"
+    "/root/repo/_avx512_build/lib/libgromacs.so.2"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libgromacs.so.2.0.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libgromacs.so.2"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_avx512_build/lib/libgromacs.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libgromacs.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libgromacs.so")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libgromacs.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/pkgconfig" TYPE FILE RENAME "libgromacs.pc" FILES "/root/repo/_avx512_build/src/gromacs/libgromacs.pc")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/share/cmake/gromacs/libgromacs.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/share/cmake/gromacs/libgromacs.cmake"
+         "/root/repo/_avx512_build/src/gromacs/CMakeFiles/Export/61be7a8dfb8f59a540c33cb55c92167c/libgromacs.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/share/cmake/gromacs/libgromacs-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/share/cmake/gromacs/libgromacs.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/cmake/gromacs" TYPE FILE FILES "/root/repo/_avx512_build/src/gromacs/CMakeFiles/Export/61be7a8dfb8f59a540c33cb55c92167c/libgromacs.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee])$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/cmake/gromacs" TYPE FILE FILES "/root/repo/_avx512_build/src/gromacs/CMakeFiles/Export/61be7a8dfb8f59a540c33cb55c92167c/libgromacs-release.cmake")
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/cmake/gromacs" TYPE FILE RENAME "gromacs-config.cmake" FILES "/root/repo/_avx512_build/src/gromacs/gromacs-config.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/cmake/gromacs" TYPE FILE RENAME "gromacs-config-version.cmake" FILES "/root/repo/_avx512_build/src/gromacs/gromacs-config-version.cmake")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_avx512_build/src/gromacs/gmxlib/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/mdlib/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/listed-forces/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/commandline/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/domdec/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/ewald/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/fft/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/linearalgebra/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/math/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/mdrunutility/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/random/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/onlinehelp/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/options/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/pbcutil/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/timing/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/topology/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/utility/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/fileio/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/swap/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/essentialdynamics/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/pulling/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/simd/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/imd/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/legacyheaders/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/gmxana/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/gmxpreprocess/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/correlationfunctions/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/statistics/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/analysisdata/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/selection/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/trajectoryanalysis/cmake_install.cmake")
+  include("/root/repo/_avx512_build/src/gromacs/tools/cmake_install.cmake")
+
+endif()
+
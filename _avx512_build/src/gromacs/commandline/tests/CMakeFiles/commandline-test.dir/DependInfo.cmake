@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/tests/cmdlinehelpmodule.cpp" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlinehelpmodule.cpp.o" "gcc" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlinehelpmodule.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/tests/cmdlinehelpwriter.cpp" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlinehelpwriter.cpp.o" "gcc" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlinehelpwriter.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/tests/cmdlinemodulemanager.cpp" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlinemodulemanager.cpp.o" "gcc" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlinemodulemanager.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/tests/cmdlinemodulemanagertest.cpp" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlinemodulemanagertest.cpp.o" "gcc" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlinemodulemanagertest.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/tests/cmdlineparser.cpp" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlineparser.cpp.o" "gcc" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlineparser.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/tests/cmdlineprogramcontext.cpp" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlineprogramcontext.cpp.o" "gcc" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/cmdlineprogramcontext.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/tests/pargs.cpp" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/pargs.cpp.o" "gcc" "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/pargs.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
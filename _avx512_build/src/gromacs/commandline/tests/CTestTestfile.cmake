@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/commandline/tests
+# Build directory: /root/repo/_avx512_build/src/gromacs/commandline/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CommandLineUnitTests "/root/repo/_avx512_build/bin/commandline-test" "--gtest_output=xml:/root/repo/_avx512_build/Testing/Temporary/CommandLineUnitTests.xml")
+set_tests_properties(CommandLineUnitTests PROPERTIES  LABELS "GTest;UnitTest" _BACKTRACE_TRIPLES "/root/repo/src/testutils/TestMacros.cmake;67;add_test;/root/repo/src/testutils/TestMacros.cmake;147;gmx_register_unit_test;/root/repo/src/gromacs/commandline/tests/CMakeLists.txt;54;gmx_add_unit_test;/root/repo/src/gromacs/commandline/tests/CMakeLists.txt;0;")
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/tests/autocorr.cpp" "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/autocorr.cpp.o" "gcc" "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/autocorr.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/tests/correlationdataset.cpp" "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/correlationdataset.cpp.o" "gcc" "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/correlationdataset.cpp.o.d"
+  "/root/repo/src/gromacs/correlationfunctions/tests/expfit.cpp" "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/expfit.cpp.o" "gcc" "src/gromacs/correlationfunctions/tests/CMakeFiles/correlations-test.dir/expfit.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../../bin/correlations-test"
+  "../../../../bin/correlations-test.pdb"
+  "CMakeFiles/correlations-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/correlations-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/correlations-test.dir/autocorr.cpp.o"
+  "CMakeFiles/correlations-test.dir/autocorr.cpp.o.d"
+  "CMakeFiles/correlations-test.dir/correlationdataset.cpp.o"
+  "CMakeFiles/correlations-test.dir/correlationdataset.cpp.o.d"
+  "CMakeFiles/correlations-test.dir/expfit.cpp.o"
+  "CMakeFiles/correlations-test.dir/expfit.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/correlations-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/fft/tests/CMakeFiles/fft-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/fft/tests/CMakeFiles/fft-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/fft/tests/fft.cpp" "src/gromacs/fft/tests/CMakeFiles/fft-test.dir/fft.cpp.o" "gcc" "src/gromacs/fft/tests/CMakeFiles/fft-test.dir/fft.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
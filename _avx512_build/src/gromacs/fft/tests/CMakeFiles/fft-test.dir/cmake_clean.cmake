@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../bin/fft-test"
+  "../../../../bin/fft-test.pdb"
+  "CMakeFiles/fft-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/fft-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/fft-test.dir/fft.cpp.o"
+  "CMakeFiles/fft-test.dir/fft.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fft-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../bin/fileio-test"
+  "../../../../bin/fileio-test.pdb"
+  "CMakeFiles/fileio-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/fileio-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/fileio-test.dir/confio.cpp.o"
+  "CMakeFiles/fileio-test.dir/confio.cpp.o.d"
+  "CMakeFiles/fileio-test.dir/tngio.cpp.o"
+  "CMakeFiles/fileio-test.dir/tngio.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fileio-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/gmxana
+# Build directory: /root/repo/_avx512_build/src/gromacs/gmxana
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("legacytests")
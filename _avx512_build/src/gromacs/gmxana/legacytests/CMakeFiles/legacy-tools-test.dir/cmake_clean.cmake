@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../bin/legacy-tools-test"
+  "../../../../bin/legacy-tools-test.pdb"
+  "CMakeFiles/legacy-tools-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/legacy-tools-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/legacy-tools-test.dir/gmx_traj_tests.cpp.o"
+  "CMakeFiles/legacy-tools-test.dir/gmx_traj_tests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/legacy-tools-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/gmxana/legacytests
+# Build directory: /root/repo/_avx512_build/src/gromacs/gmxana/legacytests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LegacyToolsTests "/root/repo/_avx512_build/bin/legacy-tools-test" "--gtest_output=xml:/root/repo/_avx512_build/Testing/Temporary/LegacyToolsTests.xml")
+set_tests_properties(LegacyToolsTests PROPERTIES  LABELS "IntegrationTest" _BACKTRACE_TRIPLES "/root/repo/src/testutils/TestMacros.cmake;77;add_test;/root/repo/src/gromacs/gmxana/legacytests/CMakeLists.txt;44;gmx_register_integration_test;/root/repo/src/gromacs/gmxana/legacytests/CMakeLists.txt;0;")
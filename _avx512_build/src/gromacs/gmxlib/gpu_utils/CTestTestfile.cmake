@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/gmxlib/gpu_utils
+# Build directory: /root/repo/_avx512_build/src/gromacs/gmxlib/gpu_utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../bin/gmxpreprocess-test"
+  "../../../../bin/gmxpreprocess-test.pdb"
+  "CMakeFiles/gmxpreprocess-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/gmxpreprocess-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/gmxpreprocess-test.dir/insert-molecules.cpp.o"
+  "CMakeFiles/gmxpreprocess-test.dir/insert-molecules.cpp.o.d"
+  "CMakeFiles/gmxpreprocess-test.dir/solvate.cpp.o"
+  "CMakeFiles/gmxpreprocess-test.dir/solvate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmxpreprocess-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
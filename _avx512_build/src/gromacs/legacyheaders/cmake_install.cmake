@@ -0,0 +1,102 @@
+# Install script for directory: /root/repo/src/gromacs/legacyheaders
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local/gromacs")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/gromacs/legacyheaders" TYPE FILE FILES
+    "/root/repo/src/gromacs/legacyheaders/calcgrid.h"
+    "/root/repo/src/gromacs/legacyheaders/calcmu.h"
+    "/root/repo/src/gromacs/legacyheaders/chargegroup.h"
+    "/root/repo/src/gromacs/legacyheaders/checkpoint.h"
+    "/root/repo/src/gromacs/legacyheaders/constr.h"
+    "/root/repo/src/gromacs/legacyheaders/copyrite.h"
+    "/root/repo/src/gromacs/legacyheaders/disre.h"
+    "/root/repo/src/gromacs/legacyheaders/ebin.h"
+    "/root/repo/src/gromacs/legacyheaders/force.h"
+    "/root/repo/src/gromacs/legacyheaders/genborn.h"
+    "/root/repo/src/gromacs/legacyheaders/gmx_cpuid.h"
+    "/root/repo/src/gromacs/legacyheaders/gmx_detect_hardware.h"
+    "/root/repo/src/gromacs/legacyheaders/gmx_omp_nthreads.h"
+    "/root/repo/src/gromacs/legacyheaders/gmx_thread_affinity.h"
+    "/root/repo/src/gromacs/legacyheaders/inputrec.h"
+    "/root/repo/src/gromacs/legacyheaders/macros.h"
+    "/root/repo/src/gromacs/legacyheaders/main.h"
+    "/root/repo/src/gromacs/legacyheaders/md_logging.h"
+    "/root/repo/src/gromacs/legacyheaders/md_support.h"
+    "/root/repo/src/gromacs/legacyheaders/mdatoms.h"
+    "/root/repo/src/gromacs/legacyheaders/mdebin.h"
+    "/root/repo/src/gromacs/legacyheaders/mdrun.h"
+    "/root/repo/src/gromacs/legacyheaders/names.h"
+    "/root/repo/src/gromacs/legacyheaders/network.h"
+    "/root/repo/src/gromacs/legacyheaders/nonbonded.h"
+    "/root/repo/src/gromacs/legacyheaders/nrnb.h"
+    "/root/repo/src/gromacs/legacyheaders/ns.h"
+    "/root/repo/src/gromacs/legacyheaders/nsgrid.h"
+    "/root/repo/src/gromacs/legacyheaders/oenv.h"
+    "/root/repo/src/gromacs/legacyheaders/orires.h"
+    "/root/repo/src/gromacs/legacyheaders/perf_est.h"
+    "/root/repo/src/gromacs/legacyheaders/qmmm.h"
+    "/root/repo/src/gromacs/legacyheaders/rbin.h"
+    "/root/repo/src/gromacs/legacyheaders/readinp.h"
+    "/root/repo/src/gromacs/legacyheaders/shellfc.h"
+    "/root/repo/src/gromacs/legacyheaders/sighandler.h"
+    "/root/repo/src/gromacs/legacyheaders/sim_util.h"
+    "/root/repo/src/gromacs/legacyheaders/splitter.h"
+    "/root/repo/src/gromacs/legacyheaders/tables.h"
+    "/root/repo/src/gromacs/legacyheaders/tgroup.h"
+    "/root/repo/src/gromacs/legacyheaders/txtdump.h"
+    "/root/repo/src/gromacs/legacyheaders/typedefs.h"
+    "/root/repo/src/gromacs/legacyheaders/update.h"
+    "/root/repo/src/gromacs/legacyheaders/vcm.h"
+    "/root/repo/src/gromacs/legacyheaders/viewit.h"
+    "/root/repo/src/gromacs/legacyheaders/vsite.h"
+    "/root/repo/src/gromacs/legacyheaders/warninp.h"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_avx512_build/src/gromacs/legacyheaders/types/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/legacyheaders/types
+# Build directory: /root/repo/_avx512_build/src/gromacs/legacyheaders/types
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
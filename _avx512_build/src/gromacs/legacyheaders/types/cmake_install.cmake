@@ -0,0 +1,74 @@
+# Install script for directory: /root/repo/src/gromacs/legacyheaders/types
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local/gromacs")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/gromacs/legacyheaders/types" TYPE FILE FILES
+    "/root/repo/src/gromacs/legacyheaders/types/commrec_fwd.h"
+    "/root/repo/src/gromacs/legacyheaders/types/constr.h"
+    "/root/repo/src/gromacs/legacyheaders/types/energy.h"
+    "/root/repo/src/gromacs/legacyheaders/types/enums.h"
+    "/root/repo/src/gromacs/legacyheaders/types/fcdata.h"
+    "/root/repo/src/gromacs/legacyheaders/types/force_flags.h"
+    "/root/repo/src/gromacs/legacyheaders/types/forcerec.h"
+    "/root/repo/src/gromacs/legacyheaders/types/genborn.h"
+    "/root/repo/src/gromacs/legacyheaders/types/group.h"
+    "/root/repo/src/gromacs/legacyheaders/types/hw_info.h"
+    "/root/repo/src/gromacs/legacyheaders/types/ifunc.h"
+    "/root/repo/src/gromacs/legacyheaders/types/inputrec.h"
+    "/root/repo/src/gromacs/legacyheaders/types/interaction_const.h"
+    "/root/repo/src/gromacs/legacyheaders/types/mdatom.h"
+    "/root/repo/src/gromacs/legacyheaders/types/membedt.h"
+    "/root/repo/src/gromacs/legacyheaders/types/nblist.h"
+    "/root/repo/src/gromacs/legacyheaders/types/nrnb.h"
+    "/root/repo/src/gromacs/legacyheaders/types/ns.h"
+    "/root/repo/src/gromacs/legacyheaders/types/nsgrid.h"
+    "/root/repo/src/gromacs/legacyheaders/types/oenv.h"
+    "/root/repo/src/gromacs/legacyheaders/types/qmmmrec.h"
+    "/root/repo/src/gromacs/legacyheaders/types/rgb.h"
+    "/root/repo/src/gromacs/legacyheaders/types/shellfc.h"
+    "/root/repo/src/gromacs/legacyheaders/types/simple.h"
+    "/root/repo/src/gromacs/legacyheaders/types/state.h"
+    )
+endif()
+
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../bin/math-test"
+  "../../../../bin/math-test.pdb"
+  "CMakeFiles/math-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/math-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/math-test.dir/vectypes.cpp.o"
+  "CMakeFiles/math-test.dir/vectypes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
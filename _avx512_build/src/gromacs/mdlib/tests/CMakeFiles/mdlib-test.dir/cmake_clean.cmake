@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../../bin/mdlib-test"
+  "../../../../bin/mdlib-test.pdb"
+  "CMakeFiles/mdlib-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/mdlib-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/mdlib-test.dir/nbnxn_prune.cpp.o"
+  "CMakeFiles/mdlib-test.dir/nbnxn_prune.cpp.o.d"
+  "CMakeFiles/mdlib-test.dir/nbnxn_reduction.cpp.o"
+  "CMakeFiles/mdlib-test.dir/nbnxn_reduction.cpp.o.d"
+  "CMakeFiles/mdlib-test.dir/shake.cpp.o"
+  "CMakeFiles/mdlib-test.dir/shake.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mdlib-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/onlinehelp-test-shared.dir/mock_helptopic.cpp.o"
+  "CMakeFiles/onlinehelp-test-shared.dir/mock_helptopic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/onlinehelp-test-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../../bin/onlinehelp-test"
+  "../../../../bin/onlinehelp-test.pdb"
+  "CMakeFiles/onlinehelp-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/onlinehelp-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/onlinehelp-test.dir/helpformat.cpp.o"
+  "CMakeFiles/onlinehelp-test.dir/helpformat.cpp.o.d"
+  "CMakeFiles/onlinehelp-test.dir/helpmanager.cpp.o"
+  "CMakeFiles/onlinehelp-test.dir/helpmanager.cpp.o.d"
+  "CMakeFiles/onlinehelp-test.dir/helpwritercontext.cpp.o"
+  "CMakeFiles/onlinehelp-test.dir/helpwritercontext.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/onlinehelp-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
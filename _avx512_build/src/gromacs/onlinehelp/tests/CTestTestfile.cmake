@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/onlinehelp/tests
+# Build directory: /root/repo/_avx512_build/src/gromacs/onlinehelp/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OnlineHelpUnitTests "/root/repo/_avx512_build/bin/onlinehelp-test" "--gtest_output=xml:/root/repo/_avx512_build/Testing/Temporary/OnlineHelpUnitTests.xml")
+set_tests_properties(OnlineHelpUnitTests PROPERTIES  LABELS "GTest;UnitTest" _BACKTRACE_TRIPLES "/root/repo/src/testutils/TestMacros.cmake;67;add_test;/root/repo/src/testutils/TestMacros.cmake;147;gmx_register_unit_test;/root/repo/src/gromacs/onlinehelp/tests/CMakeLists.txt;45;gmx_add_unit_test;/root/repo/src/gromacs/onlinehelp/tests/CMakeLists.txt;0;")
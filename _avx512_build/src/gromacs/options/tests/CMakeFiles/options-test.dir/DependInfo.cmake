@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/options/tests/CMakeFiles/options-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/options/tests/CMakeFiles/options-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/options/tests/abstractoptionstorage.cpp" "src/gromacs/options/tests/CMakeFiles/options-test.dir/abstractoptionstorage.cpp.o" "gcc" "src/gromacs/options/tests/CMakeFiles/options-test.dir/abstractoptionstorage.cpp.o.d"
+  "/root/repo/src/gromacs/options/tests/filenameoption.cpp" "src/gromacs/options/tests/CMakeFiles/options-test.dir/filenameoption.cpp.o" "gcc" "src/gromacs/options/tests/CMakeFiles/options-test.dir/filenameoption.cpp.o.d"
+  "/root/repo/src/gromacs/options/tests/filenameoptionmanager.cpp" "src/gromacs/options/tests/CMakeFiles/options-test.dir/filenameoptionmanager.cpp.o" "gcc" "src/gromacs/options/tests/CMakeFiles/options-test.dir/filenameoptionmanager.cpp.o.d"
+  "/root/repo/src/gromacs/options/tests/option.cpp" "src/gromacs/options/tests/CMakeFiles/options-test.dir/option.cpp.o" "gcc" "src/gromacs/options/tests/CMakeFiles/options-test.dir/option.cpp.o.d"
+  "/root/repo/src/gromacs/options/tests/optionsassigner.cpp" "src/gromacs/options/tests/CMakeFiles/options-test.dir/optionsassigner.cpp.o" "gcc" "src/gromacs/options/tests/CMakeFiles/options-test.dir/optionsassigner.cpp.o.d"
+  "/root/repo/src/gromacs/options/tests/timeunitmanager.cpp" "src/gromacs/options/tests/CMakeFiles/options-test.dir/timeunitmanager.cpp.o" "gcc" "src/gromacs/options/tests/CMakeFiles/options-test.dir/timeunitmanager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../bin/random-test"
+  "../../../../bin/random-test.pdb"
+  "CMakeFiles/random-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/random-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/random-test.dir/random.cpp.o"
+  "CMakeFiles/random-test.dir/random.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/selection/tests/indexutil.cpp" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/indexutil.cpp.o" "gcc" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/indexutil.cpp.o.d"
+  "/root/repo/src/gromacs/selection/tests/nbsearch.cpp" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/nbsearch.cpp.o" "gcc" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/nbsearch.cpp.o.d"
+  "/root/repo/src/gromacs/selection/tests/poscalc.cpp" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/poscalc.cpp.o" "gcc" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/poscalc.cpp.o.d"
+  "/root/repo/src/gromacs/selection/tests/selectioncollection.cpp" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/selectioncollection.cpp.o" "gcc" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/selectioncollection.cpp.o.d"
+  "/root/repo/src/gromacs/selection/tests/selectionoption.cpp" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/selectionoption.cpp.o" "gcc" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/selectionoption.cpp.o.d"
+  "/root/repo/src/gromacs/selection/tests/toputils.cpp" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/toputils.cpp.o" "gcc" "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/toputils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/base.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/base.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/base.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/bootstrap_loadstore.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/bootstrap_loadstore.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/bootstrap_loadstore.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd4.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd4.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd4.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd4_floatingpoint.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd4_floatingpoint.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd4_floatingpoint.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd4_math.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd4_math.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd4_math.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd4_vector_operations.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd4_vector_operations.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd4_vector_operations.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd_floatingpoint.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd_floatingpoint.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd_floatingpoint.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd_integer.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd_integer.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd_integer.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd_math.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd_math.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd_math.cpp.o.d"
+  "/root/repo/src/gromacs/simd/tests/simd_vector_operations.cpp" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd_vector_operations.cpp.o" "gcc" "src/gromacs/simd/tests/CMakeFiles/simd-test.dir/simd_vector_operations.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
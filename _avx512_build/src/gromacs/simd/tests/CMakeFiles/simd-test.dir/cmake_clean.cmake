@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "../../../../bin/simd-test"
+  "../../../../bin/simd-test.pdb"
+  "CMakeFiles/simd-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/simd-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/simd-test.dir/base.cpp.o"
+  "CMakeFiles/simd-test.dir/base.cpp.o.d"
+  "CMakeFiles/simd-test.dir/bootstrap_loadstore.cpp.o"
+  "CMakeFiles/simd-test.dir/bootstrap_loadstore.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd.cpp.o"
+  "CMakeFiles/simd-test.dir/simd.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd4.cpp.o"
+  "CMakeFiles/simd-test.dir/simd4.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd4_floatingpoint.cpp.o"
+  "CMakeFiles/simd-test.dir/simd4_floatingpoint.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd4_math.cpp.o"
+  "CMakeFiles/simd-test.dir/simd4_math.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd4_vector_operations.cpp.o"
+  "CMakeFiles/simd-test.dir/simd4_vector_operations.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd_floatingpoint.cpp.o"
+  "CMakeFiles/simd-test.dir/simd_floatingpoint.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd_integer.cpp.o"
+  "CMakeFiles/simd-test.dir/simd_integer.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd_math.cpp.o"
+  "CMakeFiles/simd-test.dir/simd_math.cpp.o.d"
+  "CMakeFiles/simd-test.dir/simd_vector_operations.cpp.o"
+  "CMakeFiles/simd-test.dir/simd_vector_operations.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simd-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
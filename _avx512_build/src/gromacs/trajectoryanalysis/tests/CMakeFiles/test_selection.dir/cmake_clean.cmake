@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/test_selection"
+  "../../../../bin/test_selection.pdb"
+  "CMakeFiles/test_selection.dir/test_selection.cpp.o"
+  "CMakeFiles/test_selection.dir/test_selection.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_selection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
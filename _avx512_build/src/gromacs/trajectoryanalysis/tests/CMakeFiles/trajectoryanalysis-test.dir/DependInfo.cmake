@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/angle.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/angle.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/angle.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/distance.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/distance.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/distance.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/freevolume.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/freevolume.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/freevolume.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/moduletest.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/moduletest.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/moduletest.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/pairdist.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/pairdist.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/pairdist.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/rdf.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/rdf.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/rdf.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/sasa.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/sasa.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/sasa.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/select.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/select.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/select.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/surfacearea.cpp" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/surfacearea.cpp.o" "gcc" "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/surfacearea.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../../../bin/trajectoryanalysis-test"
+  "../../../../bin/trajectoryanalysis-test.pdb"
+  "CMakeFiles/trajectoryanalysis-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/angle.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/angle.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/distance.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/distance.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/freevolume.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/freevolume.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/moduletest.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/moduletest.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/pairdist.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/pairdist.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/rdf.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/rdf.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/sasa.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/sasa.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/select.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/select.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/surfacearea.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/surfacearea.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trajectoryanalysis-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
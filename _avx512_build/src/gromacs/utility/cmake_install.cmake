@@ -0,0 +1,71 @@
+# Install script for directory: /root/repo/src/gromacs/utility
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local/gromacs")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/gromacs/utility" TYPE FILE FILES
+    "/root/repo/src/gromacs/utility/arrayref.h"
+    "/root/repo/src/gromacs/utility/basedefinitions.h"
+    "/root/repo/src/gromacs/utility/classhelpers.h"
+    "/root/repo/src/gromacs/utility/cstringutil.h"
+    "/root/repo/src/gromacs/utility/datafilefinder.h"
+    "/root/repo/src/gromacs/utility/errorcodes.h"
+    "/root/repo/src/gromacs/utility/exceptions.h"
+    "/root/repo/src/gromacs/utility/fatalerror.h"
+    "/root/repo/src/gromacs/utility/flags.h"
+    "/root/repo/src/gromacs/utility/futil.h"
+    "/root/repo/src/gromacs/utility/gmxassert.h"
+    "/root/repo/src/gromacs/utility/init.h"
+    "/root/repo/src/gromacs/utility/programcontext.h"
+    "/root/repo/src/gromacs/utility/real.h"
+    "/root/repo/src/gromacs/utility/smalloc.h"
+    "/root/repo/src/gromacs/utility/stringutil.h"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_avx512_build/src/gromacs/utility/tests/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../../../bin/utility-test"
+  "../../../../bin/utility-test.pdb"
+  "CMakeFiles/utility-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/utility-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/utility-test.dir/arrayref.cpp.o"
+  "CMakeFiles/utility-test.dir/arrayref.cpp.o.d"
+  "CMakeFiles/utility-test.dir/bitmask128.cpp.o"
+  "CMakeFiles/utility-test.dir/bitmask128.cpp.o.d"
+  "CMakeFiles/utility-test.dir/bitmask32.cpp.o"
+  "CMakeFiles/utility-test.dir/bitmask32.cpp.o.d"
+  "CMakeFiles/utility-test.dir/bitmask64.cpp.o"
+  "CMakeFiles/utility-test.dir/bitmask64.cpp.o.d"
+  "CMakeFiles/utility-test.dir/stringutil.cpp.o"
+  "CMakeFiles/utility-test.dir/stringutil.cpp.o.d"
+  "CMakeFiles/utility-test.dir/textwriter.cpp.o"
+  "CMakeFiles/utility-test.dir/textwriter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utility-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/completion"
+  "completion"
+  "completion-timestamp.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/completion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/programs/gmx.cpp" "src/programs/CMakeFiles/gmx.dir/gmx.cpp.o" "gcc" "src/programs/CMakeFiles/gmx.dir/gmx.cpp.o.d"
+  "/root/repo/src/programs/legacymodules.cpp" "src/programs/CMakeFiles/gmx.dir/legacymodules.cpp.o" "gcc" "src/programs/CMakeFiles/gmx.dir/legacymodules.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "../../bin/gmx"
+  "../../bin/gmx.pdb"
+  "CMakeFiles/gmx.dir/gmx.cpp.o"
+  "CMakeFiles/gmx.dir/gmx.cpp.o.d"
+  "CMakeFiles/gmx.dir/legacymodules.cpp.o"
+  "CMakeFiles/gmx.dir/legacymodules.cpp.o.d"
+  "completion"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/gmx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
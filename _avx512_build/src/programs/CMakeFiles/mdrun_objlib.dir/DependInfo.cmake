@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/programs/mdrun/membed.c" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/membed.c.o" "gcc" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/membed.c.o.d"
+  "/root/repo/src/programs/mdrun/md.cpp" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/md.cpp.o" "gcc" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/md.cpp.o.d"
+  "/root/repo/src/programs/mdrun/mdrun.cpp" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/mdrun.cpp.o" "gcc" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/mdrun.cpp.o.d"
+  "/root/repo/src/programs/mdrun/repl_ex.cpp" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/repl_ex.cpp.o" "gcc" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/repl_ex.cpp.o.d"
+  "/root/repo/src/programs/mdrun/resource-division.cpp" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/resource-division.cpp.o" "gcc" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/resource-division.cpp.o.d"
+  "/root/repo/src/programs/mdrun/runner.cpp" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/runner.cpp.o" "gcc" "src/programs/CMakeFiles/mdrun_objlib.dir/mdrun/runner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
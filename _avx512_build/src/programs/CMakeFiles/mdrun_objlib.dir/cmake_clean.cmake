@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdrun_objlib.dir/mdrun/md.cpp.o"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/md.cpp.o.d"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/mdrun.cpp.o"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/mdrun.cpp.o.d"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/membed.c.o"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/membed.c.o.d"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/repl_ex.cpp.o"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/repl_ex.cpp.o.d"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/resource-division.cpp.o"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/resource-division.cpp.o.d"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/runner.cpp.o"
+  "CMakeFiles/mdrun_objlib.dir/mdrun/runner.cpp.o.d"
+  "completion"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/mdrun_objlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/view_objlib.dir/view/view.cpp.o"
+  "CMakeFiles/view_objlib.dir/view/view.cpp.o.d"
+  "completion"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/view_objlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1 @@
+complete -o nospace -F _gmx_compl gmx
\ No newline at end of file
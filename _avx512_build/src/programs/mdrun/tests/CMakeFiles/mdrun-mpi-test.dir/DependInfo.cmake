@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/domain_decomposition.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/domain_decomposition.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/domain_decomposition.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/fft5d_pipeline.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/fft5d_pipeline.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/fft5d_pipeline.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/grid_column_order.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/grid_column_order.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/grid_column_order.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/moduletest.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/moduletest.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/moduletest.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/multisim.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/multisim.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/multisim.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/multisimtest.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/multisimtest.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/multisimtest.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/pme_pp_shared_memory.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/pme_pp_shared_memory.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/pme_pp_shared_memory.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/replicaexchange.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/replicaexchange.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/replicaexchange.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/simulationcomparison.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/simulationcomparison.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/simulationcomparison.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/work_stealing.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/work_stealing.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-mpi-test.dir/work_stealing.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
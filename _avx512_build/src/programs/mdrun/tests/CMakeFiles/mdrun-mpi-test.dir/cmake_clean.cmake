@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../../../bin/mdrun-mpi-test"
+  "../../../../bin/mdrun-mpi-test.pdb"
+  "CMakeFiles/mdrun-mpi-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/domain_decomposition.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/domain_decomposition.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/fft5d_pipeline.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/fft5d_pipeline.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/grid_column_order.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/grid_column_order.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/moduletest.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/moduletest.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/multisim.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/multisim.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/multisimtest.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/multisimtest.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/pme_pp_shared_memory.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/pme_pp_shared_memory.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/replicaexchange.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/replicaexchange.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/simulationcomparison.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/simulationcomparison.cpp.o.d"
+  "CMakeFiles/mdrun-mpi-test.dir/work_stealing.cpp.o"
+  "CMakeFiles/mdrun-mpi-test.dir/work_stealing.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/mdrun-mpi-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/avx512_kernels.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/avx512_kernels.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/avx512_kernels.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/compressed_x_output.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/compressed_x_output.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/compressed_x_output.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/dynamic_pruning.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/dynamic_pruning.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/dynamic_pruning.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/fft_wisdom.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/fft_wisdom.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/fft_wisdom.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/free_energy_kernel.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/free_energy_kernel.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/free_energy_kernel.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/grompp.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/grompp.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/grompp.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/incremental_grid.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/incremental_grid.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/incremental_grid.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/interactiveMD.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/interactiveMD.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/interactiveMD.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/mixed_precision_kernels.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/mixed_precision_kernels.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/mixed_precision_kernels.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/moduletest.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/moduletest.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/moduletest.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/offload_loopback.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/offload_loopback.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/offload_loopback.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/pme_multiple_timestepping.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/pme_multiple_timestepping.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/pme_multiple_timestepping.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/pme_task.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/pme_task.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/pme_task.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/rerun.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/rerun.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/rerun.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/simulationcomparison.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/simulationcomparison.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/simulationcomparison.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/swapcoords.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/swapcoords.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/swapcoords.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/trajectory_writing.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/trajectory_writing.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/trajectory_writing.cpp.o.d"
+  "/root/repo/src/programs/mdrun/tests/user_tables.cpp" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/user_tables.cpp.o" "gcc" "src/programs/mdrun/tests/CMakeFiles/mdrun-test.dir/user_tables.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
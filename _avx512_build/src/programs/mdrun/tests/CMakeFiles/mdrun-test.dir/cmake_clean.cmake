@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../../../bin/mdrun-test"
+  "../../../../bin/mdrun-test.pdb"
+  "CMakeFiles/mdrun-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/mdrun-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/avx512_kernels.cpp.o"
+  "CMakeFiles/mdrun-test.dir/avx512_kernels.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/compressed_x_output.cpp.o"
+  "CMakeFiles/mdrun-test.dir/compressed_x_output.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/dynamic_pruning.cpp.o"
+  "CMakeFiles/mdrun-test.dir/dynamic_pruning.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/fft_wisdom.cpp.o"
+  "CMakeFiles/mdrun-test.dir/fft_wisdom.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/free_energy_kernel.cpp.o"
+  "CMakeFiles/mdrun-test.dir/free_energy_kernel.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/grompp.cpp.o"
+  "CMakeFiles/mdrun-test.dir/grompp.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/incremental_grid.cpp.o"
+  "CMakeFiles/mdrun-test.dir/incremental_grid.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/interactiveMD.cpp.o"
+  "CMakeFiles/mdrun-test.dir/interactiveMD.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/mixed_precision_kernels.cpp.o"
+  "CMakeFiles/mdrun-test.dir/mixed_precision_kernels.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/moduletest.cpp.o"
+  "CMakeFiles/mdrun-test.dir/moduletest.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/offload_loopback.cpp.o"
+  "CMakeFiles/mdrun-test.dir/offload_loopback.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/pme_multiple_timestepping.cpp.o"
+  "CMakeFiles/mdrun-test.dir/pme_multiple_timestepping.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/pme_task.cpp.o"
+  "CMakeFiles/mdrun-test.dir/pme_task.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/rerun.cpp.o"
+  "CMakeFiles/mdrun-test.dir/rerun.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/simulationcomparison.cpp.o"
+  "CMakeFiles/mdrun-test.dir/simulationcomparison.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/swapcoords.cpp.o"
+  "CMakeFiles/mdrun-test.dir/swapcoords.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/trajectory_writing.cpp.o"
+  "CMakeFiles/mdrun-test.dir/trajectory_writing.cpp.o.d"
+  "CMakeFiles/mdrun-test.dir/user_tables.cpp.o"
+  "CMakeFiles/mdrun-test.dir/user_tables.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/mdrun-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/programs/mdrun/tests
+# Build directory: /root/repo/_avx512_build/src/programs/mdrun/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(MdrunTests "/root/repo/_avx512_build/bin/mdrun-test" "--gtest_output=xml:/root/repo/_avx512_build/Testing/Temporary/MdrunTests.xml")
+set_tests_properties(MdrunTests PROPERTIES  LABELS "IntegrationTest" _BACKTRACE_TRIPLES "/root/repo/src/testutils/TestMacros.cmake;77;add_test;/root/repo/src/programs/mdrun/tests/CMakeLists.txt;64;gmx_register_integration_test;/root/repo/src/programs/mdrun/tests/CMakeLists.txt;0;")
+add_test(MdrunMpiTests "/root/repo/_avx512_build/bin/mdrun-mpi-test" "-nt" "2" "--gtest_output=xml:/root/repo/_avx512_build/Testing/Temporary/MdrunMpiTests.xml")
+set_tests_properties(MdrunMpiTests PROPERTIES  LABELS "MpiIntegrationTest" _BACKTRACE_TRIPLES "/root/repo/src/testutils/TestMacros.cmake;130;add_test;/root/repo/src/programs/mdrun/tests/CMakeLists.txt;90;gmx_register_mpi_integration_test;/root/repo/src/programs/mdrun/tests/CMakeLists.txt;0;")
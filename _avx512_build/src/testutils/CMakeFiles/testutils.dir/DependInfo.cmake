@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/cmdlinetest.cpp" "src/testutils/CMakeFiles/testutils.dir/cmdlinetest.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/cmdlinetest.cpp.o.d"
+  "/root/repo/src/testutils/integrationtests.cpp" "src/testutils/CMakeFiles/testutils.dir/integrationtests.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/integrationtests.cpp.o.d"
+  "/root/repo/src/testutils/interactivetest.cpp" "src/testutils/CMakeFiles/testutils.dir/interactivetest.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/interactivetest.cpp.o.d"
+  "/root/repo/src/testutils/mpi-printer.cpp" "src/testutils/CMakeFiles/testutils.dir/mpi-printer.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/mpi-printer.cpp.o.d"
+  "/root/repo/src/testutils/refdata.cpp" "src/testutils/CMakeFiles/testutils.dir/refdata.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/refdata.cpp.o.d"
+  "/root/repo/src/testutils/stringtest.cpp" "src/testutils/CMakeFiles/testutils.dir/stringtest.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/stringtest.cpp.o.d"
+  "/root/repo/src/testutils/testasserts.cpp" "src/testutils/CMakeFiles/testutils.dir/testasserts.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/testasserts.cpp.o.d"
+  "/root/repo/src/testutils/testfilemanager.cpp" "src/testutils/CMakeFiles/testutils.dir/testfilemanager.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/testfilemanager.cpp.o.d"
+  "/root/repo/src/testutils/testfileredirector.cpp" "src/testutils/CMakeFiles/testutils.dir/testfileredirector.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/testfileredirector.cpp.o.d"
+  "/root/repo/src/testutils/testinit.cpp" "src/testutils/CMakeFiles/testutils.dir/testinit.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/testinit.cpp.o.d"
+  "/root/repo/src/testutils/testoptions.cpp" "src/testutils/CMakeFiles/testutils.dir/testoptions.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/testoptions.cpp.o.d"
+  "/root/repo/src/testutils/xvgtest.cpp" "src/testutils/CMakeFiles/testutils.dir/xvgtest.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/xvgtest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx512_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_avx512_build/src/external/gmock-1.7.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "../../lib/libtestutils.a"
+  "../../lib/libtestutils.pdb"
+  "CMakeFiles/testutils.dir/cmdlinetest.cpp.o"
+  "CMakeFiles/testutils.dir/cmdlinetest.cpp.o.d"
+  "CMakeFiles/testutils.dir/integrationtests.cpp.o"
+  "CMakeFiles/testutils.dir/integrationtests.cpp.o.d"
+  "CMakeFiles/testutils.dir/interactivetest.cpp.o"
+  "CMakeFiles/testutils.dir/interactivetest.cpp.o.d"
+  "CMakeFiles/testutils.dir/mpi-printer.cpp.o"
+  "CMakeFiles/testutils.dir/mpi-printer.cpp.o.d"
+  "CMakeFiles/testutils.dir/refdata.cpp.o"
+  "CMakeFiles/testutils.dir/refdata.cpp.o.d"
+  "CMakeFiles/testutils.dir/stringtest.cpp.o"
+  "CMakeFiles/testutils.dir/stringtest.cpp.o.d"
+  "CMakeFiles/testutils.dir/testasserts.cpp.o"
+  "CMakeFiles/testutils.dir/testasserts.cpp.o.d"
+  "CMakeFiles/testutils.dir/testfilemanager.cpp.o"
+  "CMakeFiles/testutils.dir/testfilemanager.cpp.o.d"
+  "CMakeFiles/testutils.dir/testfileredirector.cpp.o"
+  "CMakeFiles/testutils.dir/testfileredirector.cpp.o.d"
+  "CMakeFiles/testutils.dir/testinit.cpp.o"
+  "CMakeFiles/testutils.dir/testinit.cpp.o.d"
+  "CMakeFiles/testutils.dir/testoptions.cpp.o"
+  "CMakeFiles/testutils.dir/testoptions.cpp.o.d"
+  "CMakeFiles/testutils.dir/xvgtest.cpp.o"
+  "CMakeFiles/testutils.dir/xvgtest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testutils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
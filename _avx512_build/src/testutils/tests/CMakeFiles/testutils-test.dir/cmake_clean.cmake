@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../bin/testutils-test"
+  "../../../bin/testutils-test.pdb"
+  "CMakeFiles/testutils-test.dir/__/unittest_main.cpp.o"
+  "CMakeFiles/testutils-test.dir/__/unittest_main.cpp.o.d"
+  "CMakeFiles/testutils-test.dir/interactivetest.cpp.o"
+  "CMakeFiles/testutils-test.dir/interactivetest.cpp.o.d"
+  "CMakeFiles/testutils-test.dir/refdata_tests.cpp.o"
+  "CMakeFiles/testutils-test.dir/refdata_tests.cpp.o.d"
+  "CMakeFiles/testutils-test.dir/testasserts_tests.cpp.o"
+  "CMakeFiles/testutils-test.dir/testasserts_tests.cpp.o.d"
+  "CMakeFiles/testutils-test.dir/xvgtest_tests.cpp.o"
+  "CMakeFiles/testutils-test.dir/xvgtest_tests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testutils-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
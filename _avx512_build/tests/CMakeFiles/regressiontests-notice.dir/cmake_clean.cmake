@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/regressiontests-notice"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/regressiontests-notice.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -288,14 +288,14 @@ elseif(GMX_SIMD STREQUAL "AVX_512F")
 
     gmx_find_cflag_for_source(CFLAGS_AVX_512F "C compiler AVX-512F flag"
                               "#include<immintrin.h>
-                              int main(){__m512 y,x=_mm512_set1_ps(0.5);y=_mm512_fmadd_ps(x,x,x);return (int)_mm512_cmp_ps_mask(x,y,_CMP_LT_OS);}"
+                              int main(){__m512 y,x=_mm512_set1_ps(0.5);__m128 z=_mm_set1_ps(0.5);y=_mm512_fmadd_ps(x,x,x);z=_mm_fmadd_ps(z,z,z);return (int)_mm512_cmp_ps_mask(x,y,_CMP_LT_OS)+_mm_movemask_ps(z);}"
                               SIMD_C_FLAGS
-                              "-xMIC-AVX512" "-mavx512f" "/arch:AVX" "-hgnu") # no AVX_512F flags known for MSVC yet
+                              "-xMIC-AVX512" "-mavx512f -mfma" "-mavx512f" "/arch:AVX" "-hgnu") # no AVX_512F flags known for MSVC yet
     gmx_find_cxxflag_for_source(CXXFLAGS_AVX_512F "C++ compiler AVX-512F flag"
                                 "#include<immintrin.h>
-                                int main(){__m512 y,x=_mm512_set1_ps(0.5);y=_mm512_fmadd_ps(x,x,x);return (int)_mm512_cmp_ps_mask(x,y,_CMP_LT_OS);}"
+                                int main(){__m512 y,x=_mm512_set1_ps(0.5);__m128 z=_mm_set1_ps(0.5);y=_mm512_fmadd_ps(x,x,x);z=_mm_fmadd_ps(z,z,z);return (int)_mm512_cmp_ps_mask(x,y,_CMP_LT_OS)+_mm_movemask_ps(z);}"
                                 SIMD_CXX_FLAGS
-                                "-xMIC-AVX512" "-mavx512f" "/arch:AVX" "-hgnu") # no AVX_512F flags known for MSVC yet
+                                "-xMIC-AVX512" "-mavx512f -mfma" "-mavx512f" "/arch:AVX" "-hgnu") # no AVX_512F flags known for MSVC yet
 
     if(NOT CFLAGS_AVX_512F OR NOT CXXFLAGS_AVX_512F)
         message(FATAL_ERROR "Cannot find AVX 512F compiler flag. Use a newer compiler, or choose a lower level of SIMD")
@@ -6728,6 +6728,7 @@ gmx_domdec_t *init_domain_decomposition(FILE *fplog, t_commrec *cr,
 
     dd->pme_recv_f_alloc = 0;
     dd->pme_recv_f_buf   = NULL;
+    dd->pme_pp_shared    = gmx_pme_pp_shared_memory(fplog);
 
     if (dd->bSendRecv2 && fplog)
     {
@@ -848,6 +848,9 @@ pme_load_balance(pme_load_balancing_t      *pme_lb,
         {
             /* Generate a new PME data structure,
              * copying part of the old pointers.
+             * The structure, including its FFT plans, is kept with
+             * the setup, so switching back to this grid does not plan
+             * the FFTs again.
              */
             gmx_pme_reinit(&set->pmedata,
                            cr, pme_lb->setup[0].pmedata, ir,
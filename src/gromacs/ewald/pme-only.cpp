@@ -133,7 +133,10 @@ static void gmx_pmeonly_switch(int *npmedata, struct gmx_pme_t ***pmedata,
     (*npmedata)++;
     srenew(*pmedata, *npmedata);
 
-    /* Generate a new PME data structure, copying part of the old pointers */
+    /* Generate a new PME data structure, copying part of the old pointers.
+     * The structures of all grids, including their FFT plans, are kept
+     * in pmedata, so switching back to a grid does not plan again.
+     */
     gmx_pme_reinit(&((*pmedata)[ind]), cr, pme, ir, grid_size);
 
     *pme_ret = (*pmedata)[ind];
@@ -50,6 +50,7 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "gromacs/domdec/domdec.h"
@@ -100,6 +101,7 @@ enum {
 #define PME_PP_SIGSTOPNSS     (1<<1)
 //@}
 
+
 /*! \brief Master PP-PME communication data structure */
 struct gmx_pme_pp {
 #ifdef GMX_MPI
@@ -129,6 +131,9 @@ struct gmx_pme_pp {
     MPI_Status  *stat;
     //@}
 #endif
+    gmx_bool     bShared;       /**< Exchange x and f through shared memory */
+    rvec       **x_shared;      /**< The home coordinates of each PP rank */
+    rvec       **f_shared;      /**< The forces for each PP rank, in \p f */
 };
 
 /*! \brief Helper struct for PP-PME communication of parameters */
@@ -147,6 +152,7 @@ typedef struct gmx_pme_comm_n_box {
     real            ewaldcoeff_q;
     real            ewaldcoeff_lj;
     //@}
+    rvec           *x;          /**< Home coordinates, only used with shared memory */
 } gmx_pme_comm_n_box_t;
 
 /*! \brief Helper struct for PP-PME communication of virial and energy */
@@ -164,6 +170,36 @@ typedef struct {
     gmx_stop_cond_t stop_cond;  /**< Flag used in responding to an external signal to terminate */
 } gmx_pme_comm_vir_ene_t;
 
+/* With thread-MPI all ranks are threads in the same process. The PP ranks
+ * can then send only the address of their home coordinates and the PME
+ * ranks the address of the forces for each PP rank. The receiver reads
+ * the data in place. This is safe, since the PP ranks do not modify their
+ * home coordinates before they have received the PME forces and the PME
+ * rank does not touch its force buffer before it has received the
+ * coordinates of the next step from all its PP ranks. The pointer message
+ * also serves as the per-step signal that the data is ready.
+ */
+gmx_bool gmx_pme_pp_shared_memory(FILE *fplog)
+{
+#ifdef GMX_THREAD_MPI
+    if (getenv("GMX_NO_PME_PP_SHARED") != NULL)
+    {
+        if (fplog)
+        {
+            fprintf(fplog, "Found env.var. GMX_NO_PME_PP_SHARED, PP and PME ranks will copy coordinates and forces\n");
+        }
+
+        return FALSE;
+    }
+
+    return TRUE;
+#else
+    GMX_UNUSED_VALUE(fplog);
+
+    return FALSE;
+#endif
+}
+
 gmx_pme_pp_t gmx_pme_pp_init(t_commrec *cr)
 {
     struct gmx_pme_pp *pme_pp;
@@ -179,6 +215,9 @@ gmx_pme_pp_t gmx_pme_pp_init(t_commrec *cr)
     snew(pme_pp->nat, pme_pp->nnode);
     snew(pme_pp->req, eCommType_NR*pme_pp->nnode);
     snew(pme_pp->stat, eCommType_NR*pme_pp->nnode);
+    pme_pp->bShared      = cr->dd->pme_pp_shared;
+    snew(pme_pp->x_shared, pme_pp->nnode);
+    snew(pme_pp->f_shared, pme_pp->nnode);
     pme_pp->nalloc       = 0;
     pme_pp->flags_charge = 0;
 #else
@@ -236,6 +275,16 @@ static void gmx_pme_send_coeffs_coords(t_commrec *cr, int flags,
     gmx_pme_send_coeffs_coords_wait(dd);
 #endif
 
+    if (dd->pme_pp_shared)
+    {
+        /* All PP ranks need cnb to store the address of their coordinates */
+        if (dd->cnb == NULL)
+        {
+            snew(dd->cnb, 1);
+        }
+        dd->cnb->x = x;
+    }
+
     if (dd->pme_receive_vir_ener)
     {
         /* Peer PP node: communicate all data */
@@ -313,9 +362,19 @@ static void gmx_pme_send_coeffs_coords(t_commrec *cr, int flags,
         }
         if (flags & PP_PME_COORD)
         {
-            MPI_Isend(x[0], n*sizeof(rvec), MPI_BYTE,
-                      dd->pme_nodeid, eCommType_COORD, cr->mpi_comm_mysim,
-                      &dd->req_pme[dd->nreq_pme++]);
+            if (dd->pme_pp_shared)
+            {
+                /* Only send the address, the PME rank reads x in place */
+                MPI_Isend(&dd->cnb->x, sizeof(dd->cnb->x), MPI_BYTE,
+                          dd->pme_nodeid, eCommType_COORD, cr->mpi_comm_mysim,
+                          &dd->req_pme[dd->nreq_pme++]);
+            }
+            else
+            {
+                MPI_Isend(x[0], n*sizeof(rvec), MPI_BYTE,
+                          dd->pme_nodeid, eCommType_COORD, cr->mpi_comm_mysim,
+                          &dd->req_pme[dd->nreq_pme++]);
+            }
         }
     }
 
@@ -436,6 +495,43 @@ void gmx_pme_send_resetcounters(t_commrec gmx_unused *cr, gmx_int64_t gmx_unused
 #endif
 }
 
+/*! \brief Returns the PP coordinates received through shared memory
+ *
+ * With a single PP rank with atoms, its coordinates are used in place.
+ * Otherwise the coordinates are copied into the contiguous buffer pme_pp->x.
+ */
+static rvec *get_shared_coordinates(struct gmx_pme_pp *pme_pp)
+{
+    int nsender = 0, sender_last = -1;
+
+    for (int sender = 0; sender < pme_pp->nnode; sender++)
+    {
+        if (pme_pp->nat[sender] > 0)
+        {
+            nsender++;
+            sender_last = sender;
+        }
+    }
+
+    if (nsender == 1)
+    {
+        return pme_pp->x_shared[sender_last];
+    }
+
+    int nat = 0;
+    for (int sender = 0; sender < pme_pp->nnode; sender++)
+    {
+        if (pme_pp->nat[sender] > 0)
+        {
+            memcpy(pme_pp->x[nat], pme_pp->x_shared[sender][0],
+                   pme_pp->nat[sender]*sizeof(rvec));
+            nat += pme_pp->nat[sender];
+        }
+    }
+
+    return pme_pp->x;
+}
+
 int gmx_pme_recv_coeffs_coords(struct gmx_pme_pp *pme_pp,
                                int               *natoms,
                                real             **chargeA,
@@ -461,6 +557,7 @@ int gmx_pme_recv_coeffs_coords(struct gmx_pme_pp *pme_pp,
                                real              *ewaldcoeff_lj)
 {
     int                  nat = 0, status;
+    rvec                *x_pp;
 
     *pme_flags = 0;
 #ifdef GMX_MPI
@@ -648,10 +745,20 @@ int gmx_pme_recv_coeffs_coords(struct gmx_pme_pp *pme_pp,
             {
                 if (pme_pp->nat[sender] > 0)
                 {
-                    MPI_Irecv(pme_pp->x[nat], pme_pp->nat[sender]*sizeof(rvec),
-                              MPI_BYTE,
-                              pme_pp->node[sender], eCommType_COORD,
-                              pme_pp->mpi_comm_mysim, &pme_pp->req[messages++]);
+                    if (pme_pp->bShared)
+                    {
+                        MPI_Irecv(&pme_pp->x_shared[sender], sizeof(pme_pp->x_shared[0]),
+                                  MPI_BYTE,
+                                  pme_pp->node[sender], eCommType_COORD,
+                                  pme_pp->mpi_comm_mysim, &pme_pp->req[messages++]);
+                    }
+                    else
+                    {
+                        MPI_Irecv(pme_pp->x[nat], pme_pp->nat[sender]*sizeof(rvec),
+                                  MPI_BYTE,
+                                  pme_pp->node[sender], eCommType_COORD,
+                                  pme_pp->mpi_comm_mysim, &pme_pp->req[messages++]);
+                    }
                     nat += pme_pp->nat[sender];
                     if (debug)
                     {
@@ -670,6 +777,16 @@ int gmx_pme_recv_coeffs_coords(struct gmx_pme_pp *pme_pp,
     while (!(cnb.flags & (PP_PME_COORD | PP_PME_FINISH)));
     status = ((cnb.flags & PP_PME_FINISH) ? pmerecvqxFINISH : pmerecvqxX);
 
+    /* pme_pp->x might have been reallocated above */
+    if (pme_pp->bShared && status == pmerecvqxX)
+    {
+        x_pp = get_shared_coordinates(pme_pp);
+    }
+    else
+    {
+        x_pp = pme_pp->x;
+    }
+
     *step = cnb.step;
 #else
     GMX_UNUSED_VALUE(box);
@@ -686,6 +803,7 @@ int gmx_pme_recv_coeffs_coords(struct gmx_pme_pp *pme_pp,
     GMX_UNUSED_VALUE(ewaldcoeff_lj);
 
     status = pmerecvqxX;
+    x_pp   = pme_pp->x;
 #endif
 
     *natoms   = nat;
@@ -695,7 +813,7 @@ int gmx_pme_recv_coeffs_coords(struct gmx_pme_pp *pme_pp,
     *sqrt_c6B = pme_pp->sqrt_c6B;
     *sigmaA   = pme_pp->sigmaA;
     *sigmaB   = pme_pp->sigmaB;
-    *x        = pme_pp->x;
+    *x        = x_pp;
     *f        = pme_pp->f;
 
     return status;
@@ -760,22 +878,40 @@ void gmx_pme_receive_f(t_commrec *cr,
 
     natoms = cr->dd->nat_home;
 
-    if (natoms > cr->dd->pme_recv_f_alloc)
+    rvec *f_pme = NULL;
+
+    if (cr->dd->pme_pp_shared)
     {
-        cr->dd->pme_recv_f_alloc = over_alloc_dd(natoms);
-        srenew(cr->dd->pme_recv_f_buf, cr->dd->pme_recv_f_alloc);
+        /* Receive the address of our forces in the PME force buffer.
+         * The PME rank will not modify them before we send new coordinates.
+         */
+#ifdef GMX_MPI
+        MPI_Recv(&f_pme, sizeof(f_pme), MPI_BYTE,
+                 cr->dd->pme_nodeid, 0, cr->mpi_comm_mysim,
+                 MPI_STATUS_IGNORE);
+#endif
     }
+    else
+    {
+        if (natoms > cr->dd->pme_recv_f_alloc)
+        {
+            cr->dd->pme_recv_f_alloc = over_alloc_dd(natoms);
+            srenew(cr->dd->pme_recv_f_buf, cr->dd->pme_recv_f_alloc);
+        }
 
 #ifdef GMX_MPI
-    MPI_Recv(cr->dd->pme_recv_f_buf[0],
-             natoms*sizeof(rvec), MPI_BYTE,
-             cr->dd->pme_nodeid, 0, cr->mpi_comm_mysim,
-             MPI_STATUS_IGNORE);
+        MPI_Recv(cr->dd->pme_recv_f_buf[0],
+                 natoms*sizeof(rvec), MPI_BYTE,
+                 cr->dd->pme_nodeid, 0, cr->mpi_comm_mysim,
+                 MPI_STATUS_IGNORE);
 #endif
 
+        f_pme = cr->dd->pme_recv_f_buf;
+    }
+
     for (i = 0; i < natoms; i++)
     {
-        rvec_inc(f[i], cr->dd->pme_recv_f_buf[i]);
+        rvec_inc(f[i], f_pme[i]);
     }
 
 
@@ -791,7 +927,7 @@ void gmx_pme_send_force_vir_ener(struct gmx_pme_pp *pme_pp,
 {
 #ifdef GMX_MPI
     gmx_pme_comm_vir_ene_t cve;
-    int                    messages, ind_start, ind_end;
+    int                    messages, ind_start, ind_end, rc;
     cve.cycles = cycles;
 
     /* Now the evaluated forces have to be transferred to the PP nodes */
@@ -801,9 +937,21 @@ void gmx_pme_send_force_vir_ener(struct gmx_pme_pp *pme_pp,
     {
         ind_start = ind_end;
         ind_end   = ind_start + pme_pp->nat[receiver];
-        if (MPI_Isend(f[ind_start], (ind_end-ind_start)*sizeof(rvec), MPI_BYTE,
-                      pme_pp->node[receiver], 0,
-                      pme_pp->mpi_comm_mysim, &pme_pp->req[messages++]) != 0)
+        if (pme_pp->bShared)
+        {
+            /* Only send the address, the PP rank reads the forces in place */
+            pme_pp->f_shared[receiver] = f + ind_start;
+            rc = MPI_Isend(&pme_pp->f_shared[receiver], sizeof(pme_pp->f_shared[0]), MPI_BYTE,
+                           pme_pp->node[receiver], 0,
+                           pme_pp->mpi_comm_mysim, &pme_pp->req[messages++]);
+        }
+        else
+        {
+            rc = MPI_Isend(f[ind_start], (ind_end-ind_start)*sizeof(rvec), MPI_BYTE,
+                           pme_pp->node[receiver], 0,
+                           pme_pp->mpi_comm_mysim, &pme_pp->req[messages++]);
+        }
+        if (rc != 0)
         {
             gmx_comm("MPI_Isend failed in do_pmeonly");
         }
@@ -0,0 +1,377 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ *
+ * \brief This file contains function definitions for running the PME
+ * mesh part on task threads within a PP rank, concurrently with the
+ * particle-particle work of the rank.
+ *
+ * \ingroup module_ewald
+ */
+
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "thread_mpi/threads.h"
+
+#include "gromacs/ewald/pme.h"
+#include "gromacs/legacyheaders/gmx_omp_nthreads.h"
+#include "gromacs/legacyheaders/md_logging.h"
+#include "gromacs/legacyheaders/nrnb.h"
+#include "gromacs/legacyheaders/typedefs.h"
+#include "gromacs/legacyheaders/types/commrec.h"
+#include "gromacs/legacyheaders/network.h"
+#include "gromacs/math/vec.h"
+#include "gromacs/timing/wallcycle.h"
+#include "gromacs/utility/fatalerror.h"
+#include "gromacs/utility/gmxassert.h"
+#include "gromacs/utility/gmxomp.h"
+#include "gromacs/utility/smalloc.h"
+
+/*! \brief States of a PME task thread */
+enum {
+    epmetIDLE, epmetWORK, epmetDONE, epmetFINISH
+};
+
+/*! \brief Data for running PME on a task thread */
+struct gmx_pme_task_t {
+    tMPI_Thread_t        thread; /**< The task thread */
+    tMPI_Thread_mutex_t  mutex;  /**< Mutex protecting state */
+    tMPI_Thread_cond_t   cond;   /**< Signals changes of state */
+    int                  state;  /**< One of the epmet enum */
+    gmx_wallcycle_t      wcycle; /**< Cycle counters of the task thread */
+    int                  ncore;  /**< The number of threads to pin, 0 when pinned */
+    int                 *core;   /**< The cores to pin the threads to */
+
+    /* The input, only valid between launch and receive */
+    struct gmx_pme_t    *pme;           /**< The PME data */
+    t_commrec           *cr;            /**< The communication record */
+    int                  homenr;        /**< The number of atoms */
+    rvec                *x;             /**< The coordinates, read in place */
+    real                *chargeA;       /**< Charges, state A */
+    real                *chargeB;       /**< Charges, state B */
+    real                *c6A;           /**< sqrt(C6), state A */
+    real                *c6B;           /**< sqrt(C6), state B */
+    real                *sigmaA;        /**< sigma, state A */
+    real                *sigmaB;        /**< sigma, state B */
+    matrix               box;           /**< The box */
+    real                 ewaldcoeff_q;  /**< Coulomb Ewald coefficient */
+    real                 ewaldcoeff_lj; /**< LJ Ewald coefficient */
+    real                 lambda_q;      /**< Coulomb lambda */
+    real                 lambda_lj;     /**< LJ lambda */
+    int                  pme_flags;     /**< Flags for gmx_pme_do */
+
+    /* The output */
+    rvec                *f;             /**< The mesh forces */
+    int                  f_nalloc;      /**< Allocation size of f */
+    matrix               vir_q;         /**< Coulomb mesh virial */
+    matrix               vir_lj;        /**< LJ mesh virial */
+    real                 energy_q;      /**< Coulomb mesh energy */
+    real                 energy_lj;     /**< LJ mesh energy */
+    real                 dvdlambda_q;   /**< Coulomb dV/dlambda */
+    real                 dvdlambda_lj;  /**< LJ dV/dlambda */
+    t_nrnb               nrnb;          /**< Flop counts of the task */
+    int                  status;        /**< Return value of gmx_pme_do */
+};
+
+int gmx_pme_task_nthreads(FILE *fplog, const t_commrec *cr, const t_inputrec *ir)
+{
+    const char *env;
+    int         nthreads;
+
+    env = getenv("GMX_PME_TASK_THREADS");
+    if (env == NULL || !(EEL_PME(ir->coulombtype) || EVDW_PME(ir->vdwtype)))
+    {
+        return 0;
+    }
+    nthreads = strtol(env, NULL, 10);
+    if (nthreads <= 0)
+    {
+        return 0;
+    }
+
+    /* The task thread is not an MPI rank, so it can not communicate.
+     * We therefore need PME on this rank only, without decomposition.
+     */
+    if (PAR(cr))
+    {
+        gmx_fatal_collective(FARGS, cr, NULL,
+                             "GMX_PME_TASK_THREADS is set, but PME can only run on task threads with a single rank,\n"
+                             "this run uses %d ranks. Use a single rank or unset GMX_PME_TASK_THREADS.",
+                             cr->nnodes);
+    }
+    if (ir->cutoff_scheme != ecutsVERLET ||
+        ir->eI == eiTPI || ir->eI == eiTPIC)
+    {
+        md_print_warn(cr, fplog,
+                      "NOTE: GMX_PME_TASK_THREADS is set, but PME can only run on task threads\n"
+                      "      with the Verlet cut-off scheme and without TPI.\n"
+                      "      PME will run in the normal way.\n");
+        return 0;
+    }
+#ifndef GMX_OPENMP
+    nthreads = 1;
+#endif
+
+    return nthreads;
+}
+
+/*! \brief Pin the OpenMP threads of the task thread, including itself */
+static void pme_task_pin_threads(struct gmx_pme_task_t *task)
+{
+    int nth_affinity_set = 0;
+
+#pragma omp parallel num_threads(task->ncore) reduction(+:nth_affinity_set)
+    {
+        int thread = gmx_omp_get_thread_num();
+
+        nth_affinity_set += (tMPI_Thread_setaffinity_single(tMPI_Thread_self(), task->core[thread]) == 0);
+    }
+
+    if (debug)
+    {
+        fprintf(debug, "Set the affinity of %d out of %d PME task threads\n",
+                nth_affinity_set, task->ncore);
+    }
+    task->ncore = 0;
+}
+
+/*! \brief Compute the mesh part for the current request */
+static void pme_task_do(struct gmx_pme_task_t *task)
+{
+    if (task->ncore > 0)
+    {
+        pme_task_pin_threads(task);
+    }
+
+    if (task->homenr > task->f_nalloc)
+    {
+        task->f_nalloc = over_alloc_large(task->homenr);
+        srenew(task->f, task->f_nalloc);
+    }
+    /* Without PME decomposition gmx_pme_do adds to the forces */
+    clear_rvecs(task->homenr, task->f);
+    clear_mat(task->vir_q);
+    clear_mat(task->vir_lj);
+    task->energy_q     = 0;
+    task->energy_lj    = 0;
+    task->dvdlambda_q  = 0;
+    task->dvdlambda_lj = 0;
+    init_nrnb(&task->nrnb);
+
+    wallcycle_start(task->wcycle, ewcPMEMESH);
+    task->status = gmx_pme_do(task->pme, 0, task->homenr, task->x, task->f,
+                              task->chargeA, task->chargeB,
+                              task->c6A, task->c6B,
+                              task->sigmaA, task->sigmaB,
+                              task->box, task->cr, 0, 0,
+                              &task->nrnb, task->wcycle,
+                              task->vir_q, task->ewaldcoeff_q,
+                              task->vir_lj, task->ewaldcoeff_lj,
+                              &task->energy_q, &task->energy_lj,
+                              task->lambda_q, task->lambda_lj,
+                              &task->dvdlambda_q, &task->dvdlambda_lj,
+                              task->pme_flags);
+    wallcycle_stop(task->wcycle, ewcPMEMESH);
+}
+
+/*! \brief The main loop of the task thread */
+static void *pme_task_thread(void *arg)
+{
+    struct gmx_pme_task_t *task = (struct gmx_pme_task_t *)arg;
+
+    tMPI_Thread_mutex_lock(&task->mutex);
+    while (TRUE)
+    {
+        while (task->state == epmetIDLE || task->state == epmetDONE)
+        {
+            tMPI_Thread_cond_wait(&task->cond, &task->mutex);
+        }
+        if (task->state == epmetFINISH)
+        {
+            break;
+        }
+        tMPI_Thread_mutex_unlock(&task->mutex);
+
+        pme_task_do(task);
+
+        tMPI_Thread_mutex_lock(&task->mutex);
+        task->state = epmetDONE;
+        tMPI_Thread_cond_broadcast(&task->cond);
+    }
+    tMPI_Thread_mutex_unlock(&task->mutex);
+
+    return NULL;
+}
+
+struct gmx_pme_task_t *gmx_pme_task_init(gmx_wallcycle_t wcycle)
+{
+    struct gmx_pme_task_t *task;
+
+    snew(task, 1);
+    tMPI_Thread_mutex_init(&task->mutex);
+    tMPI_Thread_cond_init(&task->cond);
+    task->state  = epmetIDLE;
+    task->wcycle = wallcycle_init_pme_task(wcycle);
+
+    if (tMPI_Thread_create(&task->thread, pme_task_thread, task) != 0)
+    {
+        gmx_fatal(FARGS, "Could not create the PME task thread");
+    }
+
+    return task;
+}
+
+void gmx_pme_task_set_affinity(struct gmx_pme_task_t *task,
+                               int nthreads, const int *core)
+{
+    int i;
+
+    for (i = 0; i < nthreads; i++)
+    {
+        if (core[i] < 0)
+        {
+            return;
+        }
+    }
+
+    /* Only the task thread reads these, after the next launch */
+    srenew(task->core, nthreads);
+    for (i = 0; i < nthreads; i++)
+    {
+        task->core[i] = core[i];
+    }
+    task->ncore = nthreads;
+}
+
+void gmx_pme_task_launch(struct gmx_pme_task_t *task,
+                         struct gmx_pme_t *pme, t_commrec *cr,
+                         int homenr, rvec x[],
+                         real chargeA[], real chargeB[],
+                         real c6A[], real c6B[],
+                         real sigmaA[], real sigmaB[],
+                         matrix box,
+                         real ewaldcoeff_q, real ewaldcoeff_lj,
+                         real lambda_q, real lambda_lj,
+                         int pme_flags)
+{
+    tMPI_Thread_mutex_lock(&task->mutex);
+    GMX_RELEASE_ASSERT(task->state == epmetIDLE, "A PME task can only be launched when idle");
+
+    task->pme           = pme;
+    task->cr            = cr;
+    task->homenr        = homenr;
+    task->x             = x;
+    task->chargeA       = chargeA;
+    task->chargeB       = chargeB;
+    task->c6A           = c6A;
+    task->c6B           = c6B;
+    task->sigmaA        = sigmaA;
+    task->sigmaB        = sigmaB;
+    copy_mat(box, task->box);
+    task->ewaldcoeff_q  = ewaldcoeff_q;
+    task->ewaldcoeff_lj = ewaldcoeff_lj;
+    task->lambda_q      = lambda_q;
+    task->lambda_lj     = lambda_lj;
+    task->pme_flags     = pme_flags;
+
+    task->state         = epmetWORK;
+    tMPI_Thread_cond_broadcast(&task->cond);
+    tMPI_Thread_mutex_unlock(&task->mutex);
+}
+
+void gmx_pme_task_receive_f(struct gmx_pme_task_t *task,
+                            rvec f[], matrix vir_q, real *energy_q,
+                            matrix vir_lj, real *energy_lj,
+                            real *dvdlambda_q, real *dvdlambda_lj,
+                            t_nrnb *nrnb)
+{
+    int nthreads, i;
+
+    tMPI_Thread_mutex_lock(&task->mutex);
+    while (task->state == epmetWORK)
+    {
+        tMPI_Thread_cond_wait(&task->cond, &task->mutex);
+    }
+    task->state = epmetIDLE;
+    tMPI_Thread_mutex_unlock(&task->mutex);
+
+    if (task->status != 0)
+    {
+        gmx_fatal(FARGS, "Error %d in reciprocal PME routine", task->status);
+    }
+
+    if (task->pme_flags & GMX_PME_CALC_F)
+    {
+        nthreads = gmx_omp_nthreads_get(emntDefault);
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (i = 0; i < task->homenr; i++)
+        {
+            rvec_inc(f[i], task->f[i]);
+        }
+    }
+
+    m_add(vir_q, task->vir_q, vir_q);
+    m_add(vir_lj, task->vir_lj, vir_lj);
+    *energy_q     += task->energy_q;
+    *energy_lj    += task->energy_lj;
+    *dvdlambda_q  += task->dvdlambda_q;
+    *dvdlambda_lj += task->dvdlambda_lj;
+    add_nrnb(nrnb, nrnb, &task->nrnb);
+}
+
+void gmx_pme_task_destroy(struct gmx_pme_task_t *task)
+{
+    if (task == NULL)
+    {
+        return;
+    }
+
+    tMPI_Thread_mutex_lock(&task->mutex);
+    task->state = epmetFINISH;
+    tMPI_Thread_cond_broadcast(&task->cond);
+    tMPI_Thread_mutex_unlock(&task->mutex);
+    tMPI_Thread_join(task->thread, NULL);
+
+    tMPI_Thread_cond_destroy(&task->cond);
+    tMPI_Thread_mutex_destroy(&task->mutex);
+    sfree(task->core);
+    sfree(task->f);
+    sfree(task);
+}
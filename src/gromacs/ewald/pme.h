@@ -172,4 +172,68 @@ void gmx_pme_receive_f(t_commrec *cr,
                        real *dvdlambda_q, real *dvdlambda_lj,
                        float *pme_cycles);
 
+/*! \brief Returns whether PP and PME ranks exchange coordinates and
+ * forces through shared memory
+ *
+ * This is only possible with thread-MPI, where it is done unless
+ * GMX_NO_PME_PP_SHARED is set. Domain decomposition calls this once at
+ * setup on all ranks and stores the result in gmx_domdec_t, where both
+ * the PP and the PME side of the communication read it.
+ */
+gmx_bool gmx_pme_pp_shared_memory(FILE *fplog);
+
+/*! \brief Data for running PME on a task thread within a PP rank */
+struct gmx_pme_task_t;
+
+/*! \brief Return the number of OpenMP threads for running PME on a task
+ * thread, concurrently with the PP work, as set by GMX_PME_TASK_THREADS.
+ *
+ * Returns 0 when PME should run in the normal way.
+ */
+int gmx_pme_task_nthreads(FILE *fplog, const t_commrec *cr, const t_inputrec *ir);
+
+/*! \brief Create a PME task thread
+ *
+ * The task thread times the mesh part with its own counters, which are
+ * summed and printed with \p wcycle. The task thread should be
+ * created before the affinity of the calling thread is set, otherwise
+ * it inherits it.
+ */
+struct gmx_pme_task_t *gmx_pme_task_init(gmx_wallcycle_t wcycle);
+
+/*! \brief Pin the \p nthreads OpenMP threads of the task to \p core
+ *
+ * The threads are pinned at the next PME calculation, which is
+ * the first moment their OpenMP team exists. Entries of \p core of -1
+ * mean no pinning.
+ */
+void gmx_pme_task_set_affinity(struct gmx_pme_task_t *task,
+                               int nthreads, const int *core);
+
+/*! \brief Start a PME mesh calculation on the task thread
+ *
+ * The coordinate and parameter arrays are read in place, so they should
+ * not be modified before the call to gmx_pme_task_receive_f().
+ */
+void gmx_pme_task_launch(struct gmx_pme_task_t *task,
+                         struct gmx_pme_t *pme, t_commrec *cr,
+                         int homenr, rvec x[],
+                         real chargeA[], real chargeB[],
+                         real c6A[], real c6B[],
+                         real sigmaA[], real sigmaB[],
+                         matrix box,
+                         real ewaldcoeff_q, real ewaldcoeff_lj,
+                         real lambda_q, real lambda_lj,
+                         int pme_flags);
+
+/*! \brief Wait for the PME task and add its forces, virial, energies and flops */
+void gmx_pme_task_receive_f(struct gmx_pme_task_t *task,
+                            rvec f[], matrix vir_q, real *energy_q,
+                            matrix vir_lj, real *energy_lj,
+                            real *dvdlambda_q, real *dvdlambda_lj,
+                            t_nrnb *nrnb);
+
+/*! \brief Stop the task thread and free the task data */
+void gmx_pme_task_destroy(struct gmx_pme_task_t *task);
+
 #endif
@@ -417,6 +417,59 @@ gmx_fft_transpose_2d   (t_complex *       in_data,
  */
 void gmx_fft_cleanup();
 
+/*! \brief Import FFT planning information from a file
+ *
+ *  With FFTW this reads wisdom, so plans for transforms that were
+ *  measured before are created without measuring again. FFTW keys the
+ *  wisdom by transform size, layout and thread count. The wisdom is
+ *  shared by all threads of the process. As planning is not thread-safe,
+ *  it should be called before any plans are made. A no-op with
+ *  other FFT libraries.
+ *
+ * \param filename  Name of the file to read, need not exist
+ *
+ * \return 1 when planning information was read, 0 otherwise
+ */
+int gmx_fft_import_wisdom(const char *filename);
+
+/*! \brief Export FFT planning information to a file
+ *
+ *  With FFTW this writes all wisdom accumulated in the process,
+ *  including the imported wisdom. The file is replaced atomically,
+ *  so concurrent processes can share the file. Should not be called
+ *  while plans are being made. A no-op with other FFT libraries.
+ *
+ * \param filename  Name of the file to write
+ *
+ * \return 1 when planning information was written, 0 otherwise
+ */
+int gmx_fft_export_wisdom(const char *filename);
+
+/*! \brief Return FFT planning information as a string
+ *
+ *  With FFTW this returns all wisdom accumulated in the process, so
+ *  the planning information of several processes can be merged with
+ *  gmx_fft_import_wisdom_string(). Should not be called while plans
+ *  are being made.
+ *
+ * \return The planning information, to be freed with free(), or NULL
+ *         with other FFT libraries
+ */
+char *gmx_fft_export_wisdom_string();
+
+/*! \brief Add FFT planning information from a string
+ *
+ *  With FFTW this adds the wisdom in \p wisdom, as returned by
+ *  gmx_fft_export_wisdom_string() in another process, to the wisdom
+ *  of this process. Should not be called while plans are being made.
+ *  A no-op with other FFT libraries.
+ *
+ * \param wisdom  The planning information
+ *
+ * \return 1 when planning information was added, 0 otherwise
+ */
+int gmx_fft_import_wisdom_string(const char *wisdom);
+
 /*! \brief Return string describing the underlying FFT implementation.
  *
  * Used to print out information about the used FFT library where needed.
@@ -148,6 +148,12 @@ double MPI_Wtime()
 #endif
 #endif
 
+/* number of chunks for pipelining a transpose of nplanes planes */
+static int fft5d_pipe_nchunk(int npipe, int nplanes)
+{
+    return std::max(1, std::min(npipe, nplanes));
+}
+
 static int vmax(int* a, int s)
 {
     int i, max = 0;
@@ -180,6 +186,7 @@ fft5d_plan fft5d_plan_3d(int NG, int MG, int KG, MPI_Comm comm[2], int flags, t_
     t_complex *lin = 0, *lout = 0, *lout2 = 0, *lout3 = 0;
     fft5d_plan plan;
     int        s;
+    int        npipe = FFT5D_PIPELINE_NCHUNK;
 
     /* comm, prank and P are in the order of the decomposition (plan->cart is in the order of transposes) */
 #ifdef GMX_MPI
@@ -408,6 +415,29 @@ fft5d_plan fft5d_plan_3d(int NG, int MG, int KG, MPI_Comm comm[2], int flags, t_
        distributed along axis 1, 2 or both
      */
 
+    /* Pipelined transposes, the value of the environment variable (if >0)
+       sets the number of chunks each transpose is split into.
+       This only has an effect with decomposition and needs separate
+       transpose buffers, also with a single thread. */
+#if defined GMX_MPI && !defined FFT5D_MPI_TRANSPOSE
+    const char *env = getenv("GMX_FFT5D_PIPELINE");
+    if (env != NULL)
+    {
+        flags |= FFT5D_PIPELINE;
+        npipe  = strtol(env, NULL, 10);
+        if (npipe < 1)
+        {
+            npipe = FFT5D_PIPELINE_NCHUNK;
+        }
+    }
+    if (!(nP[0] > 1 || nP[1] > 1))
+    {
+        flags &= ~FFT5D_PIPELINE;
+    }
+#else
+    flags &= ~FFT5D_PIPELINE;
+#endif
+
     /* int lsize = fmax(N[0]*M[0]*K[0]*nP[0],N[1]*M[1]*K[1]*nP[1]); */
     lsize = std::max(N[0]*M[0]*K[0]*nP[0], std::max(N[1]*M[1]*K[1]*nP[1], C[2]*M[2]*K[2]));
     /* int lsize = fmax(C[0]*M[0]*K[0],fmax(C[1]*M[1]*K[1],C[2]*M[2]*K[2])); */
@@ -415,9 +445,10 @@ fft5d_plan fft5d_plan_3d(int NG, int MG, int KG, MPI_Comm comm[2], int flags, t_
     {
         snew_aligned(lin, lsize, 32);
         snew_aligned(lout, lsize, 32);
-        if (nthreads > 1)
+        if (nthreads > 1 || (flags&FFT5D_PIPELINE))
         {
-            /* We need extra transpose buffers to avoid OpenMP barriers */
+            /* We need extra transpose buffers to avoid OpenMP barriers
+               and to overlap the FFTs with the pipelined transposes */
             snew_aligned(lout2, lsize, 32);
             snew_aligned(lout3, lsize, 32);
         }
@@ -432,7 +463,7 @@ fft5d_plan fft5d_plan_3d(int NG, int MG, int KG, MPI_Comm comm[2], int flags, t_
     {
         lin  = *rlin;
         lout = *rlout;
-        if (nthreads > 1)
+        if (nthreads > 1 || (flags&FFT5D_PIPELINE))
         {
             lout2 = *rlout2;
             lout3 = *rlout3;
@@ -617,13 +648,54 @@ fft5d_plan fft5d_plan_3d(int NG, int MG, int KG, MPI_Comm comm[2], int flags, t_
 #if GMX_FFT_FFTW3
 }
 #endif
+    /* With pipelined transposes the first two FFT steps are done in chunks
+       of planes along the slowest local axis, each chunk split over the threads */
+    for (s = 0; s < 2 && (flags&FFT5D_PIPELINE); s++)
+    {
+        int nchunk = fft5d_pipe_nchunk(npipe, pK[s]);
+
+        plan->p1dpipe[s] = (gmx_fft_t*)malloc(sizeof(gmx_fft_t)*nchunk*nthreads);
+
+#pragma omp parallel for num_threads(nthreads) schedule(static) ordered
+        for (t = 0; t < nthreads; t++)
+        {
+#pragma omp ordered
+            {
+                int c;
+
+                for (c = 0; c < nchunk; c++)
+                {
+                    int csize = ((c+1)*pK[s]/nchunk - c*pK[s]/nchunk)*pM[s];
+                    int tsize = ((t+1)*csize/nthreads)-(t*csize/nthreads);
+
+                    if ((flags&FFT5D_REALCOMPLEX) && !(flags&FFT5D_BACKWARD) && s == 0)
+                    {
+                        gmx_fft_init_many_1d_real( &plan->p1dpipe[s][c*nthreads+t], rC[s], tsize, (flags&FFT5D_NOMEASURE) ? GMX_FFT_FLAG_CONSERVATIVE : 0 );
+                    }
+                    else
+                    {
+                        gmx_fft_init_many_1d     ( &plan->p1dpipe[s][c*nthreads+t],  C[s], tsize, (flags&FFT5D_NOMEASURE) ? GMX_FFT_FLAG_CONSERVATIVE : 0 );
+                    }
+                }
+            }
+        }
+    }
+    if (flags&FFT5D_PIPELINE)
+    {
+        /* At most one send and one receive per rank and chunk */
+        plan->req = (MPI_Request*)malloc(sizeof(MPI_Request)*2*std::max(nP[0], nP[1])*npipe);
+    }
+    plan->npipe = npipe;
+
     if ((flags&FFT5D_ORDER_YZ))   /*plan->cart is in the order of transposes */
     {
-        plan->cart[0] = comm[0]; plan->cart[1] = comm[1];
+        plan->cart[0]     = comm[0]; plan->cart[1] = comm[1];
+        plan->cartrank[0] = prank[0]; plan->cartrank[1] = prank[1];
     }
     else
     {
-        plan->cart[1] = comm[0]; plan->cart[0] = comm[1];
+        plan->cart[1]     = comm[0]; plan->cart[0] = comm[1];
+        plan->cartrank[1] = prank[0]; plan->cartrank[0] = prank[1];
     }
 #ifdef FFT5D_MPI_TRANSPOSE
     FFTW_LOCK;
@@ -962,6 +1034,112 @@ static void print_localdata(const t_complex* lin, const char* txt, int s, fft5d_
     }
 }
 
+#ifdef GMX_MPI
+/* FFT, split and transpose of step s with FFT5D_PIPELINE.
+   Instead of a blocking all-to-all after the FFT of all lines, the lines are
+   processed in chunks of planes along the slowest local axis. As soon as a
+   chunk has been transformed and split, it is sent to all ranks with
+   non-blocking point-to-point messages, so the FFT of the next chunk overlaps
+   with the communication of the previous ones.
+   The chunks land in lout3 at the same place as with MPI_Alltoall. */
+static void fft5d_fft_transpose_pipelined(fft5d_plan plan, int s, int thread, fft5d_time times)
+{
+    t_complex   *lin   = plan->lin;
+    t_complex   *lout  = plan->lout;
+    t_complex   *lout2 = plan->lout2;
+    t_complex   *lout3 = plan->lout3;
+    MPI_Comm     comm  = plan->cart[s];
+    MPI_Request *req   = plan->req;
+    int         *N     = plan->N, *M = plan->M, *K = plan->K, *pM = plan->pM, *pK = plan->pK, *C = plan->C, *P = plan->P;
+    int          nthreads = plan->nthreads;
+    int          rank     = plan->cartrank[s];
+    int          bTrans13, count, planesize, nreq, nchunk, c, i, z0, z1, tstart, tend;
+
+    bTrans13  = ((s == 0 && !(plan->flags&FFT5D_ORDER_YZ)) || (s == 1 && (plan->flags&FFT5D_ORDER_YZ)));
+    /* size of the data for each rank, as for MPI_Alltoall */
+    count     = bTrans13 ? N[s]*pM[s]*K[s] : N[s]*M[s]*pK[s];
+    /* size of one plane of the slowest local axis in a split chunk */
+    planesize = N[s]*M[s];
+    nreq      = 0;
+
+    /* Other threads could still be reading lout3 in the join of the previous step */
+#pragma omp barrier
+    if (thread == 0)
+    {
+        for (i = 0; i < P[s]; i++)
+        {
+            /* The number of planes sent by rank i, with 1-3 transposes
+               the slowest axis is the one which is joined */
+            int nplanes = bTrans13 ? plan->iNin[s+1][i] : pK[s];
+
+            nchunk = fft5d_pipe_nchunk(plan->npipe, nplanes);
+            for (c = 0; c < nchunk && i != rank; c++)
+            {
+                z0 = c*nplanes/nchunk;
+                z1 = (c+1)*nplanes/nchunk;
+                if (z1 > z0)
+                {
+                    MPI_Irecv((real *)(lout3 + i*count + z0*planesize), (z1 - z0)*planesize*sizeof(t_complex)/sizeof(real), GMX_MPI_REAL, i, c, comm, &req[nreq++]);
+                }
+            }
+        }
+    }
+
+    nchunk = fft5d_pipe_nchunk(plan->npipe, pK[s]);
+    for (c = 0; c < nchunk; c++)
+    {
+        gmx_fft_t p1d = plan->p1dpipe[s][c*nthreads+thread];
+        int       l0  = (c*pK[s]/nchunk)*pM[s];
+        int       l1  = ((c+1)*pK[s]/nchunk)*pM[s];
+
+        tstart = l0 + ( thread   *(l1 - l0)/nthreads);
+        tend   = l0 + ((thread+1)*(l1 - l0)/nthreads);
+        if ((plan->flags&FFT5D_REALCOMPLEX) && !(plan->flags&FFT5D_BACKWARD) && s == 0)
+        {
+            gmx_fft_many_1d_real(p1d, GMX_FFT_REAL_TO_COMPLEX, lin+tstart*C[s], lout+tstart*C[s]);
+        }
+        else
+        {
+            gmx_fft_many_1d(     p1d, (plan->flags&FFT5D_BACKWARD) ? GMX_FFT_BACKWARD : GMX_FFT_FORWARD, lin+tstart*C[s], lout+tstart*C[s]);
+        }
+        if (tend > tstart)
+        {
+            splitaxes(lout2, lout, N[s], M[s], K[s], pM[s], P[s], C[s], plan->iNout[s], plan->oNout[s], tstart%pM[s], tstart/pM[s], tend%pM[s], tend/pM[s]);
+        }
+#pragma omp barrier /*the whole chunk has to be split before sending*/
+
+        if (thread == 0)
+        {
+            z0 = l0/pM[s];
+            z1 = l1/pM[s];
+            for (i = 0; i < P[s] && z1 > z0; i++)
+            {
+                t_complex *buf = lout2 + i*count + z0*planesize;
+                if (i == rank)
+                {
+                    memcpy(lout3 + i*count + z0*planesize, buf, (z1 - z0)*planesize*sizeof(t_complex));
+                }
+                else
+                {
+                    MPI_Isend((real *)buf, (z1 - z0)*planesize*sizeof(t_complex)/sizeof(real), GMX_MPI_REAL, i, c, comm, &req[nreq++]);
+                }
+            }
+        }
+    }
+
+    if (thread == 0)
+    {
+#ifndef NOGMX
+        wallcycle_start(times, ewcPME_FFTCOMM);
+#endif
+        MPI_Waitall(nreq, req, MPI_STATUSES_IGNORE);
+#ifndef NOGMX
+        wallcycle_stop(times, ewcPME_FFTCOMM);
+#endif
+    }
+}
+#endif /*GMX_MPI*/
+
 void fft5d_execute(fft5d_plan plan, int thread, fft5d_time times)
 {
     t_complex  *lin   = plan->lin;
@@ -982,7 +1160,7 @@ void fft5d_execute(fft5d_plan plan, int thread, fft5d_time times)
 #endif
     int   *N = plan->N, *M = plan->M, *K = plan->K, *pN = plan->pN, *pM = plan->pM, *pK = plan->pK,
     *C       = plan->C, *P = plan->P, **iNin = plan->iNin, **oNin = plan->oNin, **iNout = plan->iNout, **oNout = plan->oNout;
-    int    s = 0, tstart, tend, bParallelDim;
+    int    s = 0, tstart, tend, bParallelDim, bPipeline;
 
 
 #if GMX_FFT_FFTW3
@@ -1029,6 +1207,7 @@ void fft5d_execute(fft5d_plan plan, int thread, fft5d_time times)
         {
             bParallelDim = 0;
         }
+        bPipeline = (bParallelDim && (plan->flags&FFT5D_PIPELINE));
 
         /* ---------- START FFT ------------ */
 #ifdef NOGMX
@@ -1055,7 +1234,14 @@ void fft5d_execute(fft5d_plan plan, int thread, fft5d_time times)
         }
 
         tstart = (thread*pM[s]*pK[s]/plan->nthreads)*C[s];
-        if ((plan->flags&FFT5D_REALCOMPLEX) && !(plan->flags&FFT5D_BACKWARD) && s == 0)
+        if (bPipeline)
+        {
+#ifdef GMX_MPI
+            /* FFT, split and transpose in chunks */
+            fft5d_fft_transpose_pipelined(plan, s, thread, times);
+#endif
+        }
+        else if ((plan->flags&FFT5D_REALCOMPLEX) && !(plan->flags&FFT5D_BACKWARD) && s == 0)
         {
             gmx_fft_many_1d_real(p1d[s][thread], (plan->flags&FFT5D_BACKWARD) ? GMX_FFT_COMPLEX_TO_REAL : GMX_FFT_REAL_TO_COMPLEX, lin+tstart, fftout+tstart);
         }
@@ -1078,7 +1264,7 @@ void fft5d_execute(fft5d_plan plan, int thread, fft5d_time times)
         /* ---------- END FFT ------------ */
 
         /* ---------- START SPLIT + TRANSPOSE------------ (if parallel in in this dimension)*/
-        if (bParallelDim)
+        if (bParallelDim && !bPipeline)
         {
 #ifdef NOGMX
             if (times != NULL && thread == 0)
@@ -1256,6 +1442,15 @@ void fft5d_destroy(fft5d_plan plan)
             }
             free(plan->p1d[s]);
         }
+        if (s < 2 && plan->p1dpipe[s])
+        {
+            int nchunk = fft5d_pipe_nchunk(plan->npipe, plan->pK[s]);
+            for (t = 0; t < nchunk*plan->nthreads; t++)
+            {
+                gmx_many_fft_destroy(plan->p1dpipe[s][t]);
+            }
+            free(plan->p1dpipe[s]);
+        }
         if (plan->iNin[s])
         {
             free(plan->iNin[s]);
@@ -1277,6 +1472,10 @@ void fft5d_destroy(fft5d_plan plan)
             plan->oNout[s] = 0;
         }
     }
+    if (plan->req)
+    {
+        free(plan->req);
+    }
 #if GMX_FFT_FFTW3
     FFTW_LOCK;
 #ifdef FFT5D_MPI_TRANSPOS
@@ -1296,7 +1495,7 @@ void fft5d_destroy(fft5d_plan plan)
     {
         sfree_aligned(plan->lin);
         sfree_aligned(plan->lout);
-        if (plan->nthreads > 1)
+        if (plan->nthreads > 1 || (plan->flags&FFT5D_PIPELINE))
         {
             sfree_aligned(plan->lout2);
             sfree_aligned(plan->lout3);
@@ -86,9 +86,13 @@ typedef enum fft5d_flags_t {
     FFT5D_DEBUG       = 8,
     FFT5D_NOMEASURE   = 16,
     FFT5D_INPLACE     = 32,
-    FFT5D_NOMALLOC    = 64
+    FFT5D_NOMALLOC    = 64,
+    FFT5D_PIPELINE    = 128
 } fft5d_flags;
 
+/* Default number of chunks each transpose is split into with FFT5D_PIPELINE */
+#define FFT5D_PIPELINE_NCHUNK 4
+
 struct fft5d_plan_t {
     t_complex *lin;
     t_complex *lout, *lout2, *lout3;
@@ -117,6 +121,11 @@ struct fft5d_plan_t {
     /*int P[2];*/
     int coor[2];
     int nthreads;
+    /* Pipelined transposes (FFT5D_PIPELINE) */
+    int          npipe;       /*max. number of chunks per transpose*/
+    int          cartrank[2]; /*rank in cart, MPI_Comm_rank is not called from OpenMP threads*/
+    gmx_fft_t   *p1dpipe[2];  /*1D plans for the chunks of the first two FFT steps*/
+    MPI_Request *req;         /*requests for the chunk messages*/
 };
 
 typedef struct fft5d_plan_t *fft5d_plan;
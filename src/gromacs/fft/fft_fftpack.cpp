@@ -495,6 +495,26 @@ void gmx_fft_cleanup()
 {
 }
 
+int gmx_fft_import_wisdom(const char gmx_unused *filename)
+{
+    return 0;
+}
+
+int gmx_fft_export_wisdom(const char gmx_unused *filename)
+{
+    return 0;
+}
+
+char *gmx_fft_export_wisdom_string()
+{
+    return NULL;
+}
+
+int gmx_fft_import_wisdom_string(const char gmx_unused *wisdom)
+{
+    return 0;
+}
+
 const char *gmx_fft_get_version_info()
 {
     return "fftpack (built-in)";
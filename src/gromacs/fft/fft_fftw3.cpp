@@ -40,12 +40,18 @@
 #include <errno.h>
 #include <stdlib.h>
 
+#include <cstdio>
+
+#include <string>
+
 #include <fftw3.h>
 
 #include "gromacs/fft/fft.h"
 #include "gromacs/utility/exceptions.h"
 #include "gromacs/utility/fatalerror.h"
 #include "gromacs/utility/mutex.h"
+#include "gromacs/utility/stringutil.h"
+#include "gromacs/utility/sysinfo.h"
 
 #ifdef GMX_DOUBLE
 #define FFTWPREFIX(name) fftw_ ## name
@@ -587,6 +593,60 @@ void gmx_fft_cleanup()
     FFTWPREFIX(cleanup)();
 }
 
+int gmx_fft_import_wisdom(const char *filename)
+{
+    int ret;
+
+    FFTW_LOCK;
+    ret = FFTWPREFIX(import_wisdom_from_filename)(filename);
+    FFTW_UNLOCK;
+
+    return ret;
+}
+
+int gmx_fft_export_wisdom(const char *filename)
+{
+    std::string tmpname = gmx::formatString("%s.%d", filename, gmx_getpid());
+    int         ret;
+
+    /* Write to a temporary file and rename, so other processes never
+     * read a partially written file.
+     */
+    FFTW_LOCK;
+    ret = FFTWPREFIX(export_wisdom_to_filename)(tmpname.c_str());
+    FFTW_UNLOCK;
+
+    if (ret && std::rename(tmpname.c_str(), filename) != 0)
+    {
+        std::remove(tmpname.c_str());
+        ret = 0;
+    }
+
+    return ret;
+}
+
+char *gmx_fft_export_wisdom_string()
+{
+    char *wisdom;
+
+    FFTW_LOCK;
+    wisdom = FFTWPREFIX(export_wisdom_to_string)();
+    FFTW_UNLOCK;
+
+    return wisdom;
+}
+
+int gmx_fft_import_wisdom_string(const char *wisdom)
+{
+    int ret;
+
+    FFTW_LOCK;
+    ret = FFTWPREFIX(import_wisdom_from_string)(wisdom);
+    FFTW_UNLOCK;
+
+    return ret;
+}
+
 const char *gmx_fft_get_version_info()
 {
 #ifdef GMX_NATIVE_WINDOWS
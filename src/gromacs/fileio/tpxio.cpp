@@ -94,7 +94,8 @@ enum tpxv {
     tpxv_RemoveObsoleteParameters1,                          /**< remove optimize_fft, dihre_fc, nstcheckpoint */
     tpxv_PullCoordTypeGeom,                                  /**< add pull type and geometry per group and flat-bottom */
     tpxv_PullGeomDirRel,                                     /**< add pull geometry direction-relative */
-    tpxv_IntermolecularBondeds                               /**< permit inter-molecular bonded interactions in the topology */
+    tpxv_IntermolecularBondeds,                              /**< permit inter-molecular bonded interactions in the topology */
+    tpxv_PmeMultipleTimeStepping                             /**< add nstcalcpme for multiple time stepping of the PME mesh part */
 };
 
 /*! \brief Version number of the file format written to run input
@@ -108,7 +109,7 @@ enum tpxv {
  *
  * When developing a feature branch that needs to change the run input
  * file format, change tpx_tag instead. */
-static const int tpx_version = tpxv_IntermolecularBondeds;
+static const int tpx_version = tpxv_PmeMultipleTimeStepping;
 
 
 /* This number should only be increased when you edit the TOPOLOGY section
@@ -1177,6 +1178,14 @@ static void do_inputrec(t_fileio *fio, t_inputrec *ir, gmx_bool bRead,
     {
         gmx_fio_do_real(fio, ir->epsilon_surface);
     }
+    if (file_version >= tpxv_PmeMultipleTimeStepping)
+    {
+        gmx_fio_do_int(fio, ir->nstcalcpme);
+    }
+    else
+    {
+        ir->nstcalcpme = 1;
+    }
 
     /* ignore bOptFFT */
     if (file_version < tpxv_RemoveObsoleteParameters1)
@@ -113,7 +113,7 @@ static void pick_module_nthreads(FILE *fplog, int m,
                                  gmx_bool bSimMaster,
                                  gmx_bool bFullOmpSupport,
                                  gmx_bool bSepPME,
-                                 gmx_bool bUseOffloadedKernel)
+                                 gmx_bool gmx_unused bUseOffloadedKernel)
 {
     char    *env;
     int      nth;
@@ -185,24 +185,21 @@ static void pick_module_nthreads(FILE *fplog, int m,
         /* pick the global PME node nthreads if we are setting the number
          * of threads in separate PME nodes  */
         nth = (bSepPME && m == emntPME) ? modth.gnth_pme : modth.gnth;
+#ifdef GMX_OFFLOAD
         /* Nonbonded nthreads must agree on CPU and coprocessor because of
-         * shared data structures.
+         * shared data structures. The loopback target uses the host default.
          */
         if (bUseOffloadedKernel && m == emntNonbonded)
         {
             nth = GMX_OPENMP_OFFLOAD_THREADS;
         }
+#endif
     }
 
+    /* The thread count on an offload target is set for each device when
+     * the offload context of a rank is created, see nbnxn_offload_init.
+     */
     gmx_omp_nthreads_set(m, nth);
-    /* Logic needs to change if we do more than nonbonded on the coprocessor */
-    if (bUseOffloadedKernel && m == emntNonbonded)
-    {
-#pragma offload target(mic:0)
-        {
-            gmx_omp_nthreads_set(m, nth);
-        }
-    }
 }
 
 void gmx_omp_nthreads_read_env(int     *nthreads_omp,
@@ -186,13 +186,20 @@ void
 gmx_set_thread_affinity(FILE                *fplog,
                         const t_commrec     *cr,
                         gmx_hw_opt_t        *hw_opt,
-                        const gmx_hw_info_t *hwinfo)
+                        const gmx_hw_info_t *hwinfo,
+                        int                  nthread_task,
+                        int                 *task_core)
 {
     int        nth_affinity_set, thread0_id_node,
-               nthread_local, nthread_node;
+               nthread_local, nthread_rank, nthread_node;
     int        offset;
     const int *locality_order;
-    int        rc;
+    int        rc, i;
+
+    for (i = 0; i < nthread_task; i++)
+    {
+        task_core[i] = -1;
+    }
 
     if (hw_opt->thread_affinity == threadaffOFF)
     {
@@ -231,9 +238,12 @@ gmx_set_thread_affinity(FILE                *fplog,
     }
 #endif
 
+    /* the task threads run on the cores after those of the OpenMP team */
+    nthread_rank = nthread_local + nthread_task;
+
     /* map the current process to cores */
     thread0_id_node = 0;
-    nthread_node    = nthread_local;
+    nthread_node    = nthread_rank;
 #ifdef GMX_MPI
     if (PAR(cr) || MULTISIM(cr))
     {
@@ -245,11 +255,11 @@ gmx_set_thread_affinity(FILE                *fplog,
         MPI_Comm_split(MPI_COMM_WORLD,
                        gmx_physicalnode_id_hash(), cr->rank_intranode,
                        &comm_intra);
-        MPI_Scan(&nthread_local, &thread0_id_node, 1, MPI_INT, MPI_SUM, comm_intra);
+        MPI_Scan(&nthread_rank, &thread0_id_node, 1, MPI_INT, MPI_SUM, comm_intra);
         /* MPI_Scan is inclusive, but here we need exclusive */
-        thread0_id_node -= nthread_local;
+        thread0_id_node -= nthread_rank;
         /* Get the total number of threads on this physical node */
-        MPI_Allreduce(&nthread_local, &nthread_node, 1, MPI_INT, MPI_SUM, comm_intra);
+        MPI_Allreduce(&nthread_rank, &nthread_node, 1, MPI_INT, MPI_SUM, comm_intra);
         MPI_Comm_free(&comm_intra);
     }
 #endif
@@ -328,6 +338,13 @@ gmx_set_thread_affinity(FILE                *fplog,
         }
     }
 
+    for (i = 0; i < nthread_task; i++)
+    {
+        int index = offset + (thread0_id_node + nthread_local + i)*hw_opt->core_pinning_stride;
+
+        task_core[i] = (locality_order != NULL ? locality_order[index] : index);
+    }
+
     if (nth_affinity_set > nthread_local)
     {
         char msg[STRLEN];
@@ -959,6 +959,7 @@ void pr_inputrec(FILE *fp, int indent, const char *title, t_inputrec *ir,
         PS("lj-pme-comb-rule", ELJPMECOMBNAMES(ir->ljpme_combination_rule));
         PR("ewald-geometry", ir->ewald_geometry);
         PR("epsilon-surface", ir->epsilon_surface);
+        PI("nstcalcpme", ir->nstcalcpme);
 
         /* Implicit solvent */
         PS("implicit-solvent", EIMPLICITSOL(ir->implicit_solvent));
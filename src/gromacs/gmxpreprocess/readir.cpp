@@ -221,11 +221,13 @@ static int lcd(int n1, int n2)
     return d;
 }
 
-static void process_interaction_modifier(const t_inputrec *ir, int *eintmod)
+static void process_interaction_modifier(const t_inputrec *ir, int *eintmod,
+                                         gmx_bool bUserTable)
 {
     if (*eintmod == eintmodPOTSHIFT_VERLET)
     {
-        if (ir->cutoff_scheme == ecutsVERLET)
+        /* User tables are used as they are, without shift */
+        if (ir->cutoff_scheme == ecutsVERLET && !bUserTable)
         {
             *eintmod = eintmodPOTSHIFT;
         }
@@ -273,8 +275,10 @@ void check_ir(const char *mdparin, t_inputrec *ir, t_gromppopts *opts,
     sprintf(err_buf, "nstlist can not be smaller than 0. (If you were trying to use the heuristic neighbour-list update scheme for efficient buffering for improved energy conservation, please use the Verlet cut-off scheme instead.)");
     CHECK(ir->nstlist < 0);
 
-    process_interaction_modifier(ir, &ir->coulomb_modifier);
-    process_interaction_modifier(ir, &ir->vdw_modifier);
+    process_interaction_modifier(ir, &ir->coulomb_modifier,
+                                 ir->coulombtype == eelUSER);
+    process_interaction_modifier(ir, &ir->vdw_modifier,
+                                 ir->vdwtype == evdwUSER);
 
     if (ir->cutoff_scheme == ecutsGROUP)
     {
@@ -355,15 +359,41 @@ void check_ir(const char *mdparin, t_inputrec *ir, t_gromppopts *opts,
             }
         }
 
-        if (!(ir->vdwtype == evdwCUT || ir->vdwtype == evdwPME))
+        if (!(ir->vdwtype == evdwCUT || ir->vdwtype == evdwPME ||
+              ir->vdwtype == evdwUSER))
         {
-            warning_error(wi, "With Verlet lists only cut-off and PME LJ interactions are supported");
+            warning_error(wi, "With Verlet lists only cut-off, PME and user LJ interactions are supported");
         }
         if (!(ir->coulombtype == eelCUT ||
               (EEL_RF(ir->coulombtype) && ir->coulombtype != eelRF_NEC) ||
-              EEL_PME(ir->coulombtype) || ir->coulombtype == eelEWALD))
+              EEL_PME(ir->coulombtype) || ir->coulombtype == eelEWALD ||
+              ir->coulombtype == eelUSER))
+        {
+            warning_error(wi, "With Verlet lists only cut-off, reaction-field, PME, Ewald and user electrostatics are supported");
+        }
+        if (ir->vdwtype == evdwUSER || ir->coulombtype == eelUSER)
         {
-            warning_error(wi, "With Verlet lists only cut-off, reaction-field, PME and Ewald electrostatics are supported");
+            if (ir->coulombtype == eelPMEUSER || ir->coulombtype == eelPMEUSERSWITCH)
+            {
+                warning_error(wi, "With Verlet lists user tables can not be combined with PME-User electrostatics");
+            }
+            if (ir->vdwtype == evdwPME)
+            {
+                warning_error(wi, "With Verlet lists user tables can not be combined with LJ-PME");
+            }
+            if ((ir->coulombtype == eelUSER && ir->coulomb_modifier != eintmodNONE) ||
+                (ir->vdwtype == evdwUSER && ir->vdw_modifier != eintmodNONE))
+            {
+                warning_error(wi, "With Verlet lists user tables can not be used with a potential modifier");
+            }
+            if (ir->efep != efepNO)
+            {
+                warning_error(wi, "With Verlet lists free-energy calculations are not supported with user tables");
+            }
+            if (ir->verletbuf_tol > 0)
+            {
+                warning_error(wi, "With Verlet lists and user tables the pair-list buffer can not be determined automatically, set verlet-buffer-tolerance = -1 and set rlist manually");
+            }
         }
         if (!(ir->coulomb_modifier == eintmodNONE ||
               ir->coulomb_modifier == eintmodPOTSHIFT))
@@ -463,6 +493,28 @@ void check_ir(const char *mdparin, t_inputrec *ir, t_gromppopts *opts,
         warning_error(wi, "When used with PME, the long-range component of twin-range interactions must be updated every step (nstcalclr)");
     }
 
+    if (ir->nstcalcpme < 1)
+    {
+        warning_error(wi, "nstcalcpme should be 1 or larger");
+    }
+    else if (ir->nstcalcpme > 1)
+    {
+        if (!(EEL_PME_EWALD(ir->coulombtype) || EVDW_PME(ir->vdwtype)))
+        {
+            warning_note(wi, "nstcalcpme only affects PME and Ewald, setting nstcalcpme to 1");
+            ir->nstcalcpme = 1;
+        }
+        else if (ir->cutoff_scheme != ecutsVERLET)
+        {
+            warning_error(wi, "Multiple time stepping of the mesh part (nstcalcpme > 1) is only supported with cutoff-scheme = Verlet");
+        }
+        else if (!(ir->eI == eiMD || EI_VV(ir->eI) || ir->eI == eiSD1))
+        {
+            sprintf(warn_buf, "Multiple time stepping of the mesh part (nstcalcpme > 1) is not supported with integrator %s", ei_names[ir->eI]);
+            warning_error(wi, warn_buf);
+        }
+    }
+
     /* GENERAL INTEGRATOR STUFF */
     if (!(ir->eI == eiMD || EI_VV(ir->eI)))
     {
@@ -539,6 +591,16 @@ void check_ir(const char *mdparin, t_inputrec *ir, t_gromppopts *opts,
                           "nstpcouple", &ir->nstpcouple, wi);
             }
         }
+        if (ir->nstcalcpme > 1 && ir->nstcalcenergy > 0 &&
+            ir->nstcalcenergy % ir->nstcalcpme != 0)
+        {
+            /* The mesh part is also computed at steps where energies
+             * or the virial are needed, which costs extra mesh steps.
+             */
+            sprintf(warn_buf, "The mesh part is also computed every nstcalcenergy (%d) steps, for optimal performance set nstcalcenergy to a multiple of nstcalcpme (%d)",
+                    ir->nstcalcenergy, ir->nstcalcpme);
+            warning_note(wi, warn_buf);
+        }
 
         if (ir->nstcalcenergy > 0)
         {
@@ -1981,6 +2043,8 @@ void get_ir(const char *mdparin, const char *mdparout,
     EETYPE("lj-pme-comb-rule", ir->ljpme_combination_rule, eljpme_names);
     EETYPE("ewald-geometry", ir->ewald_geometry, eewg_names);
     RTYPE ("epsilon-surface", ir->epsilon_surface, 0.0);
+    CTYPE ("Interval in steps for applying the PME/Ewald mesh forces (multiple time stepping)");
+    ITYPE ("nstcalcpme",  ir->nstcalcpme,  1);
 
     CCTYPE("IMPLICIT SOLVENT ALGORITHM");
     EETYPE("implicit-solvent", ir->implicit_solvent, eis_names);
@@ -3737,6 +3801,10 @@ void do_index(const char* mdparin, const char *ndx,
     }
 
     bTable = do_egp_flag(ir, groups, "energygrp-table", is->egptable, EGP_TABLE);
+    if (bTable && ir->cutoff_scheme == ecutsVERLET)
+    {
+        warning_error(wi, "Energy group pair tables are not (yet) implemented for the Verlet scheme");
+    }
     if (bTable && !(ir->vdwtype == evdwUSER) &&
         !(ir->coulombtype == eelUSER) && !(ir->coulombtype == eelPMEUSER) &&
         !(ir->coulombtype == eelPMEUSERSWITCH))
@@ -4316,9 +4384,9 @@ void double_check(t_inputrec *ir, matrix box,
             warning_error(wi, warn_buf);
         }
 
-        if (IR_TWINRANGE(*ir) && ir->nstlist > 1)
+        if ((IR_TWINRANGE(*ir) && ir->nstlist > 1) || ir->nstcalcpme > 1)
         {
-            sprintf(warn_buf, "With twin-range cut-off's and SHAKE the virial and the pressure are incorrect.");
+            sprintf(warn_buf, "With multiple time stepping (twin-range cut-off's or nstcalcpme > 1) and SHAKE the virial and the pressure are incorrect.");
             if (ir->epc == epcNO)
             {
                 warning(wi, warn_buf);
@@ -4330,6 +4398,12 @@ void double_check(t_inputrec *ir, matrix box,
         }
     }
 
+    if (bHasAnyConstraints && EI_VV(ir->eI) && ir->nstcalcpme > 1)
+    {
+        sprintf(warn_buf, "Multiple time stepping of the mesh part (nstcalcpme > 1) is not supported with constraints and integrator %s", ei_names[ir->eI]);
+        warning_error(wi, warn_buf);
+    }
+
     if ( (ir->eConstrAlg == econtLINCS) && bHasNormalConstraints)
     {
         /* If we have Lincs constraints: */
@@ -172,11 +172,13 @@ void init_forcerec(FILE              *fplog,
                    const char        *tabbfn,
                    const char        *nbpu_opt,
                    gmx_bool           bNoSolvOpt,
+                   gmx_bool           bReproducible,
                    real               print_force);
 /* The Force rec struct must be created with mk_forcerec
  * The gmx_booleans have the following meaning:
  * bSetQ:    Copy the charges [ only necessary when they change ]
  * bMolEpot: Use the free energy stuff per molecule
+ * bReproducible: Avoid algorithms with run-to-run varying summation order
  * print_force >= 0: print forces for atoms with force >= print_force
  */
 
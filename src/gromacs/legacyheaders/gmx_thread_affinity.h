@@ -51,12 +51,17 @@ struct t_commrec;
 
 /* Sets the thread affinity using the requested setting stored in hw_opt.
  * The hardware topologu is requested from hwinfo, when present.
+ * The rank also runs nthread_task threads outside the OpenMP team of
+ * the calling thread, the cores after those of the team are reserved
+ * for them and returned in task_core, or -1 when they should not be pinned.
  */
 void
 gmx_set_thread_affinity(FILE                       *fplog,
                         const struct t_commrec     *cr,
                         gmx_hw_opt_t               *hw_opt,
-                        const gmx_hw_info_t        *hwinfo);
+                        const gmx_hw_info_t        *hwinfo,
+                        int                         nthread_task,
+                        int                        *task_core);
 
 /* Check the process affinity mask and if it is found to be non-zero,
  * will honor it and disable mdrun internal affinity setting.
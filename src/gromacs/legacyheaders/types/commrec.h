@@ -225,6 +225,8 @@ struct gmx_domdec_t {
     /* gmx_pme_recv_f buffer */
     int   pme_recv_f_alloc;
     rvec *pme_recv_f_buf;
+    /* Exchange coordinates and forces with PME ranks through shared memory */
+    gmx_bool pme_pp_shared;
 
 };
 
@@ -59,6 +59,7 @@ extern "C" {
 
 /* Abstract type for PME that is defined only in the routine that use them. */
 struct gmx_pme_t;
+struct gmx_pme_task_t;
 struct nonbonded_verlet_t;
 struct bonded_threading_t;
 
@@ -203,6 +204,7 @@ typedef struct {
 
     const gmx_hw_info_t *hwinfo;
     const gmx_gpu_opt_t *gpu_opt;
+    int                  offload_device; /* The offload device of this PP rank */
     gmx_bool             use_simd_kernels;
 
     /* Interaction for calculated in kernels. In many cases this is similar to
@@ -334,6 +336,10 @@ typedef struct {
     gmx_bool bTwinRange;
     int      nlr;
     rvec    *f_twin;
+    /* Interval for applying the PME/Ewald mesh forces with the Verlet scheme,
+     * with nstcalcpme > 1 the mesh forces are stored in f_twin
+     */
+    int      nstcalcpme;
     /* Constraint virial correction for multiple time stepping */
     tensor   vir_twin_constr;
 
@@ -350,10 +356,12 @@ typedef struct {
     rvec *f_novirsum;
 
     /* Long-range forces and virial for PPPM/PME/Ewald */
-    struct gmx_pme_t *pmedata;
-    int               ljpme_combination_rule;
-    tensor            vir_el_recip;
-    tensor            vir_lj_recip;
+    struct gmx_pme_t      *pmedata;
+    /* Task thread running the PME mesh part concurrently, NULL when unused */
+    struct gmx_pme_task_t *pme_task;
+    int                    ljpme_combination_rule;
+    tensor                 vir_el_recip;
+    tensor                 vir_lj_recip;
 
     /* PME/Ewald stuff */
     gmx_bool                bEwald;
@@ -331,6 +331,7 @@ typedef struct {
     real            ewald_rtol_lj;           /* Real space tolerance for LJ-Ewald            */
     int             ewald_geometry;          /* normal/3d ewald, or pseudo-2d LR corrections */
     real            epsilon_surface;         /* Epsilon for PME dipole correction            */
+    int             nstcalcpme;              /* Frequency of applying the mesh forces (MTS)  */
     int             ljpme_combination_rule;  /* Type of combination rule in LJ-PME          */
     int             ePBC;                    /* Type of periodic boundary conditions		*/
     int             bPeriodicMols;           /* Periodic molecules                           */
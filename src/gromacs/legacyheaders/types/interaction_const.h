@@ -131,6 +131,16 @@ typedef struct {
        single precision x86 SIMD for aligned loads */
     real *tabq_vdw_FDV0;
 
+    /* Cubic spline table for user potentials with the Verlet scheme,
+     * points to the group scheme table with stride tabcs_stride,
+     * entries are YFGH quadruplets for Coulomb, dispersion and repulsion
+     */
+    real  tabcs_scale;
+    int   tabcs_stride;
+    real *tabcs_data;
+    /* The Coulomb table potential shift, added back for excluded pairs */
+    real  tabcs_sh_excl;
+
 } interaction_const_t;
 
 #ifdef __cplusplus
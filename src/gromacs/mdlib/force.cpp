@@ -158,6 +158,7 @@ void do_force_lowlevel(t_forcerec *fr,      t_inputrec *ir,
     gmx_bool    bSB;
     int         pme_flags;
     matrix      boxs;
+    rvec       *f_mesh;
     rvec        box_size;
     t_pbc       pbc;
     real        dvdl_dum[efptNR], dvdl_nb[efptNR];
@@ -386,10 +387,17 @@ void do_force_lowlevel(t_forcerec *fr,      t_inputrec *ir,
     clear_mat(fr->vir_el_recip);
     clear_mat(fr->vir_lj_recip);
 
+    /* With the Verlet scheme the mesh forces go to f_longrange, which is
+     * fr->f_twin with multiple time stepping of the mesh part. The mesh
+     * part is then only computed at steps with GMX_FORCE_DO_LR set.
+     */
+    f_mesh = (ir->cutoff_scheme == ecutsVERLET ? f_longrange : fr->f_novirsum);
+
     /* Do long-range electrostatics and/or LJ-PME, including related short-range
      * corrections.
      */
-    if (EEL_FULL(fr->eeltype) || EVDW_PME(fr->vdwtype))
+    if ((EEL_FULL(fr->eeltype) || EVDW_PME(fr->vdwtype)) &&
+        (fr->nstcalcpme == 1 || (flags & GMX_FORCE_DO_LR)))
     {
         int  status            = 0;
         real Vlr_q             = 0, Vlr_lj = 0, Vcorr_q = 0, Vcorr_lj = 0;
@@ -473,7 +481,7 @@ void do_force_lowlevel(t_forcerec *fr,      t_inputrec *ir,
                                        excl, x, bSB ? boxs : box, mu_tot,
                                        ir->ewald_geometry,
                                        ir->epsilon_surface,
-                                       fr->f_novirsum, *vir_q, *vir_lj,
+                                       f_mesh, *vir_q, *vir_lj,
                                        Vcorrt_q, Vcorrt_lj,
                                        lambda[efptCOUL], lambda[efptVDW],
                                        dvdlt_q, dvdlt_lj);
@@ -501,7 +509,11 @@ void do_force_lowlevel(t_forcerec *fr,      t_inputrec *ir,
             enerd->dvdl_lin[efptCOUL] += dvdl_long_range_correction_q;
             enerd->dvdl_lin[efptVDW]  += dvdl_long_range_correction_lj;
 
-            if ((EEL_PME(fr->eeltype) || EVDW_PME(fr->vdwtype)) && (cr->duty & DUTY_PME))
+            /* With a PME task thread the mesh part is computed concurrently,
+             * the results are added at the end of do_force.
+             */
+            if ((EEL_PME(fr->eeltype) || EVDW_PME(fr->vdwtype)) && (cr->duty & DUTY_PME) &&
+                fr->pme_task == NULL)
             {
                 /* Do reciprocal PME for Coulomb and/or LJ. */
                 assert(fr->n_tpi >= 0);
@@ -532,7 +544,7 @@ void do_force_lowlevel(t_forcerec *fr,      t_inputrec *ir,
                     wallcycle_start(wcycle, ewcPMEMESH);
                     status = gmx_pme_do(fr->pmedata,
                                         0, md->homenr - fr->n_tpi,
-                                        x, fr->f_novirsum,
+                                        x, f_mesh,
                                         md->chargeA, md->chargeB,
                                         md->sqrt_c6A, md->sqrt_c6B,
                                         md->sigmaA, md->sigmaB,
@@ -578,7 +590,7 @@ void do_force_lowlevel(t_forcerec *fr,      t_inputrec *ir,
 
         if (!EEL_PME(fr->eeltype) && EEL_PME_EWALD(fr->eeltype))
         {
-            Vlr_q = do_ewald(ir, x, fr->f_novirsum,
+            Vlr_q = do_ewald(ir, x, f_mesh,
                              md->chargeA, md->chargeB,
                              box_size, cr, md->homenr,
                              fr->vir_el_recip, fr->ewaldcoeff_q,
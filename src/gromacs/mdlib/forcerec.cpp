@@ -70,11 +70,14 @@
 #include "gromacs/math/units.h"
 #include "gromacs/math/utilities.h"
 #include "gromacs/math/vec.h"
+#include "gromacs/mdlib/calc_verletbuf.h"
 #include "gromacs/mdlib/forcerec-threading.h"
 #include "gromacs/mdlib/nb_verlet.h"
+#include "gromacs/mdlib/nb_verlet_offload_arena.h"
 #include "gromacs/mdlib/nb_verlet_simd_offload.h"
 #include "gromacs/mdlib/nbnxn_atomdata.h"
 #include "gromacs/mdlib/nbnxn_gpu_data_mgmt.h"
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_fep.h"
 #include "gromacs/mdlib/nbnxn_search.h"
 #include "gromacs/mdlib/nbnxn_simd.h"
 #include "gromacs/pbcutil/ishift.h"
@@ -1433,7 +1436,7 @@ void forcerec_set_ranges(t_forcerec *fr,
     {
         fr->nalloc_force = over_alloc_dd(fr->natoms_force_constr);
 
-        if (fr->bTwinRange)
+        if (fr->bTwinRange || fr->nstcalcpme > 1)
         {
             srenew(fr->f_twin, fr->nalloc_force);
         }
@@ -1554,6 +1557,11 @@ gmx_bool nbnxn_acceleration_supported(FILE             *fplog,
                       bGPU ? "CPU only" : "plain-C kernels");
         return FALSE;
     }
+    if (bGPU && (ir->vdwtype == evdwUSER || ir->coulombtype == eelUSER))
+    {
+        md_print_warn(cr, fplog, "User tables are not supported with GPUs, falling back to CPU only\n");
+        return FALSE;
+    }
 
     return TRUE;
 }
@@ -1593,11 +1601,6 @@ static void pick_nbnxn_kernel_cpu(const t_inputrec gmx_unused *ir,
          * On Intel Haswell 4x8 is always faster.
          */
 
-        /* Only 2xNN is currently supported for offload, but it is okay to have
-         * 4xN only (offloading is just not used) */
-#ifdef GMX_OFFLOAD
-        *kernel_type = nbnxnk4xN_SIMD_2xNN;
-#else
         *kernel_type = nbnxnk4xN_SIMD_4xN;
 #ifndef GMX_SIMD_HAVE_FMA
         if (EEL_PME_EWALD(ir->coulombtype) ||
@@ -1609,7 +1612,15 @@ static void pick_nbnxn_kernel_cpu(const t_inputrec gmx_unused *ir,
             *kernel_type = nbnxnk4xN_SIMD_2xNN;
         }
 #endif
-#endif
+        /* Use the other kernel type when the offload target does not have
+         * this one, e.g. 4xN with the 16-wide SIMD of a Xeon Phi.
+         */
+        if (offloadTarget() != eoffloadNONE &&
+            !offloadedKernelEnabled(*kernel_type))
+        {
+            *kernel_type = (*kernel_type == nbnxnk4xN_SIMD_4xN ?
+                            nbnxnk4xN_SIMD_2xNN : nbnxnk4xN_SIMD_4xN);
+        }
 #endif  /* GMX_NBNXN_SIMD_2XNN && GMX_NBNXN_SIMD_4XN */
 
 
@@ -1681,6 +1692,10 @@ const char *lookup_nbnxn_kernel_name(int kernel_type)
             returnvalue = "AVX_256";
 #elif defined GMX_SIMD_X86_AVX2_256
             returnvalue = "AVX2_256";
+#elif defined GMX_SIMD_X86_AVX_512F
+            returnvalue = "AVX_512F";
+#elif defined GMX_SIMD_X86_AVX_512ER
+            returnvalue = "AVX_512ER";
 #else
             returnvalue = "SIMD";
 #endif
@@ -1717,6 +1732,11 @@ static void pick_nbnxn_kernel(FILE                *fp,
 
     if (bEmulateGPU)
     {
+        if (ir->vdwtype == evdwUSER || ir->coulombtype == eelUSER)
+        {
+            gmx_fatal(FARGS, "GPU emulation is not supported with user tables");
+        }
+
         *kernel_type = nbnxnk8x8x8_PlainC;
 
         if (bDoNonbonded)
@@ -2058,6 +2078,24 @@ init_interaction_const(FILE                       *fp,
         }
     }
 
+    if (fr->cutoff_scheme == ecutsVERLET && fr->bvdwtab)
+    {
+        const t_forcetable *tab = &fr->nblists[0].table_elec_vdw;
+
+        ic->tabcs_scale  = tab->scale;
+        ic->tabcs_stride = tab->stride;
+        ic->tabcs_data   = tab->data;
+        /* Only the Ewald table is shifted with a long-range correction */
+        if (fr->bEwald && fr->coulomb_modifier == eintmodPOTSHIFT)
+        {
+            ic->tabcs_sh_excl = gmx_erfc(ic->ewaldcoeff_q*ic->rcoulomb)/ic->rcoulomb;
+        }
+        else
+        {
+            ic->tabcs_sh_excl = 0;
+        }
+    }
+
     if (fp != NULL)
     {
         real dispersion_shift;
@@ -2084,18 +2122,78 @@ init_interaction_const(FILE                       *fp,
     *interaction_const = ic;
 }
 
+/* Returns whether the mixed-precision 2x(N+N) kernels, which compute
+ * the pair interactions in single precision and accumulate in double
+ * precision, are requested and can be used with the selected kernels.
+ */
+static gmx_bool use_nbnxn_mixed_precision(FILE                     *fp,
+                                          const t_inputrec         *ir,
+                                          const nonbonded_verlet_t *nbv)
+{
+    const char *reason = NULL;
+
+    if (getenv("GMX_NBNXN_MIXED_PRECISION") == NULL)
+    {
+        return FALSE;
+    }
+
+#ifdef GMX_NBNXN_SIMD_2XNN_MIXED
+    for (int i = 0; i < nbv->ngrp; i++)
+    {
+        if (nbv->grp[i].kernel_type != nbnxnk4xN_SIMD_4xN ||
+            offloadedKernelEnabled(nbv->grp[i].kernel_type))
+        {
+            reason = "they require the SIMD 4xN kernels on the CPU";
+        }
+    }
+    if (ir->opts.ngener > 1)
+    {
+        reason = "energy groups are not supported";
+    }
+    if (ir->coulombtype == eelUSER || ir->vdwtype == evdwUSER)
+    {
+        reason = "user tables are not supported";
+    }
+    if (getenv("GMX_NBNXN_EWALD_TABLE") != NULL)
+    {
+        reason = "only the analytical Ewald correction is supported";
+    }
+#else
+    GMX_UNUSED_VALUE(ir);
+    GMX_UNUSED_VALUE(nbv);
+    reason = "they are only supported in double precision with AVX SIMD";
+#endif
+
+    if (fp != NULL)
+    {
+        if (reason == NULL)
+        {
+            fprintf(fp, "Using mixed-precision non-bonded kernels: pair interactions in single precision, accumulation in double precision\n\n");
+        }
+        else
+        {
+            fprintf(fp, "\nNOTE: GMX_NBNXN_MIXED_PRECISION is set, but the mixed-precision non-bonded\n"
+                    "      kernels can not be used: %s\n\n", reason);
+        }
+    }
+
+    return (reason == NULL);
+}
+
 static void init_nb_verlet(FILE                *fp,
                            nonbonded_verlet_t **nb_verlet,
                            gmx_bool             bFEP_NonBonded,
                            const t_inputrec    *ir,
                            const t_forcerec    *fr,
                            const t_commrec     *cr,
-                           const char          *nbpu_opt)
+                           const char          *nbpu_opt,
+                           gmx_bool             bReproducible)
 {
     nonbonded_verlet_t *nbv;
     int                 i;
     char               *env;
     gmx_bool            bEmulateGPU, bHybridGPURun = FALSE;
+    gmx_bool            bMixedPrecision;
 
     nbnxn_alloc_t      *nb_alloc;
     nbnxn_free_t       *nb_free;
@@ -2148,22 +2246,53 @@ static void init_nb_verlet(FILE                *fp,
         }
     }
 
+    bMixedPrecision = use_nbnxn_mixed_precision(fp, ir, nbv);
+    if (bMixedPrecision)
+    {
+        for (i = 0; i < nbv->ngrp; i++)
+        {
+            /* The mixed-precision kernels have no Ewald correction tables */
+            nbv->grp[i].ewald_excl = ewaldexclAnalytical;
+        }
+    }
+
     nbnxn_init_search(&nbv->nbs,
                       DOMAINDECOMP(cr) ? &cr->dd->nc : NULL,
                       DOMAINDECOMP(cr) ? domdec_zones(cr->dd) : NULL,
                       bFEP_NonBonded,
                       gmx_omp_nthreads_get(emntPairsearch));
 
+    /* The perturbed pairs are computed on the CPU outside the nbnxn kernels,
+     * we can use SIMD for them when the interactions are supported.
+     */
+    nbv->bUseFEPSimdKernel = (bFEP_NonBonded &&
+                              fr->use_simd_kernels &&
+                              getenv("GMX_DISABLE_SIMD_FEP_KERNEL") == NULL &&
+                              nbnxn_kernel_fep_simd_supported(fr));
+    if (bFEP_NonBonded && fp != NULL)
+    {
+        fprintf(fp, "Using %s kernel for the perturbed non-bonded interactions\n\n",
+                nbv->bUseFEPSimdKernel ? "SIMD" : "plain-C");
+    }
+
     for (i = 0; i < nbv->ngrp; i++)
     {
         gpu_set_host_malloc_and_free(nbv->grp[0].kernel_type == nbnxnk8x8x8_GPU,
                                      &nb_alloc, &nb_free);
+        if (offloadedKernelEnabled(nbv->grp[0].kernel_type))
+        {
+            /* The offloaded pair lists and atom data live in the offload arena */
+            nb_alloc = nbnxn_offload_arena_alloc;
+            nb_free  = nbnxn_offload_arena_free;
+        }
 
         nbnxn_init_pairlist_set(&nbv->grp[i].nbl_lists,
                                 nbnxn_kernel_pairlist_simple(nbv->grp[i].kernel_type),
                                 /* 8x8x8 "non-simple" lists are ATM always combined */
                                 !nbnxn_kernel_pairlist_simple(nbv->grp[i].kernel_type),
-                                nb_alloc, nb_free, nbv->grp[i].kernel_type);
+                                nb_alloc, nb_free, nbv->grp[i].kernel_type,
+                                /* Work stealing makes the force summation order vary */
+                                !bReproducible);
 
         if (i == 0 ||
             nbv->grp[0].kernel_type != nbv->grp[i].kernel_type)
@@ -2206,6 +2335,10 @@ static void init_nb_verlet(FILE                *fp,
                                 ir->opts.ngener,
                                 bSimpleList ? gmx_omp_nthreads_get(emntNonbonded) : 1,
                                 nb_alloc, nb_free);
+            if (bMixedPrecision)
+            {
+                nbnxn_atomdata_init_mixed(nbv->grp[i].nbat);
+            }
         }
         else
         {
@@ -2213,6 +2346,13 @@ static void init_nb_verlet(FILE                *fp,
         }
     }
 
+    nbv->offload = NULL;
+    if (offloadedKernelEnabled(nbv->grp[0].kernel_type))
+    {
+        /* The device of this rank was selected by mdrun */
+        nbnxn_offload_init(fp, cr, &nbv->offload, fr->offload_device);
+    }
+
     if (nbv->bUseGPU)
     {
         /* init the NxN GPU data; the last argument tells whether we'll have
@@ -2281,6 +2421,84 @@ gmx_bool usingGpu(nonbonded_verlet_t *nbv)
     return nbv != NULL && nbv->bUseGPU;
 }
 
+/* Default interval for pruning the CPU pair lists */
+static const int nstlist_prune_default = 4;
+
+static void init_dynamic_pruning(FILE               *fp,
+                                 nonbonded_verlet_t *nbv,
+                                 const t_inputrec   *ir,
+                                 const gmx_mtop_t   *mtop,
+                                 matrix              box)
+{
+    t_inputrec              ir_inner;
+    verletbuf_list_setup_t  ls;
+    char                   *env;
+    int                     kernel_type, i;
+
+    nbv->nstlist_prune = 0;
+    nbv->rlist_inner   = ir->rlist;
+    nbv->search_step   = 0;
+
+    kernel_type = nbv->grp[0].kernel_type;
+
+    /* Pruning only helps when the outer list has a buffer set by the
+     * drift tolerance and it needs a temperature to set the inner one.
+     * The GPU and offloaded kernels handle their lists themselves.
+     */
+    if (getenv("GMX_DISABLE_DYNAMICPRUNING") != NULL ||
+        !EI_DYNAMICS(ir->eI) ||
+        ir->verletbuf_tol <= 0 ||
+        (EI_MD(ir->eI) && ir->etc == etcNO) ||
+        nbv->bUseGPU ||
+        !nbnxn_kernel_pairlist_simple(kernel_type) ||
+        kernel_type == nbnxnk8x8x8_PlainC ||
+        offloadedKernelEnabled(kernel_type))
+    {
+        return;
+    }
+
+    nbv->nstlist_prune = nstlist_prune_default;
+    env                = getenv("GMX_NSTLIST_DYNAMICPRUNING");
+    if (env != NULL)
+    {
+        nbv->nstlist_prune = strtol(env, NULL, 10);
+    }
+    if (nbv->nstlist_prune <= 0 || nbv->nstlist_prune >= ir->nstlist)
+    {
+        nbv->nstlist_prune = 0;
+        return;
+    }
+
+    /* The inner list only needs to be valid for nstlist_prune steps */
+    ir_inner         = *ir;
+    ir_inner.nstlist = nbv->nstlist_prune;
+    verletbuf_get_list_setup(kernel_type != nbnxnk4x4_PlainC, FALSE, &ls);
+    calc_verlet_buffer_size(mtop, det(box), &ir_inner, -1, &ls, NULL,
+                            &nbv->rlist_inner);
+
+    if (nbv->rlist_inner >= ir->rlist)
+    {
+        nbv->nstlist_prune = 0;
+        nbv->rlist_inner   = ir->rlist;
+        return;
+    }
+
+    /* The search keeps the full j-lists, which are the outer lists */
+    for (i = 0; i < nbv->ngrp; i++)
+    {
+        nbv->grp[i].nbl_lists.bPrune = TRUE;
+    }
+
+    if (fp != NULL)
+    {
+        fprintf(fp, "Using dynamic pair-list pruning:\n"
+                "  outer list: rlist %.3f nm, updated every %d steps\n"
+                "  inner list: rlist %.3f nm, pruned every %d steps\n",
+                ir->rlist, ir->nstlist,
+                nbv->rlist_inner, nbv->nstlist_prune);
+    }
+}
+
 void init_forcerec(FILE              *fp,
                    const output_env_t oenv,
                    t_forcerec        *fr,
@@ -2295,6 +2513,7 @@ void init_forcerec(FILE              *fp,
                    const char        *tabbfn,
                    const char        *nbpu_opt,
                    gmx_bool           bNoSolvOpt,
+                   gmx_bool           bReproducible,
                    real               print_force)
 {
     int            i, m, negp_pp, negptable, egi, egj;
@@ -2658,6 +2877,7 @@ void init_forcerec(FILE              *fp,
 
     fr->bTwinRange = fr->rlistlong > fr->rlist;
     fr->bEwald     = (EEL_PME(fr->eeltype) || fr->eeltype == eelEWALD);
+    fr->nstcalcpme = (ir->cutoff_scheme == ecutsVERLET ? ir->nstcalcpme : 1);
 
     fr->reppow     = mtop->ffparams.reppow;
 
@@ -2738,8 +2958,11 @@ void init_forcerec(FILE              *fp,
         {
             gmx_fatal(FARGS, "Cut-off scheme %S only supports LJ repulsion power 12", ecutscheme_names[ir->cutoff_scheme]);
         }
-        fr->bvdwtab  = FALSE;
-        fr->bcoultab = FALSE;
+        /* The Verlet kernels only use tables for user potentials,
+         * in that case a single table with all interactions is used.
+         */
+        fr->bvdwtab  = (fr->vdwtype == evdwUSER || fr->eeltype == eelUSER);
+        fr->bcoultab = fr->bvdwtab;
     }
 
     /* Tables are used for direct ewald sum */
@@ -3237,7 +3460,9 @@ void init_forcerec(FILE              *fp,
             gmx_fatal(FARGS, "With Verlet lists rcoulomb and rvdw should be identical");
         }
 
-        init_nb_verlet(fp, &fr->nbv, bFEP_NonBonded, ir, fr, cr, nbpu_opt);
+        init_nb_verlet(fp, &fr->nbv, bFEP_NonBonded, ir, fr, cr, nbpu_opt,
+                       bReproducible);
+        init_dynamic_pruning(fp, fr->nbv, ir, mtop, box);
     }
 
     if (ir->eDispCorr != edispcNO)
@@ -105,6 +105,13 @@ typedef struct nonbonded_verlet_t {
     gmx_nbnxn_gpu_t         *gpu_nbv;         /* pointer to GPU nb verlet data     */
     int                      min_ci_balanced; /* pair list balancing parameter
                                                  used for the 8x8x8 GPU kernels    */
+    struct nbnxn_offload_t  *offload;         /* offload context of this rank,
+                                                 NULL when not offloading          */
+    int                      nstlist_prune;   /* prune the pair lists every
+                                                 nstlist_prune steps, 0: never     */
+    real                     rlist_inner;     /* the radius of the pruned lists    */
+    gmx_int64_t              search_step;     /* the step of the last search       */
+    gmx_bool                 bUseFEPSimdKernel; /* SIMD kernel for perturbed pairs */
 } nonbonded_verlet_t;
 
 /*! \brief Getter for bUseGPU */
@@ -0,0 +1,417 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/* The offload arena, see nb_verlet_offload_arena.h. The arena is carved
+ * up first-fit, with a sorted list of free extents that are merged with
+ * their neighbours on free. Each allocation is preceded by a header of
+ * OFFLOAD_ARENA_ALIGN bytes that stores its size. Pair lists and atom
+ * data are only reallocated when they grow, so the allocation rate is low
+ * and a single lock is sufficient. When no extent is large enough, a chunk
+ * is added. The offsets of a chunk start OFFLOAD_ARENA_CHUNK_GAP after the
+ * end of the previous one, so extents of different chunks are never
+ * merged.
+ */
+#include "gmxpre.h"
+
+#include "nb_verlet_offload_arena.h"
+
+#include "config.h"
+
+#include <stdlib.h>
+
+#include "thread_mpi/threads.h"
+
+#include "gromacs/utility/fatalerror.h"
+#include "gromacs/utility/smalloc.h"
+
+/* The alignment of the allocations, also the size of their header */
+#define OFFLOAD_ARENA_ALIGN       64
+/* The default minimum size of a chunk in MB */
+#define OFFLOAD_ARENA_DEFAULT_MB  64
+/* The offset gap between chunks, at least two allocation units */
+#define OFFLOAD_ARENA_CHUNK_GAP   4096
+
+/* A free range of the arena */
+typedef struct {
+    size_t offset;
+    size_t size;
+} arena_extent_t;
+
+static offload_arena_map_t  arena_map;                /* The chunks of the arena */
+static size_t               arena_size        = 0;    /* The total size of the chunks */
+static size_t               arena_chunk_min   = (size_t)OFFLOAD_ARENA_DEFAULT_MB << 20;
+static int                  arena_nref        = 0;
+static arena_extent_t      *arena_free        = NULL; /* Free extents, sorted by offset */
+static int                  arena_nfree       = 0;
+static int                  arena_free_nalloc = 0;
+static size_t               arena_used        = 0;
+static size_t               arena_used_max    = 0;
+static tMPI_Thread_mutex_t  arena_mtx         = TMPI_THREAD_MUTEX_INITIALIZER;
+
+void offload_arena_init(FILE *fplog)
+{
+    char *env;
+    long  size_mb;
+
+    size_mb = OFFLOAD_ARENA_DEFAULT_MB;
+    env     = getenv("GMX_OFFLOAD_ARENA_SIZE");
+    if (env != NULL)
+    {
+        size_mb = strtol(env, NULL, 10);
+        if (size_mb <= 0)
+        {
+            gmx_fatal(FARGS, "GMX_OFFLOAD_ARENA_SIZE should be a positive number of MB, not '%s'", env);
+        }
+    }
+    tMPI_Thread_mutex_lock(&arena_mtx);
+    arena_chunk_min = (size_t)size_mb << 20;
+    tMPI_Thread_mutex_unlock(&arena_mtx);
+
+    if (fplog != NULL)
+    {
+        fprintf(fplog, "Allocating the offloaded non-bonded data in an arena that grows in chunks of at least %ld MB\n",
+                size_mb);
+    }
+}
+
+void offload_arena_retain(void)
+{
+    tMPI_Thread_mutex_lock(&arena_mtx);
+    arena_nref++;
+    tMPI_Thread_mutex_unlock(&arena_mtx);
+}
+
+void offload_arena_release(void)
+{
+    int c;
+
+    tMPI_Thread_mutex_lock(&arena_mtx);
+    arena_nref--;
+    if (arena_nref == 0)
+    {
+        if (debug)
+        {
+            fprintf(debug, "Freeing the offload arena of %lu bytes in %d chunks, at most %lu bytes were used\n",
+                    (unsigned long)arena_size, arena_map.nchunk,
+                    (unsigned long)arena_used_max);
+        }
+        for (c = 0; c < arena_map.nchunk; c++)
+        {
+            sfree_aligned(arena_map.chunk[c].base);
+        }
+        arena_map.nchunk = 0;
+        arena_size       = 0;
+        arena_nfree      = 0;
+        arena_used       = 0;
+        arena_used_max   = 0;
+    }
+    tMPI_Thread_mutex_unlock(&arena_mtx);
+}
+
+void offload_arena_get_map(offload_arena_map_t *map)
+{
+    tMPI_Thread_mutex_lock(&arena_mtx);
+    *map = arena_map;
+    tMPI_Thread_mutex_unlock(&arena_mtx);
+}
+
+gmx_offload
+char *offload_arena_map_ptr(const offload_arena_map_t *map, size_t offset)
+{
+    int c;
+
+    for (c = 0; c < map->nchunk; c++)
+    {
+        if (offset >= map->chunk[c].offset &&
+            offset <  map->chunk[c].offset + map->chunk[c].size)
+        {
+            return map->chunk[c].base + (offset - map->chunk[c].offset);
+        }
+    }
+    gmx_incons("An offset beyond the chunks of the offload arena was used");
+
+    return NULL;
+}
+
+size_t offload_arena_offset(const void *p)
+{
+    const char *ptr = (const char *)p;
+    size_t      offset;
+    int         c;
+
+    tMPI_Thread_mutex_lock(&arena_mtx);
+    for (c = 0; c < arena_map.nchunk; c++)
+    {
+        const offload_arena_chunk_t *chunk = &arena_map.chunk[c];
+
+        if (ptr >= chunk->base && ptr < chunk->base + chunk->size)
+        {
+            offset = chunk->offset + (size_t)(ptr - chunk->base);
+            tMPI_Thread_mutex_unlock(&arena_mtx);
+
+            return offset;
+        }
+    }
+    tMPI_Thread_mutex_unlock(&arena_mtx);
+
+    gmx_incons("Offloaded non-bonded data is not in the offload arena");
+
+    return 0;
+}
+
+/* The host address of offset in the arena, call with arena_mtx locked */
+static char *arena_ptr(size_t offset)
+{
+    return offload_arena_map_ptr(&arena_map, offset);
+}
+
+/* Add a chunk of at least n bytes to the arena and append its free extent,
+ * call with arena_mtx locked.
+ */
+static void arena_add_chunk(size_t n)
+{
+    offload_arena_chunk_t *chunk;
+    size_t                 size;
+
+    if (arena_map.nchunk == OFFLOAD_ARENA_MAX_CHUNKS)
+    {
+        tMPI_Thread_mutex_unlock(&arena_mtx);
+        gmx_fatal(FARGS, "The offload arena of %lu MB can not grow further, %lu bytes were requested",
+                  (unsigned long)(arena_size >> 20), (unsigned long)n);
+    }
+
+    /* Growing by at least the current size keeps the number of chunks low */
+    size = arena_chunk_min;
+    if (size < arena_size)
+    {
+        size = arena_size;
+    }
+    if (size < n)
+    {
+        size = n;
+    }
+    size = (size + OFFLOAD_ARENA_CHUNK_GAP - 1)/OFFLOAD_ARENA_CHUNK_GAP*OFFLOAD_ARENA_CHUNK_GAP;
+
+    chunk = &arena_map.chunk[arena_map.nchunk];
+    if (arena_map.nchunk == 0)
+    {
+        chunk->offset = 0;
+    }
+    else
+    {
+        chunk->offset = chunk[-1].offset + chunk[-1].size + OFFLOAD_ARENA_CHUNK_GAP;
+    }
+    chunk->size = size;
+    /* The chunk is not cleared, so the system only backs the pages that
+     * are actually used with memory.
+     */
+    chunk->base = (char *)save_malloc_aligned("chunk", __FILE__, __LINE__,
+                                              size, 1, 4096);
+    arena_map.nchunk++;
+    arena_size += size;
+
+    /* The chunk comes after all existing extents */
+    if (arena_nfree == arena_free_nalloc)
+    {
+        arena_free_nalloc = (arena_free_nalloc == 0) ? 16 : 2*arena_free_nalloc;
+        srenew(arena_free, arena_free_nalloc);
+    }
+    arena_free[arena_nfree].offset = chunk->offset;
+    arena_free[arena_nfree].size   = size;
+    arena_nfree++;
+
+    if (debug)
+    {
+        fprintf(debug, "Added a chunk of %lu bytes to the offload arena, which now has %d chunks\n",
+                (unsigned long)size, arena_map.nchunk);
+    }
+}
+
+static int range_comp(const void *a, const void *b)
+{
+    size_t oa = ((const offload_range_t *)a)->offset;
+    size_t ob = ((const offload_range_t *)b)->offset;
+
+    return (oa < ob) ? -1 : (oa > ob);
+}
+
+int offload_arena_merge_ranges(offload_range_t *ranges, int n)
+{
+    int i, m;
+
+    qsort(ranges, n, sizeof(*ranges), range_comp);
+
+    m = 0;
+    for (i = 0; i < n; i++)
+    {
+        if (ranges[i].size == 0)
+        {
+            continue;
+        }
+        /* An allocation with data takes at least two units, so a gap
+         * of less than that only holds padding and a header.
+         */
+        if (m > 0 &&
+            ranges[i].offset < ranges[m - 1].offset + ranges[m - 1].size + 2*OFFLOAD_ARENA_ALIGN)
+        {
+            size_t end = ranges[i].offset + ranges[i].size;
+
+            if (end > ranges[m - 1].offset + ranges[m - 1].size)
+            {
+                ranges[m - 1].size = end - ranges[m - 1].offset;
+            }
+        }
+        else
+        {
+            ranges[m++] = ranges[i];
+        }
+    }
+
+    return m;
+}
+
+void nbnxn_offload_arena_alloc(void **ptr, size_t nbytes)
+{
+    size_t n;
+    int    e;
+
+    n = ((nbytes + OFFLOAD_ARENA_ALIGN - 1)/OFFLOAD_ARENA_ALIGN + 1)*OFFLOAD_ARENA_ALIGN;
+
+    tMPI_Thread_mutex_lock(&arena_mtx);
+    for (e = 0; e < arena_nfree && arena_free[e].size < n; e++)
+    {
+        ;
+    }
+    if (e == arena_nfree)
+    {
+        arena_add_chunk(n);
+        e = arena_nfree - 1;
+    }
+
+    *(size_t *)arena_ptr(arena_free[e].offset) = n;
+    *ptr = arena_ptr(arena_free[e].offset) + OFFLOAD_ARENA_ALIGN;
+
+    arena_free[e].offset += n;
+    arena_free[e].size   -= n;
+    if (arena_free[e].size == 0)
+    {
+        arena_nfree--;
+        for (; e < arena_nfree; e++)
+        {
+            arena_free[e] = arena_free[e + 1];
+        }
+    }
+    arena_used += n;
+    if (arena_used > arena_used_max)
+    {
+        arena_used_max = arena_used;
+        if (debug)
+        {
+            fprintf(debug, "Offload arena use: %lu bytes\n", (unsigned long)arena_used_max);
+        }
+    }
+    tMPI_Thread_mutex_unlock(&arena_mtx);
+}
+
+void nbnxn_offload_arena_free(void *ptr)
+{
+    size_t offset, n;
+    int    lo, hi, e;
+
+    if (ptr == NULL)
+    {
+        return;
+    }
+    offset = offload_arena_offset(ptr) - OFFLOAD_ARENA_ALIGN;
+
+    tMPI_Thread_mutex_lock(&arena_mtx);
+    n      = *(size_t *)arena_ptr(offset);
+    /* Find the first free extent after the block */
+    lo = 0;
+    hi = arena_nfree;
+    while (lo < hi)
+    {
+        int mid = (lo + hi)/2;
+
+        if (arena_free[mid].offset < offset)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    e = lo;
+
+    if (e > 0 && arena_free[e - 1].offset + arena_free[e - 1].size == offset)
+    {
+        /* Merge with the preceding extent, and possibly the next one */
+        arena_free[e - 1].size += n;
+        if (e < arena_nfree &&
+            arena_free[e - 1].offset + arena_free[e - 1].size == arena_free[e].offset)
+        {
+            arena_free[e - 1].size += arena_free[e].size;
+            arena_nfree--;
+            for (; e < arena_nfree; e++)
+            {
+                arena_free[e] = arena_free[e + 1];
+            }
+        }
+    }
+    else if (e < arena_nfree && offset + n == arena_free[e].offset)
+    {
+        arena_free[e].offset  = offset;
+        arena_free[e].size   += n;
+    }
+    else
+    {
+        int i;
+
+        if (arena_nfree == arena_free_nalloc)
+        {
+            arena_free_nalloc = (arena_free_nalloc == 0) ? 16 : 2*arena_free_nalloc;
+            srenew(arena_free, arena_free_nalloc);
+        }
+        for (i = arena_nfree; i > e; i--)
+        {
+            arena_free[i] = arena_free[i - 1];
+        }
+        arena_free[e].offset = offset;
+        arena_free[e].size   = n;
+        arena_nfree++;
+    }
+    arena_used -= n;
+    tMPI_Thread_mutex_unlock(&arena_mtx);
+}
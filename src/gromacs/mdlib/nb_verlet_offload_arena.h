@@ -0,0 +1,149 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+#ifndef GMX_OFFLOAD_ARENA_HEADER
+#define GMX_OFFLOAD_ARENA_HEADER
+
+/* The offload arena: an offset-addressed memory region that holds the
+ * pair-list and atom data arrays of all PP ranks in this process that
+ * offload their non-bonded work. The arrays are allocated in the arena
+ * through the nbnxn_alloc_t and nbnxn_free_t hooks of the pair lists and
+ * the atom data. An offload target keeps a mirror of the arena, so arrays
+ * are transferred as byte ranges to the same offset in the mirror and used
+ * there in place, without packing them into the input packet.
+ * The arena grows in chunks, which are separate allocations that each
+ * cover their own range of offsets, the mirrors follow chunk by chunk.
+ * No allocation spans two chunks.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A byte range in the offload arena */
+typedef struct offload_range_t {
+    size_t offset;
+    size_t size;
+} offload_range_t;
+
+/* The maximum number of chunks of the arena. Each new chunk is at least
+ * as large as all earlier chunks together, so this is never reached.
+ */
+#define OFFLOAD_ARENA_MAX_CHUNKS 32
+
+/* A chunk of the arena, the offsets offset up to offset + size are at base */
+typedef struct offload_arena_chunk_t {
+    size_t offset;
+    size_t size;
+    char  *base;
+} offload_arena_chunk_t;
+
+/* The chunks of the arena, or of a mirror of it on an offload target */
+typedef struct offload_arena_map_t {
+    int                   nchunk;
+    offload_arena_chunk_t chunk[OFFLOAD_ARENA_MAX_CHUNKS];
+} offload_arena_map_t;
+
+/*
+ * Set up the offload arena of this process. The memory is only allocated
+ * when arrays are allocated in the arena, in chunks of at least the size
+ * in MB set with the environment variable GMX_OFFLOAD_ARENA_SIZE.
+ * Each PP rank that offloads holds a reference to the arena with
+ * offload_arena_retain.
+ */
+void offload_arena_init(FILE *fplog);
+
+/*
+ * Take a reference to the arena, released with offload_arena_release.
+ */
+void offload_arena_retain(void);
+
+/*
+ * Release a reference to the arena. The release of the last reference
+ * frees the arena, the arrays allocated in it should no longer be used.
+ * The mirrors of the arena should be freed before this.
+ */
+void offload_arena_release(void);
+
+/*
+ * Copy the current chunks of the arena to map. This is thread-safe.
+ */
+void offload_arena_get_map(offload_arena_map_t *map);
+
+/*
+ * Return the address of offset in the chunks of map, which is the arena
+ * or a mirror of it. The offset should be in one of the chunks.
+ */
+gmx_offload
+char *offload_arena_map_ptr(const offload_arena_map_t *map, size_t offset);
+
+/*
+ * Return the offset of p in the arena. p should point into the arena.
+ */
+size_t offload_arena_offset(const void *p);
+
+/*
+ * Sort the n ranges by offset and merge ranges that overlap or that are
+ * separated by less than two allocation units. Such a gap can not hold
+ * a whole allocation with data, only padding, headers and the parts of
+ * arrays that are only partly in a range. Transferring the merged ranges
+ * therefore refreshes at most such parts in a mirror beyond what was
+ * asked. The offsets of different chunks are further apart, so merged
+ * ranges stay within one chunk. Zero-size ranges are removed. Returns
+ * the number of ranges left.
+ */
+int offload_arena_merge_ranges(offload_range_t *ranges, int n);
+
+/*
+ * Allocate nbytes in the arena, aligned for the non-bonded kernels,
+ * with the signature of nbnxn_alloc_t. When no free range is large
+ * enough, a chunk is added to the arena. This is thread-safe.
+ */
+void nbnxn_offload_arena_alloc(void **ptr, size_t nbytes);
+
+/*
+ * Free memory allocated with nbnxn_offload_arena_alloc, with the signature
+ * of nbnxn_free_t. This is thread-safe.
+ */
+void nbnxn_offload_arena_free(void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  /* GMX_OFFLOAD_ARENA_HEADER */
@@ -0,0 +1,315 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+#ifndef GMX_OFFLOAD_BACKEND_HEADER
+#define GMX_OFFLOAD_BACKEND_HEADER
+
+/* Internal interface between the offload driver in nb_verlet_simd_offload.c
+ * and the backends that move packets to an offload target and run the
+ * non-bonded work there. Only the offload code should include this file.
+ */
+
+#include "config.h"
+
+#include <stddef.h>
+
+#include "gromacs/legacyheaders/types/commrec.h"
+#include "gromacs/legacyheaders/types/interaction_const.h"
+#include "gromacs/mdlib/nb_verlet_offload_arena.h"
+#include "gromacs/mdlib/nbnxn_pairlist.h"
+#include "gromacs/topology/block.h"
+#include "gromacs/utility/basedefinitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Offloads are issued on one stream per non-bonded locality, indexed by
+ * eintLocal and eintNonlocal. A target executes the launches of all streams
+ * in the order they were issued, the streams only differ in the pair list
+ * they use and in what the host waits for.
+ */
+#define OFFLOAD_NUM_STREAMS 2
+
+/* The maximum number of chunks the forces are returned in */
+#define OFFLOAD_MAX_F_CHUNKS 16
+
+/* Buffers of a stream that are kept resident on the offload target */
+enum {
+    eodlNBL_LISTS, eodlNBL, eodlVC, eodlVVDW, eodlNR
+};
+
+/* The pair list and energy output of one stream on the offload target.
+ * The list arrays are not copied here, they point into the arena mirror.
+ */
+typedef struct offload_device_list_t {
+    nbnxn_pairlist_set_t *nbl_lists;
+    nbnxn_pairlist_t     *nbl_buffer;
+    real                 *Vc;
+    real                 *Vvdw;
+    size_t                buffer_sizes[eodlNR];
+    /* The pair lists built on the target, used instead of the above
+     * when the pair search runs on the target
+     */
+    gmx_bool              bSearchLists;
+    nbnxn_pairlist_set_t  search_lists;
+} offload_device_list_t;
+
+/* The search parameters sent with a launch that builds its pair lists on
+ * the target. The local launch of a pair-list step also sends the grids,
+ * the atom order and the exclusions, the non-local launch reuses these.
+ */
+typedef struct offload_search_t {
+    int      ePBC;
+    matrix   box;
+    gmx_bool DomDec;
+    ivec     dd_dim;
+    int      ngrid;           /* The number of grids sent, 0 with the non-local launch */
+    int      natoms_local;
+    int      natoms_nonlocal;
+    int      excl_nr;
+    real     rlist;
+    int      min_ci_balanced;
+} offload_search_t;
+
+/* The arrays of a search grid sent along with the grid struct */
+enum {
+    eosgCXY_NA, eosgCXY_IND, eosgCXY_XY, eosgXY_CXY, eosgNSUBC, eosgBBCZ, eosgBB,
+    eosgBBJ, eosgFLAGS, eosgNR
+};
+
+/* The copy of the search grid arrays on the target */
+typedef struct offload_device_grid_t {
+    void  *buf[eosgNR];
+    size_t size[eosgNR];
+} offload_device_grid_t;
+
+/* Search buffers that are kept resident on the offload target */
+enum {
+    eodsZONES, eodsCELL, eodsA, eodsEXCL_INDEX, eodsEXCL_A, eodsNR
+};
+
+/* The pair-search state on the target, only used when the pair lists are
+ * built there. The grid structs and their arrays are copies of the host
+ * grids, the search work data only exists here.
+ */
+typedef struct offload_device_search_t {
+    nbnxn_search_t         nbs;
+    offload_device_grid_t *grid;
+    int                    grid_nalloc;
+    gmx_domdec_zones_t    *zones;
+    t_blocka               excl;
+    void                  *buf[eodsNR];
+    size_t                 buffer_sizes[eodsNR];
+    nbnxn_buffer_flags_t   buffer_flags; /* The flags of the lists built here */
+} offload_device_search_t;
+
+/* Atom data buffers that are kept resident on the offload target */
+enum {
+    eodbNBAT, eodbBUFFER_FLAGS, eodbIC,
+    eodbDIAG, eodbFILTER1, eodbFILTER2,
+    eodbTABQ_COUL_F, eodbTABQ_COUL_V, eodbTABQ_COUL_FDV0, eodbTABCS, eodbNR
+};
+
+/* The atom data arrays in the offload arena, their offsets are sent with
+ * every launch. The parameters are only transferred when the pair list
+ * has been refreshed, the shift vectors only then or with a dynamic box.
+ * The coordinates are transferred with every launch.
+ */
+enum {
+    eoaNBFP, eoaNBFP_COMB, eoaNBFP_S4, eoaTYPE, eoaLJ_COMB, eoaQ,
+    eoaENERGRP, eoaSHIFT_VEC, eoaX, eoaNR
+};
+
+/* The pair-list arrays in the offload arena, their offsets are sent for
+ * each list of a stream when the pair list has been refreshed.
+ * With compressed lists only the compressed j-lists are transferred.
+ */
+enum {
+    eoalCI, eoalSCI, eoalCJ, eoalCJ4, eoalCIC, eoalCJC, eoalCJC_EXCL, eoalNR
+};
+
+/* Data that stays resident on the offload target between offloads.
+ * The pair lists, the atom data parameters and the interaction constants
+ * are only sent when the pair list has been refreshed, the shift vectors
+ * only then or with a dynamic box. In all other steps only the coordinates
+ * are sent and the copies here are used. The atom data parameters are sent
+ * with the local stream, each stream sends the coordinates of its own
+ * atom range: the home atoms for the local stream, the halo atoms for
+ * the non-local stream. The pair-list and atom data arrays live in the
+ * offload arena and are used in place in the mirror of the arena, only
+ * the structs that point to them are sent in the input packet.
+ * Each PP rank has its own device state, also when several ranks share
+ * a device.
+ */
+typedef struct offload_device_state_t {
+    offload_arena_map_t   arena;          /* The chunks of the mirror of the offload
+                                           * arena, added by the backend before the
+                                           * launch that first uses them             */
+    offload_device_list_t list[OFFLOAD_NUM_STREAMS];
+    nbnxn_atomdata_t     *nbat;
+    gmx_bitmask_t        *buffer_flags;
+    interaction_const_t  *ic;
+    real                 *diag_buffer;    /* The diagonal masks of the kernel type in use and
+                                           * the exclusion masks, set up on the host for the
+                                           * target width */
+    unsigned int         *filter1_buffer;
+    unsigned int         *filter2_buffer;
+    real                 *tabq_coul_F;    /* The Ewald correction tables, only sent when */
+    real                 *tabq_coul_V;    /* the kernels use them                        */
+    real                 *tabq_coul_FDV0;
+    real                 *tabcs_data;     /* The cubic spline table for user potentials  */
+    size_t                buffer_sizes[eodbNR];
+    /* The thread force and energy output buffers, these only exist here */
+    nbnxn_atomdata_output_t *out;
+    int                      out_nalloc;  /* Allocation size of out[].f in atoms */
+    offload_device_search_t  search;
+} offload_device_state_t;
+
+/* The arguments of one offload. First the nrange byte ranges of the
+ * offload arena are transferred to the same offsets in the mirror of
+ * the arena on the target, which first gets the chunks that were added
+ * to the arena since the last launch, then the input packet is transferred from
+ * cpu_out_packet to dev_in_packet, the output packet from dev_out_packet
+ * back to cpu_in_packet. The dev_ pointers are addresses on the target.
+ * The output packet is returned in parts: first the head, the f_offset
+ * bytes with the energies and shift forces, then, with bReduceF, the
+ * forces in nf_chunk chunks of f_chunk_size bytes, the last one shorter.
+ * Each force chunk is packed and sent as soon as the previous one is on
+ * its way, so the host can add the chunks that arrived to its force
+ * buffer while the later ones are in transfer.
+ */
+typedef struct offload_launch_t {
+    int                    stream;
+    const offload_range_t *ranges;
+    int                    nrange;
+    char                  *cpu_out_packet;
+    char                  *dev_in_packet;
+    size_t                 in_size;
+    char                  *dev_out_packet;
+    char                  *cpu_in_packet;
+    size_t                 out_size;
+    int                    kernel_type;
+    int                    flags;
+    int                    clearF;
+    int                    ewald_excl;
+    /* Reduce and return the forces and shift forces. Only the last launch
+     * of a step does this, earlier launches only return energies.
+     */
+    gmx_bool               bReduceF;
+    size_t                 f_offset;
+    size_t                 f_chunk_size;
+    int                    nf_chunk;
+    /* Backends that do the transfers themselves store the in and out
+     * transfer times of the launch here, in ms, before the last part of
+     * the output packet arrives. Others leave these untouched.
+     */
+    double                *xfer_t;
+} offload_launch_t;
+
+/* The byte range in the output packet of force chunk chunk of launch */
+static gmx_inline void offload_f_chunk_range(const offload_launch_t *launch, int chunk,
+                                             size_t *offset, size_t *len)
+{
+    *offset = launch->f_offset + chunk*launch->f_chunk_size;
+    *len    = launch->out_size - *offset;
+    if (*len > launch->f_chunk_size)
+    {
+        *len = launch->f_chunk_size;
+    }
+}
+
+/* An offload backend. All transfers and the device computation of a launch
+ * run asynchronously to the caller, wait blocks until the head of the
+ * output packet of the last launch on a stream has arrived in host memory,
+ * wait_f_chunk until force chunk chunk of that launch has arrived.
+ * All calls except num_devices take the context returned by init, which
+ * holds the device state of one PP rank on one device, finalize releases
+ * the context.
+ */
+typedef struct offload_backend_t {
+    const char  *name;
+    /* The number of offload devices in this node */
+    int        (*num_devices)(void);
+    /* Create the context of a PP rank for offloading to device */
+    void      *(*init)(int device);
+    /* Allocate s bytes on the host and a mirror of s bytes on the target,
+     * the address of the mirror is returned in *dev_ptr.
+     */
+    void      *(*mirror_alloc)(void *ctx, size_t s, void **dev_ptr);
+    void       (*mirror_free)(void *ctx, void *p, void *dev_ptr);
+    void       (*launch)(void *ctx, const offload_launch_t *launch);
+    void       (*wait)(void *ctx, int stream);
+    void       (*wait_f_chunk)(void *ctx, int stream, int chunk);
+    /* Stop the device work of ctx, after the launches issued have
+     * completed, and free ctx and its mirror of the offload arena.
+     */
+    void       (*finalize)(void *ctx);
+    /* The SIMD width of the non-bonded kernels on the target */
+    int          simd_width;
+} offload_backend_t;
+
+/* The work done on the offload target for one launch on stream: unpack
+ * the input packet into the resident state dev, run the SIMD kernel,
+ * with bReduceF reduce the thread force and shift-force buffers, and pack
+ * the head of the output packet. The energies in the output packet are only
+ * the contributions of this launch, the host adds them to its energy terms.
+ */
+gmx_offload
+void offload_device_compute(offload_device_state_t *dev, int stream,
+                            char *in_packet, char *out_packet,
+                            int kernel_type, int flags, int clearF,
+                            int ewald_excl, gmx_bool bReduceF);
+
+/* Pack the len bytes of the reduced forces that go at offset in the output
+ * packet, which has the forces starting at f_offset.
+ */
+gmx_offload
+void offload_device_pack_f(offload_device_state_t *dev, char *out_packet,
+                           size_t f_offset, size_t offset, size_t len);
+
+#ifdef GMX_OFFLOAD
+/* Backend for an Intel Xeon Phi coprocessor, using the offload pragmas */
+extern const offload_backend_t offload_backend_mic;
+#else
+/* Backend that runs the offloaded work on a dedicated host thread,
+ * with separately allocated "device" memory, see nb_verlet_offload_loopback.c
+ */
+extern const offload_backend_t offload_backend_loopback;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif  /* GMX_OFFLOAD_BACKEND_HEADER */
@@ -0,0 +1,351 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+
+/* The loopback offload target. It implements the offload protocol of
+ * nb_verlet_simd_offload.c on the host: packets are copied between host and
+ * separately allocated "device" buffers, and the device work runs on a
+ * dedicated thread with its own OpenMP thread pool. Each rank context has
+ * its own mirror of the offload arena, the arena ranges of a launch are
+ * copied there before the input packet, after allocating the mirror of
+ * chunks that were added to the arena. This makes it possible to run,
+ * test and profile the complete offload path, including packing,
+ * transfers, overlap and the remote force reduction, without a coprocessor.
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "thread_mpi/threads.h"
+
+#include "gromacs/legacyheaders/gmx_omp_nthreads.h"
+#include "gromacs/mdlib/nb_verlet_offload_backend.h"
+#include "gromacs/timing/walltime_accounting.h"
+#include "gromacs/utility/fatalerror.h"
+#include "gromacs/utility/gmxomp.h"
+#include "gromacs/utility/smalloc.h"
+
+#ifndef GMX_OFFLOAD
+
+#include "gromacs/mdlib/nbnxn_simd.h"
+
+/* The loopback target runs the host SIMD kernels, 4xN or 2xNN */
+#ifdef GMX_NBNXN_SIMD
+#define LOOPBACK_SIMD_WIDTH GMX_SIMD_REAL_WIDTH
+#else
+#define LOOPBACK_SIMD_WIDTH 0
+#endif
+
+/* The context of a PP rank on a loopback device, shared between the host
+ * (caller) thread and the loopback thread of the rank, protected by mtx.
+ * Launches are queued and executed in issue order, at most one per stream
+ * is in flight. Every rank has its own loopback thread, ranks that map to
+ * the same device only share the cores it is pinned to.
+ */
+typedef struct {
+    int                    device;
+    tMPI_Thread_t          thread;
+    tMPI_Thread_mutex_t    mtx;
+    tMPI_Thread_cond_t     cond;
+    gmx_bool               bStarted;    /* The loopback thread is running       */
+    gmx_bool               bStop;       /* Exit the thread when the queue is empty */
+    int                    pin_offset;  /* First core to pin to, -1: no pinning */
+    int                    queue[OFFLOAD_NUM_STREAMS]; /* Streams with a pending launch, in issue order */
+    int                    nqueued;     /* The number of pending launches       */
+    gmx_bool               bBusy[OFFLOAD_NUM_STREAMS]; /* Launch pending or running */
+    int                    nready[OFFLOAD_NUM_STREAMS]; /* Parts of the output packet that
+                                                         * arrived: 1 for the head, plus
+                                                         * the force chunks      */
+    offload_launch_t       launch[OFFLOAD_NUM_STREAMS]; /* The last launch per stream */
+    offload_device_state_t dev;         /* Data resident on the "device"        */
+} loopback_t;
+
+/* Pin the OpenMP threads used by the loopback thread. The OpenMP runtime
+ * keeps a separate pool for each thread that starts parallel regions, so
+ * pinning once here pins the threads that later run the device work.
+ */
+static void loopback_pin_threads(int pin_offset)
+{
+    int nth = gmx_omp_nthreads_get(emntNonbonded);
+
+#pragma omp parallel num_threads(nth)
+    {
+        int core = pin_offset + gmx_omp_get_thread_num();
+
+        if (tMPI_Thread_setaffinity_single(tMPI_Thread_self(), core) != 0 &&
+            debug)
+        {
+            fprintf(debug, "Pinning loopback offload thread %d to core %d failed\n",
+                    gmx_omp_get_thread_num(), core);
+        }
+    }
+}
+
+/* Add the chunks of arena that mirror does not have yet to mirror */
+static void loopback_mirror_chunks(offload_arena_map_t *mirror, const offload_arena_map_t *arena)
+{
+    for (; mirror->nchunk < arena->nchunk; mirror->nchunk++)
+    {
+        offload_arena_chunk_t *chunk = &mirror->chunk[mirror->nchunk];
+
+        *chunk = arena->chunk[mirror->nchunk];
+        /* Like the arena itself, the mirror is only backed by memory where used */
+        chunk->base = (char *)save_malloc_aligned("chunk", __FILE__, __LINE__,
+                                                  chunk->size, 1, 4096);
+    }
+}
+
+static void *loopback_thread(void *arg)
+{
+    loopback_t         *lb = (loopback_t *)arg;
+    offload_launch_t    launch;
+    offload_arena_map_t arena;
+
+    if (lb->pin_offset >= 0)
+    {
+        loopback_pin_threads(lb->pin_offset);
+    }
+
+    tMPI_Thread_mutex_lock(&lb->mtx);
+    for (;; )
+    {
+        int    s, c, r;
+        double t0;
+
+        while (lb->nqueued == 0 && !lb->bStop)
+        {
+            tMPI_Thread_cond_wait(&lb->cond, &lb->mtx);
+        }
+        if (lb->nqueued == 0)
+        {
+            break;
+        }
+        launch = lb->launch[lb->queue[0]];
+        for (s = 1; s < lb->nqueued; s++)
+        {
+            lb->queue[s - 1] = lb->queue[s];
+        }
+        lb->nqueued--;
+        tMPI_Thread_mutex_unlock(&lb->mtx);
+
+        /* Transfer in, compute and transfer out, as a coprocessor would */
+        t0 = gmx_gettime();
+        offload_arena_get_map(&arena);
+        loopback_mirror_chunks(&lb->dev.arena, &arena);
+        for (r = 0; r < launch.nrange; r++)
+        {
+            memcpy(offload_arena_map_ptr(&lb->dev.arena, launch.ranges[r].offset),
+                   offload_arena_map_ptr(&arena, launch.ranges[r].offset),
+                   launch.ranges[r].size);
+        }
+        memcpy(launch.dev_in_packet, launch.cpu_out_packet, launch.in_size);
+        launch.xfer_t[0] = 1000*(gmx_gettime() - t0);
+        offload_device_compute(&lb->dev, launch.stream,
+                               launch.dev_in_packet, launch.dev_out_packet,
+                               launch.kernel_type, launch.flags, launch.clearF,
+                               launch.ewald_excl, launch.bReduceF);
+        t0 = gmx_gettime();
+        memcpy(launch.cpu_in_packet, launch.dev_out_packet, launch.f_offset);
+        launch.xfer_t[1] = 1000*(gmx_gettime() - t0);
+
+        tMPI_Thread_mutex_lock(&lb->mtx);
+        lb->nready[launch.stream] = 1;
+        tMPI_Thread_cond_broadcast(&lb->cond);
+
+        for (c = 0; c < launch.nf_chunk; c++)
+        {
+            size_t offset, len;
+
+            tMPI_Thread_mutex_unlock(&lb->mtx);
+            offload_f_chunk_range(&launch, c, &offset, &len);
+            offload_device_pack_f(&lb->dev, launch.dev_out_packet,
+                                  launch.f_offset, offset, len);
+            t0 = gmx_gettime();
+            memcpy(launch.cpu_in_packet + offset, launch.dev_out_packet + offset, len);
+            launch.xfer_t[1] += 1000*(gmx_gettime() - t0);
+            tMPI_Thread_mutex_lock(&lb->mtx);
+            lb->nready[launch.stream] = 2 + c;
+            tMPI_Thread_cond_broadcast(&lb->cond);
+        }
+        lb->bBusy[launch.stream] = FALSE;
+        tMPI_Thread_cond_broadcast(&lb->cond);
+    }
+    tMPI_Thread_mutex_unlock(&lb->mtx);
+
+    return NULL;
+}
+
+/* The number of loopback devices is set by a positive value of
+ * GMX_OFFLOAD_LOOPBACK, there is one device by default.
+ */
+static int loopback_num_devices()
+{
+    char *env = getenv("GMX_OFFLOAD_LOOPBACK");
+    int   ndev;
+
+    ndev = (env != NULL) ? strtol(env, NULL, 10) : 0;
+
+    return (ndev > 0) ? ndev : 1;
+}
+
+static void *loopback_init(int device)
+{
+    loopback_t *lb;
+
+    snew(lb, 1);
+    lb->device     = device;
+    lb->pin_offset = -1;
+    tMPI_Thread_mutex_init(&lb->mtx);
+    tMPI_Thread_cond_init(&lb->cond);
+
+    return lb;
+}
+
+/* Host and "device" buffers are separate allocations, so the packets
+ * really have to be transferred, as with a coprocessor.
+ */
+static void *loopback_mirror_alloc(void gmx_unused *ctx, size_t s, void **dev_ptr)
+{
+    char *p, *dev;
+
+    snew_aligned(p, s, 64);
+    snew_aligned(dev, s, 64);
+    *dev_ptr = dev;
+
+    return p;
+}
+
+static void loopback_mirror_free(void gmx_unused *ctx, void *p, void *dev_ptr)
+{
+    sfree_aligned(dev_ptr);
+    sfree_aligned(p);
+}
+
+static void loopback_launch(void *ctx, const offload_launch_t *launch)
+{
+    loopback_t *lb = (loopback_t *)ctx;
+
+    tMPI_Thread_mutex_lock(&lb->mtx);
+    if (!lb->bStarted)
+    {
+        char *env = getenv("GMX_OFFLOAD_LOOPBACK_PINOFFSET");
+
+        if (env != NULL)
+        {
+            /* Each device gets its own set of cores */
+            lb->pin_offset = strtol(env, NULL, 10) +
+                lb->device*gmx_omp_nthreads_get(emntNonbonded);
+        }
+        if (tMPI_Thread_create(&lb->thread, loopback_thread, lb) != 0)
+        {
+            gmx_fatal(FARGS, "Could not start the loopback offload thread");
+        }
+        lb->bStarted = TRUE;
+    }
+    /* There is at most one launch per stream in flight */
+    while (lb->bBusy[launch->stream])
+    {
+        tMPI_Thread_cond_wait(&lb->cond, &lb->mtx);
+    }
+    lb->launch[launch->stream] = *launch;
+    lb->bBusy[launch->stream]  = TRUE;
+    lb->nready[launch->stream] = 0;
+    lb->queue[lb->nqueued++]   = launch->stream;
+    tMPI_Thread_cond_broadcast(&lb->cond);
+    tMPI_Thread_mutex_unlock(&lb->mtx);
+}
+
+static void loopback_wait(void *ctx, int stream)
+{
+    loopback_t *lb = (loopback_t *)ctx;
+
+    tMPI_Thread_mutex_lock(&lb->mtx);
+    while (lb->nready[stream] < 1)
+    {
+        tMPI_Thread_cond_wait(&lb->cond, &lb->mtx);
+    }
+    tMPI_Thread_mutex_unlock(&lb->mtx);
+}
+
+static void loopback_wait_f_chunk(void *ctx, int stream, int chunk)
+{
+    loopback_t *lb = (loopback_t *)ctx;
+
+    tMPI_Thread_mutex_lock(&lb->mtx);
+    while (lb->nready[stream] < 2 + chunk)
+    {
+        tMPI_Thread_cond_wait(&lb->cond, &lb->mtx);
+    }
+    tMPI_Thread_mutex_unlock(&lb->mtx);
+}
+
+static void loopback_finalize(void *ctx)
+{
+    loopback_t *lb = (loopback_t *)ctx;
+    int         c;
+
+    tMPI_Thread_mutex_lock(&lb->mtx);
+    lb->bStop = TRUE;
+    tMPI_Thread_cond_broadcast(&lb->cond);
+    tMPI_Thread_mutex_unlock(&lb->mtx);
+    if (lb->bStarted && tMPI_Thread_join(lb->thread, NULL) != 0)
+    {
+        gmx_fatal(FARGS, "Could not stop the loopback offload thread");
+    }
+    tMPI_Thread_mutex_destroy(&lb->mtx);
+    tMPI_Thread_cond_destroy(&lb->cond);
+    for (c = 0; c < lb->dev.arena.nchunk; c++)
+    {
+        sfree_aligned(lb->dev.arena.chunk[c].base);
+    }
+    sfree(lb);
+}
+
+const offload_backend_t offload_backend_loopback = {
+    "loopback",
+    loopback_num_devices,
+    loopback_init,
+    loopback_mirror_alloc,
+    loopback_mirror_free,
+    loopback_launch,
+    loopback_wait,
+    loopback_wait_f_chunk,
+    loopback_finalize,
+    LOOPBACK_SIMD_WIDTH
+};
+
+#endif /* GMX_OFFLOAD */
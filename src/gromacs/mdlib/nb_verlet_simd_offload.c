@@ -34,65 +34,485 @@
  * To help us fund GROMACS development, we humbly ask that you cite
  * the research papers on the package. Check out http://www.gromacs.org.
  */
+#include "gmxpre.h"
+
+#include "config.h"
+
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
 #include <immintrin.h>
 #include "nbnxn_internal.h"
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
 #include "nbnxn_atomdata.h"
+#include "nbnxn_consts.h"
+#include "nbnxn_search.h"
 #include "nb_verlet.h"
 #include "nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn.h"
+#include "nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn.h"
 #include "gromacs/legacyheaders/gmx_omp_nthreads.h"
+#include "gromacs/legacyheaders/macros.h"
+#include "gromacs/legacyheaders/types/commrec.h"
+#include "gromacs/legacyheaders/types/force_flags.h"
 #include "gromacs/pbcutil/pbc.h"
+#include "gromacs/timing/offload_timing.h"
+#include "gromacs/utility/cstringutil.h"
+#include "gromacs/utility/fatalerror.h"
+#include "gromacs/utility/futil.h"
 #include "gromacs/utility/smalloc.h"
 #include "gromacs/math/vec.h"
 #include "nb_verlet_simd_offload.h"
+#include "nb_verlet_offload_arena.h"
+#include "nb_verlet_offload_backend.h"
 #include "packdata.h"
+#include "thread_mpi/threads.h"
+
+/* The offload target and backend are selected once per run, the
+ * device state is kept in the offload context of each PP rank.
+ */
+static int                      offload_target    = eoffloadNONE;
+static const offload_backend_t *backend           = NULL;
+
+/* The host share of the non-bonded work is kept within these bounds,
+ * below the minimum it is switched off.
+ */
+#define OFFLOAD_HOST_FRACTION_MIN  0.01
+#define OFFLOAD_HOST_FRACTION_MAX  0.9
+/* The host waits for the target when the wait is above this fraction
+ * of the time from the launch until the forces are back.
+ */
+#define OFFLOAD_BALANCE_WAIT_TOL   0.02
+/* Factor for the host share when the host finished last */
+#define OFFLOAD_BALANCE_BACKOFF    0.8
+
+/* The timings in the per-step offload trace */
+enum {
+    eotPACK, eotXFER_IN, eotKERNEL, eotREDUCE, eotXFER_OUT, eotWAIT, eotUNPACK, eotNR
+};
+
+static const char *eot_names[eotNR] = {
+    "pack", "xfer_in", "kernel", "reduce", "xfer_out", "wait", "unpack"
+};
+
+/* The default number of chunks the forces are returned in */
+#define OFFLOAD_DEFAULT_F_CHUNKS   4
+
+/* The buffers in the input packet. Buffers that are kept resident on the
+ * target are sent with size zero in steps where they did not change.
+ * The arrays of the pair lists and the atom data are not in the packet,
+ * they are transferred as ranges of the offload arena, the packet only
+ * holds their offsets in the arena.
+ */
+enum {
+    eoipNBL_LISTS, eoipNBL, eoipNBL_ARENA, eoipNBAT, eoipNBAT_ARENA,
+    eoipBUFFER_FLAGS, eoipIC, eoipDIAG, eoipFILTER1, eoipFILTER2,
+    eoipTABQ_COUL_F, eoipTABQ_COUL_V, eoipTABQ_COUL_FDV0, eoipTABCS,
+    eoipNENER, eoipNR
+};
+
+/* The offset sent for an array that is not allocated */
+#define OFFLOAD_ARENA_NONE ((size_t)-1)
+
+/* The search section follows the input packet buffers above when the pair
+ * search runs on the target: the search parameters, the eodsNR search
+ * buffers and, with the local launch of a pair-list step, eosgNR + 1
+ * buffers for each grid, its struct followed by its arrays.
+ */
 
-gmx_offload static gmx_bool bRefreshNbl         = TRUE;
-gmx_offload char           *phi_in_packet;
-gmx_offload char           *phi_out_packet;
-static float                off_signal = 0;
-gmx_offload static size_t   phi_buffer_sizes[9];
+/* The buffers in the output packet, the forces should come last */
+enum {
+    eoopFSHIFT, eoopVC, eoopVVDW, eoopTIMING, eoopNATPAIR, eoopF, eoopNR
+};
 
+typedef struct offload_unpack_data_struct
+{
+    char                 *out_packet_addr;
+    void                 *cpu_buffers[eoopNR];
+    /* The energy terms the returned energies are added to */
+    int                   nener;
+    real                 *Vc;
+    real                 *Vvdw;
+    /* The forces in the output packet, in nf_chunk chunks of natoms_f_chunk
+     * grid atoms. These are not unpacked, but added to f directly.
+     */
+    real                 *f;
+    int                   nf_chunk;
+    int                   natoms_f_chunk;
+    /* The lists the pair counts of a search on the target are stored in */
+    nbnxn_pairlist_set_t *natpair_lists;
+} offload_unpack_data;
+
+/* Host side state of an offload stream, there is one per locality */
+typedef struct offload_stream_struct
+{
+    gmx_bool             bRefreshNbl;     /* Send the pair list with the next launch */
+    /* The pair-list structs of the target part of the lists of the locality
+     * and the arena offsets of their arrays, eoalNR per list
+     */
+    int                  nbl_nalloc;
+    nbnxn_pairlist_t    *nbl_buffer;
+    size_t              *nbl_arena;
+    /* The arena offsets of the atom data arrays */
+    size_t               nbat_arena[eoaNR];
+    /* The arena ranges to transfer with the next launch */
+    offload_range_t     *ranges;
+    int                  nrange;
+    int                  range_nalloc;
+    /* The search to run on the target with the next launch */
+    gmx_bool             bSearch;
+    nbnxn_search_t       nbs;
+    const t_blocka      *excl;
+    offload_search_t     search;
+    /* The input packet buffers, the search section has a variable length */
+    packet_buffer       *ibuffers;
+    int                  ibuffer_nalloc;
+    int                  natpair[3];      /* Receive buffer for the pair counts */
+    /* The i-cluster ranges of the pair lists computed on the host, these
+     * views point into the ci and cj arrays of the lists of the locality.
+     */
+    nbnxn_pairlist_t    *host_nbl;
+    nbnxn_pairlist_t   **host_nbl_ptr;
+    nbnxn_pairlist_set_t host_lists;
+    int                  host_nci;
+    /* The input and output packets and their mirrors on the target */
+    char                *cpu_out_packet;
+    char                *dev_in_packet;
+    size_t               in_packet_size;
+    char                *cpu_in_packet;
+    char                *dev_out_packet;
+    size_t               out_packet_size;
+    /* Receive buffer for the Coulomb and VdW energies */
+    real                *V_buffer;
+    int                  V_nalloc;
+    offload_unpack_data  unpack_data;
+    /* Timings of the last launch in ms: the kernel and reduction times
+     * on the target, and the in and out transfer times from the backend
+     */
+    double               device_t[2];
+    double               xfer_t[2];
+    gmx_bool             bLaunched;   /* Launched in the current step */
+} offload_stream_t;
+
+/* The offload context of a PP rank */
+struct nbnxn_offload_t
+{
+    int                      device;        /* The offload device used by this rank   */
+    void                    *backend_ctx;   /* The backend context for device         */
+    offload_stream_t         streams[OFFLOAD_NUM_STREAMS];
+    int                      nf_chunk;      /* The number of chunks to return f in    */
+    /* The host share of the non-bonded work, the fraction of the j-clusters
+     * of each pair list computed by the host threads while the target works.
+     */
+    gmx_bool                 bTargetSearch; /* The pair lists are built on the target */
+    gmx_bool                 bHostShare;    /* The host can run the target pair lists */
+    gmx_bool                 bBalance;      /* Tune host_fraction at run time         */
+    double                   host_fraction;
+    nbnxn_atomdata_output_t *host_out;      /* Thread output of the host share        */
+    int                      host_nout;
+    int                      host_out_nalloc;
+    /* Cycle counts for balancing, summed over the steps since the last
+     * pair-list step: from the local launch until the forces are back,
+     * the host share kernels and the waits for the target.
+     */
+    gmx_cycles_t             cyc_launch;
+    gmx_cycles_t             cyc_ready;
+    double                   cyc_elapsed;
+    double                   cyc_host;
+    double                   cyc_wait;
+    int                      nstep_timed;
+    /* The offload timings of the current step in ms, the totals of the run
+     * and the per-step trace, which is written as CSV or as JSON lines.
+     */
+    double                   step_t[eotNR];
+    struct gmx_wallclock_offload_t timings;
+    FILE                    *fp_trace;
+    gmx_bool                 bTraceJSON;
+};
+
+#ifdef GMX_OFFLOAD
 #define REUSE alloc_if(0) free_if(0)
 #define ALLOC alloc_if(1) free_if(0)
 #define FREE  alloc_if(0) free_if(1)
 
-#define NUM_OFFLOAD_BUFFERS 21
+/* The context of a PP rank on a Xeon Phi */
+typedef struct {
+    int       device;
+    uintptr_t dev_state; /* Address of the rank's offload_device_state_t on the card */
+    float     signal[OFFLOAD_NUM_STREAMS];
+    float     f_signal[OFFLOAD_NUM_STREAMS][OFFLOAD_MAX_F_CHUNKS];
+    /* One signal per arena range of the last launch on a stream */
+    float    *range_signal[OFFLOAD_NUM_STREAMS];
+    int       nrange[OFFLOAD_NUM_STREAMS];
+    int       range_signal_nalloc[OFFLOAD_NUM_STREAMS];
+    int       nchunk;    /* The number of arena chunks known to dev_state */
+} mic_context_t;
 
-typedef struct offload_unpack_data_struct
+/* The chunks of the offload arena are mapped once on each card, the ranks
+ * of this process that share a card share the mappings. The mappings are
+ * removed when the last rank using the card finishes.
+ */
+static int                *mic_chunks_mapped = NULL;
+static int                *mic_device_nref   = NULL;
+static tMPI_Thread_mutex_t mic_arena_mtx     = TMPI_THREAD_MUTEX_INITIALIZER;
+
+static int mic_num_devices()
 {
-    char *out_packet_addr;
-    void *cpu_buffers[4];
-} offload_unpack_data;
+    return _Offload_number_of_devices();
+}
+
+static void *mic_init(int device)
+{
+    mic_context_t *mic;
+    uintptr_t      dev_state;
+    int            nth = gmx_omp_nthreads_get(emntNonbonded);
+
+    tMPI_Thread_mutex_lock(&mic_arena_mtx);
+    if (mic_chunks_mapped == NULL)
+    {
+        snew(mic_chunks_mapped, mic_num_devices());
+        snew(mic_device_nref, mic_num_devices());
+    }
+    mic_device_nref[device]++;
+    tMPI_Thread_mutex_unlock(&mic_arena_mtx);
+
+    // Nonbonded nthreads must agree on CPU and coprocessor because of
+    // shared data structures. The device state is allocated on the card,
+    // so that all ranks sharing a card have their own.
+#pragma offload target(mic:device) in(nth) out(dev_state)
+    {
+        offload_device_state_t *state;
 
-static offload_unpack_data unpack_data;
+        gmx_omp_nthreads_set(emntNonbonded, nth);
+        snew(state, 1);
+        dev_state = (uintptr_t)state;
+    }
+    snew(mic, 1);
+    mic->device    = device;
+    mic->dev_state = dev_state;
+
+    return mic;
+}
 
 // "Mirror" malloc with corresponding renew and free. Memory is allocated on both
 // host and coprocessor, and the two are linked to support offloading operations.
 
-void *mmalloc(size_t s, void *off_ptr)
+static void *mic_mirror_alloc(void *ctx, size_t s, void **off_ptr)
 {
+    int   device = ((mic_context_t *)ctx)->device;
     char *p;
     snew_aligned(p, s, 64);
     char *off_ptr_val;
-#pragma offload target(mic:0) nocopy(off_ptr_val:length(s) ALLOC preallocated targetptr)
+#pragma offload target(mic:device) nocopy(off_ptr_val:length(s) ALLOC preallocated targetptr)
     {
         snew_aligned(off_ptr_val, s, 64);
     }
-    *(void **)off_ptr = off_ptr_val;
+    *off_ptr = off_ptr_val;
     return p;
 }
 
-void mfree(void *p, void *off_ptr_val)
+static void mic_mirror_free(void *ctx, void *p, void *off_ptr_val)
 {
-    char *c = (char *)p;
-#pragma offload target(mic:0) nocopy(off_ptr_val:length(0) FREE preallocated targetptr)
+    int   device = ((mic_context_t *)ctx)->device;
+    char *c      = (char *)p;
+#pragma offload target(mic:device) nocopy(off_ptr_val:length(0) FREE preallocated targetptr)
     {
         sfree_aligned(off_ptr_val);
     }
     sfree_aligned(c);
 }
 
+// Map the chunks of the arena that were added since the last launch
+// on the card and add them to the arena mirror of the device state
+static void mic_map_chunks(mic_context_t *mic, const offload_arena_map_t *arena)
+{
+    int       device    = mic->device;
+    uintptr_t dev_state = mic->dev_state;
+
+    tMPI_Thread_mutex_lock(&mic_arena_mtx);
+    for (; mic_chunks_mapped[device] < arena->nchunk; mic_chunks_mapped[device]++)
+    {
+        char  *base = arena->chunk[mic_chunks_mapped[device]].base;
+        size_t size = arena->chunk[mic_chunks_mapped[device]].size;
+
+#pragma offload_transfer target(mic:device) nocopy(base:length(size) ALLOC)
+    }
+    tMPI_Thread_mutex_unlock(&mic_arena_mtx);
+
+    for (; mic->nchunk < arena->nchunk; mic->nchunk++)
+    {
+        int    c      = mic->nchunk;
+        char  *base   = arena->chunk[c].base;
+        size_t offset = arena->chunk[c].offset;
+        size_t size   = arena->chunk[c].size;
+
+#pragma offload target(mic:device) in(dev_state) in(c) in(offset) in(size) nocopy(base:length(0) REUSE)
+        {
+            offload_arena_map_t *mirror = &((offload_device_state_t *)dev_state)->arena;
+
+            mirror->chunk[c].offset = offset;
+            mirror->chunk[c].size   = size;
+            mirror->chunk[c].base   = base;
+            mirror->nchunk          = c + 1;
+        }
+    }
+}
+
+static void mic_launch(void *ctx, const offload_launch_t *launch)
+{
+    mic_context_t      *mic             = (mic_context_t *)ctx;
+    int                 device          = mic->device;
+    uintptr_t           dev_state       = mic->dev_state;
+    int                 stream          = launch->stream;
+    char               *cpu_out_packet  = launch->cpu_out_packet;
+    char               *cpu_in_packet   = launch->cpu_in_packet;
+    char               *phi_in_packet   = launch->dev_in_packet;
+    char               *phi_out_packet  = launch->dev_out_packet;
+    size_t              packet_in_size  = launch->in_size;
+    size_t              packet_out_size = launch->out_size;
+    int                 kernel_type     = launch->kernel_type;
+    int                 flags           = launch->flags;
+    int                 clearF          = launch->clearF;
+    int                 ewald_excl      = launch->ewald_excl;
+    gmx_bool            bReduceF        = launch->bReduceF;
+    size_t              f_offset        = launch->f_offset;
+    offload_arena_map_t arena;
+    int                 r, c;
+
+    offload_arena_get_map(&arena);
+    mic_map_chunks(mic, &arena);
+
+    // The arena ranges are transferred into the mapping of their chunk on
+    // the card. Asynchronous offloads from one host thread execute in order
+    // on the card, so these arrive before the compute region starts.
+    if (launch->nrange > mic->range_signal_nalloc[stream])
+    {
+        mic->range_signal_nalloc[stream] = 2*launch->nrange;
+        srenew(mic->range_signal[stream], mic->range_signal_nalloc[stream]);
+    }
+    for (r = 0; r < launch->nrange; r++)
+    {
+        size_t offset = launch->ranges[r].offset;
+        size_t len    = launch->ranges[r].size;
+        char  *base;
+
+        // The mapping of a chunk is addressed from the start of the chunk
+        for (c = 0; offset >= arena.chunk[c].offset + arena.chunk[c].size; c++)
+        {
+            ;
+        }
+        base    = arena.chunk[c].base;
+        offset -= arena.chunk[c].offset;
+
+#pragma offload_transfer target(mic:device) \
+    in(base[offset:len] : REUSE) \
+    signal(&mic->range_signal[stream][r])
+    }
+    mic->nrange[stream] = launch->nrange;
+
+    // Asynchronous offloads from one host thread execute in order on the card
+#pragma offload target(mic:device) \
+    in(dev_state) \
+    in (cpu_out_packet[0:packet_in_size] :  into(phi_in_packet[0:packet_in_size]) REUSE targetptr) \
+    out(phi_out_packet[0:f_offset] : into(cpu_in_packet[0:f_offset]) REUSE targetptr) \
+    signal(&mic->signal[stream])
+    {
+        offload_device_compute((offload_device_state_t *)dev_state, stream,
+                               phi_in_packet, phi_out_packet,
+                               kernel_type, flags, clearF, ewald_excl, bReduceF);
+    }
+    // Each force chunk is a separate offload, so its transfer overlaps
+    // with packing the next chunk on the card
+    for (c = 0; c < launch->nf_chunk; c++)
+    {
+        size_t offset, len;
+
+        offload_f_chunk_range(launch, c, &offset, &len);
+#pragma offload target(mic:device) \
+    in(dev_state) in(f_offset) in(offset) in(len) \
+    out(phi_out_packet[offset:len] : into(cpu_in_packet[offset:len]) REUSE targetptr) \
+    signal(&mic->f_signal[stream][c])
+        {
+            offload_device_pack_f((offload_device_state_t *)dev_state, phi_out_packet,
+                                  f_offset, offset, len);
+        }
+    }
+}
+
+static void mic_wait(void *ctx, int stream)
+{
+    mic_context_t *mic    = (mic_context_t *)ctx;
+    int            device = mic->device;
+    int            r;
+
+    for (r = 0; r < mic->nrange[stream]; r++)
+    {
+#pragma offload_wait target(mic:device) wait(&mic->range_signal[stream][r])
+    }
+#pragma offload_wait target(mic:device) wait(&mic->signal[stream])
+}
+
+static void mic_wait_f_chunk(void *ctx, int stream, int chunk)
+{
+    mic_context_t *mic    = (mic_context_t *)ctx;
+    int            device = mic->device;
+
+#pragma offload_wait target(mic:device) wait(&mic->f_signal[stream][chunk])
+}
+
+static void mic_finalize(void *ctx)
+{
+    mic_context_t *mic       = (mic_context_t *)ctx;
+    int            device    = mic->device;
+    uintptr_t      dev_state = mic->dev_state;
+    int            s;
+
+#pragma offload target(mic:device) in(dev_state)
+    {
+        sfree((offload_device_state_t *)dev_state);
+    }
+    for (s = 0; s < OFFLOAD_NUM_STREAMS; s++)
+    {
+        sfree(mic->range_signal[s]);
+    }
+    sfree(mic);
+
+    // The last rank using the card removes the mappings of the arena chunks
+    tMPI_Thread_mutex_lock(&mic_arena_mtx);
+    mic_device_nref[device]--;
+    if (mic_device_nref[device] == 0)
+    {
+        offload_arena_map_t arena;
+        int                 c;
+
+        offload_arena_get_map(&arena);
+        for (c = 0; c < mic_chunks_mapped[device]; c++)
+        {
+            char *base = arena.chunk[c].base;
+
+#pragma offload_transfer target(mic:device) nocopy(base:length(0) FREE)
+        }
+        mic_chunks_mapped[device] = 0;
+    }
+    tMPI_Thread_mutex_unlock(&mic_arena_mtx);
+}
+
+const offload_backend_t offload_backend_mic = {
+    "Xeon Phi",
+    mic_num_devices,
+    mic_init,
+    mic_mirror_alloc,
+    mic_mirror_free,
+    mic_launch,
+    mic_wait,
+    mic_wait_f_chunk,
+    mic_finalize,
+    16
+};
+#endif /* GMX_OFFLOAD */
+
 // Helper method for copying packet buffer into an external buffer.
 // Allocates buffer and updates both the passed buffer pointer and
 // passed buffer size as needed. Advances iter to the next buffer.
@@ -121,370 +541,1506 @@ void *refresh_buffer(void *buffer, size_t *bsize, packet_iter *iter)
     return *buf;
 }
 
-void nbnxn_kernel_simd_2xnn_offload(t_forcerec *fr,
-                                    interaction_const_t *ic,
-                                    gmx_enerdata_t *enerd,
-                                    int flags, int ilocality,
-                                    int clearF,
-                                    t_nrnb *nrnb)
-{
-    nonbonded_verlet_group_t                *nbvg      = &fr->nbv->grp[ilocality];
-    gmx_offload static nbnxn_pairlist_set_t *nbl_lists = NULL;
-    nbl_lists = &nbvg->nbl_lists;
-
-    static int nbl_buffer_size = 0;
-    static int ci_buffer_size  = 0;
-    static int sci_buffer_size = 0;
-    static int cj_buffer_size  = 0;
-    static int cj4_buffer_size = 0;
-    gmx_offload static nbnxn_pairlist_t *nbl_buffer     = NULL;
-    gmx_offload static nbnxn_ci_t       *ci_buffer      = NULL;
-    gmx_offload static nbnxn_sci_t      *sci_buffer     = NULL;
-    gmx_offload static nbnxn_cj_t       *cj_buffer      = NULL;
-    gmx_offload static nbnxn_cj4_t      *cj4_buffer     = NULL;
-    gmx_offload static int              *type_buffer    = NULL;
-    gmx_offload static real             *lj_comb_buffer = NULL;
-    gmx_offload static real             *q_buffer       = NULL;
-
-    if (bRefreshNbl)
-    {
-        int                nbl_buffer_size_req = nbvg->nbl_lists.nnbl;
-        int                ci_buffer_size_req  = 0;
-        int                sci_buffer_size_req = 0;
-        int                cj_buffer_size_req  = 0;
-        int                cj4_buffer_size_req = 0;
-        nbnxn_pairlist_t **nbl                 = nbl_lists->nbl;
-        int                i;
-        for (i = 0; i < nbl_buffer_size_req; i++)
-        {
-            ci_buffer_size_req   += nbl[i]->nci;
-            sci_buffer_size_req  += nbl[i]->nsci;
-            cj_buffer_size_req   += nbl[i]->ncj;
-            cj4_buffer_size_req  += nbl[i]->ncj4;
-        }
-        if (nbl_buffer_size_req > nbl_buffer_size)
-        {
-            if (nbl_buffer_size > 0)
-            {
-                sfree_aligned(nbl_buffer);
-            }
-            snew_aligned(nbl_buffer, sizeof(nbnxn_pairlist_t)*nbl_buffer_size_req, 64);
-            nbl_buffer_size = nbl_buffer_size_req;
-        }
-        if (ci_buffer_size_req > ci_buffer_size)
-        {
-            if (ci_buffer_size > 0)
-            {
-                sfree_aligned(ci_buffer);
-            }
-            snew_aligned(ci_buffer, sizeof(nbnxn_ci_t)*ci_buffer_size_req, 64);
-            ci_buffer_size = ci_buffer_size_req;
-        }
-        if (sci_buffer_size_req > sci_buffer_size)
-        {
-            if (sci_buffer_size > 0)
-            {
-                sfree_aligned(sci_buffer);
-            }
-            snew_aligned(sci_buffer, sizeof(nbnxn_sci_t)*sci_buffer_size_req, 64);
-            sci_buffer_size = sci_buffer_size_req;
-        }
-        if (cj_buffer_size_req > cj_buffer_size)
-        {
-            if (cj_buffer_size > 0)
-            {
-                sfree_aligned(cj_buffer);
-            }
-            snew_aligned(cj_buffer, sizeof(nbnxn_cj_t)*cj_buffer_size_req, 64);
-            cj_buffer_size = cj_buffer_size_req;
-        }
-        if (cj4_buffer_size_req > cj4_buffer_size)
+// Helper for the energy output buffers on the target. Reallocates buffer
+// for n elements when needed and clears it.
+gmx_offload
+static real *clear_energy_buffer(real **buf, size_t *bsize, int n)
+{
+    int i;
+
+    if (n*sizeof(real) > *bsize)
+    {
+        sfree_aligned(*buf);
+        snew_aligned(*buf, n, 64);
+        *bsize = n*sizeof(real);
+    }
+    for (i = 0; i < n; i++)
+    {
+        (*buf)[i] = 0;
+    }
+
+    return *buf;
+}
+
+// Wall-clock time in seconds, usable on the offload target
+gmx_offload
+static double offload_wtime()
+{
+#if defined HAVE_CLOCK_GETTIME
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+
+    return t.tv_sec + 1e-9*t.tv_nsec;
+#elif defined HAVE_GETTIMEOFDAY
+    struct timeval t;
+
+    gettimeofday(&t, NULL);
+
+    return t.tv_sec + 1e-6*t.tv_usec;
+#else
+    return 0;
+#endif
+}
+
+// The address in the arena mirror of dev of the array at offset
+gmx_offload
+static void *arena_ptr(const offload_device_state_t *dev, size_t offset)
+{
+    return (offset == OFFLOAD_ARENA_NONE) ? NULL : offload_arena_map_ptr(&dev->arena, offset);
+}
+
+// The coordinate range, in reals, that the launch on stream sends
+gmx_offload
+static void stream_x_range(const nbnxn_atomdata_t *nbat, int stream,
+                           int *x0, int *x1)
+{
+    if (stream == eintLocal)
+    {
+        *x0 = 0;
+        *x1 = nbat->natoms_local*nbat->xstride;
+    }
+    else
+    {
+        *x0 = nbat->natoms_local*nbat->xstride;
+        *x1 = nbat->natoms*nbat->xstride;
+    }
+}
+
+// Run the SIMD kernel of type kernel_type, the same code runs on the
+// target and for the host share
+gmx_offload
+static void run_simd_kernel(int kernel_type, nbnxn_pairlist_set_t *nbl_lists,
+                            nbnxn_atomdata_t *nbat,
+                            const interaction_const_t *ic, int ewald_excl,
+                            rvec *shift_vec, int flags, int clearF,
+                            real *fshift, real *Vc, real *Vvdw)
+{
+    if (kernel_type == nbnxnk4xN_SIMD_4xN)
+    {
+        nbnxn_kernel_simd_4xn(nbl_lists, nbat, ic, ewald_excl, shift_vec,
+                              flags, clearF, fshift, Vc, Vvdw);
+    }
+    else
+    {
+        nbnxn_kernel_simd_2xnn(nbl_lists, nbat, ic, ewald_excl, shift_vec,
+                               flags, clearF, fshift, Vc, Vvdw);
+    }
+}
+
+// Read the search section of the input packet and, when it has search
+// parameters, build the pair lists of stream on the target. Returns
+// whether the lists were built, their pair counts are returned in natpair.
+gmx_offload
+static gmx_bool offload_device_search(offload_device_state_t *dev, int stream,
+                                      packet_iter *it, nbnxn_atomdata_t *nbat,
+                                      int kernel_type, int *natpair)
+{
+    offload_device_search_t *ds = &dev->search;
+    offload_device_list_t   *dl = &dev->list[stream];
+    offload_search_t        *sp;
+    nbnxn_search_t           nbs;
+    t_nrnb                   nrnb;
+    int                      g, b;
+
+    if (size(it) == 0)
+    {
+        for (b = 0; b <= eodsNR; b++)
         {
-            if (cj4_buffer_size > 0)
-            {
-                sfree_aligned(cj4_buffer);
-            }
-            snew_aligned(cj4_buffer, sizeof(nbnxn_cj4_t)*cj4_buffer_size_req, 64);
-            cj4_buffer_size = cj4_buffer_size_req;
+            next(it);
         }
+        return FALSE;
+    }
+    sp = (offload_search_t *)next(it);
+
+    if (ds->nbs == NULL)
+    {
+        nbnxn_init_search(&ds->nbs, NULL, NULL, FALSE,
+                          gmx_omp_nthreads_get(emntNonbonded));
+    }
+    nbs         = ds->nbs;
+    nbs->ePBC   = sp->ePBC;
+    copy_mat(sp->box, nbs->box);
+    nbs->DomDec = sp->DomDec;
+    copy_ivec(sp->dd_dim, nbs->dd_dim);
+    nbs->natoms_local    = sp->natoms_local;
+    nbs->natoms_nonlocal = sp->natoms_nonlocal;
+
+    ds->zones      = refresh_buffer(&ds->buf[eodsZONES], &ds->buffer_sizes[eodsZONES], it);
+    nbs->zones     = sp->DomDec ? ds->zones : NULL;
+    nbs->cell      = refresh_buffer(&ds->buf[eodsCELL], &ds->buffer_sizes[eodsCELL], it);
+    nbs->a         = refresh_buffer(&ds->buf[eodsA], &ds->buffer_sizes[eodsA], it);
+    ds->excl.nr    = sp->excl_nr;
+    ds->excl.index = refresh_buffer(&ds->buf[eodsEXCL_INDEX], &ds->buffer_sizes[eodsEXCL_INDEX], it);
+    ds->excl.a     = refresh_buffer(&ds->buf[eodsEXCL_A], &ds->buffer_sizes[eodsEXCL_A], it);
+
+    if (sp->ngrid > ds->grid_nalloc)
+    {
+        srenew(nbs->grid, sp->ngrid);
+        srenew(ds->grid, sp->ngrid);
+        memset(ds->grid + ds->grid_nalloc, 0,
+               (sp->ngrid - ds->grid_nalloc)*sizeof(*ds->grid));
+        ds->grid_nalloc = sp->ngrid;
+    }
+    for (g = 0; g < sp->ngrid; g++)
+    {
+        nbnxn_grid_t          *grid = &nbs->grid[g];
+        offload_device_grid_t *dg   = &ds->grid[g];
+        gmx_bool               bSameBBJ;
 
-        int ci_offset  = 0;
-        int sci_offset = 0;
-        int cj_offset  = 0;
-        int cj4_offset = 0;
-        for (i = 0; i < nbvg->nbl_lists.nnbl; i++)
+        // The struct is copied as is, its arrays are replaced below
+        cnext(it, grid);
+        grid->cxy_na  = refresh_buffer(&dg->buf[eosgCXY_NA], &dg->size[eosgCXY_NA], it);
+        grid->cxy_ind = refresh_buffer(&dg->buf[eosgCXY_IND], &dg->size[eosgCXY_IND], it);
+        grid->cxy_xy  = refresh_buffer(&dg->buf[eosgCXY_XY], &dg->size[eosgCXY_XY], it);
+        grid->xy_cxy  = refresh_buffer(&dg->buf[eosgXY_CXY], &dg->size[eosgXY_CXY], it);
+        grid->nsubc   = refresh_buffer(&dg->buf[eosgNSUBC], &dg->size[eosgNSUBC], it);
+        grid->bbcz    = refresh_buffer(&dg->buf[eosgBBCZ], &dg->size[eosgBBCZ], it);
+        grid->bb      = refresh_buffer(&dg->buf[eosgBB], &dg->size[eosgBB], it);
+        bSameBBJ      = (size(it) == 0);
+        grid->bbj     = refresh_buffer(&dg->buf[eosgBBJ], &dg->size[eosgBBJ], it);
+        if (bSameBBJ)
         {
-            memcpy(nbl_buffer + i, nbl[i], sizeof(nbnxn_pairlist_t));
-            memcpy(ci_buffer + ci_offset, nbl[i]->ci, nbl[i]->nci * sizeof(nbnxn_ci_t));
-            ci_offset += nbl[i]->nci;
-            memcpy(sci_buffer + sci_offset, nbl[i]->sci, nbl[i]->nsci * sizeof(nbnxn_sci_t));
-            sci_offset += nbl[i]->nsci;
-            memcpy(cj_buffer + cj_offset, nbl[i]->cj, nbl[i]->ncj * sizeof(nbnxn_cj_t));
-            cj_offset += nbl[i]->ncj;
-            memcpy(cj4_buffer + cj4_offset, nbl[i]->cj4, nbl[i]->ncj4 * sizeof(nbnxn_cj4_t));
-            cj4_offset += nbl[i]->ncj4;
+            grid->bbj = grid->bb;
         }
+        grid->flags   = refresh_buffer(&dg->buf[eosgFLAGS], &dg->size[eosgFLAGS], it);
+        grid->pbb          = NULL;
+        grid->fep          = NULL;
+        grid->bbcz_simple  = NULL;
+        grid->bb_simple    = NULL;
+        grid->flags_simple = NULL;
+    }
+    if (sp->ngrid > 0)
+    {
+        nbs->ngrid = sp->ngrid;
     }
 
-    packet_buffer ibuffers[NUM_OFFLOAD_BUFFERS];
-    ibuffers[0] =  (packet_buffer){
-        nbl_lists, sizeof(nbnxn_pairlist_set_t) * (bRefreshNbl ? 1 : 0)
-    };
-    ibuffers[1] =  (packet_buffer){
-        nbl_buffer, sizeof(nbnxn_pairlist_t) * (bRefreshNbl ? nbl_buffer_size : 0)
-    };
-    ibuffers[2] =  (packet_buffer){
-        ci_buffer, sizeof(nbnxn_ci_t) * (bRefreshNbl ? ci_buffer_size : 0)
-    };
-    ibuffers[3] =  (packet_buffer){
-        sci_buffer, sizeof(nbnxn_sci_t) * (bRefreshNbl ? sci_buffer_size : 0)
-    };
-    ibuffers[4] =  (packet_buffer){
-        cj_buffer, sizeof(nbnxn_cj_t) * (bRefreshNbl ? cj_buffer_size : 0)
-    };
-    ibuffers[5] =  (packet_buffer){
-        cj4_buffer, sizeof(nbnxn_cj4_t) * (bRefreshNbl ? cj4_buffer_size : 0)
-    };
-    nbnxn_atomdata_t *nbat = nbvg->nbat;
-    ibuffers[6]  =  (packet_buffer){
-        nbat, sizeof(nbnxn_atomdata_t)
-    };
-    ibuffers[7]  =  (packet_buffer){
-        nbat->nbfp, sizeof(real) * (nbat->ntype*nbat->ntype*2)
-    };
-    ibuffers[8]  =  (packet_buffer){
-        nbat->nbfp_comb, sizeof(real) * (nbat->comb_rule != ljcrNONE ? nbat->ntype*2 : 0)
-    };
-    ibuffers[9]  =  (packet_buffer){
-        nbat->nbfp_s4, sizeof(real) * (nbat->ntype*nbat->ntype*4)
-    };
-    ibuffers[10] = (packet_buffer){
-        nbat->type, sizeof(int) * (bRefreshNbl ? (nbat->natoms) : 0)
-    };
-    ibuffers[11] = (packet_buffer){
-        nbat->lj_comb, sizeof(real) * (bRefreshNbl ? (nbat->natoms*2) : 0)
-    };
-    ibuffers[12] = (packet_buffer){
-        nbat->q, sizeof(real) * (bRefreshNbl ? (nbat->natoms) : 0)
-    };
-    ibuffers[13] = (packet_buffer){
-        nbat->energrp, sizeof(int) * ((nbat->nenergrp > 1) ? (nbat->natoms/nbat->na_c) : 0)
-    };
-    ibuffers[14] = (packet_buffer){
-        nbat->shift_vec, sizeof(rvec) * SHIFTS
-    };
-    ibuffers[15] = (packet_buffer){
-        nbat->x, sizeof(real) * (nbat->natoms * nbat->xstride)
-    };
-    ibuffers[16] = (packet_buffer){
-        nbat->buffer_flags.flag, sizeof(gmx_bitmask_t) * (nbat->buffer_flags.flag_nalloc)
-    };
-    ibuffers[17] = (packet_buffer){
-        ic, sizeof(interaction_const_t)
-    };
-    ibuffers[18] = (packet_buffer){
-        fr->shift_vec, sizeof(rvec) * SHIFTS
-    };
-    void *Vc   = enerd->grpp.ener[egCOULSR];
-    void *Vvdw = fr->bBHAM ? enerd->grpp.ener[egBHAMSR] : enerd->grpp.ener[egLJSR];
-    ibuffers[19] = (packet_buffer){
-        Vc, sizeof(real) * (enerd->grpp.nener)
-    };
-    ibuffers[20] = (packet_buffer){
-        Vvdw, sizeof(real) * (enerd->grpp.nener)
-    };
+    if (!dl->bSearchLists)
+    {
+        nbnxn_init_pairlist_set(&dl->search_lists, TRUE, FALSE, NULL, NULL,
+                                kernel_type, TRUE);
+        dl->bSearchLists = TRUE;
+    }
+    // The lists are built with the buffer flags kept here, the local
+    // search resets them, the non-local search adds to them.
+    memset(&nrnb, 0, sizeof(nrnb));
+    nbat->buffer_flags = ds->buffer_flags;
+    nbnxn_make_pairlist(nbs, nbat, &ds->excl, sp->rlist, sp->min_ci_balanced,
+                        &dl->search_lists, stream, kernel_type, &nrnb);
+    ds->buffer_flags = nbat->buffer_flags;
+
+    natpair[0] = dl->search_lists.natpair_ljq;
+    natpair[1] = dl->search_lists.natpair_lj;
+    natpair[2] = dl->search_lists.natpair_q;
+
+    return TRUE;
+}
+
+void offload_device_compute(offload_device_state_t *dev, int stream,
+                            char *in_packet, char *out_packet,
+                            int kernel_type, int flags, int clearF,
+                            int ewald_excl, gmx_bool bReduceF)
+{
+    offload_device_list_t *dl = &dev->list[stream];
+    // Unpack data
+    packet_iter            it;
+    int                    i;
+
+    create_packet_iter(in_packet, &it);
+    // Memory for nbl_lists->nbl is handled by the target. So we store
+    // the value in case refresh overwrites it and restore it later.
+    // TODO: What about nbl->excl ?
+    nbnxn_pairlist_t **nbl_ptr = NULL;
+    if (dl->nbl_lists != NULL)
+    {
+        nbl_ptr = dl->nbl_lists->nbl;
+    }
+    refresh_buffer(&dl->nbl_lists, &dl->buffer_sizes[eodlNBL_LISTS], &it);
+    refresh_buffer(&dl->nbl_buffer, &dl->buffer_sizes[eodlNBL], &it);
+    // The arena offsets of the list arrays are only sent with a new list
+    size_t        nbl_arena_size = size(&it);
+    const size_t *nbl_arena      = next(&it);
+    gmx_bool      bRefresh       = (nbl_arena_size > 0);
+    // The pointers in the host atom data are overwritten below with their
+    // resident copies on the target.
+    nbnxn_atomdata_t *nbat       = refresh_buffer(&dev->nbat, &dev->buffer_sizes[eodbNBAT], &it);
+    const size_t     *nbat_arena = next(&it);
 
-    int ewald_excl = nbvg->ewald_excl;
+    // The atom data arrays are used in place in the arena mirror
+    nbat->nbfp      = arena_ptr(dev, nbat_arena[eoaNBFP]);
+    nbat->nbfp_comb = arena_ptr(dev, nbat_arena[eoaNBFP_COMB]);
+    nbat->nbfp_s4   = arena_ptr(dev, nbat_arena[eoaNBFP_S4]);
+    nbat->type      = arena_ptr(dev, nbat_arena[eoaTYPE]);
+    nbat->lj_comb   = arena_ptr(dev, nbat_arena[eoaLJ_COMB]);
+    nbat->q         = arena_ptr(dev, nbat_arena[eoaQ]);
+    nbat->energrp   = arena_ptr(dev, nbat_arena[eoaENERGRP]);
+    nbat->shift_vec = arena_ptr(dev, nbat_arena[eoaSHIFT_VEC]);
 
-    // Data needed for force and shift reductions
-    // TODO: Compiler complains if this buffer is not offloaded, but it shouldn't be necessary.
-    gmx_offload static char *cpu_out_packet         = NULL;
-    static size_t            current_packet_in_size = 0;
-    size_t                   packet_in_size         = compute_required_size(ibuffers, NUM_OFFLOAD_BUFFERS);
-    if (packet_in_size > current_packet_in_size)
+    nbat->x         = arena_ptr(dev, nbat_arena[eoaX]);
+
+    nbat->buffer_flags.flag            = refresh_buffer(&dev->buffer_flags, &dev->buffer_sizes[eodbBUFFER_FLAGS], &it);
+    interaction_const_t *ic            = refresh_buffer(&dev->ic, &dev->buffer_sizes[eodbIC], &it);
+    // Only the diagonal masks of the kernel type in use are sent
+    real                *diag          = refresh_buffer(&dev->diag_buffer, &dev->buffer_sizes[eodbDIAG], &it);
+    nbat->simd_4xn_diagonal_j_minus_i  = diag;
+    nbat->simd_2xnn_diagonal_j_minus_i = diag;
+    nbat->simd_exclusion_filter1       = refresh_buffer(&dev->filter1_buffer, &dev->buffer_sizes[eodbFILTER1], &it);
+    nbat->simd_exclusion_filter2       = refresh_buffer(&dev->filter2_buffer, &dev->buffer_sizes[eodbFILTER2], &it);
+    // The table pointers in the host interaction constants are replaced
+    // by the resident copies of the tables, which are only sent when used
+    ic->tabq_coul_F    = refresh_buffer(&dev->tabq_coul_F, &dev->buffer_sizes[eodbTABQ_COUL_F], &it);
+    ic->tabq_coul_V    = refresh_buffer(&dev->tabq_coul_V, &dev->buffer_sizes[eodbTABQ_COUL_V], &it);
+    ic->tabq_coul_FDV0 = refresh_buffer(&dev->tabq_coul_FDV0, &dev->buffer_sizes[eodbTABQ_COUL_FDV0], &it);
+    ic->tabcs_data     = refresh_buffer(&dev->tabcs_data, &dev->buffer_sizes[eodbTABCS], &it);
+    ic->tabq_vdw_F     = NULL;
+    ic->tabq_vdw_V     = NULL;
+    ic->tabq_vdw_FDV0  = NULL;
+
+    // The thread output buffers only exist on the target. Their number
+    // is fixed, their size follows the allocation size of the host atom data.
+    nbat->alloc = nbnxn_alloc_aligned;
+    nbat->free  = nbnxn_free_aligned;
+    if (dev->out == NULL)
     {
-        if (cpu_out_packet != NULL)
+        snew(dev->out, nbat->nout);
+        for (i = 0; i < nbat->nout; i++)
         {
-            mfree(cpu_out_packet, phi_in_packet);
+            nbnxn_atomdata_output_init(&dev->out[i], kernel_type,
+                                       nbat->nenergrp, 1<<nbat->neg_2log,
+                                       nbat->alloc);
         }
-        cpu_out_packet         = mmalloc(2*packet_in_size, &phi_in_packet);
-        current_packet_in_size = 2*packet_in_size;
     }
-    packdata(cpu_out_packet, ibuffers, NUM_OFFLOAD_BUFFERS);
-
-    packet_buffer obuffers[4];
-    obuffers[0] = (packet_buffer){
-        nbat->out[0].fshift, sizeof(real) * SHIFTS * DIM
-    };
-    obuffers[1] = ibuffers[19];    // Vc
-    obuffers[2] = ibuffers[20];    // Vvdw
-    obuffers[3] = (packet_buffer){ // Force
-        nbat->out[0].f, sizeof(real) * nbat->natoms * nbat->fstride
-    };
-    static char  *cpu_in_packet           = NULL;
-    static size_t current_packet_out_size = 0;
-    size_t        packet_out_size         = compute_required_size(obuffers, 4);
-    if (packet_out_size > current_packet_out_size)
+    if (nbat->nalloc > dev->out_nalloc)
     {
-        if (cpu_in_packet != NULL)
+        for (i = 0; i < nbat->nout; i++)
         {
-            mfree(cpu_in_packet, phi_out_packet);
+            nbnxn_realloc_void((void **)&dev->out[i].f, 0,
+                               nbat->nalloc*nbat->fstride*sizeof(*dev->out[i].f),
+                               nbat->alloc, nbat->free);
         }
-        cpu_in_packet           = mmalloc(2*packet_out_size, &phi_out_packet);
-        current_packet_out_size = 2*packet_out_size;
+        dev->out_nalloc = nbat->nalloc;
     }
+    nbat->out               = dev->out;
+    int                  nener         = *(int *)next(&it);
+    real                *Vc            = clear_energy_buffer(&dl->Vc, &dl->buffer_sizes[eodlVC], nener);
+    real                *Vvdw          = clear_energy_buffer(&dl->Vvdw, &dl->buffer_sizes[eodlVVDW], nener);
 
-    //TODO: if tables are used, the coul_F and coul_V need to be copied
-    //following not needed after. Instead we should call init_simple_exclusion_masks
-    //nbat->simd_4xn_diagonal_j_minus_i  = simd_4xn_diagonal_j_minus_i_p;
-    //                nbat->simd_2xnn_diagonal_j_minus_i = simd_2xnn_diagonal_j_minus_i_p;
-    //                nbat->simd_exclusion_filter1       = simd_exclusion_filter1_p;
-    //                nbat->simd_exclusion_filter2       = simd_exclusion_filter2_p;
-
-    // TODO: What about nbl->excl ?
+    int                  natpair[3];
+    gmx_bool             bSearched     = offload_device_search(dev, stream, &it, nbat,
+                                                               kernel_type, natpair);
 
-#pragma offload target(mic:0) \
-    nocopy(nbl_lists) \
-    nocopy(nbl_buffer) \
-    nocopy(ci_buffer) \
-    nocopy(sci_buffer) \
-    nocopy(cj_buffer) \
-    nocopy(cj4_buffer) \
-    nocopy(type_buffer) \
-    nocopy(lj_comb_buffer) \
-    nocopy(q_buffer) \
-    nocopy(phi_buffer_sizes) \
-    in (cpu_out_packet[0:packet_in_size] :  into(phi_in_packet[0:packet_in_size]) REUSE targetptr) \
-    out(phi_out_packet[0:packet_out_size] : into(cpu_in_packet[0:packet_out_size]) REUSE targetptr) \
-    signal(&off_signal)
-    {
-        // Unpack data
-        packet_iter *it;
-        smalloc(it, sizeof(packet_iter));
-
-        create_packet_iter(phi_in_packet, it);
-        // Memory for nbl_lists->nbl is handled by the Phi. So we store
-        // the value in case refresh overwrites it and restore it later.
-        nbnxn_pairlist_t **nbl_ptr = NULL;
-        if (nbl_lists != NULL)
-        {
-            nbl_ptr = nbl_lists->nbl;
-        }
-        refresh_buffer(&nbl_lists, &phi_buffer_sizes[0], it);
-        refresh_buffer(&nbl_buffer, &phi_buffer_sizes[1], it);
-        refresh_buffer(&ci_buffer, &phi_buffer_sizes[2], it);
-        refresh_buffer(&sci_buffer, &phi_buffer_sizes[3], it);
-        refresh_buffer(&cj_buffer, &phi_buffer_sizes[4], it);
-        refresh_buffer(&cj4_buffer, &phi_buffer_sizes[5], it);
-        nbnxn_atomdata_t *nbat = next(it);
-        nbat->nbfp              = next(it);
-        nbat->nbfp_comb         = next(it);
-        nbat->nbfp_s4           = next(it);
-        nbat->type              = refresh_buffer(&type_buffer, &phi_buffer_sizes[6], it);
-        nbat->lj_comb           = refresh_buffer(&lj_comb_buffer, &phi_buffer_sizes[7], it);
-        nbat->q                 = refresh_buffer(&q_buffer, &phi_buffer_sizes[8], it);
-        nbat->energrp           = next(it);
-        nbat->shift_vec         = next(it);
-        nbat->x                 = next(it);
-        nbnxn_atomdata_t *phi_nbat = get_nbat_for_offload(nbat->id);
-        nbat->out               = phi_nbat->out;
-        nbat->simd_2xnn_diagonal_j_minus_i = phi_nbat->simd_2xnn_diagonal_j_minus_i;
-        nbat->simd_exclusion_filter1 = phi_nbat->simd_exclusion_filter1;
-        nbat->simd_exclusion_filter2 = phi_nbat->simd_exclusion_filter2;
-        nbat->buffer_flags.flag = next(it);
-        interaction_const_t *ic_buffer = next(it);
-        rvec                *shift_vec = next(it);
-        // TODO: Remove from package - not used.
-        real                *Vc   = next(it);
-        real                *Vvdw = next(it);
-        sfree(it);
-
-        // Neighbor list pointer assignments
-        int ci_offset  = 0;
-        int sci_offset = 0;
-        int cj_offset  = 0;
-        int cj4_offset = 0;
-
-        // Restore nbl_lists->nbl or allocate if first time
-        nbl_lists->nbl = nbl_ptr;
+    // With the search on the target the kernels use the lists and the
+    // buffer flags built here, otherwise those sent by the host
+    nbnxn_pairlist_set_t *nbl_lists;
+    if (dl->bSearchLists)
+    {
+        nbl_lists          = &dl->search_lists;
+        nbat->buffer_flags = dev->search.buffer_flags;
+    }
+    else
+    {
+        // Restore nbl_lists->nbl or allocate if first time,
+        // the work-stealing state of the host lists is not used here
+        nbl_lists        = dl->nbl_lists;
+        nbl_lists->nbl   = nbl_ptr;
+        nbl_lists->steal = NULL;
         if (nbl_lists->nbl == NULL)
         {
             nbl_lists->nbl = malloc(sizeof(nbnxn_pairlist_t *)*nbl_lists->nnbl);
         }
+    }
 
-        int i;
+    // The list arrays are used in place in the arena mirror
+    if (bRefresh)
+    {
         for (i = 0; i < nbl_lists->nnbl; i++)
         {
-            nbl_lists->nbl[i] = nbl_buffer + i;
-            nbnxn_pairlist_t *nbl = nbl_lists->nbl[i];
-            nbl->ci     = ci_buffer  + ci_offset;
-            nbl->sci    = sci_buffer + sci_offset;
-            nbl->cj     = cj_buffer  + cj_offset;
-            nbl->cj4    = cj4_buffer + cj4_offset;
-            ci_offset  += nbl->nci;
-            sci_offset += nbl->nsci;
-            cj_offset  += nbl->ncj;
-            cj4_offset += nbl->ncj4;
+            nbnxn_pairlist_t *nbl = dl->nbl_buffer + i;
+            const size_t     *off = nbl_arena + i*eoalNR;
+
+            nbl_lists->nbl[i] = nbl;
+            nbl->ci           = arena_ptr(dev, off[eoalCI]);
+            nbl->sci          = arena_ptr(dev, off[eoalSCI]);
+            nbl->cj           = arena_ptr(dev, off[eoalCJ]);
+            nbl->cj4          = arena_ptr(dev, off[eoalCJ4]);
+            nbl->cic          = arena_ptr(dev, off[eoalCIC]);
+            nbl->cjc          = arena_ptr(dev, off[eoalCJC]);
+            nbl->cjc_excl     = arena_ptr(dev, off[eoalCJC_EXCL]);
+        }
+    }
+
+    // With a single list the kernel accumulates the shift forces
+    // directly in the fshift buffer we pass, without clearing it.
+    if (clearF == enbvClearFYes)
+    {
+        for (i = 0; i < SHIFTS * DIM; i++)
+        {
+            nbat->out[0].fshift[i] = 0;
         }
+    }
 
-        // End unpacking of data and start actual computing
-        /*TODO: ic: table (only if tables are used)
+    // End unpacking of data and start actual computing
+    /*TODO: verify that those marked as in/out are really only input/output
+                    do outputs need to be zeroed?
 
-                        verify that those marked as in/out are really only input/output
-                        do outputs need to be zeroed?
+                    the numa issue for nbl_lists might also be important for MIC so we might want to do a manual allocation
+     */
+    // The buffer flags arrive with the last launch of a pair-list step,
+    // after the non-local search has added its flags. An earlier launch
+    // that clears the forces can therefore not rely on them and clears
+    // the complete thread force buffers instead.
+    gmx_bool bUseBufferFlags = nbat->bUseBufferFlags;
+    if (!bReduceF)
+    {
+        nbat->bUseBufferFlags = FALSE;
+    }
+    double   timing[2];
+    double   t_start = offload_wtime();
+    run_simd_kernel(kernel_type, nbl_lists,
+                    // static information (e.g. charges)
+                    //ic seems to be all static. is fr->ic
+                    nbat, ic,
+                    ewald_excl,      //might depend on Neighbor list or is static
+                    nbat->shift_vec, //depends on box size (changes usually with neighbor list)
+                    flags,
+                    clearF,
+                    nbat->out[0].fshift, // only used when nnbl == 1
+                    Vc,                  //output
+                    Vvdw);               //output
+    nbat->bUseBufferFlags = bUseBufferFlags;
+    double t_kernel       = offload_wtime();
 
-                        the numa issue for nbl_lists might also be important for MIC so we might want to do a manual allocation
-         */
-        nbnxn_kernel_simd_2xnn(nbl_lists,
-                               // static information (e.g. charges)
-                                           //ic seems to be all static. is fr->ic
-                               nbat, ic_buffer,
-                               ewald_excl, //might depend on Neighbor list or is static
-                               shift_vec,  //depends on box size (changes usually with neighbor list)
-                               flags,
-                               clearF,
-                               NULL,  // fshift not used when nnbl > 1
-                               Vc,    //output
-                               Vvdw); //output
-        bRefreshNbl = FALSE;
-
-        // Force and shift reductions
+    // Force and shift reductions, only after the last launch of the step,
+    // since the launches of both localities accumulate in the same buffers.
+    if (bReduceF && nbat->nout > 1)
+    {
         nbnxn_atomdata_add_nbat_f_to_f_treereduce(nbat, gmx_omp_nthreads_get(emntNonbonded));
-
-        packet_buffer phi_buffers[4];
-        phi_buffers[0] = (packet_buffer){
-            nbat->out[0].fshift, sizeof(real) * SHIFTS * DIM
-        };
-        phi_buffers[1] = get_buffer(phi_in_packet, 19);
-        phi_buffers[2] = get_buffer(phi_in_packet, 20);
-        phi_buffers[3] = (packet_buffer){
-            nbat->out[0].f, sizeof(real) * nbat->natoms * nbat->fstride
-        };
-        packdata(phi_out_packet, phi_buffers, 4);
+#ifndef GMX_ACCELERATOR
+        // The tree reduction only sums the shift forces on the accelerator
+        int th;
+        for (th = 1; th < nbat->nout; th++)
+        {
+            for (i = 0; i < SHIFTS * DIM; i++)
+            {
+                nbat->out[0].fshift[i] += nbat->out[th].fshift[i];
+            }
+        }
+#endif
     }
-    unpack_data.out_packet_addr = cpu_in_packet;
-    unpack_data.cpu_buffers[0]  = nbat->out[0].fshift;
-    unpack_data.cpu_buffers[1]  = Vc;
-    unpack_data.cpu_buffers[2]  = Vvdw;
-    unpack_data.cpu_buffers[3]  = nbat->out[0].f;
-}
 
-void wait_for_offload()
-{
-#pragma offload_wait target(mic:0) wait(&off_signal)
-    unpackdata(unpack_data.out_packet_addr, unpack_data.cpu_buffers, 4);
+    // The kernel and reduction times in ms
+    timing[0] = 1000*(t_kernel - t_start);
+    timing[1] = 1000*(offload_wtime() - t_kernel);
+
+    packet_buffer phi_buffers[eoopNR];
+    phi_buffers[eoopFSHIFT] = (packet_buffer){
+        nbat->out[0].fshift, bReduceF ? sizeof(real) * SHIFTS * DIM : 0
+    };
+    phi_buffers[eoopVC] = (packet_buffer){
+        Vc, sizeof(real) * nener
+    };
+    phi_buffers[eoopVVDW] = (packet_buffer){
+        Vvdw, sizeof(real) * nener
+    };
+    phi_buffers[eoopTIMING] = (packet_buffer){
+        timing, sizeof(timing)
+    };
+    phi_buffers[eoopNATPAIR] = (packet_buffer){
+        natpair, bSearched ? sizeof(natpair) : 0
+    };
+    // The forces are only reserved here, they are packed in chunks
+    phi_buffers[eoopF] = (packet_buffer){
+        NULL, bReduceF ? sizeof(real) * nbat->natoms * nbat->fstride : 0
+    };
+    packdata(out_packet, phi_buffers, eoopNR);
 }
 
-void setRefreshNblForOffload()
+void offload_device_pack_f(offload_device_state_t *dev, char *out_packet,
+                           size_t f_offset, size_t offset, size_t len)
 {
-    bRefreshNbl = TRUE;
+    memcpy(out_packet + offset, (char *)dev->out[0].f + (offset - f_offset), len);
 }
 
-gmx_bool offloadedKernelEnabled(int kernel_type)
+// Set the buffers of the search section of the input packet of st, starting
+// at buf, and return the number of buffers. All buffers are empty when the
+// launch does not search, with the local launch of a pair-list step they
+// hold the grids, the atom order and the exclusions.
+static int setup_search_buffers(offload_stream_t *st, const nbnxn_atomdata_t *nbat,
+                                int ilocality, packet_buffer *buf)
 {
-#if defined GMX_OFFLOAD && defined GMX_NBNXN_SIMD_2XNN
-    return (kernel_type == nbnxnk4xN_SIMD_2xNN);
-#else
-    return FALSE;
+    const nbnxn_search_t nbs  = st->nbs;
+    offload_search_t    *sp   = &st->search;
+    gmx_bool             bAll = (st->bSearch && ilocality == eintLocal);
+    int                  nb   = 0;
+    int                  g;
+
+    buf[nb++] = (packet_buffer){
+        sp, st->bSearch ? sizeof(*sp) : 0
+    };
+    buf[nb++] = (packet_buffer){
+        nbs != NULL ? nbs->zones : NULL, (bAll && nbs->DomDec) ? sizeof(*nbs->zones) : 0
+    };
+    buf[nb++] = (packet_buffer){
+        nbs != NULL ? nbs->cell : NULL, bAll ? sizeof(int)*nbs->natoms_nonlocal : 0
+    };
+    buf[nb++] = (packet_buffer){
+        nbs != NULL ? nbs->a : NULL, bAll ? sizeof(int)*nbat->natoms : 0
+    };
+    buf[nb++] = (packet_buffer){
+        st->excl != NULL ? st->excl->index : NULL, bAll ? sizeof(int)*(st->excl->nr + 1) : 0
+    };
+    buf[nb++] = (packet_buffer){
+        st->excl != NULL ? st->excl->a : NULL, bAll ? sizeof(int)*st->excl->nra : 0
+    };
+    if (!bAll)
+    {
+        return nb;
+    }
+
+    for (g = 0; g < sp->ngrid; g++)
+    {
+        nbnxn_grid_t *grid = &nbs->grid[g];
+        int           ncxy = grid->ncx*grid->ncy;
+
+        buf[nb++] = (packet_buffer){ grid, sizeof(*grid) };
+        buf[nb++] = (packet_buffer){ grid->cxy_na, sizeof(int)*ncxy };
+        buf[nb++] = (packet_buffer){ grid->cxy_ind, sizeof(int)*(ncxy + 1) };
+        buf[nb++] = (packet_buffer){ grid->cxy_xy, sizeof(int)*(ncxy + 1) };
+        buf[nb++] = (packet_buffer){ grid->xy_cxy, sizeof(int)*(ncxy + 1) };
+        buf[nb++] = (packet_buffer){ grid->nsubc, sizeof(int)*grid->nc };
+        buf[nb++] = (packet_buffer){ grid->bbcz, sizeof(float)*grid->nc*NNBSBB_D };
+        buf[nb++] = (packet_buffer){ grid->bb, sizeof(nbnxn_bb_t)*grid->nc };
+        /* An empty bbj tells the target that bbj is bb */
+        buf[nb++] = (packet_buffer){
+            grid->bbj, (grid->bbj == grid->bb) ? 0 : sizeof(nbnxn_bb_t)*grid->nc_nalloc*grid->na_c/grid->na_cj
+        };
+        buf[nb++] = (packet_buffer){ grid->flags, sizeof(int)*grid->nc };
+    }
+
+    return nb;
+}
+
+// Return the number of leading i-clusters of nbl that leaves about
+// host_fraction of the j-clusters of nbl for the host to compute
+static int split_ci(const nbnxn_pairlist_t *nbl, double host_fraction)
+{
+    int ncj_target, lo, hi, mid;
+
+    if (host_fraction <= 0 || nbl->nci == 0)
+    {
+        return nbl->nci;
+    }
+    ncj_target = (int)((1 - host_fraction)*nbl->ci[nbl->nci - 1].cj_ind_end + 0.5);
+
+    // The j-cluster ranges of the i-clusters are consecutive, so we can
+    // bisect for the first i-cluster that reaches the target.
+    lo = 0;
+    hi = nbl->nci;
+    while (lo < hi)
+    {
+        mid = (lo + hi)/2;
+        if (nbl->ci[mid].cj_ind_end < ncj_target)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return (lo < nbl->nci) ? lo + 1 : nbl->nci;
+}
+
+// The arena offset of the array p, which can be NULL
+static size_t arena_offset(const void *p)
+{
+    return (p == NULL) ? OFFLOAD_ARENA_NONE : offload_arena_offset(p);
+}
+
+// Add the nbytes at p in the offload arena to the ranges to transfer
+// with the next launch on st
+static void add_range(offload_stream_t *st, const void *p, size_t nbytes)
+{
+    if (nbytes == 0)
+    {
+        return;
+    }
+    if (st->nrange == st->range_nalloc)
+    {
+        st->range_nalloc = 2*st->range_nalloc + 16;
+        srenew(st->ranges, st->range_nalloc);
+    }
+    st->ranges[st->nrange].offset = offload_arena_offset(p);
+    st->ranges[st->nrange].size   = nbytes;
+    st->nrange++;
+}
+
+// Set up the pair-list structs of the target part of the pair lists of a
+// locality and the arena offsets of their arrays, add the target part of
+// the arrays to the ranges to transfer and set up the views of the host part
+static void setup_pairlists(offload_stream_t *st, const nbnxn_pairlist_set_t *nbl_lists,
+                            double host_fraction)
+{
+    nbnxn_pairlist_t **nbl = nbl_lists->nbl;
+    int                i;
+
+    if (nbl_lists->nnbl > st->nbl_nalloc)
+    {
+        sfree_aligned(st->nbl_buffer);
+        snew_aligned(st->nbl_buffer, nbl_lists->nnbl, 64);
+        srenew(st->nbl_arena, nbl_lists->nnbl*eoalNR);
+        srenew(st->host_nbl, nbl_lists->nnbl);
+        srenew(st->host_nbl_ptr, nbl_lists->nnbl);
+        st->nbl_nalloc = nbl_lists->nnbl;
+    }
+
+    st->host_nci = 0;
+    for (i = 0; i < nbl_lists->nnbl; i++)
+    {
+        nbnxn_pairlist_t *nbl_dev  = st->nbl_buffer + i;
+        nbnxn_pairlist_t *nbl_host = st->host_nbl + i;
+        size_t           *off      = st->nbl_arena + i*eoalNR;
+        int               nci_dev  = split_ci(nbl[i], host_fraction);
+
+        memcpy(nbl_dev, nbl[i], sizeof(nbnxn_pairlist_t));
+        nbl_dev->nci   = nci_dev;
+        nbl_dev->ncj   = (nci_dev > 0) ? nbl[i]->ci[nci_dev - 1].cj_ind_end : 0;
+
+        memcpy(nbl_host, nbl[i], sizeof(nbnxn_pairlist_t));
+        nbl_host->ci  += nci_dev;
+        nbl_host->nci -= nci_dev;
+        if (nbl_lists->bCompressed)
+        {
+            nbl_host->cic += nci_dev;
+        }
+        st->host_nbl_ptr[i] = nbl_host;
+
+        off[eoalCI]  = arena_offset(nbl[i]->ci);
+        off[eoalSCI] = arena_offset(nbl[i]->sci);
+        off[eoalCJ]  = arena_offset(nbl[i]->cj);
+        off[eoalCJ4] = arena_offset(nbl[i]->cj4);
+        add_range(st, nbl[i]->ci, nbl_dev->nci*sizeof(nbnxn_ci_t));
+        add_range(st, nbl[i]->sci, nbl_dev->nsci*sizeof(nbnxn_sci_t));
+        add_range(st, nbl[i]->cj4, nbl_dev->ncj4*sizeof(nbnxn_cj4_t));
+        if (nbl_lists->bCompressed)
+        {
+            // The kernels only read the compressed j-lists, the masks
+            // of the target part end where those of the host part start
+            int ncjc_dev, nexcl_dev;
+
+            ncjc_dev  = (nci_dev > 0) ? nbl[i]->cic[nci_dev - 1].cjc_ind_end : 0;
+            nexcl_dev = (nci_dev < nbl[i]->nci) ? nbl[i]->cic[nci_dev].excl_ind_start : nbl[i]->ncjc_excl;
+
+            off[eoalCIC]      = arena_offset(nbl[i]->cic);
+            off[eoalCJC]      = arena_offset(nbl[i]->cjc);
+            off[eoalCJC_EXCL] = arena_offset(nbl[i]->cjc_excl);
+            add_range(st, nbl[i]->cic, nci_dev*sizeof(nbnxn_cic_t));
+            add_range(st, nbl[i]->cjc, ncjc_dev*sizeof(unsigned short));
+            add_range(st, nbl[i]->cjc_excl, nexcl_dev*sizeof(unsigned int));
+        }
+        else
+        {
+            off[eoalCIC]      = OFFLOAD_ARENA_NONE;
+            off[eoalCJC]      = OFFLOAD_ARENA_NONE;
+            off[eoalCJC_EXCL] = OFFLOAD_ARENA_NONE;
+            add_range(st, nbl[i]->cj, nbl_dev->ncj*sizeof(nbnxn_cj_t));
+        }
+
+        st->host_nci += nbl_host->nci;
+    }
+    st->host_lists     = *nbl_lists;
+    st->host_lists.nbl = st->host_nbl_ptr;
+}
+
+// Update the host share from the cycle counts since the last pair-list step
+static void balance_host_share(nbnxn_offload_t *ol)
+{
+    double elapsed, wait, host, other, f, f_new;
+
+    if (!ol->bBalance || ol->nstep_timed == 0)
+    {
+        return;
+    }
+
+    elapsed = ol->cyc_elapsed;
+    wait    = ol->cyc_wait;
+    host    = ol->cyc_host;
+    f       = ol->host_fraction;
+    if (wait > OFFLOAD_BALANCE_WAIT_TOL*elapsed)
+    {
+        // The target finished last, at the end of the wait
+        if (f > 0 && host > 0)
+        {
+            // Balance the times the host and the target need for their
+            // shares of the work, with the host doing its other force
+            // work first.
+            double target_all = elapsed/(1 - f);
+            double host_all   = host/f;
+
+            other = elapsed - wait - host;
+            f_new = (target_all - other)/(host_all + target_all);
+        }
+        else
+        {
+            // Without a host rate, start by taking half the wait time
+            f_new = 0.5*wait/elapsed;
+        }
+    }
+    else
+    {
+        // The host finished last, shift work back to the target
+        f_new = OFFLOAD_BALANCE_BACKOFF*f;
+    }
+    if (f_new < OFFLOAD_HOST_FRACTION_MIN)
+    {
+        f_new = 0;
+    }
+    if (f_new > OFFLOAD_HOST_FRACTION_MAX)
+    {
+        f_new = OFFLOAD_HOST_FRACTION_MAX;
+    }
+
+    if (debug)
+    {
+        fprintf(debug, "Offload balancing over %d steps: wait %.1f%%, host share %.1f%% -> %.1f%%\n",
+                ol->nstep_timed, 100*wait/elapsed, 100*f, 100*f_new);
+    }
+    ol->host_fraction = f_new;
+    ol->cyc_elapsed   = 0;
+    ol->cyc_host      = 0;
+    ol->cyc_wait      = 0;
+    ol->nstep_timed   = 0;
+}
+
+void nbnxn_kernel_simd_offload(t_forcerec *fr,
+                               interaction_const_t *ic,
+                               gmx_enerdata_t *enerd,
+                               int flags, int ilocality,
+                               int clearF,
+                               t_nrnb gmx_unused *nrnb,
+                               gmx_wallcycle_t wcycle)
+{
+    nbnxn_offload_t          *offload   = fr->nbv->offload;
+    nonbonded_verlet_group_t *nbvg      = &fr->nbv->grp[ilocality];
+    nbnxn_pairlist_set_t     *nbl_lists = &nbvg->nbl_lists;
+    offload_stream_t         *st        = &offload->streams[ilocality];
+    nbnxn_atomdata_t         *nbat      = nbvg->nbat;
+    gmx_bool                  bRefresh  = st->bRefreshNbl;
+    /* With the search on the target the pair lists are not sent */
+    gmx_bool                  bSendNbl  = (bRefresh && !offload->bTargetSearch);
+    /* The atom data parameters are shared by both localities */
+    gmx_bool                  bSendAtomdata = (bRefresh && ilocality == eintLocal);
+    gmx_bool                  bSendShiftVec = (ilocality == eintLocal &&
+                                               (bRefresh || nbat->bDynamicBox));
+    /* The last launch of the step reduces and returns the forces */
+    gmx_bool                  bReduceF = (ilocality == fr->nbv->ngrp - 1);
+    /* The buffer flags are complete after the search of the last locality */
+    gmx_bool                  bSendFlags = (bSendNbl && bReduceF);
+    int                       simd_width = backend->simd_width;
+    real                     *diag;
+    int                       diag_size, x0, x1;
+    int                       ntabq, ntabcs;
+    double                    t_start    = offload_wtime();
+
+    wallcycle_sub_start(wcycle, ewcsOFFLOAD_PACK);
+
+    if (ilocality == eintLocal && offload->bBalance)
+    {
+        if (offload->cyc_launch != 0)
+        {
+            offload->cyc_elapsed += (double)(offload->cyc_ready - offload->cyc_launch);
+            offload->nstep_timed++;
+        }
+        if (bRefresh)
+        {
+            balance_host_share(offload);
+        }
+    }
+    st->nrange = 0;
+    if (bSendNbl)
+    {
+        setup_pairlists(st, nbl_lists,
+                        offload->bHostShare ? offload->host_fraction : 0);
+    }
+
+    stream_x_range(nbat, ilocality, &x0, &x1);
+
+    /* The energies are returned per launch and added to these on the host */
+    int nener = enerd->grpp.nener;
+    if (2*nener > st->V_nalloc)
+    {
+        st->V_nalloc = 2*nener;
+        srenew(st->V_buffer, st->V_nalloc);
+    }
+
+    /* The atom data arrays are transferred as ranges of the offload arena */
+    st->nbat_arena[eoaNBFP]      = arena_offset(nbat->nbfp);
+    st->nbat_arena[eoaNBFP_COMB] = arena_offset(nbat->nbfp_comb);
+    st->nbat_arena[eoaNBFP_S4]   = arena_offset(nbat->nbfp_s4);
+    st->nbat_arena[eoaTYPE]      = arena_offset(nbat->type);
+    st->nbat_arena[eoaLJ_COMB]   = arena_offset(nbat->lj_comb);
+    st->nbat_arena[eoaQ]         = arena_offset(nbat->q);
+    st->nbat_arena[eoaENERGRP]   = arena_offset(nbat->energrp);
+    st->nbat_arena[eoaSHIFT_VEC] = arena_offset(nbat->shift_vec);
+    st->nbat_arena[eoaX]         = arena_offset(nbat->x);
+    if (bSendAtomdata)
+    {
+        add_range(st, nbat->nbfp, sizeof(real)*nbat->ntype*nbat->ntype*2);
+        if (nbat->comb_rule != ljcrNONE)
+        {
+            add_range(st, nbat->nbfp_comb, sizeof(real)*nbat->ntype*2);
+        }
+        add_range(st, nbat->nbfp_s4, sizeof(real)*nbat->ntype*nbat->ntype*4);
+        add_range(st, nbat->type, sizeof(int)*nbat->natoms);
+        add_range(st, nbat->lj_comb, sizeof(real)*nbat->natoms*2);
+        add_range(st, nbat->q, sizeof(real)*nbat->natoms);
+        if (nbat->nenergrp > 1)
+        {
+            add_range(st, nbat->energrp, sizeof(int)*nbat->natoms/nbat->na_c);
+        }
+    }
+    if (bSendShiftVec)
+    {
+        add_range(st, nbat->shift_vec, sizeof(rvec)*SHIFTS);
+    }
+    /* Each stream transfers the coordinates of its own atom range */
+    add_range(st, nbat->x + x0, sizeof(real)*(x1 - x0));
+    st->nrange = offload_arena_merge_ranges(st->ranges, st->nrange);
+
+    /* The tables are only sent when the kernels use them */
+    ntabq = 0;
+    if (EEL_PME_EWALD(ic->eeltype) && nbvg->ewald_excl == ewaldexclTable)
+    {
+        ntabq = ic->tabq_size;
+    }
+    ntabcs = 0;
+    if (ic->tabcs_data != NULL)
+    {
+        ntabcs = (fr->nblists[0].table_elec_vdw.n + 1)*ic->tabcs_stride;
+    }
+
+    /* The diagonal masks are set up for the SIMD width of the target */
+    if (nbvg->kernel_type == nbnxnk4xN_SIMD_4xN)
+    {
+        diag      = nbat->simd_4xn_diagonal_j_minus_i;
+        diag_size = max(NBNXN_CPU_CLUSTER_I_SIZE, simd_width);
+    }
+    else
+    {
+        diag      = nbat->simd_2xnn_diagonal_j_minus_i;
+        diag_size = simd_width;
+    }
+
+    /* The search section follows the fixed buffers */
+    int nibuffer = eoipNR + 1 + eodsNR;
+    if (st->bSearch && ilocality == eintLocal)
+    {
+        nibuffer += st->search.ngrid*(1 + eosgNR);
+    }
+    if (nibuffer > st->ibuffer_nalloc)
+    {
+        st->ibuffer_nalloc = over_alloc_small(nibuffer);
+        srenew(st->ibuffers, st->ibuffer_nalloc);
+    }
+    packet_buffer *ibuffers = st->ibuffers;
+    ibuffers[eoipNBL_LISTS] =  (packet_buffer){
+        nbl_lists, sizeof(nbnxn_pairlist_set_t) * (bSendNbl ? 1 : 0)
+    };
+    ibuffers[eoipNBL] =  (packet_buffer){
+        st->nbl_buffer, sizeof(nbnxn_pairlist_t) * (bSendNbl ? nbl_lists->nnbl : 0)
+    };
+    ibuffers[eoipNBL_ARENA] =  (packet_buffer){
+        st->nbl_arena, sizeof(size_t) * (bSendNbl ? nbl_lists->nnbl*eoalNR : 0)
+    };
+    ibuffers[eoipNBAT]  =  (packet_buffer){
+        nbat, sizeof(nbnxn_atomdata_t) * (bSendAtomdata ? 1 : 0)
+    };
+    ibuffers[eoipNBAT_ARENA]  =  (packet_buffer){
+        st->nbat_arena, sizeof(st->nbat_arena)
+    };
+    ibuffers[eoipBUFFER_FLAGS] = (packet_buffer){
+        nbat->buffer_flags.flag, sizeof(gmx_bitmask_t) * (bSendFlags ? nbat->buffer_flags.flag_nalloc : 0)
+    };
+    ibuffers[eoipIC] = (packet_buffer){
+        ic, sizeof(interaction_const_t) * (bSendAtomdata ? 1 : 0)
+    };
+    ibuffers[eoipDIAG] = (packet_buffer){
+        diag, sizeof(real) * (bSendAtomdata ? diag_size : 0)
+    };
+    ibuffers[eoipFILTER1] = (packet_buffer){
+        nbat->simd_exclusion_filter1, sizeof(unsigned int) * (bSendAtomdata ? NBNXN_CPU_CLUSTER_I_SIZE*simd_width : 0)
+    };
+    ibuffers[eoipFILTER2] = (packet_buffer){
+        nbat->simd_exclusion_filter2, sizeof(unsigned int) * (bSendAtomdata ? 2*NBNXN_CPU_CLUSTER_I_SIZE*simd_width : 0)
+    };
+    ibuffers[eoipTABQ_COUL_F] = (packet_buffer){
+        ic->tabq_coul_F, sizeof(real) * (bSendAtomdata ? ntabq : 0)
+    };
+    ibuffers[eoipTABQ_COUL_V] = (packet_buffer){
+        ic->tabq_coul_V, sizeof(real) * (bSendAtomdata ? ntabq : 0)
+    };
+    ibuffers[eoipTABQ_COUL_FDV0] = (packet_buffer){
+        ic->tabq_coul_FDV0, sizeof(real) * (bSendAtomdata ? 4*ntabq : 0)
+    };
+    ibuffers[eoipTABCS] = (packet_buffer){
+        ic->tabcs_data, sizeof(real) * (bSendAtomdata ? ntabcs : 0)
+    };
+    ibuffers[eoipNENER] = (packet_buffer){
+        &nener, sizeof(int)
+    };
+    nibuffer = eoipNR + setup_search_buffers(st, nbat, ilocality, ibuffers + eoipNR);
+
+    size_t packet_in_size = compute_required_size(ibuffers, nibuffer);
+    if (packet_in_size > st->in_packet_size)
+    {
+        if (st->cpu_out_packet != NULL)
+        {
+            backend->mirror_free(offload->backend_ctx, st->cpu_out_packet, st->dev_in_packet);
+        }
+        st->cpu_out_packet = backend->mirror_alloc(offload->backend_ctx, 2*packet_in_size, (void **)&st->dev_in_packet);
+        st->in_packet_size = 2*packet_in_size;
+    }
+    packdata(st->cpu_out_packet, ibuffers, nibuffer);
+
+    packet_buffer obuffers[eoopNR];
+    obuffers[eoopFSHIFT] = (packet_buffer){
+        nbat->out[0].fshift, bReduceF ? sizeof(real) * SHIFTS * DIM : 0
+    };
+    obuffers[eoopVC] = (packet_buffer){
+        st->V_buffer, sizeof(real) * nener
+    };
+    obuffers[eoopVVDW] = (packet_buffer){
+        st->V_buffer + nener, sizeof(real) * nener
+    };
+    obuffers[eoopTIMING] = (packet_buffer){
+        st->device_t, sizeof(st->device_t)
+    };
+    obuffers[eoopNATPAIR] = (packet_buffer){
+        st->natpair, st->bSearch ? sizeof(st->natpair) : 0
+    };
+    obuffers[eoopF] = (packet_buffer){
+        NULL, bReduceF ? sizeof(real) * nbat->natoms * nbat->fstride : 0
+    };
+    size_t packet_out_size = compute_required_size(obuffers, eoopNR);
+    size_t f_offset        = compute_buffer_offset(obuffers, eoopNR, eoopF);
+    if (packet_out_size > st->out_packet_size)
+    {
+        if (st->cpu_in_packet != NULL)
+        {
+            backend->mirror_free(offload->backend_ctx, st->cpu_in_packet, st->dev_out_packet);
+        }
+        st->cpu_in_packet   = backend->mirror_alloc(offload->backend_ctx, 2*packet_out_size, (void **)&st->dev_out_packet);
+        st->out_packet_size = 2*packet_out_size;
+    }
+
+    //TODO: instead of sending the masks we should call init_simple_exclusion_masks
+    //nbat->simd_4xn_diagonal_j_minus_i  = simd_4xn_diagonal_j_minus_i_p;
+    //                nbat->simd_2xnn_diagonal_j_minus_i = simd_2xnn_diagonal_j_minus_i_p;
+    //                nbat->simd_exclusion_filter1       = simd_exclusion_filter1_p;
+    //                nbat->simd_exclusion_filter2       = simd_exclusion_filter2_p;
+
+    // TODO: What about nbl->excl ?
+
+    offload_launch_t launch;
+    launch.stream         = ilocality;
+    launch.ranges         = st->ranges;
+    launch.nrange         = st->nrange;
+    launch.cpu_out_packet = st->cpu_out_packet;
+    launch.dev_in_packet  = st->dev_in_packet;
+    launch.in_size        = packet_in_size;
+    launch.dev_out_packet = st->dev_out_packet;
+    launch.cpu_in_packet  = st->cpu_in_packet;
+    launch.out_size       = packet_out_size;
+    launch.kernel_type    = nbvg->kernel_type;
+    launch.flags          = flags;
+    launch.clearF         = clearF;
+    launch.ewald_excl     = nbvg->ewald_excl;
+    launch.bReduceF       = bReduceF;
+    launch.xfer_t         = st->xfer_t;
+    /* The force chunks are whole buffer flag blocks */
+    int natoms_f_chunk    = 0;
+    if (bReduceF && nbat->natoms > 0)
+    {
+        natoms_f_chunk = (nbat->natoms + offload->nf_chunk - 1)/offload->nf_chunk;
+        natoms_f_chunk = ((natoms_f_chunk + NBNXN_BUFFERFLAG_SIZE - 1)/NBNXN_BUFFERFLAG_SIZE)*NBNXN_BUFFERFLAG_SIZE;
+        launch.f_offset     = f_offset;
+        launch.f_chunk_size = natoms_f_chunk*nbat->fstride*sizeof(real);
+        launch.nf_chunk     = (nbat->natoms + natoms_f_chunk - 1)/natoms_f_chunk;
+    }
+    else
+    {
+        launch.f_offset     = packet_out_size;
+        launch.f_chunk_size = 0;
+        launch.nf_chunk     = 0;
+    }
+    wallcycle_sub_stop(wcycle, ewcsOFFLOAD_PACK);
+    offload->step_t[eotPACK] += 1000*(offload_wtime() - t_start);
+
+    if (ilocality == eintLocal && offload->bBalance)
+    {
+        offload->cyc_launch = gmx_cycles_read();
+    }
+    backend->launch(offload->backend_ctx, &launch);
+    st->bRefreshNbl = FALSE;
+    st->bLaunched   = TRUE;
+
+    st->unpack_data.out_packet_addr          = st->cpu_in_packet;
+    st->unpack_data.cpu_buffers[eoopFSHIFT]  = obuffers[eoopFSHIFT].p;
+    st->unpack_data.cpu_buffers[eoopVC]      = obuffers[eoopVC].p;
+    st->unpack_data.cpu_buffers[eoopVVDW]    = obuffers[eoopVVDW].p;
+    st->unpack_data.cpu_buffers[eoopTIMING]  = obuffers[eoopTIMING].p;
+    st->unpack_data.cpu_buffers[eoopNATPAIR] = obuffers[eoopNATPAIR].p;
+    st->unpack_data.cpu_buffers[eoopF]       = NULL;
+    st->unpack_data.nener                    = nener;
+    st->unpack_data.Vc                       = enerd->grpp.ener[egCOULSR];
+    st->unpack_data.Vvdw                     = fr->bBHAM ? enerd->grpp.ener[egBHAMSR] : enerd->grpp.ener[egLJSR];
+    st->unpack_data.f                        = (real *)(st->cpu_in_packet + launch.f_offset);
+    st->unpack_data.nf_chunk                 = launch.nf_chunk;
+    st->unpack_data.natoms_f_chunk           = natoms_f_chunk;
+    st->unpack_data.natpair_lists            = st->bSearch ? nbl_lists : NULL;
+
+    st->bSearch = FALSE;
+}
+
+// Wait for the head of the output packet of stream, with chunk < 0,
+// or for force chunk chunk, and account the wait time
+static void offload_wait_part(nbnxn_offload_t *offload, int stream, int chunk,
+                              gmx_wallcycle_t wcycle)
+{
+    gmx_cycles_t cyc_start = gmx_cycles_read();
+    double       t_start   = offload_wtime();
+
+    if (chunk < 0)
+    {
+        wallcycle_start(wcycle, ewcWAIT_OFFLOAD_NB);
+        backend->wait(offload->backend_ctx, stream);
+    }
+    else
+    {
+        wallcycle_start_nocount(wcycle, ewcWAIT_OFFLOAD_NB);
+        backend->wait_f_chunk(offload->backend_ctx, stream, chunk);
+    }
+    wallcycle_stop(wcycle, ewcWAIT_OFFLOAD_NB);
+
+    offload->step_t[eotWAIT] += 1000*(offload_wtime() - t_start);
+    if (offload->bBalance)
+    {
+        offload->cyc_ready  = gmx_cycles_read();
+        offload->cyc_wait  += (double)(offload->cyc_ready - cyc_start);
+    }
+}
+
+void wait_for_offload(nbnxn_offload_t *offload, int ilocality,
+                      gmx_wallcycle_t wcycle)
+{
+    offload_unpack_data *ud = &offload->streams[ilocality].unpack_data;
+    const real          *Vc_offload, *Vvdw_offload;
+    double               t_start;
+    int                  i;
+
+    offload_wait_part(offload, ilocality, -1, wcycle);
+
+    t_start = offload_wtime();
+    wallcycle_start(wcycle, ewcNB_XF_BUF_OPS);
+    wallcycle_sub_start(wcycle, ewcsOFFLOAD_UNPACK);
+
+    /* The forces come last in the packet, they arrive in chunks */
+    unpackdata(ud->out_packet_addr, ud->cpu_buffers, eoopF);
+
+    Vc_offload   = (const real *)ud->cpu_buffers[eoopVC];
+    Vvdw_offload = (const real *)ud->cpu_buffers[eoopVVDW];
+    for (i = 0; i < ud->nener; i++)
+    {
+        ud->Vc[i]   += Vc_offload[i];
+        ud->Vvdw[i] += Vvdw_offload[i];
+    }
+    if (ud->natpair_lists != NULL)
+    {
+        const int *natpair = (const int *)ud->cpu_buffers[eoopNATPAIR];
+
+        ud->natpair_lists->natpair_ljq = natpair[0];
+        ud->natpair_lists->natpair_lj  = natpair[1];
+        ud->natpair_lists->natpair_q   = natpair[2];
+    }
+
+    wallcycle_sub_stop(wcycle, ewcsOFFLOAD_UNPACK);
+    wallcycle_stop(wcycle, ewcNB_XF_BUF_OPS);
+    offload->step_t[eotUNPACK] += 1000*(offload_wtime() - t_start);
+}
+
+void nbnxn_offload_add_f(t_forcerec *fr, rvec *f, gmx_wallcycle_t wcycle)
+{
+    nonbonded_verlet_t  *nbv     = fr->nbv;
+    nbnxn_offload_t     *offload = nbv->offload;
+    int                  stream  = nbv->ngrp - 1;
+    offload_unpack_data *ud      = &offload->streams[stream].unpack_data;
+    nbnxn_atomdata_t    *nbat    = nbv->grp[eintLocal].nbat;
+    int                  nth     = gmx_omp_nthreads_get(emntDefault);
+    int                  c;
+
+    for (c = 0; c < ud->nf_chunk; c++)
+    {
+        int    i0 = c*ud->natoms_f_chunk;
+        int    i1 = (c + 1)*ud->natoms_f_chunk;
+        double t_start;
+
+        if (i1 > nbat->natoms)
+        {
+            i1 = nbat->natoms;
+        }
+        offload_wait_part(offload, stream, c, wcycle);
+
+        t_start = offload_wtime();
+        wallcycle_start_nocount(wcycle, ewcNB_XF_BUF_OPS);
+        wallcycle_sub_start_nocount(wcycle, ewcsNB_F_BUF_OPS);
+        nbnxn_atomdata_add_nbat_f_range_to_f(nbv->nbs, nbat,
+                                             ud->f + i0*nbat->fstride,
+                                             i0, i1, f, nth);
+        wallcycle_sub_stop(wcycle, ewcsNB_F_BUF_OPS);
+        wallcycle_stop(wcycle, ewcNB_XF_BUF_OPS);
+        offload->step_t[eotUNPACK] += 1000*(offload_wtime() - t_start);
+    }
+}
+
+void nbnxn_offload_step_done(nbnxn_offload_t *offload, gmx_int64_t step)
+{
+    char buf[STEPSTRSIZE];
+    int  s, t;
+
+    for (s = 0; s < OFFLOAD_NUM_STREAMS; s++)
+    {
+        offload_stream_t *st = &offload->streams[s];
+
+        if (st->bLaunched)
+        {
+            offload->step_t[eotXFER_IN]  += st->xfer_t[0];
+            offload->step_t[eotKERNEL]   += st->device_t[0];
+            offload->step_t[eotREDUCE]   += st->device_t[1];
+            offload->step_t[eotXFER_OUT] += st->xfer_t[1];
+            st->bLaunched                 = FALSE;
+        }
+    }
+
+    offload->timings.xfer_in_t  += offload->step_t[eotXFER_IN];
+    offload->timings.kernel_t   += offload->step_t[eotKERNEL];
+    offload->timings.reduce_t   += offload->step_t[eotREDUCE];
+    offload->timings.xfer_out_t += offload->step_t[eotXFER_OUT];
+    offload->timings.nb_c++;
+
+    if (offload->fp_trace != NULL)
+    {
+        if (offload->bTraceJSON)
+        {
+            fprintf(offload->fp_trace, "{\"step\": %s", gmx_step_str(step, buf));
+            for (t = 0; t < eotNR; t++)
+            {
+                fprintf(offload->fp_trace, ", \"%s\": %.4f", eot_names[t], offload->step_t[t]);
+            }
+            fprintf(offload->fp_trace, "}\n");
+        }
+        else
+        {
+            fprintf(offload->fp_trace, "%s", gmx_step_str(step, buf));
+            for (t = 0; t < eotNR; t++)
+            {
+                fprintf(offload->fp_trace, ",%.4f", offload->step_t[t]);
+            }
+            fprintf(offload->fp_trace, "\n");
+        }
+    }
+
+    for (t = 0; t < eotNR; t++)
+    {
+        offload->step_t[t] = 0;
+    }
+}
+
+void nbnxn_offload_finish(nbnxn_offload_t *offload)
+{
+    int s;
+
+    for (s = 0; s < OFFLOAD_NUM_STREAMS; s++)
+    {
+        offload_stream_t *st = &offload->streams[s];
+
+        if (st->cpu_out_packet != NULL)
+        {
+            backend->mirror_free(offload->backend_ctx, st->cpu_out_packet, st->dev_in_packet);
+            st->cpu_out_packet = NULL;
+        }
+        if (st->cpu_in_packet != NULL)
+        {
+            backend->mirror_free(offload->backend_ctx, st->cpu_in_packet, st->dev_out_packet);
+            st->cpu_in_packet = NULL;
+        }
+    }
+    backend->finalize(offload->backend_ctx);
+    offload->backend_ctx = NULL;
+    offload_arena_release();
+
+    if (offload->fp_trace != NULL)
+    {
+        gmx_ffclose(offload->fp_trace);
+        offload->fp_trace = NULL;
+    }
+}
+
+struct gmx_wallclock_offload_t *nbnxn_offload_get_timings(nbnxn_offload_t *offload)
+{
+    return (offload != NULL) ? &offload->timings : NULL;
+}
+
+void nbnxn_offload_reset_timings(nbnxn_offload_t *offload)
+{
+    offload->timings.xfer_in_t  = 0;
+    offload->timings.kernel_t   = 0;
+    offload->timings.reduce_t   = 0;
+    offload->timings.xfer_out_t = 0;
+    offload->timings.nb_c       = 0;
+}
+
+void nbnxn_offload_do_host_share(t_forcerec *fr,
+                                 interaction_const_t *ic,
+                                 gmx_enerdata_t *enerd,
+                                 int flags, int ilocality,
+                                 int clearF)
+{
+    nbnxn_offload_t          *offload = fr->nbv->offload;
+    nonbonded_verlet_group_t *nbvg    = &fr->nbv->grp[ilocality];
+    offload_stream_t         *st      = &offload->streams[ilocality];
+    nbnxn_atomdata_t          nbat;
+    gmx_cycles_t              cyc_start;
+    int                       i, j;
+
+    if (!offload->bHostShare || offload->host_fraction <= 0)
+    {
+        return;
+    }
+
+    cyc_start = gmx_cycles_read();
+
+    /* The host share uses its own thread output buffers, so it does not
+     * interfere with the buffers the target results are returned in.
+     */
+    nbat = *nbvg->nbat;
+    if (offload->host_out == NULL)
+    {
+        offload->host_nout = nbat.nout;
+        snew(offload->host_out, offload->host_nout);
+        for (i = 0; i < offload->host_nout; i++)
+        {
+            nbnxn_atomdata_output_init(&offload->host_out[i], nbvg->kernel_type,
+                                       nbat.nenergrp, 1<<nbat.neg_2log,
+                                       nbat.alloc);
+        }
+    }
+    if (nbat.nalloc > offload->host_out_nalloc)
+    {
+        for (i = 0; i < offload->host_nout; i++)
+        {
+            nbnxn_realloc_void((void **)&offload->host_out[i].f, 0,
+                               nbat.nalloc*nbat.fstride*sizeof(*offload->host_out[i].f),
+                               nbat.alloc, nbat.free);
+        }
+        offload->host_out_nalloc = nbat.nalloc;
+    }
+    nbat.out = offload->host_out;
+
+    if (st->host_nci > 0 || clearF == enbvClearFYes)
+    {
+        /* With a single list the kernel accumulates the shift forces
+         * in the buffer we pass without clearing it.
+         */
+        if (clearF == enbvClearFYes)
+        {
+            for (j = 0; j < SHIFTS*DIM; j++)
+            {
+                offload->host_out[0].fshift[j] = 0;
+            }
+        }
+        run_simd_kernel(nbvg->kernel_type, &st->host_lists,
+                        &nbat, ic,
+                        nbvg->ewald_excl,
+                        fr->shift_vec,
+                        flags,
+                        clearF,
+                        offload->host_out[0].fshift,
+                        enerd->grpp.ener[egCOULSR],
+                        fr->bBHAM ?
+                        enerd->grpp.ener[egBHAMSR] :
+                        enerd->grpp.ener[egLJSR]);
+    }
+
+    if (offload->bBalance)
+    {
+        offload->cyc_host += (double)(gmx_cycles_read() - cyc_start);
+    }
+}
+
+void nbnxn_offload_add_host_share_f(t_forcerec *fr, int flags, rvec *f)
+{
+    nonbonded_verlet_t *nbv     = fr->nbv;
+    nbnxn_offload_t    *offload = nbv->offload;
+    nbnxn_atomdata_t    nbat;
+    int                 th, j;
+
+    if (!offload->bHostShare || offload->host_fraction <= 0)
+    {
+        return;
+    }
+
+    nbat     = *nbv->grp[eintLocal].nbat;
+    nbat.out = offload->host_out;
+    nbnxn_atomdata_add_nbat_f_to_f(nbv->nbs, eatAll, &nbat, f);
+
+    if (flags & GMX_FORCE_VIRIAL)
+    {
+        for (th = 0; th < offload->host_nout; th++)
+        {
+            for (j = 0; j < SHIFTS*DIM; j++)
+            {
+                ((real *)fr->fshift)[j] += offload->host_out[th].fshift[j];
+            }
+        }
+    }
+}
+
+void setRefreshNblForOffload(nbnxn_offload_t *offload)
+{
+    int s;
+
+    for (s = 0; s < OFFLOAD_NUM_STREAMS; s++)
+    {
+        offload->streams[s].bRefreshNbl = TRUE;
+    }
+}
+
+gmx_bool nbnxn_offload_search_on_target(const nbnxn_offload_t *offload)
+{
+    return (offload != NULL && offload->bTargetSearch);
+}
+
+void nbnxn_offload_make_pairlist(nbnxn_offload_t *offload,
+                                 const nbnxn_search_t nbs,
+                                 const t_blocka *excl,
+                                 real rlist, int min_ci_balanced,
+                                 int ilocality)
+{
+    offload_stream_t *st = &offload->streams[ilocality];
+    offload_search_t *sp = &st->search;
+
+    if (nbs->bFEP)
+    {
+        gmx_fatal(FARGS, "The pair search can not run on the offload target with perturbed atoms, unset GMX_OFFLOAD_SEARCH");
+    }
+
+    st->bSearch         = TRUE;
+    st->nbs             = nbs;
+    st->excl            = excl;
+    sp->ePBC            = nbs->ePBC;
+    copy_mat(nbs->box, sp->box);
+    sp->DomDec          = nbs->DomDec;
+    copy_ivec(nbs->dd_dim, sp->dd_dim);
+    /* The local launch sends the grids of all zones */
+    sp->ngrid           = (ilocality == eintLocal) ? nbs->ngrid : 0;
+    sp->natoms_local    = nbs->natoms_local;
+    sp->natoms_nonlocal = nbs->natoms_nonlocal;
+    sp->excl_nr         = excl->nr;
+    sp->rlist           = rlist;
+    sp->min_ci_balanced = min_ci_balanced;
+}
+
+void nbnxn_offload_init(FILE *fplog, const t_commrec *cr,
+                        nbnxn_offload_t **offload, int device)
+{
+    nbnxn_offload_t *ol;
+    const char      *trace;
+    int              s;
+
+    if (backend == NULL)
+    {
+        gmx_incons("Offload context requested without an offload target");
+    }
+    if (device < 0 || device >= offloadNumDevices())
+    {
+        gmx_fatal(FARGS, "Offload device %d requested, but there are only %d offload devices",
+                  device, offloadNumDevices());
+    }
+
+    snew(ol, 1);
+    ol->device      = device;
+    ol->backend_ctx = backend->init(device);
+    offload_arena_retain();
+    for (s = 0; s < OFFLOAD_NUM_STREAMS; s++)
+    {
+        ol->streams[s].bRefreshNbl = TRUE;
+    }
+    ol->nf_chunk = OFFLOAD_DEFAULT_F_CHUNKS;
+    if (getenv("GMX_OFFLOAD_F_CHUNKS") != NULL)
+    {
+        ol->nf_chunk = strtol(getenv("GMX_OFFLOAD_F_CHUNKS"), NULL, 10);
+        if (ol->nf_chunk < 1 || ol->nf_chunk > OFFLOAD_MAX_F_CHUNKS)
+        {
+            gmx_fatal(FARGS, "GMX_OFFLOAD_F_CHUNKS should be between 1 and %d",
+                      OFFLOAD_MAX_F_CHUNKS);
+        }
+    }
+    if (fplog != NULL)
+    {
+        fprintf(fplog, "Offloading the non-bonded kernels to %s device %d, forces are returned in %d chunks\n",
+                backend->name, device, ol->nf_chunk);
+    }
+
+    trace = getenv("GMX_OFFLOAD_TRACE");
+    if (trace != NULL)
+    {
+        const char *ext = strrchr(trace, '.');
+        char        fn[GMX_PATH_MAX];
+        int         t;
+
+        ol->bTraceJSON = (ext != NULL && gmx_strcasecmp(ext, ".json") == 0);
+        if (cr->nnodes > 1)
+        {
+            /* Each rank writes its own trace file */
+            int len = (ext != NULL) ? (int)(ext - trace) : (int)strlen(trace);
+
+            sprintf(fn, "%.*s_rank%d%s", len, trace, cr->nodeid,
+                    (ext != NULL) ? ext : "");
+        }
+        else
+        {
+            sprintf(fn, "%s", trace);
+        }
+        ol->fp_trace = gmx_ffopen(fn, "w");
+        if (!ol->bTraceJSON)
+        {
+            fprintf(ol->fp_trace, "step");
+            for (t = 0; t < eotNR; t++)
+            {
+                fprintf(ol->fp_trace, ",%s", eot_names[t]);
+            }
+            fprintf(ol->fp_trace, "\n");
+        }
+        if (fplog != NULL)
+        {
+            fprintf(fplog, "Writing per-step offload timings in ms to %s\n", fn);
+        }
+    }
+
+    ol->bTargetSearch = (getenv("GMX_OFFLOAD_SEARCH") != NULL);
+    if (ol->bTargetSearch && fplog != NULL)
+    {
+        fprintf(fplog, "The non-bonded pair lists are built on the offload target\n");
+    }
+
+    /* The host can only compute part of the pair lists when these are
+     * laid out for the SIMD width of the host kernels and built on the host.
+     */
+#ifdef GMX_NBNXN_SIMD_2XNN
+    ol->bHostShare = (backend->simd_width == GMX_SIMD_REAL_WIDTH &&
+                      !ol->bTargetSearch);
+#else
+    ol->bHostShare = FALSE;
 #endif
+    if (ol->bHostShare)
+    {
+        char *env = getenv("GMX_OFFLOAD_HOST_FRACTION");
+
+        if (env != NULL)
+        {
+            ol->host_fraction = strtod(env, NULL);
+            if (ol->host_fraction < 0 || ol->host_fraction > OFFLOAD_HOST_FRACTION_MAX)
+            {
+                gmx_fatal(FARGS, "GMX_OFFLOAD_HOST_FRACTION should be between 0 and %g, not '%s'",
+                          OFFLOAD_HOST_FRACTION_MAX, env);
+            }
+            ol->bBalance = FALSE;
+        }
+        else
+        {
+            ol->host_fraction = 0;
+            ol->bBalance      = gmx_cycles_have_counter();
+        }
+        if (fplog != NULL)
+        {
+            if (ol->bBalance)
+            {
+                fprintf(fplog, "The host computes a share of the non-bonded work, balanced at run time\n");
+            }
+            else
+            {
+                fprintf(fplog, "The host computes %.0f%% of the non-bonded work\n",
+                        100*ol->host_fraction);
+            }
+        }
+    }
+
+    *offload = ol;
+}
+
+void init_offload_target(FILE *fplog)
+{
+#ifdef GMX_OFFLOAD
+    offload_target = eoffloadMIC;
+    backend        = &offload_backend_mic;
+#else
+    if (getenv("GMX_OFFLOAD_LOOPBACK") != NULL)
+    {
+        offload_target = eoffloadLOOPBACK;
+        backend        = &offload_backend_loopback;
+    }
+    else
+    {
+        offload_target = eoffloadNONE;
+        backend        = NULL;
+    }
+#endif
+    if (fplog != NULL && backend != NULL)
+    {
+        fprintf(fplog, "Using the %s offload target for the non-bonded kernels\n",
+                backend->name);
+    }
+    if (backend != NULL)
+    {
+        offload_arena_init(fplog);
+    }
+}
+
+int offloadTarget()
+{
+    return offload_target;
+}
+
+int offloadTargetSimdWidth()
+{
+    return (backend != NULL) ? backend->simd_width : 0;
+}
+
+int offloadNumDevices()
+{
+    return (backend != NULL) ? backend->num_devices() : 0;
+}
+
+gmx_bool offloadedKernelEnabled(int kernel_type)
+{
+    if (offload_target == eoffloadNONE)
+    {
+        return FALSE;
+    }
+    /* The same SIMD widths as in nbnxn_simd.h, but for the target */
+    switch (kernel_type)
+    {
+#ifdef GMX_NBNXN_SIMD_4XN
+        case nbnxnk4xN_SIMD_4xN:
+            return (backend->simd_width == 2 || backend->simd_width == 4 ||
+                    backend->simd_width == 8);
+#endif
+#ifdef GMX_NBNXN_SIMD_2XNN
+        case nbnxnk4xN_SIMD_2xNN:
+            return (backend->simd_width == 8 || backend->simd_width == 16);
+#endif
+        default:
+            return FALSE;
+    }
 }
@@ -37,38 +37,188 @@
 #ifndef GMX_OFFLOAD_HEADER
 #define GMX_OFFLOAD_HEADER
 
+#include <stdio.h>
+
+#include "../legacyheaders/types/commrec_fwd.h"
+#include "../timing/wallcycle.h"
+#include "../topology/block.h"
 #include "../utility/basedefinitions.h"
 
+#include "nbnxn_pairlist.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/* Run 2xnn kernel on Intel Xeon Phi coprocessor. Note that this also does
- * force and fshift reductions, unlike the normal, non-offloaded kernel.
+/* Offload targets: none, an Intel Xeon Phi coprocessor, or the loopback
+ * target, which runs the offload path on a dedicated host thread.
+ */
+enum {
+    eoffloadNONE, eoffloadMIC, eoffloadLOOPBACK, eoffloadNR
+};
+
+/* The offload context of a PP rank: the device it uses, its streams and
+ * the backend state, see nb_verlet_simd_offload.c.
+ */
+typedef struct nbnxn_offload_t nbnxn_offload_t;
+
+/*
+ * Select the offload target for this run. Builds with GMX_OFFLOAD use the
+ * Xeon Phi. Other builds use the loopback target when the environment
+ * variable GMX_OFFLOAD_LOOPBACK is set, so that the offload path can be run
+ * and profiled on machines without a coprocessor. A positive value of
+ * GMX_OFFLOAD_LOOPBACK sets the number of loopback devices, default 1.
+ * With GMX_OFFLOAD_LOOPBACK_PINOFFSET set, the threads of loopback device d
+ * are pinned to consecutive logical cores starting at that offset plus
+ * d times the number of non-bonded threads.
+ * This is called once per run, before any thread-MPI ranks are spawned,
+ * so that each run picks up the current environment.
+ */
+void init_offload_target(FILE *fplog);
+
+/*
+ * Return the offload target selected for this run, one of the enum above.
+ */
+int offloadTarget();
+
+/*
+ * Return the SIMD width of the non-bonded kernels on the offload target.
+ */
+int offloadTargetSimdWidth();
+
+/*
+ * Return the number of offload devices in this node, 0 without offloading.
+ */
+int offloadNumDevices();
+
+/*
+ * Create the offload context of this PP rank for offloading to device.
+ * When the environment variable GMX_OFFLOAD_TRACE is set, the timings of
+ * each step are written to the file it names, as CSV, or as JSON lines
+ * when the name ends in .json. With several ranks, each rank writes its
+ * own file with _rank<N> inserted before the extension.
+ */
+void nbnxn_offload_init(FILE *fplog, const t_commrec *cr,
+                        nbnxn_offload_t **offload, int device);
+
+/* Launch the SIMD kernel of locality ilocality, 4xN or 2xNN, on the
+ * offload target. Note that the last launch of a step, the non-local one
+ * with domain decomposition, also does the force and fshift reductions,
+ * unlike the normal, non-offloaded kernel.
+ */
+void nbnxn_kernel_simd_offload(t_forcerec *fr,
+                               interaction_const_t *ic,
+                               gmx_enerdata_t *enerd,
+                               int flags, int ilocality,
+                               int clearF,
+                               t_nrnb *nrnb,
+                               gmx_wallcycle_t wcycle);
+/*
+ * Wait for the offloaded kernel computation of locality ilocality to complete
+ * and add the energies it returned. The launches of both localities run in
+ * order on the target. With domain decomposition the non-local launch,
+ * which is issued last, also returns the reduced forces and shift forces
+ * of both localities. The shift forces are unpacked here, the forces
+ * are added by nbnxn_offload_add_f.
+ */
+void wait_for_offload(nbnxn_offload_t *offload, int ilocality,
+                      gmx_wallcycle_t wcycle);
+
+/*
+ * Add the non-bonded forces returned by the last launch of the step to f.
+ * These arrive in chunks of grid atoms, each chunk is added as soon as it
+ * has arrived, while the target is still packing and sending the later
+ * ones. The number of chunks can be set with the environment variable
+ * GMX_OFFLOAD_F_CHUNKS. Call this after wait_for_offload for the last
+ * launch.
+ */
+void nbnxn_offload_add_f(t_forcerec *fr, rvec *f, gmx_wallcycle_t wcycle);
+
+/*
+ * Close the offload timings of step: add the transfer and target kernel
+ * times of the launches of this step to the run totals and, with
+ * GMX_OFFLOAD_TRACE, write the timings of the step to the trace file.
+ */
+void nbnxn_offload_step_done(nbnxn_offload_t *offload, gmx_int64_t step);
+
+/*
+ * Finish the offloading of this PP rank at the end of the run:
+ * free the packets, stop the work on the offload target and release
+ * the target state and this rank's reference to the offload arena,
+ * and close the trace file.
+ */
+void nbnxn_offload_finish(nbnxn_offload_t *offload);
+
+/*
+ * Return the offload timings accumulated over the run, for the
+ * performance summary of wallcycle_print.
+ */
+struct gmx_wallclock_offload_t *nbnxn_offload_get_timings(nbnxn_offload_t *offload);
+
+/*
+ * Reset the offload timings accumulated over the run.
+ */
+void nbnxn_offload_reset_timings(nbnxn_offload_t *offload);
+
+/*
+ * Compute the host share of the pair lists of locality ilocality with the
+ * host non-bonded threads. This should be called after both launches of
+ * the step, while the target computes its share. The host share is a
+ * suffix of i-clusters of each pair list. Its size is set at each pair-list
+ * step, from the environment variable GMX_OFFLOAD_HOST_FRACTION, or, by
+ * default, by balancing the host and target times measured since the
+ * previous pair-list step. This is only possible when the host kernels
+ * have the SIMD width of the target kernels, otherwise the target gets
+ * the whole lists.
  */
-void nbnxn_kernel_simd_2xnn_offload(t_forcerec *fr,
-                                    interaction_const_t *ic,
-                                    gmx_enerdata_t *enerd,
-                                    int flags, int ilocality,
-                                    int clearF,
-                                    t_nrnb *nrnb);
+void nbnxn_offload_do_host_share(t_forcerec *fr,
+                                 interaction_const_t *ic,
+                                 gmx_enerdata_t *enerd,
+                                 int flags, int ilocality,
+                                 int clearF);
+
 /*
- * Wait for offloaded kernel computation to complete
+ * Add the forces and, with flags containing GMX_FORCE_VIRIAL, the shift
+ * forces of the host share of both localities to f and fr->fshift.
  */
-void wait_for_offload();
+void nbnxn_offload_add_host_share_f(t_forcerec *fr, int flags, rvec *f);
 
 /*
  * Signal to the offloaded kernel that the neighbour list has been refreshed.
  * This causes additional data to be offloaded on the next offload computation.
  */
-void setRefreshNblForOffload();
+void setRefreshNblForOffload(nbnxn_offload_t *offload);
+
+/*
+ * Return whether the pair lists are built on the offload target. This is
+ * selected with the environment variable GMX_OFFLOAD_SEARCH. The host then
+ * only puts the atoms on the search grid and calls
+ * nbnxn_offload_make_pairlist instead of nbnxn_make_pairlist. The host does
+ * not compute a share of the pair lists in this mode.
+ */
+gmx_bool nbnxn_offload_search_on_target(const nbnxn_offload_t *offload);
+
+/*
+ * Have the next launch of locality ilocality build its pair lists on the
+ * target, with the same parameters as nbnxn_make_pairlist. The local launch
+ * sends the search grids of all zones, the atom order and the exclusions
+ * along, so for the non-local launch the grids should be set up before
+ * the local launch. The pair counts used for flop accounting are returned
+ * by the launch, so they are only updated after the wait.
+ */
+void nbnxn_offload_make_pairlist(nbnxn_offload_t *offload,
+                                 const nbnxn_search_t nbs,
+                                 const t_blocka *excl,
+                                 real rlist, int min_ci_balanced,
+                                 int ilocality);
 
 /*
  * Query whether the offloaded kernel is being used for the current run. Note
  * that this is different from the GMX_OFFLOAD macro, which only indicates that
- * the build supports offloading. The kernel type is needed because it is
+ * the build supports offloading to a Xeon Phi. The kernel type is needed because it is
  * possible to use multiple kernels, and so offloading could be used for only
- * certain atom groups.
+ * certain atom groups. The 4xN and 2xNN SIMD kernels are offloaded when the
+ * target has them, which depends on its SIMD width.
  */
 gmx_bool offloadedKernelEnabled(int kernel_type);
 
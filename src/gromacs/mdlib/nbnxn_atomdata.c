@@ -60,25 +60,6 @@
 #include "gromacs/utility/smalloc.h"
 #include "gromacs/mdlib/nb_verlet_simd_offload.h"
 
-nbnxn_atomdata_t *get_nbat_for_offload(int id)
-{
-    if (id >= MAX_NUM_NBATS)
-    {
-        gmx_fatal(FARGS, "Request for atom data on coprocessor failed: index is out-of-range");
-    }
-    return &nbats_for_phi[id];
-}
-
-/* Assign unique ids to each atomdata. This benefits lower-level code that cannot access
- * the higher-level data structures that contain the atomdata structures.
- */
-static int next_nbnxn_atomdata_id()
-{
-    static int atomdata_id = -1;
-    atomdata_id++;
-    return atomdata_id;
-}
-
 /* Default nbnxn allocation routine, allocates NBNXN_MEM_ALIGN byte aligned */
 gmx_offload
 void nbnxn_alloc_aligned(void **ptr, size_t nbytes)
@@ -155,6 +136,21 @@ void nbnxn_atomdata_realloc(nbnxn_atomdata_t *nbat, int n, int nb_kernel_type)
                        nbat->natoms*nbat->xstride*sizeof(*nbat->x),
                        n*nbat->xstride*sizeof(*nbat->x),
                        nbat->alloc, nbat->free);
+    if (nbat->mixed != NULL)
+    {
+        nbnxn_realloc_void((void **)&nbat->mixed->lj_comb,
+                           nbat->natoms*2*sizeof(*nbat->mixed->lj_comb),
+                           n*2*sizeof(*nbat->mixed->lj_comb),
+                           nbat->alloc, nbat->free);
+        nbnxn_realloc_void((void **)&nbat->mixed->q,
+                           nbat->natoms*sizeof(*nbat->mixed->q),
+                           n*sizeof(*nbat->mixed->q),
+                           nbat->alloc, nbat->free);
+        nbnxn_realloc_void((void **)&nbat->mixed->x,
+                           nbat->natoms*nbat->xstride*sizeof(*nbat->mixed->x),
+                           n*nbat->xstride*sizeof(*nbat->mixed->x),
+                           nbat->alloc, nbat->free);
+    }
 
     if (!offloadedKernelEnabled(nb_kernel_type))
     {
@@ -175,29 +171,16 @@ void nbnxn_atomdata_realloc(nbnxn_atomdata_t *nbat, int n, int nb_kernel_type)
                            nbat->natoms*nbat->fstride*sizeof(*nbat->out[0].f),
                            n*nbat->fstride*sizeof(*nbat->out[0].f),
                            nbat->alloc, nbat->free);
-#pragma offload target(mic:0) in(nbat:length(1))
-        {
-            for (t = 0; t < nbat->nout; t++)
-            {
-                nbat->alloc = nbnxn_alloc_aligned;
-                nbat->free  = nbnxn_free_aligned;
-                nbnxn_atomdata_t *nbat_for_phi = get_nbat_for_offload(nbat->id);
-                nbnxn_realloc_void((void **)&nbat_for_phi->out[t].f,
-                                   nbat->natoms*nbat->fstride*sizeof(*nbat_for_phi->out[t].f),
-                                   n*nbat->fstride*sizeof(*nbat_for_phi->out[t].f),
-                                   nbat->alloc, nbat->free);
-            }
-        }
     }
     nbat->nalloc = n;
 }
 
 /* Initializes an nbnxn_atomdata_output_t data structure */
 gmx_offload
-static void nbnxn_atomdata_output_init(nbnxn_atomdata_output_t *out,
-                                       int nb_kernel_type,
-                                       int nenergrp, int stride,
-                                       nbnxn_alloc_t *ma)
+void nbnxn_atomdata_output_init(nbnxn_atomdata_output_t *out,
+                                int nb_kernel_type,
+                                int nenergrp, int stride,
+                                nbnxn_alloc_t *ma)
 {
     int cj_size;
 
@@ -228,6 +211,17 @@ static void nbnxn_atomdata_output_init(nbnxn_atomdata_output_t *out,
     }
 }
 
+/* Copies n reals from src to the single precision array dest */
+static void copy_real_to_float(const real *src, int n, float *dest)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        dest[i] = src[i];
+    }
+}
+
 static void copy_int_to_nbat_int(const int *a, int na, int na_round,
                                  const int *in, int fill, int *innb)
 {
@@ -506,8 +500,7 @@ void
 nbnxn_atomdata_init_simple_exclusion_masks(nbnxn_atomdata_t *nbat, int nb_kernel_type)
 {
     int       i, j;
-    gmx_bool bOffloadMasks = offloadedKernelEnabled(nb_kernel_type);
-    const int simd_width = bOffloadMasks ? 16 : GMX_SIMD_REAL_WIDTH;
+    const int simd_width = offloadedKernelEnabled(nb_kernel_type) ? offloadTargetSimdWidth() : GMX_SIMD_REAL_WIDTH;
     int       simd_excl_size;
     /* Set the diagonal cluster pair exclusion mask setup data.
      * In the kernel we check 0 < j - i to generate the masks.
@@ -526,31 +519,16 @@ nbnxn_atomdata_init_simple_exclusion_masks(nbnxn_atomdata_t *nbat, int nb_kernel
         nbat->simd_4xn_diagonal_j_minus_i[j] = j - 0.5;
     }
 
-    if (!bOffloadMasks)
-    {
-    	snew_aligned(nbat->simd_2xnn_diagonal_j_minus_i, simd_width, NBNXN_MEM_ALIGN);
-    	for (j = 0; j < simd_width/2; j++)
-    	{
-    		/* The j-cluster size is half the SIMD width */
-    		nbat->simd_2xnn_diagonal_j_minus_i[j]              = j - 0.5;
-    		/* The next half of the SIMD width is for i + 1 */
-    		nbat->simd_2xnn_diagonal_j_minus_i[simd_width/2+j] = j - 1 - 0.5;
-    	}
-    }
-    else
+    /* With offloading the 2xNN masks are set up here for the SIMD width of
+     * the target and sent along with the atom data.
+     */
+    snew_aligned(nbat->simd_2xnn_diagonal_j_minus_i, simd_width, NBNXN_MEM_ALIGN);
+    for (j = 0; j < simd_width/2; j++)
     {
-#pragma offload target(mic:0) in(nbat:length(1))
-    	{
-            nbnxn_atomdata_t *nbat_for_phi = get_nbat_for_offload(nbat->id);
-    		snew_aligned(nbat_for_phi->simd_2xnn_diagonal_j_minus_i, simd_width, NBNXN_MEM_ALIGN);
-    		for (j = 0; j < simd_width/2; j++)
-    		{
-    			/* The j-cluster size is half the SIMD width */
-    			nbat_for_phi->simd_2xnn_diagonal_j_minus_i[j]              = j - 0.5;
-    			/* The next half of the SIMD width is for i + 1 */
-    			nbat_for_phi->simd_2xnn_diagonal_j_minus_i[simd_width/2+j] = j - 1 - 0.5;
-    		}
-    	}
+        /* The j-cluster size is half the SIMD width */
+        nbat->simd_2xnn_diagonal_j_minus_i[j]              = j - 0.5;
+        /* The next half of the SIMD width is for i + 1 */
+        nbat->simd_2xnn_diagonal_j_minus_i[simd_width/2+j] = j - 1 - 0.5;
     }
 
     /* We use up to 32 bits for exclusion masking.
@@ -564,35 +542,15 @@ nbnxn_atomdata_init_simple_exclusion_masks(nbnxn_atomdata_t *nbat, int nb_kernel
      * need to use two, identical, 32-bit masks per real.
      */
     simd_excl_size = NBNXN_CPU_CLUSTER_I_SIZE*simd_width;
-    if (!bOffloadMasks)
-    {
-    	snew_aligned(nbat->simd_exclusion_filter1, simd_excl_size,   NBNXN_MEM_ALIGN);
-    	snew_aligned(nbat->simd_exclusion_filter2, simd_excl_size*2, NBNXN_MEM_ALIGN);
+    snew_aligned(nbat->simd_exclusion_filter1, simd_excl_size,   NBNXN_MEM_ALIGN);
+    snew_aligned(nbat->simd_exclusion_filter2, simd_excl_size*2, NBNXN_MEM_ALIGN);
 
-    	for (j = 0; j < simd_excl_size; j++)
-    	{
-    		/* Set the consecutive bits for masking pair exclusions */
-    		nbat->simd_exclusion_filter1[j]       = (1U << j);
-    		nbat->simd_exclusion_filter2[j*2 + 0] = (1U << j);
-    		nbat->simd_exclusion_filter2[j*2 + 1] = (1U << j);
-    	}
-    }
-    else
+    for (j = 0; j < simd_excl_size; j++)
     {
-#pragma offload target(mic:0) in(nbat:length(1))
-    	{
-            nbnxn_atomdata_t *nbat_for_phi = get_nbat_for_offload(nbat->id);
-    		snew_aligned(nbat_for_phi->simd_exclusion_filter1, simd_excl_size,   NBNXN_MEM_ALIGN);
-    		snew_aligned(nbat_for_phi->simd_exclusion_filter2, simd_excl_size*2, NBNXN_MEM_ALIGN);
-
-    		for (j = 0; j < simd_excl_size; j++)
-    		{
-    			/* Set the consecutive bits for masking pair exclusions */
-    			nbat_for_phi->simd_exclusion_filter1[j]       = (1U << j);
-    			nbat_for_phi->simd_exclusion_filter2[j*2 + 0] = (1U << j);
-    			nbat_for_phi->simd_exclusion_filter2[j*2 + 1] = (1U << j);
-    		}
-    	}
+        /* Set the consecutive bits for masking pair exclusions */
+        nbat->simd_exclusion_filter1[j]       = (1U << j);
+        nbat->simd_exclusion_filter2[j*2 + 0] = (1U << j);
+        nbat->simd_exclusion_filter2[j*2 + 1] = (1U << j);
     }
 
 #if (defined GMX_SIMD_IBM_QPX)
@@ -641,7 +599,6 @@ void nbnxn_atomdata_init(FILE *fp,
     char    *ptr;
     gmx_bool simple, bCombGeom, bCombLB, bSIMD;
 
-    nbat->id = next_nbnxn_atomdata_id();
     if (alloc == NULL)
     {
         nbat->alloc = nbnxn_alloc_aligned;
@@ -867,6 +824,7 @@ void nbnxn_atomdata_init(FILE *fp,
     nbat->xstride = (nbat->XFormat == nbatXYZQ ? STRIDE_XYZQ : DIM);
     nbat->fstride = (nbat->FFormat == nbatXYZQ ? STRIDE_XYZQ : DIM);
     nbat->x       = NULL;
+    nbat->mixed   = NULL;
 
 #ifdef GMX_NBNXN_SIMD
     if (simple)
@@ -898,20 +856,6 @@ void nbnxn_atomdata_init(FILE *fp,
                                    nb_kernel_type,
                                    nbat->nenergrp, 1<<nbat->neg_2log,
                                    nbat->alloc);
-#pragma offload target(mic:0) in(nbat:length(1))
-        {
-            nbnxn_atomdata_t *nbat_for_phi = get_nbat_for_offload(nbat->id);
-            snew(nbat_for_phi->out, nbat->nout);
-            nbat->alloc = nbnxn_alloc_aligned;
-            int i;
-            for (i = 0; i < nbat->nout; i++)
-            {
-                nbnxn_atomdata_output_init(&nbat_for_phi->out[i],
-                                           nb_kernel_type,
-                                           nbat->nenergrp, 1<<nbat->neg_2log,
-                                           nbat->alloc);
-            }
-        }
     }
     nbat->buffer_flags.flag        = NULL;
     nbat->buffer_flags.flag_nalloc = 0;
@@ -1221,6 +1165,48 @@ static void nbnxn_atomdata_set_energygroups(nbnxn_atomdata_t    *nbat,
     }
 }
 
+void nbnxn_atomdata_init_mixed(nbnxn_atomdata_t gmx_unused *nbat)
+{
+#ifdef GMX_NBNXN_SIMD_2XNN_MIXED
+    nbnxn_atomdata_mixed_t *mixed;
+    int                     nt, j;
+
+    if (nbat->XFormat != nbatX4 || nbat->nbfp_s4 == NULL || nbat->natoms > 0)
+    {
+        gmx_incons("nbnxn_atomdata_init_mixed should be called directly after initializing the atom data for 4xN SIMD kernels");
+    }
+
+    snew(mixed, 1);
+
+    nt = nbat->ntype;
+    nbat->alloc((void **)&mixed->nbfp, nt*nt*2*sizeof(*mixed->nbfp));
+    copy_real_to_float(nbat->nbfp, nt*nt*2, mixed->nbfp);
+    nbat->alloc((void **)&mixed->nbfp_s4, nt*nt*4*sizeof(*mixed->nbfp_s4));
+    copy_real_to_float(nbat->nbfp_s4, nt*nt*4, mixed->nbfp_s4);
+
+    /* The 2xNN diagonal masking data for the single precision SIMD width,
+     * which is twice the j-cluster size, see
+     * nbnxn_atomdata_init_simple_exclusion_masks().
+     */
+    nbat->alloc((void **)&mixed->simd_2xnn_diagonal_j_minus_i,
+                2*NBNXN_CPU_CLUSTER_I_SIZE*sizeof(*mixed->simd_2xnn_diagonal_j_minus_i));
+    for (j = 0; j < NBNXN_CPU_CLUSTER_I_SIZE; j++)
+    {
+        mixed->simd_2xnn_diagonal_j_minus_i[j]                            = j - 0.5;
+        mixed->simd_2xnn_diagonal_j_minus_i[NBNXN_CPU_CLUSTER_I_SIZE + j] = j - 1 - 0.5;
+    }
+
+    /* The per-atom arrays are (re)allocated in nbnxn_atomdata_realloc */
+    mixed->lj_comb = NULL;
+    mixed->q       = NULL;
+    mixed->x       = NULL;
+
+    nbat->mixed = mixed;
+#else
+    gmx_incons("The mixed-precision non-bonded kernels are not supported in this build");
+#endif
+}
+
 /* Sets all required atom parameter data in nbnxn_atomdata_t */
 void nbnxn_atomdata_set(nbnxn_atomdata_t    *nbat,
                         int                  locality,
@@ -1252,6 +1238,16 @@ void nbnxn_atomdata_set(nbnxn_atomdata_t    *nbat,
     nbnxn_atomdata_set_ljcombparams(nbat, ngrid, nbs);
 
     nbnxn_atomdata_set_energygroups(nbat, ngrid, nbs, atinfo);
+
+    if (nbat->mixed != NULL)
+    {
+        copy_real_to_float(nbat->q, nbat->natoms, nbat->mixed->q);
+        if (nbat->comb_rule != ljcrNONE)
+        {
+            copy_real_to_float(nbat->lj_comb, nbat->natoms*2,
+                               nbat->mixed->lj_comb);
+        }
+    }
 }
 
 /* Copies the shift vector array to nbnxn_atomdata_t */
@@ -1268,6 +1264,12 @@ void nbnxn_atomdata_copy_shiftvec(gmx_bool          bDynamicBox,
     }
 }
 
+void nbnxn_atomdata_copy_x_to_mixed(nbnxn_atomdata_t *nbat, int a0, int na)
+{
+    copy_real_to_float(nbat->x + a0*nbat->xstride, na*nbat->xstride,
+                       nbat->mixed->x + a0*nbat->xstride);
+}
+
 /* Copies (and reorders) the coordinates to nbnxn_atomdata_t */
 void nbnxn_atomdata_copy_x_to_nbat_x(const nbnxn_search_t nbs,
                                      int                  locality,
@@ -1339,6 +1341,12 @@ void nbnxn_atomdata_copy_x_to_nbat_x(const nbnxn_search_t nbs,
                 copy_rvec_to_nbat_real(nbs->a+ash, na, na_fill, x,
                                        nbat->XFormat, nbat->x, ash,
                                        0, 0, 0);
+                if (nbat->mixed != NULL)
+                {
+                    /* Convert the whole column, including the fillers */
+                    nbnxn_atomdata_copy_x_to_mixed(nbat, ash,
+                                                   (grid->cxy_ind[cxy+1] - grid->cxy_ind[cxy])*grid->na_sc);
+                }
             }
         }
     }
@@ -1688,19 +1696,98 @@ void nbnxn_atomdata_add_nbat_f_to_f_treereduce(const nbnxn_atomdata_t *nbat,
     sfree(syncStep);
 }
 
-static void nbnxn_atomdata_add_nbat_f_to_f_stdreduce(const nbnxn_atomdata_t *nbat,
-                                                     int                     nth)
+/* Add the forces of the grid atoms i0 to i1, stored in fnb in the layout
+ * of nbat and starting at grid atom i0, to f. Filler atoms are skipped.
+ */
+gmx_offload static void
+nbnxn_atomdata_add_nbat_f_atoms_to_f(const int              *a,
+                                     const nbnxn_atomdata_t *nbat,
+                                     const real             *fnb,
+                                     int i0, int i1,
+                                     rvec                   *f)
+{
+    int ind0, i, j, at;
+
+    ind0 = i0*nbat->fstride;
+
+    switch (nbat->FFormat)
+    {
+        case nbatXYZ:
+        case nbatXYZQ:
+            for (i = i0; i < i1; i++)
+            {
+                at = a[i];
+                if (at >= 0)
+                {
+                    j         = i*nbat->fstride - ind0;
+                    f[at][XX] += fnb[j];
+                    f[at][YY] += fnb[j+1];
+                    f[at][ZZ] += fnb[j+2];
+                }
+            }
+            break;
+        case nbatX4:
+            for (i = i0; i < i1; i++)
+            {
+                at = a[i];
+                if (at >= 0)
+                {
+                    j         = X4_IND_A(i) - ind0;
+                    f[at][XX] += fnb[j+XX*PACK_X4];
+                    f[at][YY] += fnb[j+YY*PACK_X4];
+                    f[at][ZZ] += fnb[j+ZZ*PACK_X4];
+                }
+            }
+            break;
+        case nbatX8:
+            for (i = i0; i < i1; i++)
+            {
+                at = a[i];
+                if (at >= 0)
+                {
+                    j         = X8_IND_A(i) - ind0;
+                    f[at][XX] += fnb[j+XX*PACK_X8];
+                    f[at][YY] += fnb[j+YY*PACK_X8];
+                    f[at][ZZ] += fnb[j+ZZ*PACK_X8];
+                }
+            }
+            break;
+        default:
+            gmx_incons("Unsupported nbnxn_atomdata_t format");
+    }
+}
+
+/* Reduce the force thread output buffers and add them to f in one pass.
+ * Each thread handles a range of buffer flag blocks. The flagged output
+ * buffers of a block are summed into a small, cache resident, buffer
+ * which is directly scattered to f through the grid to atom index.
+ * This avoids the reduction into, and a second pass over, out[0].f.
+ * As the grid atoms map to distinct atoms, threads never write
+ * the same elements of f.
+ */
+gmx_offload static void
+nbnxn_atomdata_add_nbat_f_to_f_fused(const nbnxn_search_t    nbs,
+                                     const nbnxn_atomdata_t *nbat,
+                                     rvec                   *f,
+                                     int                     nth)
 {
     int th;
+
 #pragma omp parallel for num_threads(nth) schedule(static)
     for (th = 0; th < nth; th++)
     {
         const nbnxn_buffer_flags_t *flags;
-        int   b0, b1, b;
-        int   i0, i1;
-        int   nfptr;
-        real *fptr[NBNXN_BUFFERFLAG_MAX_THREADS];
-        int   out;
+        int                         b0, b1, b;
+        int                         i0, i1, ind0;
+        int                         nfptr;
+        real                       *fptr[NBNXN_BUFFERFLAG_MAX_THREADS];
+        int                         out;
+#ifdef GMX_NBNXN_SIMD
+        real                        fnb_array[NBNXN_BUFFERFLAG_SIZE*STRIDE_XYZQ + GMX_SIMD_REAL_WIDTH];
+        real                       *fnb = gmx_simd_align_r(fnb_array);
+#else
+        real                        fnb[NBNXN_BUFFERFLAG_SIZE*STRIDE_XYZQ];
+#endif
 
         flags = &nbat->buffer_flags;
 
@@ -1710,33 +1797,36 @@ static void nbnxn_atomdata_add_nbat_f_to_f_stdreduce(const nbnxn_atomdata_t *nba
 
         for (b = b0; b < b1; b++)
         {
-            i0 =  b   *NBNXN_BUFFERFLAG_SIZE*nbat->fstride;
-            i1 = (b+1)*NBNXN_BUFFERFLAG_SIZE*nbat->fstride;
+            i0   = b*NBNXN_BUFFERFLAG_SIZE;
+            i1   = min(i0 + NBNXN_BUFFERFLAG_SIZE, nbat->natoms);
+            ind0 = i0*nbat->fstride;
 
             nfptr = 0;
-            for (out = 1; out < nbat->nout; out++)
+            for (out = 0; out < nbat->nout; out++)
             {
                 if (bitmask_is_set(flags->flag[b], out))
                 {
-                    fptr[nfptr++] = nbat->out[out].f;
+                    fptr[nfptr++] = nbat->out[out].f + ind0;
                 }
             }
-            if (nfptr > 0)
+            if (nfptr == 1)
+            {
+                /* Only one buffer contributes, scatter it directly */
+                nbnxn_atomdata_add_nbat_f_atoms_to_f(nbs->a, nbat, fptr[0],
+                                                     i0, i1, f);
+            }
+            else if (nfptr > 1)
             {
 #ifdef GMX_NBNXN_SIMD
                 nbnxn_atomdata_reduce_reals_simd
 #else
                 nbnxn_atomdata_reduce_reals
 #endif
-                    (nbat->out[0].f,
-                    bitmask_is_set(flags->flag[b], 0),
-                    fptr, nfptr,
-                    i0, i1);
-            }
-            else if (!bitmask_is_set(flags->flag[b], 0))
-            {
-                nbnxn_atomdata_clear_reals(nbat->out[0].f,
-                                           i0, i1);
+                    (fnb, FALSE, fptr, nfptr,
+                    0, NBNXN_BUFFERFLAG_SIZE*nbat->fstride);
+
+                nbnxn_atomdata_add_nbat_f_atoms_to_f(nbs->a, nbat, fnb,
+                                                     i0, i1, f);
             }
         }
     }
@@ -1763,22 +1853,27 @@ void nbnxn_atomdata_add_nbat_f_to_f(const nbnxn_search_t    nbs,
             gmx_incons("add_f_to_f called with nout>1 and locality!=eatAll");
         }
 
-        /* Reduce the force thread output buffers into buffer 0, before adding
-         * them to the, differently ordered, "real" force buffer.
-         */
         if (nbat->bUseTreeReduce)
         {
+            /* Reduce the force thread output buffers into buffer 0, before
+             * adding them to the, differently ordered, "real" force buffer.
+             */
             nbnxn_atomdata_add_nbat_f_to_f_treereduce(nbat, nth);
+
+            nbnxn_atomdata_add_nbat_f_to_f_final(nbs, locality, nbat, f, nth);
         }
         else
         {
-#ifndef GMX_OFFLOAD
-            nbnxn_atomdata_add_nbat_f_to_f_stdreduce(nbat, nth);
-#endif
+            /* Reduce the force thread output buffers and add them to the,
+             * differently ordered, "real" force buffer in a single pass.
+             */
+            nbnxn_atomdata_add_nbat_f_to_f_fused(nbs, nbat, f, nth);
         }
     }
-
-    nbnxn_atomdata_add_nbat_f_to_f_final(nbs, locality, nbat, f, nth);
+    else
+    {
+        nbnxn_atomdata_add_nbat_f_to_f_final(nbs, locality, nbat, f, nth);
+    }
 
 #ifndef GMX_OFFLOAD
     nbs_cycle_stop(&nbs->cc[enbsCCreducef]);
@@ -1823,6 +1918,37 @@ void nbnxn_atomdata_add_nbat_f_to_f_final(const nbnxn_search_t    nbs,
     }
 }
 
+/* Add the forces fnb, in the layout of nbat, of the grid atoms i0 to i1
+ * to f, fnb starts at atom i0. Loops over grid atoms, instead of over
+ * the atoms in f as nbnxn_atomdata_add_nbat_f_to_f_final does, so any
+ * range of whole buffer flag blocks can be added on its own.
+ */
+void nbnxn_atomdata_add_nbat_f_range_to_f(const nbnxn_search_t    nbs,
+                                          const nbnxn_atomdata_t *nbat,
+                                          const real             *fnb,
+                                          int i0, int i1,
+                                          rvec                   *f,
+                                          int                     nth)
+{
+    int th;
+
+#pragma omp parallel for num_threads(nth) schedule(static)
+    for (th = 0; th < nth; th++)
+    {
+        int a0, a1;
+
+        /* Start the thread ranges at multiples of the packing size,
+         * so the offset of a0 into fnb is a0*fstride for all layouts.
+         */
+        a0 = i0 + (((i1 - i0)* th   )/(nth*PACK_X8))*PACK_X8;
+        a1 = (th + 1 < nth) ? i0 + (((i1 - i0)*(th+1))/(nth*PACK_X8))*PACK_X8 : i1;
+
+        nbnxn_atomdata_add_nbat_f_atoms_to_f(nbs->a, nbat,
+                                             fnb + (a0 - i0)*nbat->fstride,
+                                             a0, a1, f);
+    }
+}
+
 /* Adds the shift forces from nbnxn_atomdata_t to fshift */
 void nbnxn_atomdata_add_nbat_fshift_to_fshift(const nbnxn_atomdata_t *nbat,
                                               rvec                   *fshift)
@@ -43,15 +43,6 @@
 extern "C" {
 #endif
 
-/* The maximum number of nbats that will be created. Currently 2 because 1 is
- * for local forces and 1 for nonlocal forces if domain decomposition is used.
- */
-#define MAX_NUM_NBATS 2
-gmx_offload static nbnxn_atomdata_t nbats_for_phi[MAX_NUM_NBATS];
-
-gmx_offload
-nbnxn_atomdata_t *get_nbat_for_offload(int id);
-
 /* Default nbnxn allocation routine, allocates 32 byte aligned,
  * which works for plain C and aligned SSE and AVX loads/stores.
  */
@@ -67,6 +58,15 @@ void nbnxn_realloc_void(void **ptr,
                         nbnxn_alloc_t *ma,
                         nbnxn_free_t  *mf);
 
+/* Initializes an nbnxn_atomdata_output_t data structure, also used for
+ * the output buffers on an offload target.
+ */
+gmx_offload
+void nbnxn_atomdata_output_init(nbnxn_atomdata_output_t *out,
+                                int nb_kernel_type,
+                                int nenergrp, int stride,
+                                nbnxn_alloc_t *ma);
+
 /* Reallocate the nbnxn_atomdata_t for a size of n atoms */
 void nbnxn_atomdata_realloc(nbnxn_atomdata_t *nbat, int n, int nb_kernel_type);
 
@@ -97,6 +97,19 @@ void nbnxn_atomdata_init(FILE *fp,
                          nbnxn_alloc_t *alloc,
                          nbnxn_free_t  *free);
 
+/* Sets up the single precision copies of the atom data in nbat used by
+ * the mixed-precision 2xNN kernels. Should be called directly after
+ * nbnxn_atomdata_init() for 4xN SIMD kernels. The per-atom copies are
+ * updated by nbnxn_atomdata_set(), nbnxn_atomdata_copy_x_to_nbat_x()
+ * and, during search, by nbnxn_atomdata_copy_x_to_mixed().
+ */
+void nbnxn_atomdata_init_mixed(nbnxn_atomdata_t *nbat);
+
+/* Converts the packed coordinates of atoms a0 to a0+na in nbat->x to
+ * nbat->mixed->x, a0 and na should be multiples of the packing width.
+ */
+void nbnxn_atomdata_copy_x_to_mixed(nbnxn_atomdata_t *nbat, int a0, int na);
+
 /* Copy the atom data to the non-bonded atom data structure */
 void nbnxn_atomdata_set(nbnxn_atomdata_t    *nbat,
                         int                  locality,
@@ -137,6 +150,17 @@ void nbnxn_atomdata_add_nbat_f_to_f_final(const nbnxn_search_t    nbs,
                                           rvec                   *f,
                                           int                     nth);
 
+/* Add the forces fnb, in the layout of nbat and starting at grid atom i0,
+ * of the grid atoms i0 to i1 to f. i0 and i1 should be multiples of
+ * NBNXN_BUFFERFLAG_SIZE or the number of grid atoms.
+ */
+void nbnxn_atomdata_add_nbat_f_range_to_f(const nbnxn_search_t    nbs,
+                                          const nbnxn_atomdata_t *nbat,
+                                          const real             *fnb,
+                                          int i0, int i1,
+                                          rvec                   *f,
+                                          int                     nth);
+
 /* Add the fshift force stored in nbat to fshift */
 gmx_offload
 void nbnxn_atomdata_add_nbat_fshift_to_fshift(const nbnxn_atomdata_t *nbat,
@@ -95,6 +95,13 @@ typedef struct {
 } nbnxn_bb_t;
 
 
+/* The order of the grid columns in memory: x-major, i.e. x*ncy+y,
+ * or along a Morton (Z-order) or Hilbert space-filling curve.
+ */
+enum {
+    enbsColOrderXMajor, enbsColOrderMorton, enbsColOrderHilbert, enbsColOrderNR
+};
+
 /* A pair-search grid struct for one domain decomposition zone */
 typedef struct {
     rvec          c0;               /* The lower corner of the (local) grid        */
@@ -121,7 +128,16 @@ typedef struct {
 
     int          *cxy_na;           /* The number of atoms for each column in x,y  */
     int          *cxy_ind;          /* Grid (super)cell index, offset from cell0   */
-    int           cxy_nalloc;       /* Allocation size for cxy_na and cxy_ind      */
+    int          *cxy_na_prev;      /* cxy_na of the previous grid setup           */
+    int          *cxy_ind_prev;     /* cxy_ind of the previous grid setup          */
+    int           col_order;        /* The column order, enbsColOrder...           */
+    int          *cxy_xy;           /* The location x*ncy+y of each column         */
+    int          *xy_cxy;           /* The column index of each location x*ncy+y   */
+    int           cxy_nalloc;       /* Allocation size for the cxy arrays          */
+
+    int           natoms_sorted;    /* The number of atoms of the previous setup
+                                     * when it can be updated incrementally,
+                                     * -1 otherwise                                */
 
     int          *nsubc;            /* The number of sub cells for each super cell */
     float        *bbcz;             /* Bounding boxes in z for the super cells     */
@@ -228,6 +244,7 @@ typedef struct {
     int                  cxy_na_nalloc;
 
     int                 *sort_work;
+    real                *sort_coord;   /* Coordinates for incremental sorting */
     int                  sort_work_nalloc;
 
     nbnxn_buffer_flags_t buffer_flags; /* Flags for force buffer access */
@@ -256,7 +273,10 @@ typedef struct nbnxn_search {
     int                *cell;            /* Actual allocated cell array for all grids  */
     int                 cell_nalloc;     /* Allocation size of cell                    */
     int                *a;               /* Atom index for grid, the inverse of cell   */
-    int                 a_nalloc;        /* Allocation size of a                       */
+    int                *a_prev;          /* a of the previous grid setup               */
+    int                 a_nalloc;        /* Allocation size of a and a_prev            */
+    gmx_bool            bIncrementalGrid; /* Update the previous home grid ordering?   */
+    int                 col_order;       /* The grid column order, enbsColOrder...     */
 
     int                 natoms_local;    /* The local atoms run from 0 to natoms_local */
     int                 natoms_nonlocal; /* The non-local atoms run from natoms_local
@@ -36,7 +36,9 @@
 
 #include "nbnxn_kernel_common.h"
 
+#include "gromacs/legacyheaders/macros.h"
 #include "gromacs/pbcutil/ishift.h"
+#include "gromacs/utility/smalloc.h"
 
 static void
 clear_f_all(const nbnxn_atomdata_t *nbat, real *f)
@@ -128,3 +130,268 @@ reduce_energies_over_lists(const nbnxn_atomdata_t     *nbat,
         }
     }
 }
+
+void
+nbnxn_kernel_steal_init(nbnxn_pairlist_set_t *nbl_list)
+{
+    nbnxn_steal_t st;
+
+    snew(st, 1);
+    st->nthread = nbl_list->nnbl;
+    snew(st->th, st->nthread);
+    st->ncall   = 0;
+    st->cyc_max = 0;
+    st->cyc_sum = 0;
+    st->nsteal  = 0;
+
+    nbl_list->steal = st;
+}
+
+void
+nbnxn_kernel_steal_prepare(const nbnxn_pairlist_set_t *nbl_list,
+                           const nbnxn_atomdata_t     *nbat)
+{
+    nbnxn_steal_t         st;
+    nbnxn_steal_thread_t *sth;
+    int                   th, nflag, b;
+
+    st = nbl_list->steal;
+    if (st == NULL)
+    {
+        return;
+    }
+
+    nflag = nbat->buffer_flags.nflag;
+
+    for (th = 0; th < st->nthread; th++)
+    {
+        sth = &st->th[th];
+
+        tMPI_Atomic_set(&sth->ci_next, 0);
+        sth->ci_chunk = (nbl_list->nbl[th]->nci + NBNXN_STEAL_NCHUNK - 1)/NBNXN_STEAL_NCHUNK;
+        sth->ci_chunk = max(sth->ci_chunk, 1);
+        sth->nsteal   = 0;
+
+        if (nbat->bUseBufferFlags && nflag > sth->fb_nalloc)
+        {
+            sth->fb_nalloc = over_alloc_large(nflag);
+            srenew(sth->fb, sth->fb_nalloc);
+            srenew(sth->fb_flag, sth->fb_nalloc);
+            for (b = 0; b < sth->fb_nalloc; b++)
+            {
+                sth->fb_flag[b] = FALSE;
+            }
+        }
+        sth->nfb = 0;
+    }
+}
+
+void
+nbnxn_kernel_chunk_iter_init(nbnxn_chunk_iter_t         *it,
+                             const nbnxn_pairlist_set_t *nbl_list,
+                             int                         th)
+{
+    it->th   = th;
+    it->list = th;
+
+    if (nbl_list->steal != NULL)
+    {
+        nbl_list->steal->th[th].cyc_start = gmx_cycles_read();
+    }
+}
+
+/* Clears the blocks of force buffer f for atoms a0 to a1 that thread th
+ * does not have flagged in nbat and did not clear before.
+ */
+static void
+steal_clear_f_range(const nbnxn_atomdata_t *nbat, int th,
+                    nbnxn_steal_thread_t *sth,
+                    int a0, int a1, real *f)
+{
+    int b, i;
+
+    for (b = a0/NBNXN_BUFFERFLAG_SIZE; b <= (a1 - 1)/NBNXN_BUFFERFLAG_SIZE; b++)
+    {
+        if (!sth->fb_flag[b] &&
+            !bitmask_is_set(nbat->buffer_flags.flag[b], th))
+        {
+            for (i = b*NBNXN_BUFFERFLAG_SIZE*nbat->fstride; i < (b + 1)*NBNXN_BUFFERFLAG_SIZE*nbat->fstride; i++)
+            {
+                f[i] = 0;
+            }
+            sth->fb_flag[b]    = TRUE;
+            sth->fb[sth->nfb++] = b;
+        }
+    }
+}
+
+/* Prepares the force buffer f of thread th for computing a stolen chunk */
+static void
+steal_clear_f(const nbnxn_atomdata_t *nbat, const nbnxn_pairlist_t *nbl,
+              int th, nbnxn_steal_thread_t *sth, real *f)
+{
+    int i, j, ci, cj;
+
+    for (i = 0; i < nbl->nci; i++)
+    {
+        ci = nbl->ci[i].ci;
+        steal_clear_f_range(nbat, th, sth,
+                            ci*nbl->na_ci, (ci + 1)*nbl->na_ci, f);
+
+        if (nbl->bCompressed)
+        {
+            /* Only the compressed form of the j-list is stored */
+            j  = nbl->cic[i].cjc_ind_start;
+            cj = nbl->cic[i].cj0;
+            while (j < nbl->cic[i].cjc_ind_end)
+            {
+                cj = nbnxn_cjc_decode(nbl->cjc, &j, cj);
+                steal_clear_f_range(nbat, th, sth,
+                                    cj*nbl->na_cj, (cj + 1)*nbl->na_cj, f);
+            }
+        }
+        else
+        {
+            for (j = nbl->ci[i].cj_ind_start; j < nbl->ci[i].cj_ind_end; j++)
+            {
+                cj = nbl->cj[j].cj;
+                steal_clear_f_range(nbat, th, sth,
+                                    cj*nbl->na_cj, (cj + 1)*nbl->na_cj, f);
+            }
+        }
+    }
+}
+
+const nbnxn_pairlist_t *
+nbnxn_kernel_chunk_next(nbnxn_chunk_iter_t         *it,
+                        const nbnxn_pairlist_set_t *nbl_list,
+                        const nbnxn_atomdata_t     *nbat,
+                        real                       *f)
+{
+    nbnxn_steal_t           st;
+    nbnxn_steal_thread_t   *sthl;
+    const nbnxn_pairlist_t *nbl;
+    int                     ci0;
+
+    st = nbl_list->steal;
+
+    if (st == NULL)
+    {
+        /* Without work stealing we compute our complete list */
+        if (it->list < 0)
+        {
+            return NULL;
+        }
+        it->list = -1;
+
+        return nbl_list->nbl[it->th];
+    }
+
+    while (it->list >= 0)
+    {
+        nbl  = nbl_list->nbl[it->list];
+        sthl = &st->th[it->list];
+
+        /* Check before incrementing, to avoid atomics on finished lists */
+        if (tMPI_Atomic_get(&sthl->ci_next) < nbl->nci)
+        {
+            ci0 = tMPI_Atomic_fetch_add(&sthl->ci_next, sthl->ci_chunk);
+            if (ci0 < nbl->nci)
+            {
+                it->nbl     = *nbl;
+                it->nbl.ci  = nbl->ci + ci0;
+                it->nbl.nci = min(sthl->ci_chunk, nbl->nci - ci0);
+                if (nbl->cic != NULL)
+                {
+                    it->nbl.cic = nbl->cic + ci0;
+                }
+
+                if (it->list != it->th)
+                {
+                    st->th[it->th].nsteal++;
+
+                    if (nbat->bUseBufferFlags)
+                    {
+                        steal_clear_f(nbat, &it->nbl, it->th, &st->th[it->th], f);
+                    }
+                }
+
+                return &it->nbl;
+            }
+        }
+
+        /* This list is done, continue with the next one */
+        it->list = (it->list + 1) % st->nthread;
+        if (it->list == it->th)
+        {
+            it->list = -1;
+        }
+    }
+
+    st->th[it->th].cyc = gmx_cycles_read() - st->th[it->th].cyc_start;
+
+    return NULL;
+}
+
+void
+nbnxn_kernel_steal_finish(const nbnxn_pairlist_set_t *nbl_list,
+                          nbnxn_atomdata_t           *nbat)
+{
+    nbnxn_steal_t         st;
+    nbnxn_steal_thread_t *sth;
+    gmx_bitmask_t         our_flag;
+    int                   th, i, b;
+    double                cyc_max;
+
+    st = nbl_list->steal;
+    if (st == NULL)
+    {
+        return;
+    }
+
+    cyc_max = 0;
+    for (th = 0; th < st->nthread; th++)
+    {
+        sth = &st->th[th];
+
+        /* Let the clearing and reduction include the blocks we touched */
+        bitmask_init_bit(&our_flag, th);
+        for (i = 0; i < sth->nfb; i++)
+        {
+            b = sth->fb[i];
+            bitmask_union(&(nbat->buffer_flags.flag[b]), our_flag);
+            sth->fb_flag[b] = FALSE;
+        }
+        sth->nfb = 0;
+
+        st->nsteal   += sth->nsteal;
+        sth->cyc_tot += sth->cyc;
+        st->cyc_sum  += sth->cyc;
+        cyc_max       = max(cyc_max, (double)sth->cyc);
+    }
+    st->cyc_max += cyc_max;
+    st->ncall++;
+}
+
+void
+nbnxn_kernel_steal_print(FILE *fp, const nbnxn_pairlist_set_t *nbl_list)
+{
+    nbnxn_steal_t st;
+    int           th;
+
+    st = nbl_list->steal;
+    if (st == NULL || st->ncall == 0)
+    {
+        return;
+    }
+
+    fprintf(fp, "nb th");
+    for (th = 0; th < st->nthread; th++)
+    {
+        fprintf(fp, " %4.1f", st->th[th].cyc_tot/st->ncall*1e-6);
+    }
+    /* The imbalance is the time the slowest thread takes over the average */
+    fprintf(fp, " imb %5.3f steal %.1f\n",
+            st->cyc_max*st->nthread/st->cyc_sum,
+            st->nsteal/(double)st->ncall);
+}
@@ -36,8 +36,11 @@
 #ifndef _nbnxn_kernel_common_h
 #define _nbnxn_kernel_common_h
 
+#include <stdio.h>
+
 #include "gromacs/legacyheaders/typedefs.h"
 #include "gromacs/mdlib/nbnxn_pairlist.h"
+#include "gromacs/timing/cyclecounter.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +67,94 @@ reduce_energies_over_lists(const nbnxn_atomdata_t     *nbat,
                            real                       *Vvdw,
                            real                       *Vc);
 
+/* The number of chunks each thread pair list is split into
+ * for distributing the i-entries over the threads with work stealing.
+ * More chunks give a finer balance at the cost of more atomic operations
+ * and more force buffer blocks touched by the stealing threads.
+ */
+#define NBNXN_STEAL_NCHUNK  16
+
+/* Per-thread work-stealing data */
+typedef struct {
+    gmx_cache_protect_t cp0;
+    tMPI_Atomic_t       ci_next;    /* The next unclaimed i-entry of our list   */
+    int                 ci_chunk;   /* The chunk size in i-entries of our list  */
+    int                 nsteal;     /* The number of chunks we stole, this call */
+    int                 nfb;        /* The number of force blocks we cleared    */
+    int                *fb;         /* The force blocks we cleared, size nfb    */
+    gmx_bool           *fb_flag;    /* Tells if we cleared a force block        */
+    int                 fb_nalloc;  /* Allocation size of fb and fb_flag        */
+    gmx_cycles_t        cyc_start;  /* Cycle count at the start of our work     */
+    gmx_cycles_t        cyc;        /* Our kernel cycles, this call             */
+    double              cyc_tot;    /* Our kernel cycles summed over calls      */
+    gmx_cache_protect_t cp1;
+} nbnxn_steal_thread_t;
+
+/* The work-stealing state for a set of thread pair lists.
+ * Each list is split into chunks of i-entries which are claimed with
+ * an atomic counter. Threads first process the chunks of their own list,
+ * then steal chunks from the other lists. A stolen chunk is computed into
+ * the output buffer of the stealing thread; force blocks that thread did
+ * not flag during the search are cleared on first use and their flags are
+ * added to the buffer flags after the kernel call.
+ */
+struct nbnxn_steal {
+    int                   nthread;  /* The number of threads and lists          */
+    nbnxn_steal_thread_t *th;       /* Per thread data                          */
+    int                   ncall;    /* The number of kernel calls               */
+    double                cyc_max;  /* Sum over calls of the slowest thread     */
+    double                cyc_sum;  /* Sum over calls and threads of the cycles */
+    int                   nsteal;   /* The total number of stolen chunks        */
+};
+
+/* Iterator over the pair-list chunks computed by one thread */
+typedef struct {
+    int              th;    /* Our thread and output index                  */
+    int              list;  /* The list we take chunks from, -1 when done    */
+    nbnxn_pairlist_t nbl;   /* The current chunk, shares the list data      */
+} nbnxn_chunk_iter_t;
+
+/* Allocates and initializes the work-stealing state for nbl_list
+ * and sets nbl_list->steal.
+ */
+void
+nbnxn_kernel_steal_init(nbnxn_pairlist_set_t *nbl_list);
+
+/* Resets the chunk counters, should be called before the kernel threads
+ * start working on nbl_list.
+ */
+void
+nbnxn_kernel_steal_prepare(const nbnxn_pairlist_set_t *nbl_list,
+                           const nbnxn_atomdata_t     *nbat);
+
+/* Initializes the chunk iterator it of thread th */
+void
+nbnxn_kernel_chunk_iter_init(nbnxn_chunk_iter_t         *it,
+                             const nbnxn_pairlist_set_t *nbl_list,
+                             int                         th);
+
+/* Returns the next chunk to compute into the force buffer f of
+ * the thread of it, or NULL when all lists have been processed.
+ * Without work stealing the whole list of the thread is returned once.
+ */
+const nbnxn_pairlist_t *
+nbnxn_kernel_chunk_next(nbnxn_chunk_iter_t         *it,
+                        const nbnxn_pairlist_set_t *nbl_list,
+                        const nbnxn_atomdata_t     *nbat,
+                        real                       *f);
+
+/* Adds the force buffer flags of the stolen chunks to nbat and
+ * collects the kernel cycle statistics, should be called after
+ * all kernel threads are done with nbl_list.
+ */
+void
+nbnxn_kernel_steal_finish(const nbnxn_pairlist_set_t *nbl_list,
+                          nbnxn_atomdata_t           *nbat);
+
+/* Prints the kernel thread imbalance and work-stealing statistics */
+void
+nbnxn_kernel_steal_print(FILE *fp, const nbnxn_pairlist_set_t *nbl_list);
+
 #if 0
 {
 #endif
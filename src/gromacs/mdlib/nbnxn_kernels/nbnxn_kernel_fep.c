@@ -0,0 +1,685 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+#include "gmxpre.h"
+
+#include "nbnxn_kernel_fep.h"
+
+#include "config.h"
+
+#include <math.h>
+
+#include "gromacs/legacyheaders/macros.h"
+#include "gromacs/legacyheaders/nonbonded.h"
+#include "gromacs/legacyheaders/nrnb.h"
+#include "gromacs/legacyheaders/types/enums.h"
+#include "gromacs/legacyheaders/types/forcerec.h"
+#include "gromacs/math/vec.h"
+#include "gromacs/simd/simd.h"
+#include "gromacs/simd/simd_math.h"
+#include "gromacs/simd/vector_operations.h"
+#include "gromacs/utility/fatalerror.h"
+#include "gromacs/utility/smalloc.h"
+
+#define STATE_A  0
+#define STATE_B  1
+#define NSTATES  2
+
+/* The lambda dependent factors for one set of lambda values,
+ * see gmx_nb_free_energy_kernel for their definitions.
+ */
+typedef struct {
+    real lfc[NSTATES];
+    real lfv[NSTATES];
+    real lfac_coul[NSTATES];
+    real dlfac_coul[NSTATES];
+    real lfac_vdw[NSTATES];
+    real dlfac_vdw[NSTATES];
+} fep_lambda_t;
+
+gmx_bool
+nbnxn_kernel_fep_simd_supported(const t_forcerec gmx_unused *fr)
+{
+#ifdef GMX_SIMD_HAVE_REAL
+    /* We only support the r^6 soft-core, plain LJ and reaction-field
+     * or Ewald electrostatics, without potential-switch modifiers.
+     */
+    return (fr->sc_r_power == 6 &&
+            !EVDW_PME(fr->ic->vdwtype) &&
+            fr->vdw_modifier != eintmodPOTSWITCH &&
+            fr->coulomb_modifier != eintmodPOTSWITCH &&
+            (fr->ic->eeltype == eelCUT ||
+             EEL_RF(fr->ic->eeltype) ||
+             EEL_PME_EWALD(fr->ic->eeltype)));
+#else
+    return FALSE;
+#endif
+}
+
+#ifdef GMX_SIMD_HAVE_REAL
+
+static void
+set_fep_lambda(fep_lambda_t *fl, real lambda_coul, real lambda_vdw,
+               real lam_power, real sc_r_power)
+{
+    const real dlf[NSTATES] = { -1, 1 };
+    int        i;
+
+    fl->lfc[STATE_A] = 1 - lambda_coul;
+    fl->lfv[STATE_A] = 1 - lambda_vdw;
+    fl->lfc[STATE_B] = lambda_coul;
+    fl->lfv[STATE_B] = lambda_vdw;
+
+    for (i = 0; i < NSTATES; i++)
+    {
+        fl->lfac_coul[i]  = (lam_power == 2 ? (1 - fl->lfc[i])*(1 - fl->lfc[i]) : (1 - fl->lfc[i]));
+        fl->dlfac_coul[i] = dlf[i]*lam_power/sc_r_power*(lam_power == 2 ? (1 - fl->lfc[i]) : 1);
+        fl->lfac_vdw[i]   = (lam_power == 2 ? (1 - fl->lfv[i])*(1 - fl->lfv[i]) : (1 - fl->lfv[i]));
+        fl->dlfac_vdw[i]  = dlf[i]*lam_power/sc_r_power*(lam_power == 2 ? (1 - fl->lfv[i]) : 1);
+    }
+}
+
+/* Batch buffer layout, each entry is GMX_SIMD_REAL_WIDTH long */
+enum {
+    fepbDX, fepbDY, fepbDZ,
+    fepbQQA, fepbQQB, fepbC6A, fepbC6B, fepbC12A, fepbC12B,
+    fepbINCL, fepbSELF, fepbNR
+};
+
+/* Output buffer layout, each entry is GMX_SIMD_REAL_WIDTH long */
+enum {
+    fepoFSCAL, fepoVC, fepoVV, fepoNR
+};
+
+/* The constant parameters of the kernel */
+typedef struct {
+    gmx_bool   bEwald;         /* Ewald, else reaction-field               */
+    gmx_bool   bScCoul;        /* Soft-core for Coulomb                    */
+    real       krf, crf;       /* Reaction-field constants                 */
+    real       sh_ewald;       /* Ewald potential shift                    */
+    real       beta;           /* Ewald coefficient                        */
+    real       rcoulomb2;      /* Coulomb cut-off squared                  */
+    real       rvdw_inv6;      /* VdW cut-off to the power -6              */
+    real       rcoulomb_inv6;  /* Coulomb cut-off to the power -6          */
+    real       sh_invrc6;      /* LJ potential shift                       */
+    real       alpha_coul;     /* Soft-core alpha for Coulomb              */
+    real       alpha_vdw;      /* Soft-core alpha for VdW                  */
+    real       sigma6_def;     /* Soft-core sigma^6 for pairs without LJ   */
+    real       sigma6_min;     /* Minimum soft-core sigma^6                */
+} fep_kernel_param_t;
+
+/* Computes the interactions of one batch of pairs for nlambda sets of
+ * lambda values. Forces and energies are only returned in out for the first
+ * set, dH/dl is only accumulated for the first set, the total energies
+ * for all sets are accumulated in vlambda, when vlambda!=NULL.
+ */
+static void
+fep_simd_batch(const fep_kernel_param_t *kp,
+               const real               *batch,
+               int                       nlambda,
+               const fep_lambda_t       *fl,
+               real                     *out,
+               double                   *dvdl_coul,
+               double                   *dvdl_vdw,
+               double                   *vlambda)
+{
+    const gmx_simd_real_t zero_S  = gmx_simd_setzero_r();
+    const gmx_simd_real_t half_S  = gmx_simd_set1_r(0.5);
+    const gmx_simd_real_t sixth_S = gmx_simd_set1_r(1.0/6.0);
+    const gmx_simd_real_t twelfth_S = gmx_simd_set1_r(1.0/12.0);
+    gmx_simd_real_t       dx_S, dy_S, dz_S, rsq_S, rinv_S, r_S, rinv6_S;
+    gmx_simd_real_t       rp_S, rpm2_S;
+    gmx_simd_real_t       qq_S[NSTATES], c6_S[NSTATES], c12_S[NSTATES];
+    gmx_simd_real_t       sigma6_S[NSTATES];
+    gmx_simd_real_t       alpha_coul_S, alpha_vdw_S;
+    gmx_simd_real_t       self_S, v_lr_S, f_lr_S, krf_S;
+    gmx_simd_bool_t       incl_B, excl_B, wco_c_B;
+    int                   i, l;
+
+    dx_S      = gmx_simd_load_r(batch + fepbDX*GMX_SIMD_REAL_WIDTH);
+    dy_S      = gmx_simd_load_r(batch + fepbDY*GMX_SIMD_REAL_WIDTH);
+    dz_S      = gmx_simd_load_r(batch + fepbDZ*GMX_SIMD_REAL_WIDTH);
+    rsq_S     = gmx_simd_calc_rsq_r(dx_S, dy_S, dz_S);
+    /* The force at r=0 is zero, but the soft-core potential is not */
+    rinv_S    = gmx_simd_invsqrt_r(gmx_simd_max_r(rsq_S, gmx_simd_set1_r(GMX_REAL_MIN)));
+    rinv_S    = gmx_simd_blendzero_r(rinv_S, gmx_simd_cmplt_r(zero_S, rsq_S));
+    r_S       = gmx_simd_mul_r(rsq_S, rinv_S);
+    rpm2_S    = gmx_simd_mul_r(rsq_S, rsq_S);
+    rp_S      = gmx_simd_mul_r(rpm2_S, rsq_S);
+    rinv6_S   = gmx_simd_mul_r(rinv_S, rinv_S);
+    rinv6_S   = gmx_simd_mul_r(rinv6_S, gmx_simd_mul_r(rinv6_S, rinv6_S));
+
+    incl_B    = gmx_simd_cmplt_r(zero_S, gmx_simd_load_r(batch + fepbINCL*GMX_SIMD_REAL_WIDTH));
+    excl_B    = gmx_simd_cmple_r(gmx_simd_load_r(batch + fepbINCL*GMX_SIMD_REAL_WIDTH), zero_S);
+    self_S    = gmx_simd_load_r(batch + fepbSELF*GMX_SIMD_REAL_WIDTH);
+    wco_c_B   = gmx_simd_cmplt_r(rsq_S, gmx_simd_set1_r(kp->rcoulomb2));
+    krf_S     = gmx_simd_set1_r(kp->krf);
+
+    for (i = 0; i < NSTATES; i++)
+    {
+        gmx_simd_bool_t lj_B;
+        gmx_simd_real_t c6_safe_S;
+
+        qq_S[i]     = gmx_simd_load_r(batch + (fepbQQA + i)*GMX_SIMD_REAL_WIDTH);
+        c6_S[i]     = gmx_simd_load_r(batch + (fepbC6A + i)*GMX_SIMD_REAL_WIDTH);
+        c12_S[i]    = gmx_simd_load_r(batch + (fepbC12A + i)*GMX_SIMD_REAL_WIDTH);
+
+        /* c12 is stored scaled with 12.0 and c6 is scaled with 6.0 */
+        lj_B        = gmx_simd_and_b(gmx_simd_cmplt_r(zero_S, c6_S[i]),
+                                     gmx_simd_cmplt_r(zero_S, c12_S[i]));
+        c6_safe_S   = gmx_simd_blendv_r(gmx_simd_set1_r(1.0), c6_S[i], lj_B);
+        sigma6_S[i] = gmx_simd_mul_r(gmx_simd_mul_r(half_S, c12_S[i]), gmx_simd_inv_r(c6_safe_S));
+        sigma6_S[i] = gmx_simd_max_r(sigma6_S[i], gmx_simd_set1_r(kp->sigma6_min));
+        sigma6_S[i] = gmx_simd_blendv_r(gmx_simd_set1_r(kp->sigma6_def), sigma6_S[i], lj_B);
+    }
+
+    /* Only use soft-core when one of the states has zero repulsion */
+    {
+        gmx_simd_bool_t sc_B;
+
+        sc_B         = gmx_simd_or_b(gmx_simd_cmple_r(c12_S[STATE_A], zero_S),
+                                     gmx_simd_cmple_r(c12_S[STATE_B], zero_S));
+        alpha_coul_S = gmx_simd_blendzero_r(gmx_simd_set1_r(kp->alpha_coul), sc_B);
+        alpha_vdw_S  = gmx_simd_blendzero_r(gmx_simd_set1_r(kp->alpha_vdw), sc_B);
+    }
+
+    if (kp->bEwald)
+    {
+        /* The Ewald reciprocal-space part, which is subtracted for all
+         * pairs, including excluded pairs, as soft-core is only applied
+         * to the plain Coulomb interaction. Distances are masked to avoid
+         * overflow of the Ewald correction functions.
+         */
+        gmx_simd_real_t beta_S, brsq_S;
+
+        beta_S = gmx_simd_set1_r(kp->beta);
+        brsq_S = gmx_simd_mul_r(gmx_simd_mul_r(beta_S, beta_S),
+                                gmx_simd_blendzero_r(rsq_S, wco_c_B));
+        v_lr_S = gmx_simd_mul_r(beta_S, gmx_simd_pmecorrV_r(brsq_S));
+        v_lr_S = gmx_simd_blendzero_r(gmx_simd_mul_r(v_lr_S, self_S), wco_c_B);
+        f_lr_S = gmx_simd_mul_r(gmx_simd_mul_r(beta_S, beta_S),
+                                gmx_simd_mul_r(beta_S, gmx_simd_pmecorrF_r(brsq_S)));
+        /* The reciprocal-space force divided by r */
+        f_lr_S = gmx_simd_blendzero_r(gmx_simd_sub_r(zero_S, f_lr_S), wco_c_B);
+    }
+    else
+    {
+        v_lr_S = zero_S;
+        f_lr_S = zero_S;
+    }
+
+    for (l = 0; l < nlambda; l++)
+    {
+        gmx_simd_real_t vc_S, vv_S, fscal_S, dvdl_c_S, dvdl_v_S;
+        gmx_simd_real_t qqsum_S;
+
+        vc_S     = zero_S;
+        vv_S     = zero_S;
+        fscal_S  = zero_S;
+        dvdl_c_S = zero_S;
+        dvdl_v_S = zero_S;
+
+        for (i = 0; i < NSTATES; i++)
+        {
+            gmx_simd_real_t lfc_S, lfv_S, dlf_S;
+            gmx_simd_real_t rpinvC_S, rinvC_S, rC_S, rpinvV_S;
+            gmx_simd_real_t vcoul_S, fscalC_S, vvdw_S, fscalV_S;
+            gmx_simd_real_t vvdw6_S, vvdw12_S;
+            gmx_simd_bool_t elec_B, vdw_B;
+
+            lfc_S = gmx_simd_set1_r(fl[l].lfc[i]);
+            lfv_S = gmx_simd_set1_r(fl[l].lfv[i]);
+            dlf_S = gmx_simd_set1_r(i == STATE_A ? -1 : 1);
+
+            if (kp->bScCoul)
+            {
+                rpinvC_S = gmx_simd_inv_r(gmx_simd_fmadd_r(gmx_simd_mul_r(alpha_coul_S, gmx_simd_set1_r(fl[l].lfac_coul[i])),
+                                                           sigma6_S[i], rp_S));
+                /* rinvC = rpinvC^(1/6) */
+                rinvC_S  = gmx_simd_exp_r(gmx_simd_mul_r(sixth_S, gmx_simd_log_r(rpinvC_S)));
+                rC_S     = gmx_simd_inv_r(rinvC_S);
+            }
+            else
+            {
+                rpinvC_S = rinv6_S;
+                rinvC_S  = rinv_S;
+                rC_S     = r_S;
+            }
+            rpinvV_S = gmx_simd_inv_r(gmx_simd_fmadd_r(gmx_simd_mul_r(alpha_vdw_S, gmx_simd_set1_r(fl[l].lfac_vdw[i])),
+                                                       sigma6_S[i], rp_S));
+
+            if (kp->bEwald)
+            {
+                /* Ewald FEP is done only on the 1/r part */
+                elec_B   = wco_c_B;
+                vcoul_S  = gmx_simd_mul_r(qq_S[i], gmx_simd_sub_r(rinvC_S, gmx_simd_set1_r(kp->sh_ewald)));
+                fscalC_S = gmx_simd_mul_r(qq_S[i], rinvC_S);
+            }
+            else
+            {
+                gmx_simd_real_t krsq_S;
+
+                /* rC < rcoulomb, using rpinvC = rC^-6 */
+                elec_B   = gmx_simd_cmplt_r(gmx_simd_set1_r(kp->rcoulomb_inv6), rpinvC_S);
+                krsq_S   = gmx_simd_mul_r(krf_S, gmx_simd_mul_r(rC_S, rC_S));
+                vcoul_S  = gmx_simd_mul_r(qq_S[i], gmx_simd_sub_r(gmx_simd_add_r(rinvC_S, krsq_S), gmx_simd_set1_r(kp->crf)));
+                fscalC_S = gmx_simd_mul_r(qq_S[i], gmx_simd_fnmadd_r(gmx_simd_set1_r(2.0), krsq_S, rinvC_S));
+            }
+            elec_B   = gmx_simd_and_b(elec_B, incl_B);
+            vcoul_S  = gmx_simd_blendzero_r(vcoul_S, elec_B);
+            fscalC_S = gmx_simd_blendzero_r(gmx_simd_mul_r(fscalC_S, rpinvC_S), elec_B);
+
+            /* rV < rvdw, using rpinvV = rV^-6 */
+            vdw_B    = gmx_simd_and_b(gmx_simd_cmplt_r(gmx_simd_set1_r(kp->rvdw_inv6), rpinvV_S), incl_B);
+            vvdw6_S  = gmx_simd_mul_r(c6_S[i], rpinvV_S);
+            vvdw12_S = gmx_simd_mul_r(c12_S[i], gmx_simd_mul_r(rpinvV_S, rpinvV_S));
+            vvdw_S   = gmx_simd_mul_r(twelfth_S,
+                                      gmx_simd_fnmadd_r(c12_S[i], gmx_simd_set1_r(kp->sh_invrc6*kp->sh_invrc6), vvdw12_S));
+            vvdw_S   = gmx_simd_fnmadd_r(sixth_S,
+                                         gmx_simd_fnmadd_r(c6_S[i], gmx_simd_set1_r(kp->sh_invrc6), vvdw6_S),
+                                         vvdw_S);
+            vvdw_S   = gmx_simd_blendzero_r(vvdw_S, vdw_B);
+            fscalV_S = gmx_simd_blendzero_r(gmx_simd_mul_r(gmx_simd_sub_r(vvdw12_S, vvdw6_S), rpinvV_S), vdw_B);
+
+            /* Assemble the A and B states */
+            vc_S     = gmx_simd_fmadd_r(lfc_S, vcoul_S, vc_S);
+            vv_S     = gmx_simd_fmadd_r(lfv_S, vvdw_S, vv_S);
+            fscal_S  = gmx_simd_fmadd_r(gmx_simd_fmadd_r(lfc_S, fscalC_S, gmx_simd_mul_r(lfv_S, fscalV_S)),
+                                        rpm2_S, fscal_S);
+
+            dvdl_c_S = gmx_simd_fmadd_r(dlf_S, vcoul_S, dvdl_c_S);
+            dvdl_c_S = gmx_simd_fmadd_r(gmx_simd_mul_r(gmx_simd_mul_r(lfc_S, alpha_coul_S),
+                                                       gmx_simd_set1_r(fl[l].dlfac_coul[i])),
+                                        gmx_simd_mul_r(fscalC_S, sigma6_S[i]), dvdl_c_S);
+            dvdl_v_S = gmx_simd_fmadd_r(dlf_S, vvdw_S, dvdl_v_S);
+            dvdl_v_S = gmx_simd_fmadd_r(gmx_simd_mul_r(gmx_simd_mul_r(lfv_S, alpha_vdw_S),
+                                                       gmx_simd_set1_r(fl[l].dlfac_vdw[i])),
+                                        gmx_simd_mul_r(fscalV_S, sigma6_S[i]), dvdl_v_S);
+        }
+
+        qqsum_S = gmx_simd_fmadd_r(gmx_simd_set1_r(fl[l].lfc[STATE_A]), qq_S[STATE_A],
+                                   gmx_simd_mul_r(gmx_simd_set1_r(fl[l].lfc[STATE_B]), qq_S[STATE_B]));
+
+        if (kp->bEwald)
+        {
+            /* Subtract the reciprocal-space part, the potential shift
+             * has been applied to the 1/r part above.
+             */
+            vc_S     = gmx_simd_fnmadd_r(qqsum_S, v_lr_S, vc_S);
+            fscal_S  = gmx_simd_fnmadd_r(qqsum_S, f_lr_S, fscal_S);
+            dvdl_c_S = gmx_simd_fnmadd_r(gmx_simd_sub_r(qq_S[STATE_B], qq_S[STATE_A]), v_lr_S, dvdl_c_S);
+        }
+        else
+        {
+            /* Excluded pairs only have the reaction-field correction,
+             * for which we don't use soft-core.
+             */
+            gmx_simd_real_t vv_rf_S, ff_rf_S;
+
+            vv_rf_S  = gmx_simd_mul_r(gmx_simd_fmsub_r(krf_S, rsq_S, gmx_simd_set1_r(kp->crf)), self_S);
+            vv_rf_S  = gmx_simd_blendzero_r(vv_rf_S, excl_B);
+            ff_rf_S  = gmx_simd_blendzero_r(gmx_simd_mul_r(gmx_simd_set1_r(-2.0), krf_S), excl_B);
+            vc_S     = gmx_simd_fmadd_r(qqsum_S, vv_rf_S, vc_S);
+            fscal_S  = gmx_simd_fmadd_r(qqsum_S, ff_rf_S, fscal_S);
+            dvdl_c_S = gmx_simd_fmadd_r(gmx_simd_sub_r(qq_S[STATE_B], qq_S[STATE_A]), vv_rf_S, dvdl_c_S);
+        }
+
+        if (l == 0)
+        {
+            gmx_simd_store_r(out + fepoFSCAL*GMX_SIMD_REAL_WIDTH, fscal_S);
+            gmx_simd_store_r(out + fepoVC*GMX_SIMD_REAL_WIDTH, vc_S);
+            gmx_simd_store_r(out + fepoVV*GMX_SIMD_REAL_WIDTH, vv_S);
+
+            *dvdl_coul += gmx_simd_reduce_r(dvdl_c_S);
+            *dvdl_vdw  += gmx_simd_reduce_r(dvdl_v_S);
+        }
+        if (vlambda != NULL)
+        {
+            vlambda[l] += gmx_simd_reduce_r(gmx_simd_add_r(vc_S, vv_S));
+        }
+    }
+}
+
+/* Accumulation buffer for the i-entry which is currently being processed */
+typedef struct {
+    int  n;       /* The index of the i-entry, -1 when not set */
+    rvec fi;      /* The force on the i-atom                    */
+    real vctot;   /* The Coulomb energy                         */
+    real vvtot;   /* The VdW energy                             */
+} fep_ientry_t;
+
+/* The output buffers of the kernel */
+typedef struct {
+    real     *f;
+    real     *fshift;
+    real     *Vc;
+    real     *Vv;
+    gmx_bool  bDoForces;
+    gmx_bool  bDoShiftForces;
+    gmx_bool  bDoPotential;
+} fep_output_t;
+
+/* Adds the i-force and energies of ie, when set, and resets ie */
+static void
+fep_flush_ientry(fep_ientry_t *ie, const t_nblist *nlist, const fep_output_t *fo)
+{
+    int ii3, is3, ggid;
+
+    if (ie->n >= 0)
+    {
+        ii3 = 3*nlist->iinr[ie->n];
+        is3 = 3*nlist->shift[ie->n];
+        if (fo->bDoForces)
+        {
+#pragma omp atomic
+            fo->f[ii3]        += ie->fi[XX];
+#pragma omp atomic
+            fo->f[ii3+1]      += ie->fi[YY];
+#pragma omp atomic
+            fo->f[ii3+2]      += ie->fi[ZZ];
+        }
+        if (fo->bDoShiftForces)
+        {
+#pragma omp atomic
+            fo->fshift[is3]   += ie->fi[XX];
+#pragma omp atomic
+            fo->fshift[is3+1] += ie->fi[YY];
+#pragma omp atomic
+            fo->fshift[is3+2] += ie->fi[ZZ];
+        }
+        if (fo->bDoPotential)
+        {
+            ggid               = nlist->gid[ie->n];
+#pragma omp atomic
+            fo->Vc[ggid]      += ie->vctot;
+#pragma omp atomic
+            fo->Vv[ggid]      += ie->vvtot;
+        }
+    }
+
+    ie->n      = -1;
+    clear_rvec(ie->fi);
+    ie->vctot  = 0;
+    ie->vvtot  = 0;
+}
+
+/* Adds the forces and energies of the first nlane pairs in a batch.
+ * The pairs of an i-entry are consecutive, so we accumulate the i-force
+ * and energies in ie and only add them when the next i-entry starts.
+ */
+static void
+fep_add_batch(int nlane, const real *batch, const real *out,
+              const int *pair_n, const int *pair_j,
+              const t_nblist *nlist, const fep_output_t *fo,
+              fep_ientry_t *ie)
+{
+    int s;
+
+    for (s = 0; s < nlane; s++)
+    {
+        real fscal, tx, ty, tz;
+        int  j3;
+
+        if (pair_n[s] != ie->n)
+        {
+            fep_flush_ientry(ie, nlist, fo);
+            ie->n = pair_n[s];
+        }
+
+        fscal       = out[fepoFSCAL*GMX_SIMD_REAL_WIDTH + s];
+        tx          = fscal*batch[fepbDX*GMX_SIMD_REAL_WIDTH + s];
+        ty          = fscal*batch[fepbDY*GMX_SIMD_REAL_WIDTH + s];
+        tz          = fscal*batch[fepbDZ*GMX_SIMD_REAL_WIDTH + s];
+        ie->fi[XX] += tx;
+        ie->fi[YY] += ty;
+        ie->fi[ZZ] += tz;
+        ie->vctot  += out[fepoVC*GMX_SIMD_REAL_WIDTH + s];
+        ie->vvtot  += out[fepoVV*GMX_SIMD_REAL_WIDTH + s];
+
+        if (fo->bDoForces)
+        {
+            /* As in gmx_nb_free_energy_kernel, we use atomics
+             * instead of thread-local output buffers.
+             */
+            j3 = 3*pair_j[s];
+#pragma omp atomic
+            fo->f[j3]   -= tx;
+#pragma omp atomic
+            fo->f[j3+1] -= ty;
+#pragma omp atomic
+            fo->f[j3+2] -= tz;
+        }
+    }
+}
+
+#endif /* GMX_SIMD_HAVE_REAL */
+
+void
+nbnxn_kernel_fep_simd(const t_nblist gmx_unused    *nlist,
+                      rvec gmx_unused              *xx,
+                      rvec gmx_unused              *ff,
+                      t_forcerec gmx_unused        *fr,
+                      const t_mdatoms gmx_unused   *mdatoms,
+                      nb_kernel_data_t gmx_unused  *kernel_data,
+                      int gmx_unused                n_lambda,
+                      double gmx_unused           **all_lambda,
+                      double gmx_unused            *enerpart_lambda,
+                      t_nrnb gmx_unused            *nrnb)
+#ifdef GMX_SIMD_HAVE_REAL
+{
+    const real         *x        = xx[0];
+    const real         *shiftvec = fr->shift_vec[0];
+    const real         *chargeA  = mdatoms->chargeA;
+    const real         *chargeB  = mdatoms->chargeB;
+    const int          *typeA    = mdatoms->typeA;
+    const int          *typeB    = mdatoms->typeB;
+    const real         *nbfp     = fr->nbfp;
+    const real          facel    = fr->epsfac;
+    const int           ntype    = fr->ntype;
+    fep_kernel_param_t  kp;
+    fep_output_t        fo;
+    fep_lambda_t       *fl;
+    int                 nlambda;
+    double             *vlambda;
+    double              dvdl_coul, dvdl_vdw;
+    real                rcutoff_max2;
+    real                batch_array[(fepbNR + 1)*GMX_SIMD_REAL_WIDTH], *batch;
+    real                out_array[(fepoNR + 1)*GMX_SIMD_REAL_WIDTH], *out;
+    int                 pair_n[GMX_SIMD_REAL_WIDTH], pair_j[GMX_SIMD_REAL_WIDTH];
+    fep_ientry_t        ie;
+    int                 n, k, s, b, l, nlane;
+
+    /* Ensure register memory alignment */
+    batch = gmx_simd_align_r(batch_array);
+    out   = gmx_simd_align_r(out_array);
+
+    fo.f              = ff[0];
+    fo.fshift         = fr->fshift[0];
+    fo.Vc             = kernel_data->energygrp_elec;
+    fo.Vv             = kernel_data->energygrp_vdw;
+    fo.bDoForces      = kernel_data->flags & GMX_NONBONDED_DO_FORCE;
+    fo.bDoShiftForces = kernel_data->flags & GMX_NONBONDED_DO_SHIFTFORCE;
+    fo.bDoPotential   = kernel_data->flags & GMX_NONBONDED_DO_POTENTIAL;
+
+    kp.bEwald         = EEL_PME_EWALD(fr->ic->eeltype);
+    kp.bScCoul        = (fr->sc_alphacoul != 0);
+    kp.krf            = fr->k_rf;
+    kp.crf            = fr->c_rf;
+    kp.sh_ewald       = fr->ic->sh_ewald;
+    kp.beta           = fr->ic->ewaldcoeff_q;
+    kp.rcoulomb2      = fr->rcoulomb*fr->rcoulomb;
+    kp.rcoulomb_inv6  = 1/(kp.rcoulomb2*kp.rcoulomb2*kp.rcoulomb2);
+    kp.rvdw_inv6      = 1/(fr->rvdw*fr->rvdw*fr->rvdw*fr->rvdw*fr->rvdw*fr->rvdw);
+    kp.sh_invrc6      = fr->ic->sh_invrc6;
+    kp.alpha_coul     = fr->sc_alphacoul;
+    kp.alpha_vdw      = fr->sc_alphavdw;
+    kp.sigma6_def     = fr->sc_sigma6_def;
+    kp.sigma6_min     = fr->sc_sigma6_min;
+
+    rcutoff_max2      = max(fr->rcoulomb, fr->rvdw);
+    rcutoff_max2      = rcutoff_max2*rcutoff_max2;
+
+    /* The first lambda set is the current one, then the foreign ones */
+    nlambda = 1 + (enerpart_lambda != NULL ? n_lambda : 0);
+    snew(fl, nlambda);
+    set_fep_lambda(&fl[0],
+                   kernel_data->lambda[efptCOUL], kernel_data->lambda[efptVDW],
+                   fr->sc_power, fr->sc_r_power);
+    for (l = 1; l < nlambda; l++)
+    {
+        set_fep_lambda(&fl[l],
+                       all_lambda[efptCOUL][l - 1], all_lambda[efptVDW][l - 1],
+                       fr->sc_power, fr->sc_r_power);
+    }
+    vlambda = NULL;
+    if (enerpart_lambda != NULL)
+    {
+        snew(vlambda, nlambda);
+    }
+
+    dvdl_coul = 0;
+    dvdl_vdw  = 0;
+
+    ie.n      = -1;
+    clear_rvec(ie.fi);
+    ie.vctot  = 0;
+    ie.vvtot  = 0;
+
+    nlane     = 0;
+    for (n = 0; n < nlist->nri; n++)
+    {
+        int  ii, is3, ntiA, ntiB;
+        real ix, iy, iz, iqA, iqB;
+
+        ii   = nlist->iinr[n];
+        is3  = 3*nlist->shift[n];
+        ix   = shiftvec[is3]   + x[3*ii];
+        iy   = shiftvec[is3+1] + x[3*ii+1];
+        iz   = shiftvec[is3+2] + x[3*ii+2];
+        iqA  = facel*chargeA[ii];
+        iqB  = facel*chargeB[ii];
+        ntiA = 2*ntype*typeA[ii];
+        ntiB = 2*ntype*typeB[ii];
+
+        for (k = nlist->jindex[n]; k < nlist->jindex[n+1]; k++)
+        {
+            int  jnr, tjA, tjB;
+            real dx, dy, dz;
+
+            jnr = nlist->jjnr[k];
+            dx  = ix - x[3*jnr];
+            dy  = iy - x[3*jnr+1];
+            dz  = iz - x[3*jnr+2];
+            if (dx*dx + dy*dy + dz*dz >= rcutoff_max2)
+            {
+                /* As in gmx_nb_free_energy_kernel, we can skip pairs
+                 * beyond the cut-off, since the soft-core distance
+                 * is always larger than r.
+                 */
+                continue;
+            }
+
+            s   = nlane;
+            tjA = ntiA + 2*typeA[jnr];
+            tjB = ntiB + 2*typeB[jnr];
+            batch[fepbDX*GMX_SIMD_REAL_WIDTH + s]   = dx;
+            batch[fepbDY*GMX_SIMD_REAL_WIDTH + s]   = dy;
+            batch[fepbDZ*GMX_SIMD_REAL_WIDTH + s]   = dz;
+            batch[fepbQQA*GMX_SIMD_REAL_WIDTH + s]  = iqA*chargeA[jnr];
+            batch[fepbQQB*GMX_SIMD_REAL_WIDTH + s]  = iqB*chargeB[jnr];
+            batch[fepbC6A*GMX_SIMD_REAL_WIDTH + s]  = nbfp[tjA];
+            batch[fepbC6B*GMX_SIMD_REAL_WIDTH + s]  = nbfp[tjB];
+            batch[fepbC12A*GMX_SIMD_REAL_WIDTH + s] = nbfp[tjA+1];
+            batch[fepbC12B*GMX_SIMD_REAL_WIDTH + s] = nbfp[tjB+1];
+            batch[fepbINCL*GMX_SIMD_REAL_WIDTH + s] = (nlist->excl_fep == NULL || nlist->excl_fep[k]) ? 1 : 0;
+            /* The self-interaction is present twice, count it once */
+            batch[fepbSELF*GMX_SIMD_REAL_WIDTH + s] = (ii == jnr) ? 0.5 : 1;
+            pair_n[s] = n;
+            pair_j[s] = jnr;
+            nlane++;
+
+            if (nlane == GMX_SIMD_REAL_WIDTH)
+            {
+                fep_simd_batch(&kp, batch, nlambda, fl, out,
+                               &dvdl_coul, &dvdl_vdw, vlambda);
+                fep_add_batch(nlane, batch, out, pair_n, pair_j, nlist, &fo, &ie);
+                nlane = 0;
+            }
+        }
+    }
+
+    if (nlane > 0)
+    {
+        /* Fill the last batch with pairs beyond the cut-off */
+        for (s = nlane; s < GMX_SIMD_REAL_WIDTH; s++)
+        {
+            for (b = 0; b < fepbNR; b++)
+            {
+                batch[b*GMX_SIMD_REAL_WIDTH + s] = 0;
+            }
+            batch[fepbDX*GMX_SIMD_REAL_WIDTH + s]   = 2*sqrt(rcutoff_max2);
+            batch[fepbINCL*GMX_SIMD_REAL_WIDTH + s] = 1;
+            batch[fepbSELF*GMX_SIMD_REAL_WIDTH + s] = 1;
+        }
+        fep_simd_batch(&kp, batch, nlambda, fl, out,
+                       &dvdl_coul, &dvdl_vdw, vlambda);
+        fep_add_batch(nlane, batch, out, pair_n, pair_j, nlist, &fo, &ie);
+    }
+    fep_flush_ientry(&ie, nlist, &fo);
+
+#pragma omp atomic
+    kernel_data->dvdl[efptCOUL] += dvdl_coul;
+#pragma omp atomic
+    kernel_data->dvdl[efptVDW]  += dvdl_vdw;
+
+    if (enerpart_lambda != NULL)
+    {
+        for (l = 0; l < nlambda; l++)
+        {
+#pragma omp atomic
+            enerpart_lambda[l] += vlambda[l];
+        }
+        sfree(vlambda);
+    }
+    sfree(fl);
+
+    /* Count flops as gmx_nb_free_energy_kernel, for each lambda set */
+#pragma omp atomic
+    inc_nrnb(nrnb, eNR_NBKERNEL_FREE_ENERGY, nlambda*(nlist->nri*12 + nlist->jindex[nlist->nri]*150));
+}
+#else
+{
+    gmx_incons("nbnxn_kernel_fep_simd called without SIMD support");
+}
+#endif
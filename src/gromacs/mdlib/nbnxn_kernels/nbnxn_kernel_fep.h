@@ -0,0 +1,82 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+#ifndef _nbnxn_kernel_fep_h
+#define _nbnxn_kernel_fep_h
+
+#include "gromacs/gmxlib/nonbonded/nb_kernel.h"
+#include "gromacs/legacyheaders/typedefs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* With the Verlet scheme the perturbed pairs are taken out of the cluster
+ * pair lists into a separate atom pair list, see make_fep_list. The SIMD
+ * kernel below computes these pairs in batches of SIMD width pairs,
+ * gathered from consecutive i-entries, so the SIMD efficiency does not
+ * depend on the (often very short) j-lists of the unperturbed i-atoms.
+ * The soft-core interactions at all foreign lambda values are computed
+ * in the same pass, reusing the distances and pair parameters.
+ */
+
+/* Returns whether the SIMD free-energy kernel supports the interaction
+ * setup in fr. When it does not, gmx_nb_free_energy_kernel should be used.
+ */
+gmx_bool
+nbnxn_kernel_fep_simd_supported(const t_forcerec *fr);
+
+/* Computes the forces, energies and dH/dlambda of the perturbed pairs
+ * in nlist at the lambda values in kernel_data, as gmx_nb_free_energy_kernel.
+ * When enerpart_lambda!=NULL, the energies at the current lambda values
+ * and at the n_lambda foreign lambda values in all_lambda[efptNR][n_lambda]
+ * are added to enerpart_lambda[0] and enerpart_lambda[1+i], respectively.
+ */
+void
+nbnxn_kernel_fep_simd(const t_nblist    *nlist,
+                      rvec              *x,
+                      rvec              *f,
+                      t_forcerec        *fr,
+                      const t_mdatoms   *mdatoms,
+                      nb_kernel_data_t  *kernel_data,
+                      int                n_lambda,
+                      double           **all_lambda,
+                      double            *enerpart_lambda,
+                      t_nrnb            *nrnb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -65,6 +65,14 @@
 #   customized by numerous preprocessor defines to suit the hardware
 #   and kernel type.
 #
+# The 2xnn_mixed type compiles the 2xnn kernel loops in single
+# precision for double precision builds, on single precision copies of
+# the atom data. It has a subset of the kernels and its own dispatcher.
+# Its outer and inner loops, and the single precision AVX-256 utility
+# functions they use, are also generated: these are copies of the 2xnn
+# files with the real SIMD types and functions replaced by their
+# explicit float versions.
+#
 # Note that while functions for both nbnxn kernel structures are
 # compiled and built into an mdrun executable, because that executable
 # is not portable, only the functions for the useful nbnxn kernel
@@ -115,20 +123,25 @@ VdwTreatmentDict['VdwLJFSw'] = { 'define' : '#define LJ_FORCE_SWITCH\n/* Use ful
 VdwTreatmentDict['VdwLJPSw'] = { 'define' : '#define LJ_POT_SWITCH\n/* Use full LJ combination matrix */' }
 VdwTreatmentDict['VdwLJEwCombGeom'] = { 'define' : '#define LJ_CUT\n#define LJ_EWALD_GEOM\n/* Use full LJ combination matrix + geometric rule for the grid correction */' }
 
-# This is OK as an unordered dict
-EnergiesComputationDict = {
-    'F'  : {
-        'function type' : 'nbk_func_noener',
-        'define' : '/* Will not calculate energies */',
-    },
-    'VF'    : {
-        'function type' : 'nbk_func_ener',
-        'define' : '#define CALC_ENERGIES',
-    },
-    'VgrpF' : {
-        'function type' : 'nbk_func_ener',
-        'define' : '#define CALC_ENERGIES\n#define ENERGY_GROUPS',
-    },
+# The kernel with all interactions tabulated with cubic splines, used
+# with user tables, is not part of the lookup table over the above
+# treatments, the dispatcher selects it separately.
+TabulatedElectrostatics = ('ElecCSTab', { 'define' : '#define CALC_COUL_CSTAB' })
+TabulatedVdwTreatment = ('VdwCSTab', { 'define' : '#define LJ_CSTAB\n/* Use full LJ combination matrix */' })
+
+# The dict order sets the order of the declarations in the header
+EnergiesComputationDict = collections.OrderedDict()
+EnergiesComputationDict['VgrpF'] = {
+    'function type' : 'nbk_func_ener',
+    'define' : '#define CALC_ENERGIES\n#define ENERGY_GROUPS',
+}
+EnergiesComputationDict['VF'] = {
+    'function type' : 'nbk_func_ener',
+    'define' : '#define CALC_ENERGIES',
+}
+EnergiesComputationDict['F'] = {
+    'function type' : 'nbk_func_noener',
+    'define' : '/* Will not calculate energies */',
 }
 
 # This is OK as an unordered dict
@@ -140,6 +153,7 @@ VerletKernelTypeDict = {
                         '#error "unsupported SIMD width"\n' \
                         '#endif\n'),
         'UnrollSize' : 2,
+        'FileSuffix' : 'cpp',
     },
     '4xn' : {
         'Define' : 'GMX_NBNXN_SIMD_4XN',
@@ -148,6 +162,17 @@ VerletKernelTypeDict = {
                         '#error "unsupported SIMD width"\n' \
                         '#endif\n'),
         'UnrollSize' : 1,
+        'FileSuffix' : 'c',
+    },
+    '2xnn_mixed' : {
+        'Define' : 'GMX_NBNXN_SIMD_2XNN_MIXED',
+        'UnrollSize' : 2,
+        'FileSuffix' : 'cpp',
+        # No tables, no energy groups, see nbnxn_atomdata_init_mixed()
+        'Electrostatics' : [ 'ElecRF', 'ElecEw', 'ElecEwTwinCut' ],
+        'Energies' : [ 'VF', 'F' ],
+        'Tabulated' : False,
+        'DispatcherTemplate' : 'nbnxn_kernel_simd_2xnn_mixed_template.c.pre',
     },
 }
 
@@ -165,44 +190,61 @@ for type in VerletKernelTypeDict:
     KernelsName = "{0}_simd_{1}".format(KernelNamePrefix,type)
     KernelsHeaderFileName = "{0}.h".format(KernelsName,type)
     KernelsHeaderPathName = "gromacs/mdlib/nbnxn_kernels/simd_{0}/{1}".format(type,KernelsHeaderFileName)
+    FileSuffix = VerletKernelTypeDict[type]['FileSuffix']
     KernelFunctionLookupTable = {}
+    TabulatedKernelFunction = {}
     KernelDeclarations = ''
     KernelTemplate = read_kernel_template("{0}_kernel.c.pre".format(KernelsName))
 
+    # Declare the kernel function and write the file with its definition
+    def write_kernel(elec, elecdict, ljtreat, ljdict, ener):
+        global KernelDeclarations
+        KernelName = ('{0}_{1}_{2}_{3}_{4}'
+                      .format(KernelNamePrefix,elec,ljtreat,ener,type))
+
+        KernelDeclarations += ('{1:21} {0};\n'
+                               .format(KernelName,
+                                       EnergiesComputationDict[ener]['function type']))
+
+        with open('{0}/{1}.{2}'.format(DirName,KernelName,FileSuffix), 'w') as kernelfp:
+            kernelfp.write(FileHeader.format(type))
+            kernelfp.write(KernelTemplate
+                           .format(VerletKernelTypeDict[type]['Define'],
+                                   elecdict['define'],
+                                   ljdict['define'],
+                                   EnergiesComputationDict[ener]['define'],
+                                   KernelsHeaderPathName,
+                                   KernelName,
+                                   " " * (len(KernelName) + 1),
+                                   VerletKernelTypeDict[type]['UnrollSize'],
+                               )
+                       )
+        return KernelName
+
+    TypeDict = VerletKernelTypeDict[type]
+
     # Loop over all kernels
-    for ener in EnergiesComputationDict:
+    for ener in TypeDict.get('Energies', EnergiesComputationDict):
         KernelFunctionLookupTable[ener] = '{\n'
-        for elec in ElectrostaticsDict:
+        for elec in TypeDict.get('Electrostatics', ElectrostaticsDict):
             KernelFunctionLookupTable[ener] += '    {\n'
             for ljtreat in VdwTreatmentDict:
-                KernelName = ('{0}_{1}_{2}_{3}_{4}'
-                              .format(KernelNamePrefix,elec,ljtreat,ener,type))
-
-                # Declare the kernel function
-                KernelDeclarations += ('{1:21} {0};\n'
-                                       .format(KernelName,
-                                               EnergiesComputationDict[ener]['function type']))
-
-                # Write the file with the kernel definition
-                with open('{0}/{1}.c'.format(DirName,KernelName), 'w') as kernelfp:
-                    kernelfp.write(FileHeader.format(type))
-                    kernelfp.write(KernelTemplate
-                                   .format(VerletKernelTypeDict[type]['Define'],
-                                           ElectrostaticsDict[elec]['define'],
-                                           VdwTreatmentDict[ljtreat]['define'],
-                                           EnergiesComputationDict[ener]['define'],
-                                           KernelsHeaderPathName,
-                                           KernelName,
-                                           " " * (len(KernelName) + 1),
-                                           VerletKernelTypeDict[type]['UnrollSize'],
-                                       )
-                               )
+                KernelName = write_kernel(elec, ElectrostaticsDict[elec],
+                                          ljtreat, VdwTreatmentDict[ljtreat],
+                                          ener)
 
                 # Enter the kernel function in the lookup table
                 KernelFunctionLookupTable[ener] += '        {0},\n'.format(KernelName)
 
             KernelFunctionLookupTable[ener] += '    },\n'
         KernelFunctionLookupTable[ener] += '};\n'
+
+        if TypeDict.get('Tabulated', True):
+            TabulatedKernelFunction[ener] = write_kernel(TabulatedElectrostatics[0],
+                                                         TabulatedElectrostatics[1],
+                                                         TabulatedVdwTreatment[0],
+                                                         TabulatedVdwTreatment[1],
+                                                         ener)
         KernelDeclarations += '\n'
 
     # Write the header file that declares all the kernel
@@ -216,8 +258,19 @@ for type in VerletKernelTypeDict:
 
     # Write the file defining the kernel dispatcher
     # function for this type
-    with open('{0}/{1}'.format(DirName,"{0}.c".format(KernelsName,type)),'w') as fp:
+    with open('{0}/{1}.{2}'.format(DirName,KernelsName,FileSuffix),'w') as fp:
         fp.write(FileHeader.format(type))
+        if 'DispatcherTemplate' in TypeDict:
+            fp.write(read_kernel_template(TypeDict['DispatcherTemplate'])
+                     .format(TypeDict['Define'],
+                             KernelsHeaderFileName,
+                             KernelsName,
+                             ' ' * (len(KernelsName)+1),
+                             KernelFunctionLookupTable['F'],
+                             KernelFunctionLookupTable['VF'],
+                         )
+                 )
+            continue
         fp.write(KernelDispatcherTemplate
                  .format(VerletKernelTypeDict[type]['Define'],
                          VerletKernelTypeDict[type]['WidthSetup'],
@@ -229,7 +282,52 @@ for type in VerletKernelTypeDict:
                          KernelFunctionLookupTable['F'],
                          KernelFunctionLookupTable['VF'],
                          KernelFunctionLookupTable['VgrpF'],
+                         TabulatedKernelFunction['F'],
+                         TabulatedKernelFunction['VF'],
+                         TabulatedKernelFunction['VgrpF'],
                      )
              )
 
+# Translations from real to float for the files of the 2xnn_mixed type
+# that are copies of 2xnn files. The kernel loops should not use real
+# for anything that is double in the mixed-precision kernels.
+FloatCopyTranslations = [
+    (r'\bgmx_simd_real_t\b', 'gmx_simd_float_t'),
+    (r'\bgmx_simd4_real_t\b', 'gmx_simd4_float_t'),
+    (r'\bgmx_simd_bool_t\b', 'gmx_simd_fbool_t'),
+    (r'\bgmx_simd_int32_t\b', 'gmx_simd_fint32_t'),
+    (r'\bgmx_simd_(and|or)_b\b', r'gmx_simd_\1_fb'),
+    (r'\bgmx_simd_cvtt_r2i\b', 'gmx_simd_cvtt_f2i'),
+    (r'\bgmx_simd_cvt_i2r\b', 'gmx_simd_cvt_i2f'),
+    (r'\bgmx_simd_load_i\b', 'gmx_simd_load_fi'),
+    (r'\b(gmx_simd4?_\w+)_r\b', r'\1_f'),
+    (r'\bGMX_SIMD_REAL_WIDTH\b', 'GMX_SIMD_FLOAT_WIDTH'),
+    (r'\bGMX_SIMD_INT32_WIDTH\b', 'GMX_SIMD_FINT32_WIDTH'),
+    (r'\bGMX_NBNXN_SIMD_2XNN\b', 'GMX_NBNXN_SIMD_2XNN_MIXED'),
+    (r'\breal\b', 'float'),
+    (r'simd_2xnn/nbnxn_kernel_simd_2xnn_inner\.h', 'simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed_inner.h'),
+    (r'_nbnxn_kernel_simd_utils_x86_s?256s_h_', '_nbnxn_kernel_simd_2xnn_mixed_utils_h_'),
+]
+
+FloatCopyHeader = create_copyright_header('2012,2013,2014,2015')
+FloatCopyHeader += """/*
+ * Note: this file was generated by the Verlet kernel generator from
+ * {0}, with explicit single precision SIMD types.
+ */
+
+"""
+
+FloatCopies = collections.OrderedDict()
+FloatCopies['../simd_2xnn/nbnxn_kernel_simd_2xnn_outer.h'] = '../simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed_outer.h'
+FloatCopies['../simd_2xnn/nbnxn_kernel_simd_2xnn_inner.h'] = '../simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed_inner.h'
+FloatCopies['../nbnxn_kernel_simd_utils_x86_256s.h'] = '../simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed_utils.h'
+
+for source in FloatCopies:
+    text = read_kernel_template(source)
+    for pattern, replacement in FloatCopyTranslations:
+        text = re.sub(pattern, replacement, text)
+    with open(FloatCopies[source], 'w') as fp:
+        fp.write(FloatCopyHeader.format(os.path.basename(source)))
+        fp.write(text)
+
 sys.exit()
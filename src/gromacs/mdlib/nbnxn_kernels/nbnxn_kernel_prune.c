@@ -0,0 +1,277 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+#include "gmxpre.h"
+
+#include "nbnxn_kernel_prune.h"
+
+#include "config.h"
+
+#include "gromacs/legacyheaders/gmx_omp_nthreads.h"
+#include "gromacs/legacyheaders/macros.h"
+#include "gromacs/mdlib/nb_verlet.h"
+#include "gromacs/mdlib/nbnxn_atomdata.h"
+#include "gromacs/mdlib/nbnxn_consts.h"
+#include "gromacs/mdlib/nbnxn_internal.h"
+#include "gromacs/mdlib/nbnxn_search.h"
+#include "gromacs/utility/fatalerror.h"
+#include "gromacs/utility/smalloc.h"
+
+void
+nbnxn_set_outer_pairlists(nbnxn_pairlist_set_t *nbl_list)
+{
+    int i;
+
+    if (!nbl_list->bSimple)
+    {
+        gmx_incons("Dynamic pruning is only supported with simple pair lists");
+    }
+
+    for (i = 0; i < nbl_list->nnbl; i++)
+    {
+        nbnxn_pairlist_t *nbl = nbl_list->nbl[i];
+        nbnxn_ci_t       *ci;
+        nbnxn_cj_t       *cj;
+        int               nalloc, ncj_max, cio;
+
+        /* Swap the buffers, the next search overwrites the old outer list */
+        ci                   = nbl->ci_outer;
+        nbl->ci_outer        = nbl->ci;
+        nbl->ci              = ci;
+        nalloc               = nbl->ci_outer_nalloc;
+        nbl->ci_outer_nalloc = nbl->ci_nalloc;
+        nbl->ci_nalloc       = nalloc;
+        nbl->nci_outer       = nbl->nci;
+
+        cj                   = nbl->cj_outer;
+        nbl->cj_outer        = nbl->cj;
+        nbl->cj              = cj;
+        nalloc               = nbl->cj_outer_nalloc;
+        nbl->cj_outer_nalloc = nbl->cj_nalloc;
+        nbl->cj_nalloc       = nalloc;
+        nbl->ncj_outer       = nbl->ncj;
+
+        /* The inner list is at most as long as the outer list.
+         * A compressed inner list only stages one i-entry in cj.
+         */
+        nbl->bCompressed = nbl_list->bCompressed;
+        ncj_max          = nbl->ncj_outer;
+        if (nbl->bCompressed)
+        {
+            ncj_max = 0;
+            for (cio = 0; cio < nbl->nci_outer; cio++)
+            {
+                ncj_max = max(ncj_max,
+                              nbl->ci_outer[cio].cj_ind_end - nbl->ci_outer[cio].cj_ind_start);
+            }
+        }
+        if (nbl->nci_outer > nbl->ci_nalloc)
+        {
+            nbl->ci_nalloc = over_alloc_small(nbl->nci_outer);
+            nbnxn_realloc_void((void **)&nbl->ci, 0,
+                               nbl->ci_nalloc*sizeof(*nbl->ci),
+                               nbl->alloc, nbl->free);
+        }
+        if (ncj_max > nbl->cj_nalloc)
+        {
+            nbl->cj_nalloc = over_alloc_small(ncj_max);
+            nbnxn_realloc_void((void **)&nbl->cj, 0,
+                               nbl->cj_nalloc*sizeof(*nbl->cj),
+                               nbl->alloc, nbl->free);
+        }
+    }
+}
+
+void
+nbnxn_prune_close_ci_entry(nbnxn_pairlist_t *nbl, const nbnxn_ci_t *ci_outer,
+                           int cj_ind_start)
+{
+    nbnxn_ci_t *ci;
+    int         jlen;
+
+    jlen = nbl->ncj - cj_ind_start;
+    if (jlen == 0)
+    {
+        return;
+    }
+
+    ci               = &nbl->ci[nbl->nci];
+    ci->ci           = ci_outer->ci;
+    ci->shift        = ci_outer->shift;
+    ci->cj_ind_start = cj_ind_start;
+    ci->cj_ind_end   = nbl->ncj;
+
+    /* The same counts as for the search, see close_ci_entry_simple */
+    if (!(ci->shift & NBNXN_CI_DO_COUL(0)))
+    {
+        nbl->work->ncj_noq += jlen;
+    }
+    else if ((ci->shift & NBNXN_CI_HALF_LJ(0)) ||
+             !(ci->shift & NBNXN_CI_DO_LJ(0)))
+    {
+        nbl->work->ncj_hlj += jlen;
+    }
+
+    if (nbl->bCompressed)
+    {
+        nbnxn_compress_ci_entry(nbl);
+    }
+
+    nbl->nci++;
+}
+
+/* Returns a pointer to x of atom a in the coordinate layout of nbat,
+ * the stride between the x, y and z components is returned in stride.
+ */
+static gmx_inline const real *
+atom_x(const nbnxn_atomdata_t *nbat, int a, int *stride)
+{
+    switch (nbat->XFormat)
+    {
+        case nbatX4:
+            *stride = PACK_X4;
+            return nbat->x + X4_IND_A(a);
+        case nbatX8:
+            *stride = PACK_X8;
+            return nbat->x + X8_IND_A(a);
+        default:
+            *stride = 1;
+            return nbat->x + a*nbat->xstride;
+    }
+}
+
+void
+nbnxn_kernel_prune_ref(nbnxn_pairlist_t       *nbl,
+                       const nbnxn_atomdata_t *nbat,
+                       rvec                   *shift_vec,
+                       real                    rlist_inner)
+{
+    real xi[NBNXN_CPU_CLUSTER_I_SIZE*DIM];
+    real rlist2;
+    int  cio, cjind, i, j, d, s;
+
+    rlist2 = rlist_inner*rlist_inner;
+
+    for (cio = 0; cio < nbl->nci_outer; cio++)
+    {
+        const nbnxn_ci_t *ci_outer = &nbl->ci_outer[cio];
+        const real       *shift    = shift_vec[ci_outer->shift & NBNXN_CI_SHIFT];
+        int               cj_ind_start;
+
+        for (i = 0; i < nbl->na_ci; i++)
+        {
+            const real *x = atom_x(nbat, ci_outer->ci*nbl->na_ci + i, &s);
+
+            for (d = 0; d < DIM; d++)
+            {
+                xi[i*DIM + d] = x[d*s] + shift[d];
+            }
+        }
+
+        cj_ind_start = nbl->ncj;
+        for (cjind = ci_outer->cj_ind_start; cjind < ci_outer->cj_ind_end; cjind++)
+        {
+            const nbnxn_cj_t *cj       = &nbl->cj_outer[cjind];
+            gmx_bool          bInRange = FALSE;
+
+            for (j = 0; j < nbl->na_cj && !bInRange; j++)
+            {
+                const real *x = atom_x(nbat, cj->cj*nbl->na_cj + j, &s);
+
+                for (i = 0; i < nbl->na_ci && !bInRange; i++)
+                {
+                    real dx, dy, dz;
+
+                    dx       = xi[i*DIM + XX] - x[XX*s];
+                    dy       = xi[i*DIM + YY] - x[YY*s];
+                    dz       = xi[i*DIM + ZZ] - x[ZZ*s];
+                    bInRange = (dx*dx + dy*dy + dz*dz < rlist2);
+                }
+            }
+
+            if (bInRange)
+            {
+                nbl->cj[nbl->ncj++] = *cj;
+            }
+        }
+        nbnxn_prune_close_ci_entry(nbl, ci_outer, cj_ind_start);
+    }
+}
+
+void
+nbnxn_kernel_cpu_prune(nbnxn_pairlist_set_t   *nbl_list,
+                       const nbnxn_atomdata_t *nbat,
+                       rvec                   *shift_vec,
+                       real                    rlist_inner,
+                       int                     nb_kernel_type)
+{
+    nbnxn_pairlist_t **nbl = nbl_list->nbl;
+    int                nnbl, nap, np_tot, np_noq, np_hlj, i;
+
+    nnbl = nbl_list->nnbl;
+
+#pragma omp parallel for schedule(static) num_threads(gmx_omp_nthreads_get(emntNonbonded))
+    for (i = 0; i < nnbl; i++)
+    {
+        nbl[i]->nci           = 0;
+        nbl[i]->ncj           = 0;
+        nbl[i]->ncjc          = 0;
+        nbl[i]->ncjc_excl     = 0;
+        nbl[i]->work->ncj_noq = 0;
+        nbl[i]->work->ncj_hlj = 0;
+
+        if (nb_kernel_type == nbnxnk4xN_SIMD_4xN)
+        {
+            nbnxn_kernel_prune_4xn(nbl[i], nbat, shift_vec, rlist_inner);
+        }
+        else
+        {
+            nbnxn_kernel_prune_ref(nbl[i], nbat, shift_vec, rlist_inner);
+        }
+    }
+
+    np_tot = 0;
+    np_noq = 0;
+    np_hlj = 0;
+    for (i = 0; i < nnbl; i++)
+    {
+        np_tot += nbnxn_pairlist_ncj(nbl[i]);
+        np_noq += nbl[i]->work->ncj_noq;
+        np_hlj += nbl[i]->work->ncj_hlj;
+    }
+    nap                   = nbl[0]->na_ci*nbl[0]->na_cj;
+    nbl_list->natpair_ljq = (np_tot - np_noq)*nap - np_hlj*nap/2;
+    nbl_list->natpair_lj  = np_noq*nap;
+    nbl_list->natpair_q   = np_hlj*nap/2;
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+
+#ifndef _nbnxn_kernel_prune_h
+#define _nbnxn_kernel_prune_h
+
+#include "gromacs/legacyheaders/typedefs.h"
+#include "gromacs/mdlib/nbnxn_pairlist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* With dynamic pruning the pair lists built by the search at radius rlist
+ * are the outer lists. Every few steps, and at the search step itself,
+ * these are pruned with the current coordinates to inner lists with
+ * a shorter radius, which are used by the non-bonded kernels.
+ * Only simple (CPU) pair lists can be pruned.
+ */
+
+/* Turn the lists just built by the search into the outer lists */
+void
+nbnxn_set_outer_pairlists(nbnxn_pairlist_set_t *nbl_list);
+
+/* Prune the outer lists of nbl_list into the lists used by the kernels,
+ * keeping the cluster pairs that have at least one atom pair within
+ * rlist_inner. The pair counts for flop accounting are updated.
+ */
+void
+nbnxn_kernel_cpu_prune(nbnxn_pairlist_set_t   *nbl_list,
+                       const nbnxn_atomdata_t *nbat,
+                       rvec                   *shift_vec,
+                       real                    rlist_inner,
+                       int                     nb_kernel_type);
+
+/* Close the inner list entry of outer i-entry ci_outer, the j-entries
+ * of which have been added to the end of nbl->cj, for use by the prune
+ * kernels.
+ */
+void
+nbnxn_prune_close_ci_entry(nbnxn_pairlist_t *nbl, const nbnxn_ci_t *ci_outer,
+                           int cj_ind_start);
+
+/* The prune kernel for the plain-C and 2xNN lists */
+void
+nbnxn_kernel_prune_ref(nbnxn_pairlist_t       *nbl,
+                       const nbnxn_atomdata_t *nbat,
+                       rvec                   *shift_vec,
+                       real                    rlist_inner);
+
+/* The SIMD prune kernel for the 4xN lists */
+void
+nbnxn_kernel_prune_4xn(nbnxn_pairlist_t       *nbl,
+                       const nbnxn_atomdata_t *nbat,
+                       rvec                   *shift_vec,
+                       real                    rlist_inner);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
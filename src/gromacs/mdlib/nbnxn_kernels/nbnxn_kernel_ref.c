@@ -70,6 +70,20 @@ typedef void (*p_nbk_func_ener)(const nbnxn_pairlist_t     *nbl,
                                 real                       *Vvdw,
                                 real                       *Vc);
 
+/* Cubic spline interpolation of the YFGH table point tab at fraction eps,
+ * returns the potential and stores dV/deps in dvdeps.
+ */
+static gmx_inline real
+cubic_spline_table(const real *tab, real eps, real *dvdeps)
+{
+    real Fp;
+
+    Fp      = tab[1] + eps*(tab[2] + eps*tab[3]);
+    *dvdeps = Fp + eps*(tab[2] + 2*eps*tab[3]);
+
+    return tab[0] + eps*Fp;
+}
+
 /* Analytical reaction-field kernels */
 #define CALC_COUL_RF
 #define LJ_CUT
@@ -139,6 +153,13 @@ typedef void (*p_nbk_func_ener)(const nbnxn_pairlist_t     *nbl,
 #undef VDW_CUTOFF_CHECK
 #undef CALC_COUL_TAB
 
+/* Cubic spline table kernels for user potentials */
+#define CALC_COUL_CSTAB
+#define LJ_CSTAB
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_ref_includes.h"
+#undef LJ_CSTAB
+#undef CALC_COUL_CSTAB
+
 
 enum {
     coultRF, coultTAB, coultTAB_TWIN, coultNR
@@ -171,7 +192,7 @@ p_nbk_func_ener p_nbk_c_energrp[coultNR][vdwtNR] =
 
 void
 nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
-                 const nbnxn_atomdata_t     *nbat,
+                 nbnxn_atomdata_t           *nbat,
                  const interaction_const_t  *ic,
                  rvec                       *shift_vec,
                  int                         force_flags,
@@ -181,67 +202,83 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
                  real                       *Vvdw)
 {
     int                nnbl;
-    nbnxn_pairlist_t **nbl;
     int                coult;
     int                vdwt;
+    p_nbk_func_noener  nbk_noener;
+    p_nbk_func_ener    nbk_ener, nbk_energrp;
     int                nb;
     int                nthreads gmx_unused;
 
     nnbl = nbl_list->nnbl;
-    nbl  = nbl_list->nbl;
 
-    if (EEL_RF(ic->eeltype) || ic->eeltype == eelCUT)
+    if (ic->eeltype == eelUSER || ic->vdwtype == evdwUSER)
     {
-        coult = coultRF;
+        /* With user tables all interactions use cubic spline tables */
+        nbk_noener  = nbnxn_kernel_ElecCSTab_VdwCSTab_F_ref;
+        nbk_ener    = nbnxn_kernel_ElecCSTab_VdwCSTab_VF_ref;
+        nbk_energrp = nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_ref;
     }
     else
     {
-        if (ic->rcoulomb == ic->rvdw)
+        if (EEL_RF(ic->eeltype) || ic->eeltype == eelCUT)
         {
-            coult = coultTAB;
+            coult = coultRF;
         }
         else
         {
-            coult = coultTAB_TWIN;
+            if (ic->rcoulomb == ic->rvdw)
+            {
+                coult = coultTAB;
+            }
+            else
+            {
+                coult = coultTAB_TWIN;
+            }
         }
-    }
 
-    if (ic->vdwtype == evdwCUT)
-    {
-        switch (ic->vdw_modifier)
+        if (ic->vdwtype == evdwCUT)
         {
-            case eintmodPOTSHIFT:
-            case eintmodNONE:
-                vdwt = vdwtCUT;
-                break;
-            case eintmodFORCESWITCH:
-                vdwt = vdwtFSWITCH;
-                break;
-            case eintmodPOTSWITCH:
-                vdwt = vdwtPSWITCH;
-                break;
-            default:
-                gmx_incons("Unsupported VdW modifier");
-                break;
+            switch (ic->vdw_modifier)
+            {
+                case eintmodPOTSHIFT:
+                case eintmodNONE:
+                    vdwt = vdwtCUT;
+                    break;
+                case eintmodFORCESWITCH:
+                    vdwt = vdwtFSWITCH;
+                    break;
+                case eintmodPOTSWITCH:
+                    vdwt = vdwtPSWITCH;
+                    break;
+                default:
+                    gmx_incons("Unsupported VdW modifier");
+                    break;
+            }
         }
-    }
-    else if (ic->vdwtype == evdwPME)
-    {
-        if (ic->ljpme_comb_rule == ljcrGEOM)
+        else if (ic->vdwtype == evdwPME)
         {
-            assert(nbat->comb_rule == ljcrGEOM);
-            vdwt = vdwtEWALDGEOM;
+            if (ic->ljpme_comb_rule == ljcrGEOM)
+            {
+                assert(nbat->comb_rule == ljcrGEOM);
+                vdwt = vdwtEWALDGEOM;
+            }
+            else
+            {
+                assert(nbat->comb_rule == ljcrLB);
+                vdwt = vdwtEWALDLB;
+            }
         }
         else
         {
-            assert(nbat->comb_rule == ljcrLB);
-            vdwt = vdwtEWALDLB;
+            gmx_incons("Unsupported vdwtype in nbnxn reference kernel");
         }
+
+        nbk_noener  = p_nbk_c_noener[coult][vdwt];
+        nbk_ener    = p_nbk_c_ener[coult][vdwt];
+        nbk_energrp = p_nbk_c_energrp[coult][vdwt];
     }
-    else
-    {
-        gmx_incons("Unsupported vdwtype in nbnxn reference kernel");
-    }
+
+    nbnxn_kernel_steal_prepare(nbl_list, nbat);
 
     nthreads = gmx_omp_nthreads_get(emntNonbonded);
 #pragma omp parallel for schedule(static) num_threads(nthreads)
@@ -249,6 +286,9 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
     {
         nbnxn_atomdata_output_t *out;
         real                    *fshift_p;
+        nbnxn_chunk_iter_t       it;
+        const nbnxn_pairlist_t  *nbl_c;
+        int                      i;
 
         out = &nbat->out[nb];
 
@@ -271,53 +311,66 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
             }
         }
 
-        if (!(force_flags & GMX_FORCE_ENERGY))
+        /* The chunks we compute accumulate into our energy buffers */
+        if (force_flags & GMX_FORCE_ENERGY)
         {
-            /* Don't calculate energies */
-            p_nbk_c_noener[coult][vdwt](nbl[nb], nbat,
-                                        ic,
-                                        shift_vec,
-                                        out->f,
-                                        fshift_p);
-        }
-        else if (out->nV == 1)
-        {
-            /* No energy groups */
-            out->Vvdw[0] = 0;
-            out->Vc[0]   = 0;
-
-            p_nbk_c_ener[coult][vdwt](nbl[nb], nbat,
-                                      ic,
-                                      shift_vec,
-                                      out->f,
-                                      fshift_p,
-                                      out->Vvdw,
-                                      out->Vc);
+            if (out->nV == 1)
+            {
+                out->Vvdw[0] = 0;
+                out->Vc[0]   = 0;
+            }
+            else
+            {
+                for (i = 0; i < out->nV; i++)
+                {
+                    out->Vvdw[i] = 0;
+                }
+                for (i = 0; i < out->nV; i++)
+                {
+                    out->Vc[i] = 0;
+                }
+            }
         }
-        else
-        {
-            /* Calculate energy group contributions */
-            int i;
 
-            for (i = 0; i < out->nV; i++)
+        nbnxn_kernel_chunk_iter_init(&it, nbl_list, nb);
+        while ((nbl_c = nbnxn_kernel_chunk_next(&it, nbl_list, nbat, out->f)) != NULL)
+        {
+            if (!(force_flags & GMX_FORCE_ENERGY))
             {
-                out->Vvdw[i] = 0;
+                /* Don't calculate energies */
+                nbk_noener(nbl_c, nbat,
+                           ic,
+                           shift_vec,
+                           out->f,
+                           fshift_p);
             }
-            for (i = 0; i < out->nV; i++)
+            else if (out->nV == 1)
             {
-                out->Vc[i] = 0;
+                /* No energy groups */
+                nbk_ener(nbl_c, nbat,
+                         ic,
+                         shift_vec,
+                         out->f,
+                         fshift_p,
+                         out->Vvdw,
+                         out->Vc);
+            }
+            else
+            {
+                /* Calculate energy group contributions */
+                nbk_energrp(nbl_c, nbat,
+                            ic,
+                            shift_vec,
+                            out->f,
+                            fshift_p,
+                            out->Vvdw,
+                            out->Vc);
             }
-
-            p_nbk_c_energrp[coult][vdwt](nbl[nb], nbat,
-                                         ic,
-                                         shift_vec,
-                                         out->f,
-                                         fshift_p,
-                                         out->Vvdw,
-                                         out->Vc);
         }
     }
 
+    nbnxn_kernel_steal_finish(nbl_list, nbat);
+
     if (force_flags & GMX_FORCE_ENERGY)
     {
         reduce_energies_over_lists(nbat, nnbl, Vvdw, Vc);
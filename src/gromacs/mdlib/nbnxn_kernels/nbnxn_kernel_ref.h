@@ -46,7 +46,7 @@ extern "C" {
 /* Wrapper call for the non-bonded n vs n reference kernels */
 void
 nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
-                 const nbnxn_atomdata_t     *nbat,
+                 nbnxn_atomdata_t           *nbat,
                  const interaction_const_t  *ic,
                  rvec                       *shift_vec,
                  int                         force_flags,
@@ -67,12 +67,20 @@
             int  aj;
             real dx, dy, dz;
             real rsq, rinv;
-            real rinvsq, rinvsix;
+            real rinvsq;
+#ifndef LJ_CSTAB
+            real rinvsix;
+#endif
             real c6, c12;
             real FrLJ6 = 0, FrLJ12 = 0, frLJ = 0, VLJ = 0;
 #if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
             real r, rsw;
 #endif
+#ifdef CALC_COUL_CSTAB
+            real        rs, frac;
+            int         ri;
+            const real *tab_ri;
+#endif
 
 #ifdef CALC_COULOMB
             real qq;
@@ -147,6 +155,14 @@
 
             rinvsq  = rinv*rinv;
 
+#ifdef CALC_COUL_CSTAB
+            /* Cubic spline table point, this is 0 for masked pairs */
+            rs      = rsq*rinv*tabcs_scale;
+            ri      = (int)rs;
+            frac    = rs - ri;
+            tab_ri  = tab_cs + ri*tabcs_stride;
+#endif
+
 #ifdef HALF_LJ
             if (i < UNROLLI/2)
 #endif
@@ -250,6 +266,22 @@
                 }
 #endif          /* LJ_EWALD */
 
+#ifdef LJ_CSTAB
+                {
+                    real fd, fr;
+
+                    /* Tabulated dispersion and repulsion, FrLJ = -dV/dr*r */
+                    VLJ     = c6*cubic_spline_table(tab_ri + 4, frac, &fd) +
+                        c12*cubic_spline_table(tab_ri + 8, frac, &fr);
+                    FrLJ6   = interact*c6*fd*rs;
+                    FrLJ12  = -interact*c12*fr*rs;
+                    frLJ    = FrLJ12 - FrLJ6;
+#ifdef CALC_ENERGIES
+                    VLJ     = VLJ * interact;
+#endif
+                }
+#endif
+
 #ifdef VDW_CUTOFF_CHECK
                 /* Mask for VdW cut-off shorter than Coulomb cut-off */
                 {
@@ -329,6 +361,26 @@
             fcoul *= qq*rinv;
 #endif
 
+#ifdef CALC_COUL_CSTAB
+            {
+                real vctab, fctab, ctab_int, ctab_ex;
+
+                vctab    = cubic_spline_table(tab_ri, frac, &fctab);
+                /* The table contains 1/r plus a long-range correction,
+                 * for excluded pairs we keep only the correction by
+                 * subtracting 1/r. With user tables excluded pairs
+                 * do not interact at all.
+                 */
+                ctab_int = (tabcs_excl != 0 ? 1 : interact);
+                ctab_ex  = tabcs_excl*(interact - 1)*rinv;
+                fcoul    = qq*(ctab_ex - ctab_int*fctab*rs)*rinvsq;
+#ifdef CALC_ENERGIES
+                /* Excluded pairs do not have the potential shift of the table */
+                vcoul    = qq*(ctab_int*vctab + ctab_ex + (1 - interact)*tabcs_sh_excl);
+#endif
+            }
+#endif
+
 #ifdef CALC_ENERGIES
 #ifdef ENERGY_GROUPS
             Vc[egp_sh_i[i]+((egp_cj>>(nbat->neg_2log*j)) & egp_mask)] += vcoul;
@@ -62,6 +62,9 @@
 #define NBK_FUNC_NAME2(ljt, feg) nbnxn_kernel ## _ElecQSTabTwinCut ## ljt ## feg ## _ref
 #endif
 #endif
+#ifdef CALC_COUL_CSTAB
+#define NBK_FUNC_NAME2(ljt, feg) nbnxn_kernel ## _ElecCSTab ## ljt ## feg ## _ref
+#endif
 
 #if defined LJ_CUT && !defined LJ_EWALD
 #define NBK_FUNC_NAME(feg) NBK_FUNC_NAME2(_VdwLJ, feg)
@@ -75,6 +78,8 @@
 #else
 #define NBK_FUNC_NAME(feg) NBK_FUNC_NAME2(_VdwLJEwCombLB, feg)
 #endif
+#elif defined LJ_CSTAB
+#define NBK_FUNC_NAME(feg) NBK_FUNC_NAME2(_VdwCSTab, feg)
 #else
 #error "No VdW type defined"
 #endif
@@ -166,6 +171,15 @@ NBK_FUNC_NAME(_VgrpF)
     const real *tab_coul_F;
     const real *tab_coul_V;
 #endif
+#endif
+#ifdef CALC_COUL_CSTAB
+    real        tabcs_scale;
+    int         tabcs_stride;
+    const real *tab_cs;
+    real        tabcs_excl;
+#ifdef CALC_ENERGIES
+    real        tabcs_sh_excl;
+#endif
 #endif
 
     int ninner;
@@ -211,6 +225,16 @@ NBK_FUNC_NAME(_VgrpF)
     tab_coul_V    = ic->tabq_coul_V;
 #endif
 #endif
+#ifdef CALC_COUL_CSTAB
+    tabcs_scale   = ic->tabcs_scale;
+    tabcs_stride  = ic->tabcs_stride;
+    tab_cs        = ic->tabcs_data;
+    /* With user electrostatics excluded pairs do not interact */
+    tabcs_excl    = (ic->eeltype == eelUSER ? 0 : 1);
+#ifdef CALC_ENERGIES
+    tabcs_sh_excl = ic->tabcs_sh_excl;
+#endif
+#endif
 
 #ifdef ENERGY_GROUPS
     egp_mask = (1<<nbat->neg_2log) - 1;
@@ -300,6 +324,21 @@ NBK_FUNC_NAME(_VgrpF)
 #else
             Vc_sub_self = 0.5*tab_coul_FDV0[2];
 #endif
+#endif
+#ifdef CALC_COUL_CSTAB
+            /* Half the exclusion correction at r=0 */
+            if (ic->eeltype == eelUSER)
+            {
+                Vc_sub_self = 0;
+            }
+            else if (EEL_PME_EWALD(ic->eeltype))
+            {
+                Vc_sub_self = 0.5*ic->ewaldcoeff_q*M_2_SQRTPI;
+            }
+            else
+            {
+                Vc_sub_self = 0.5*ic->c_rf;
+            }
 #endif
 
             if (l_cj[nbln->cj_ind_start].cj == ci_sh)
@@ -38,6 +38,7 @@
 #include "config.h"
 
 #include "gromacs/legacyheaders/types/simple.h"
+#include "gromacs/mdlib/nbnxn_pairlist.h"
 #include "gromacs/mdlib/nbnxn_simd.h"
 #include "gromacs/simd/simd.h"
 
@@ -71,7 +72,8 @@ prepare_table_load_buffer(const int gmx_unused *array)
 
 #else /* GMX_SIMD_REFERENCE */
 
-#if defined  GMX_TARGET_X86 && !defined GMX_SIMD_X86_MIC
+#if defined  GMX_TARGET_X86 && !defined GMX_SIMD_X86_MIC && \
+    !(defined GMX_SIMD_X86_AVX_512F || defined GMX_SIMD_X86_AVX_512ER)
 /* Include x86 SSE2 compatible SIMD functions */
 
 /* Set the stride for the lookup of the two LJ parameters from their
@@ -112,7 +114,7 @@ prepare_table_load_buffer(int gmx_unused *array)
 #endif
 #endif /* GMX_DOUBLE */
 
-#else  /* GMX_TARGET_X86 && !GMX_SIMD_X86_MIC */
+#else  /* GMX_TARGET_X86 && !GMX_SIMD_X86_MIC && !AVX-512 */
 
 #if GMX_SIMD_REAL_WIDTH > 4
 /* For width>4 we use unaligned loads. And thus we can use the minimal stride */
@@ -134,7 +136,11 @@ static const int nbfp_stride = GMX_SIMD_REAL_WIDTH;
 #include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_simd_utils_x86_mic.h"
 #endif
 
-#endif /* GMX_TARGET_X86 && !GMX_SIMD_X86_MIC */
+#if defined GMX_SIMD_X86_AVX_512F || defined GMX_SIMD_X86_AVX_512ER
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_simd_utils_x86_512.h"
+#endif
+
+#endif /* GMX_TARGET_X86 && !GMX_SIMD_X86_MIC && !AVX-512 */
 
 #endif /* GMX_SIMD_REFERENCE */
 
@@ -200,4 +206,61 @@ add_ener_grp_halves(gmx_simd_real_t e_S, real *v0, real *v1, const int *offset_j
 }
 #endif
 
+/* Gathers ncoef consecutive coefficients of the cubic spline table tab,
+ * with tab_stride reals per table point, at the table points given by
+ * the scaled distances rs_S. The coefficients are stored in the aligned
+ * buffer buf as ncoef SIMD registers, buf should have space for ncoef+1
+ * registers. Returns the fraction of rs_S between the table points.
+ */
+static gmx_inline gmx_simd_real_t
+load_table_cs(const real *tab, int tab_stride, int ncoef,
+              gmx_simd_real_t rs_S, real *buf)
+{
+    real            *rs;
+    gmx_simd_real_t  rf_S;
+    int              i, c;
+
+    rs = buf + ncoef*GMX_SIMD_REAL_WIDTH;
+    gmx_simd_store_r(rs, rs_S);
+    for (i = 0; i < GMX_SIMD_REAL_WIDTH; i++)
+    {
+        const real *tab_i = tab + ((int)rs[i])*tab_stride;
+
+        for (c = 0; c < ncoef; c++)
+        {
+            buf[c*GMX_SIMD_REAL_WIDTH + i] = tab_i[c];
+        }
+    }
+
+#ifdef GMX_SIMD_HAVE_TRUNC
+    rf_S = gmx_simd_trunc_r(rs_S);
+#else
+    rf_S = gmx_simd_cvt_i2r(gmx_simd_cvtt_r2i(rs_S));
+#endif
+
+    return gmx_simd_sub_r(rs_S, rf_S);
+}
+
+/* Interpolates the cubic spline with coefficients Y, F, G, H stored as
+ * four consecutive SIMD registers in buf at fraction eps_S.
+ * Returns the potential in *v_S and its derivative to eps in *f_S.
+ */
+static gmx_inline void
+interpolate_table_cs(const real *buf, gmx_simd_real_t eps_S,
+                     gmx_simd_real_t *v_S, gmx_simd_real_t *f_S)
+{
+    gmx_simd_real_t Y_S, F_S, G_S, H_S, Fp_S;
+
+    Y_S   = gmx_simd_load_r(buf + 0*GMX_SIMD_REAL_WIDTH);
+    F_S   = gmx_simd_load_r(buf + 1*GMX_SIMD_REAL_WIDTH);
+    G_S   = gmx_simd_load_r(buf + 2*GMX_SIMD_REAL_WIDTH);
+    H_S   = gmx_simd_load_r(buf + 3*GMX_SIMD_REAL_WIDTH);
+
+    /* Fp = F + eps*(G + eps*H), V = Y + eps*Fp */
+    Fp_S  = gmx_simd_fmadd_r(eps_S, gmx_simd_fmadd_r(eps_S, H_S, G_S), F_S);
+    *v_S  = gmx_simd_fmadd_r(eps_S, Fp_S, Y_S);
+    /* dV/deps = Fp + eps*(G + 2*eps*H) */
+    *f_S  = gmx_simd_fmadd_r(eps_S, gmx_simd_fmadd_r(eps_S, gmx_simd_add_r(H_S, H_S), G_S), Fp_S);
+}
+
 #endif /* _nbnxn_kernel_simd_utils_h_ */
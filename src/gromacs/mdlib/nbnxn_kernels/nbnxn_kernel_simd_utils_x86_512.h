@@ -0,0 +1,382 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+#ifndef _nbnxn_kernel_simd_utils_x86_512_h_
+#define _nbnxn_kernel_simd_utils_x86_512_h_
+
+/* This files contains all functions/macros for the SIMD kernels
+ * which have explicit dependencies on the j-cluster size and/or SIMD-width.
+ * The functionality which depends on the j-cluster size is:
+ *   LJ-parameter lookup
+ *   force table lookup
+ *   energy group pair energy storage
+ *
+ * With AVX-512F we have 16-wide single and 8-wide double precision.
+ * In single precision only the 2x(8+8) kernel is used, in double
+ * precision the 4x8 and 2x(4+4) kernels. All table and LJ parameter
+ * lookups use gather instructions, so no FDV0 table layout or
+ * aligned table index buffer is needed.
+ *
+ * The unmasked forms of the gathers, inserts, extracts and broadcasts
+ * pass an undefined source operand, which gcc reports as possibly
+ * uninitialized. We use the (zero-)masked forms with all lanes set.
+ */
+
+/* Align a stack-based thread-local working array. The gathers take
+ * the table indices directly from the SIMD register, so unused here.
+ */
+static gmx_inline int *
+prepare_table_load_buffer(int gmx_unused *array)
+{
+    return NULL;
+}
+
+#ifndef GMX_DOUBLE
+
+#ifdef GMX_NBNXN_SIMD_2XNN
+/* Half-width operations are required for the 2xnn kernels */
+
+/* Half-width SIMD real type */
+#define gmx_mm_hpr  __m256
+
+/* Half-width SIMD operations */
+/* Load reals at half-width aligned pointer b into half-width SIMD register a */
+#define gmx_load_hpr(a, b)    *(a) = _mm256_load_ps(b)
+/* Set all entries in half-width SIMD register *a to b */
+#define gmx_set1_hpr(a, b)    *(a) = _mm256_set1_ps(b)
+/* To half-width SIMD register b into half width aligned memory a */
+#define gmx_store_hpr(a, b)          _mm256_store_ps(a, b)
+#define gmx_add_hpr                  _mm256_add_ps
+#define gmx_sub_hpr                  _mm256_sub_ps
+
+/* Load one real at b and one real at b+1 into halves of a, respectively */
+static gmx_inline void
+gmx_load1p1_pr(__m512 *a, const real *b)
+{
+    *a = _mm512_castpd_ps(_mm512_maskz_insertf64x4(0xFF,
+                                                   _mm512_castpd256_pd512(_mm256_castps_pd(_mm256_set1_ps(b[0]))),
+                                                   _mm256_castps_pd(_mm256_set1_ps(b[1])), 0x1));
+}
+
+/* Load reals at half-width aligned pointer b into two halves of a */
+static gmx_inline void
+gmx_loaddh_pr(__m512 *a, const real *b)
+{
+    *a = _mm512_castpd_ps(_mm512_maskz_broadcast_f64x4(0xFF, _mm256_castps_pd(_mm256_load_ps(b))));
+}
+
+/* Extract the low and high half of a into b and c, respectively */
+static gmx_inline void
+gmx_pr_to_2hpr(__m512 a, __m256 *b, __m256 *c)
+{
+    *b = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, _mm512_castps_pd(a), 0x0));
+    *c = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, _mm512_castps_pd(a), 0x1));
+}
+
+/* Store half width SIMD registers a and b in full width register *c */
+static gmx_inline void
+gmx_2hpr_to_pr(__m256 a, __m256 b, __m512 *c)
+{
+    *c = _mm512_castpd_ps(_mm512_maskz_insertf64x4(0xFF,
+                                                   _mm512_castpd256_pd512(_mm256_castps_pd(a)),
+                                                   _mm256_castps_pd(b), 0x1));
+}
+
+/* Sum over 4 half SIMD registers */
+static gmx_inline __m256
+gmx_sum4_hpr(__m512 a, __m512 b)
+{
+    __m256 lo, hi;
+
+    gmx_pr_to_2hpr(_mm512_add_ps(a, b), &lo, &hi);
+
+    return _mm256_add_ps(lo, hi);
+}
+
+/* Sum the elements of halfs of each input register and return the sums */
+static gmx_inline __m128
+gmx_mm_transpose_sum4h_pr(__m512 in0, __m512 in2)
+{
+    __m256 in0h, in1h, in2h, in3h;
+
+    gmx_pr_to_2hpr(in0, &in0h, &in1h);
+    gmx_pr_to_2hpr(in2, &in2h, &in3h);
+
+    in0h = _mm256_hadd_ps(in0h, in1h);
+    in2h = _mm256_hadd_ps(in2h, in3h);
+    in1h = _mm256_hadd_ps(in0h, in2h);
+
+    return _mm_add_ps(_mm256_castps256_ps128(in1h),
+                      _mm256_extractf128_ps(in1h, 0x1));
+}
+
+/* Load the LJ parameters of the UNROLLJ j-atoms for two i-atoms,
+ * with parameter rows nbfp0 and nbfp1, into the two halves of
+ * c6_S and c12_S. A single gather from nbfp0 covers both rows.
+ */
+static gmx_inline void
+load_lj_pair_params2(const real *nbfp0, const real *nbfp1,
+                     const int *type, int aj,
+                     __m512 *c6_S, __m512 *c12_S)
+{
+    __m256i t_S;
+    __m512i idx_S;
+
+    t_S   = _mm256_slli_epi32(_mm256_loadu_si256((const __m256i *)(type+aj)), 1);
+    idx_S = _mm512_maskz_inserti64x4(0xFF, _mm512_castsi256_si512(t_S),
+                                     _mm256_add_epi32(t_S, _mm256_set1_epi32(nbfp1 - nbfp0)), 0x1);
+
+    *c6_S  = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, idx_S, nbfp0, sizeof(real));
+    *c12_S = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, idx_S, nbfp0 + 1, sizeof(real));
+}
+#endif /* GMX_NBNXN_SIMD_2XNN */
+
+static gmx_inline void
+load_table_f(const real *tab_coul_F, __m512i ti_S, int gmx_unused *ti,
+             __m512 *ctab0_S, __m512 *ctab1_S)
+{
+    *ctab0_S = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, ti_S, tab_coul_F, sizeof(real));
+    *ctab1_S = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, ti_S, tab_coul_F + 1, sizeof(real));
+    /* The second force table entry should contain the difference */
+    *ctab1_S = _mm512_sub_ps(*ctab1_S, *ctab0_S);
+}
+
+static gmx_inline void
+load_table_f_v(const real *tab_coul_F, const real *tab_coul_V,
+               __m512i ti_S, int *ti,
+               __m512 *ctab0_S, __m512 *ctab1_S, __m512 *ctabv_S)
+{
+    load_table_f(tab_coul_F, ti_S, ti, ctab0_S, ctab1_S);
+    *ctabv_S = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, ti_S, tab_coul_V, sizeof(real));
+}
+
+/* With 16 32-bit integers per 16 reals we use one filter bit per real */
+typedef __m512i gmx_exclfilter;
+static const int filter_stride = 1;
+
+static gmx_inline gmx_exclfilter
+gmx_load1_exclfilter(int e)
+{
+    return _mm512_set1_epi32(e);
+}
+
+static gmx_inline gmx_exclfilter
+gmx_load_exclusion_filter(const unsigned *i)
+{
+    return _mm512_load_si512(i);
+}
+
+static gmx_inline gmx_simd_bool_t
+gmx_checkbitmask_pb(gmx_exclfilter m0, gmx_exclfilter m1)
+{
+    return _mm512_test_epi32_mask(m0, m1);
+}
+
+#else /* GMX_DOUBLE */
+
+#ifdef GMX_NBNXN_SIMD_2XNN
+/* Half-width operations are required for the 2xnn kernels */
+
+/* Half-width SIMD real type */
+#define gmx_mm_hpr  __m256d
+
+/* Half-width SIMD operations */
+/* Load reals at half-width aligned pointer b into half-width SIMD register a */
+#define gmx_load_hpr(a, b)    *(a) = _mm256_load_pd(b)
+/* Set all entries in half-width SIMD register *a to b */
+#define gmx_set1_hpr(a, b)    *(a) = _mm256_set1_pd(b)
+/* To half-width SIMD register b into half width aligned memory a */
+#define gmx_store_hpr(a, b)          _mm256_store_pd(a, b)
+#define gmx_add_hpr                  _mm256_add_pd
+#define gmx_sub_hpr                  _mm256_sub_pd
+
+/* Load one real at b and one real at b+1 into halves of a, respectively */
+static gmx_inline void
+gmx_load1p1_pr(__m512d *a, const real *b)
+{
+    *a = _mm512_maskz_insertf64x4(0xFF, _mm512_castpd256_pd512(_mm256_set1_pd(b[0])),
+                                  _mm256_set1_pd(b[1]), 0x1);
+}
+
+/* Load reals at half-width aligned pointer b into two halves of a */
+static gmx_inline void
+gmx_loaddh_pr(__m512d *a, const real *b)
+{
+    *a = _mm512_maskz_broadcast_f64x4(0xFF, _mm256_load_pd(b));
+}
+
+/* Extract the low and high half of a into b and c, respectively */
+static gmx_inline void
+gmx_pr_to_2hpr(__m512d a, __m256d *b, __m256d *c)
+{
+    *b = _mm512_maskz_extractf64x4_pd(0xF, a, 0x0);
+    *c = _mm512_maskz_extractf64x4_pd(0xF, a, 0x1);
+}
+
+/* Store half width SIMD registers a and b in full width register *c */
+static gmx_inline void
+gmx_2hpr_to_pr(__m256d a, __m256d b, __m512d *c)
+{
+    *c = _mm512_maskz_insertf64x4(0xFF, _mm512_castpd256_pd512(a), b, 0x1);
+}
+
+/* Sum over 4 half SIMD registers */
+static gmx_inline __m256d
+gmx_sum4_hpr(__m512d a, __m512d b)
+{
+    __m256d lo, hi;
+
+    gmx_pr_to_2hpr(_mm512_add_pd(a, b), &lo, &hi);
+
+    return _mm256_add_pd(lo, hi);
+}
+
+/* Sum the elements of halfs of each input register and return the sums */
+static gmx_inline __m256d
+gmx_mm_transpose_sum4h_pr(__m512d in0, __m512d in2)
+{
+    __m256d in0h, in1h, in2h, in3h;
+
+    gmx_pr_to_2hpr(in0, &in0h, &in1h);
+    gmx_pr_to_2hpr(in2, &in2h, &in3h);
+
+    in0h = _mm256_hadd_pd(in0h, in1h);
+    in2h = _mm256_hadd_pd(in2h, in3h);
+
+    return _mm256_add_pd(_mm256_permute2f128_pd(in0h, in2h, 0x20),
+                         _mm256_permute2f128_pd(in0h, in2h, 0x31));
+}
+
+/* Load the LJ parameters of the UNROLLJ j-atoms for two i-atoms,
+ * with parameter rows nbfp0 and nbfp1, into the two halves of
+ * c6_S and c12_S. A single gather from nbfp0 covers both rows.
+ */
+static gmx_inline void
+load_lj_pair_params2(const real *nbfp0, const real *nbfp1,
+                     const int *type, int aj,
+                     __m512d *c6_S, __m512d *c12_S)
+{
+    __m128i t_S;
+    __m256i idx_S;
+
+    t_S   = _mm_slli_epi32(_mm_loadu_si128((const __m128i *)(type+aj)), 1);
+    idx_S = _mm256_inserti128_si256(_mm256_castsi128_si256(t_S),
+                                    _mm_add_epi32(t_S, _mm_set1_epi32(nbfp1 - nbfp0)), 0x1);
+
+    *c6_S  = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, idx_S, nbfp0, sizeof(real));
+    *c12_S = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, idx_S, nbfp0 + 1, sizeof(real));
+}
+#endif /* GMX_NBNXN_SIMD_2XNN */
+
+#ifdef GMX_NBNXN_SIMD_4XN
+/* Sum the elements within each input register and return the sums */
+static gmx_inline __m256d
+gmx_mm_transpose_sum4_pr(__m512d in0, __m512d in1,
+                         __m512d in2, __m512d in3)
+{
+    __m512d t0, t2;
+
+    /* Pairwise sums of in0/in1 and in2/in3 in each 128-bit lane */
+    t0 = _mm512_add_pd(_mm512_unpacklo_pd(in0, in1), _mm512_unpackhi_pd(in0, in1));
+    t2 = _mm512_add_pd(_mm512_unpacklo_pd(in2, in3), _mm512_unpackhi_pd(in2, in3));
+    /* Reduce the four 128-bit lanes of t0 and t2 to two */
+    t0 = _mm512_add_pd(_mm512_maskz_shuffle_f64x2(0xFF, t0, t2, _MM_SHUFFLE(2, 0, 2, 0)),
+                       _mm512_maskz_shuffle_f64x2(0xFF, t0, t2, _MM_SHUFFLE(3, 1, 3, 1)));
+    /* and to one */
+    t0 = _mm512_add_pd(_mm512_maskz_shuffle_f64x2(0xFF, t0, t0, _MM_SHUFFLE(0, 0, 2, 0)),
+                       _mm512_maskz_shuffle_f64x2(0xFF, t0, t0, _MM_SHUFFLE(0, 0, 3, 1)));
+
+    return _mm512_maskz_extractf64x4_pd(0xF, t0, 0x0);
+}
+
+/* Load the LJ parameters of the UNROLLJ j-atoms from parameter row nbfp */
+static gmx_inline void
+load_lj_pair_params(const real *nbfp, const int *type, int aj,
+                    __m512d *c6_S, __m512d *c12_S)
+{
+    __m256i idx_S;
+
+    idx_S  = _mm256_slli_epi32(_mm256_loadu_si256((const __m256i *)(type+aj)), 1);
+
+    *c6_S  = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, idx_S, nbfp, sizeof(real));
+    *c12_S = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, idx_S, nbfp + 1, sizeof(real));
+}
+#endif /* GMX_NBNXN_SIMD_4XN */
+
+static gmx_inline void
+load_table_f(const real *tab_coul_F, __m256i ti_S, int gmx_unused *ti,
+             __m512d *ctab0_S, __m512d *ctab1_S)
+{
+    *ctab0_S = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, ti_S, tab_coul_F, sizeof(real));
+    *ctab1_S = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, ti_S, tab_coul_F + 1, sizeof(real));
+    /* The second force table entry should contain the difference */
+    *ctab1_S = _mm512_sub_pd(*ctab1_S, *ctab0_S);
+}
+
+static gmx_inline void
+load_table_f_v(const real *tab_coul_F, const real *tab_coul_V,
+               __m256i ti_S, int *ti,
+               __m512d *ctab0_S, __m512d *ctab1_S, __m512d *ctabv_S)
+{
+    load_table_f(tab_coul_F, ti_S, ti, ctab0_S, ctab1_S);
+    *ctabv_S = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, ti_S, tab_coul_V, sizeof(real));
+}
+
+/* We use two identical 32-bit filters per real and test both as
+ * one 64-bit element, which gives the mask for 8 doubles directly.
+ */
+typedef __m512i gmx_exclfilter;
+static const int filter_stride = 2;
+
+static gmx_inline gmx_exclfilter
+gmx_load1_exclfilter(int e)
+{
+    return _mm512_set1_epi32(e);
+}
+
+static gmx_inline gmx_exclfilter
+gmx_load_exclusion_filter(const unsigned *i)
+{
+    return _mm512_load_si512(i);
+}
+
+static gmx_inline gmx_simd_bool_t
+gmx_checkbitmask_pb(gmx_exclfilter m0, gmx_exclfilter m1)
+{
+    return _mm512_test_epi64_mask(m0, m1);
+}
+
+#endif /* GMX_DOUBLE */
+
+#endif /* _nbnxn_kernel_simd_utils_x86_512_h_ */
@@ -47,7 +47,7 @@ extern "C" {
 /*! \brief Run-time dispatcher for nbnxn kernel functions. */
 gmx_offload void
 nbnxn_kernel_simd_2xnn(nbnxn_pairlist_set_t       *nbl_list,
-                       const nbnxn_atomdata_t     *nbat,
+                       nbnxn_atomdata_t           *nbat,
                        const interaction_const_t  *ic,
                        int                         ewald_excl,
                        rvec                       *shift_vec,
@@ -111,6 +111,7 @@ nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_2xnn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_2xnn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_2xnn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_2xnn;
+nbk_func_ener         nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_2xnn;
 
 nbk_func_ener         nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn;
 nbk_func_ener         nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn;
@@ -142,6 +143,7 @@ nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn;
+nbk_func_ener         nbnxn_kernel_ElecCSTab_VdwCSTab_VF_2xnn;
 
 nbk_func_noener       nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn;
 nbk_func_noener       nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn;
@@ -173,6 +175,7 @@ nbk_func_noener       nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn;
 nbk_func_noener       nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn;
 nbk_func_noener       nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn;
 nbk_func_noener       nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn;
+nbk_func_noener       nbnxn_kernel_ElecCSTab_VdwCSTab_F_2xnn;
 
 #ifdef __cplusplus
 }
@@ -181,6 +181,27 @@
     gmx_simd_real_t  fscal_S0;
     gmx_simd_real_t  fscal_S2;
 
+#ifdef CALC_COUL_CSTAB
+    /* For cubic spline tables: trs=r*scale, teps=trs-floor(trs) */
+    gmx_simd_real_t  trs_S0, teps_S0;
+    gmx_simd_real_t  trs_S2, teps_S2;
+#ifdef CALC_COULOMB
+    /* Coulomb table potential and its derivative to teps */
+    gmx_simd_real_t  vctab_S0, fctab_S0;
+    gmx_simd_real_t  vctab_S2, fctab_S2;
+#ifdef EXCL_FORCES
+    /* Mask for pairs with tabulated Coulomb, minus 1/r for excluded pairs */
+    gmx_simd_bool_t  ctab_int_S0, ctab_int_S2;
+    gmx_simd_real_t  ctab_ex_S0, ctab_ex_S2;
+#endif
+#endif
+    /* Dispersion and repulsion table potentials and derivatives to teps */
+    gmx_simd_real_t  vdtab_S0, fdtab_S0, vrtab_S0, frtab_S0;
+#ifndef HALF_LJ
+    gmx_simd_real_t  vdtab_S2, fdtab_S2, vrtab_S2, frtab_S2;
+#endif
+#endif
+
 #ifdef CALC_LJ
 #ifdef LJ_COMB_LB
     /* LJ sigma_j/2 and sqrt(epsilon_j) */
@@ -208,7 +229,7 @@
 #endif
 
     /* Intermediate variables for LJ calculation */
-#ifndef LJ_COMB_LB
+#if !(defined LJ_COMB_LB || defined LJ_CSTAB)
     gmx_simd_real_t  rinvsix_S0;
 #ifndef HALF_LJ
     gmx_simd_real_t  rinvsix_S2;
@@ -227,10 +248,12 @@
 #endif
 #endif /* CALC_LJ */
 
+#ifndef MIXED_PRECISION
     gmx_mm_hpr fjx_S, fjy_S, fjz_S;
+#endif
 
     /* j-cluster index */
-    cj            = l_cj[cjind].cj;
+    cj            = cj_dec;
 
     /* Atom indices (of the first atom in the cluster) */
     aj            = cj*UNROLLJ;
@@ -242,7 +265,7 @@
     ajz           = ajy + STRIDE;
 
 #ifdef CHECK_EXCLS
-    gmx_load_simd_2xnn_interactions(l_cj[cjind].excl,
+    gmx_load_simd_2xnn_interactions(l_cjc_excl[excl_ind],
                                     filter_S0, filter_S2,
                                     &interact_S0, &interact_S2);
 #endif /* CHECK_EXCLS */
@@ -392,6 +415,33 @@
     rinvsq_S0   = gmx_simd_mul_r(rinv_S0, rinv_S0);
     rinvsq_S2   = gmx_simd_mul_r(rinv_S2, rinv_S2);
 
+#ifdef CALC_COUL_CSTAB
+    /* Convert r to scaled table units, this is 0 for masked pairs */
+    trs_S0      = gmx_simd_mul_r(gmx_simd_mul_r(rsq_S0, rinv_S0), tabcs_scale_S);
+    trs_S2      = gmx_simd_mul_r(gmx_simd_mul_r(rsq_S2, rinv_S2), tabcs_scale_S);
+    /* Gather the Coulomb, dispersion and repulsion spline coefficients
+     * per i-atom pair and interpolate them, the buffer is reused.
+     */
+    teps_S0     = load_table_cs(tab_cs, tabcs_stride, 12, trs_S0, tabcs_buf);
+#ifdef CALC_COULOMB
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S0, &vctab_S0, &fctab_S0);
+#endif
+    interpolate_table_cs(tabcs_buf + 4*GMX_SIMD_REAL_WIDTH, teps_S0, &vdtab_S0, &fdtab_S0);
+    interpolate_table_cs(tabcs_buf + 8*GMX_SIMD_REAL_WIDTH, teps_S0, &vrtab_S0, &frtab_S0);
+#ifdef HALF_LJ
+    /* Only Coulomb for the second i-atom pair */
+    teps_S2     = load_table_cs(tab_cs, tabcs_stride, 4, trs_S2, tabcs_buf);
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S2, &vctab_S2, &fctab_S2);
+#else
+    teps_S2     = load_table_cs(tab_cs, tabcs_stride, 12, trs_S2, tabcs_buf);
+#ifdef CALC_COULOMB
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S2, &vctab_S2, &fctab_S2);
+#endif
+    interpolate_table_cs(tabcs_buf + 4*GMX_SIMD_REAL_WIDTH, teps_S2, &vdtab_S2, &fdtab_S2);
+    interpolate_table_cs(tabcs_buf + 8*GMX_SIMD_REAL_WIDTH, teps_S2, &vrtab_S2, &frtab_S2);
+#endif
+#endif /* CALC_COUL_CSTAB */
+
 #ifdef CALC_COULOMB
     /* Note that here we calculate force*r, not the usual force/r.
      * This allows avoiding masking the reaction-field contribution,
@@ -492,6 +542,40 @@
 #endif
 #endif /* CALC_COUL_TAB */
 
+#ifdef CALC_COUL_CSTAB
+    /* Electrostatic interactions, frcoul = -qq*dV/dr*r */
+#ifdef EXCL_FORCES
+    /* The table contains 1/r plus a long-range correction, for excluded
+     * pairs we keep only the correction by subtracting 1/r.
+     * With user tables excluded pairs do not interact at all.
+     */
+    ctab_int_S0 = gmx_simd_or_b(interact_S0, tabcs_excl_B);
+    ctab_int_S2 = gmx_simd_or_b(interact_S2, tabcs_excl_B);
+    ctab_ex_S0  = gmx_simd_blendzero_r(gmx_simd_sub_r(rinv_ex_S0, rinv_S0), tabcs_excl_B);
+    ctab_ex_S2  = gmx_simd_blendzero_r(gmx_simd_sub_r(rinv_ex_S2, rinv_S2), tabcs_excl_B);
+    fctab_S0    = gmx_simd_blendzero_r(fctab_S0, ctab_int_S0);
+    fctab_S2    = gmx_simd_blendzero_r(fctab_S2, ctab_int_S2);
+    frcoul_S0   = gmx_simd_mul_r(qq_S0, gmx_simd_fnmadd_r(fctab_S0, trs_S0, ctab_ex_S0));
+    frcoul_S2   = gmx_simd_mul_r(qq_S2, gmx_simd_fnmadd_r(fctab_S2, trs_S2, ctab_ex_S2));
+#ifdef CALC_ENERGIES
+    /* Excluded pairs do not have the potential shift of the table */
+    vctab_S0    = gmx_simd_blendzero_r(vctab_S0, ctab_int_S0);
+    vctab_S2    = gmx_simd_blendzero_r(vctab_S2, ctab_int_S2);
+    ctab_ex_S0  = gmx_simd_add_r(ctab_ex_S0, gmx_simd_blendnotzero_r(tabcs_sh_excl_S, interact_S0));
+    ctab_ex_S2  = gmx_simd_add_r(ctab_ex_S2, gmx_simd_blendnotzero_r(tabcs_sh_excl_S, interact_S2));
+    vcoul_S0    = gmx_simd_mul_r(qq_S0, gmx_simd_add_r(vctab_S0, ctab_ex_S0));
+    vcoul_S2    = gmx_simd_mul_r(qq_S2, gmx_simd_add_r(vctab_S2, ctab_ex_S2));
+#endif
+#else  /* EXCL_FORCES */
+    frcoul_S0   = gmx_simd_fneg_r(gmx_simd_mul_r(qq_S0, gmx_simd_mul_r(fctab_S0, trs_S0)));
+    frcoul_S2   = gmx_simd_fneg_r(gmx_simd_mul_r(qq_S2, gmx_simd_mul_r(fctab_S2, trs_S2)));
+#ifdef CALC_ENERGIES
+    vcoul_S0    = gmx_simd_mul_r(qq_S0, vctab_S0);
+    vcoul_S2    = gmx_simd_mul_r(qq_S2, vctab_S2);
+#endif
+#endif /* EXCL_FORCES */
+#endif /* CALC_COUL_CSTAB */
+
 #if defined CALC_ENERGIES && (defined CALC_COUL_EWALD || defined CALC_COUL_TAB)
 #ifndef NO_SHIFT_EWALD
     /* Add Ewald potential shift to vc_sub for convenience */
@@ -531,6 +615,7 @@
 #endif
 
 #ifndef LJ_COMB_LB
+#ifndef LJ_CSTAB
     rinvsix_S0  = gmx_simd_mul_r(rinvsq_S0, gmx_simd_mul_r(rinvsq_S0, rinvsq_S0));
 #ifdef EXCL_FORCES
     rinvsix_S0  = gmx_simd_blendzero_r(rinvsix_S0, interact_S0);
@@ -541,6 +626,7 @@
     rinvsix_S2  = gmx_simd_blendzero_r(rinvsix_S2, interact_S2);
 #endif
 #endif
+#endif
 
 #if defined LJ_CUT || defined LJ_POT_SWITCH
     /* We have plain LJ or LJ-PME with simple C6/6 C12/12 coefficients */
@@ -638,6 +724,32 @@
 #endif
 #endif /* LJ_COMB_LB */
 
+#ifdef LJ_CSTAB
+    /* Tabulated dispersion and repulsion, FrLJ = -dV/dr*r */
+#ifdef EXCL_FORCES
+    fdtab_S0    = gmx_simd_blendzero_r(fdtab_S0, interact_S0);
+    frtab_S0    = gmx_simd_blendzero_r(frtab_S0, interact_S0);
+#ifndef HALF_LJ
+    fdtab_S2    = gmx_simd_blendzero_r(fdtab_S2, interact_S2);
+    frtab_S2    = gmx_simd_blendzero_r(frtab_S2, interact_S2);
+#endif
+#endif
+    FrLJ6_S0    = gmx_simd_mul_r(c6_S0, gmx_simd_mul_r(fdtab_S0, trs_S0));
+#ifndef HALF_LJ
+    FrLJ6_S2    = gmx_simd_mul_r(c6_S2, gmx_simd_mul_r(fdtab_S2, trs_S2));
+#endif
+    FrLJ12_S0   = gmx_simd_fneg_r(gmx_simd_mul_r(c12_S0, gmx_simd_mul_r(frtab_S0, trs_S0)));
+#ifndef HALF_LJ
+    FrLJ12_S2   = gmx_simd_fneg_r(gmx_simd_mul_r(c12_S2, gmx_simd_mul_r(frtab_S2, trs_S2)));
+#endif
+#ifdef CALC_ENERGIES
+    gmx_simd_real_t VLJ_S0      = gmx_simd_fmadd_r(c6_S0, vdtab_S0, gmx_simd_mul_r(c12_S0, vrtab_S0));
+#ifndef HALF_LJ
+    gmx_simd_real_t VLJ_S2      = gmx_simd_fmadd_r(c6_S2, vdtab_S2, gmx_simd_mul_r(c12_S2, vrtab_S2));
+#endif
+#endif
+#endif /* LJ_CSTAB */
+
     /* Determine the total scalar LJ force*r */
     frLJ_S0     = gmx_simd_sub_r(FrLJ12_S0, FrLJ6_S0);
 #ifndef HALF_LJ
@@ -917,12 +1029,18 @@
     fiz_S2      = gmx_simd_add_r(fiz_S2, tz_S2);
 
     /* Decrement j atom force */
+#ifdef MIXED_PRECISION
+    gmx_sub_hpr_from_double(f+ajx, gmx_sum4_hpr(tx_S0, tx_S2));
+    gmx_sub_hpr_from_double(f+ajy, gmx_sum4_hpr(ty_S0, ty_S2));
+    gmx_sub_hpr_from_double(f+ajz, gmx_sum4_hpr(tz_S0, tz_S2));
+#else
     gmx_load_hpr(&fjx_S, f+ajx);
     gmx_load_hpr(&fjy_S, f+ajy);
     gmx_load_hpr(&fjz_S, f+ajz);
     gmx_store_hpr(f+ajx, gmx_sub_hpr(fjx_S, gmx_sum4_hpr(tx_S0, tx_S2)));
     gmx_store_hpr(f+ajy, gmx_sub_hpr(fjy_S, gmx_sum4_hpr(ty_S0, ty_S2)));
     gmx_store_hpr(f+ajz, gmx_sub_hpr(fjz_S, gmx_sum4_hpr(tz_S0, tz_S2)));
+#endif
 }
 
 #undef  rinv_ex_S0
@@ -64,16 +64,24 @@
 
 
 {
+#ifdef MIXED_PRECISION
+    /* The single precision copies of the real valued atom data */
+    const nbnxn_atomdata_mixed_t *nbat_r = nbat->mixed;
+#else
+    const nbnxn_atomdata_t       *nbat_r = nbat;
+#endif
     const nbnxn_ci_t   *nbln;
-    const nbnxn_cj_t   *l_cj;
+    const nbnxn_cic_t  *nblc;
+    const unsigned short *l_cjc;
+    const unsigned int *l_cjc_excl;
     const real         *q;
-    const real         *shiftvec;
     const real         *x;
     real                facel;
     int                 n, ci, ci_sh;
     int                 ish, ish3;
     gmx_bool            do_LJ, half_LJ, do_coul;
-    int                 cjind0, cjind1, cjind;
+    int                 cjind0, cjind1;
+    int                 cjc_ind, cjc_ind1, excl_ind, cj_dec;
 
 #ifdef ENERGY_GROUPS
     int         Vstride_i;
@@ -138,6 +146,22 @@
     gmx_simd_real_t beta2_S, beta_S;
 #endif
 
+#ifdef CALC_COUL_CSTAB
+    /* Cubic spline table variables */
+    gmx_simd_real_t   tabcs_scale_S;
+    const real       *tab_cs;
+    int               tabcs_stride;
+    /* Thread-local working buffer for gathering the 12 table coefficients,
+     * with space for the table distances and alignment
+     */
+    real              tabcs_array[(12 + 2)*GMX_SIMD_REAL_WIDTH], *tabcs_buf;
+    /* Whether we compute the long-range correction for excluded pairs */
+    gmx_simd_bool_t   tabcs_excl_B;
+#ifdef CALC_ENERGIES
+    gmx_simd_real_t   tabcs_sh_excl_S;
+#endif
+#endif
+
 #if defined CALC_ENERGIES && (defined CALC_COUL_EWALD || defined CALC_COUL_TAB)
     gmx_simd_real_t  sh_ewald_S;
 #endif
@@ -194,16 +218,16 @@
 #endif
 
 #if defined LJ_COMB_GEOM || defined LJ_COMB_LB || defined LJ_EWALD_GEOM
-    ljc = nbat->lj_comb;
+    ljc = nbat_r->lj_comb;
 #endif
 #if !(defined LJ_COMB_GEOM || defined LJ_COMB_LB || defined FIX_LJ_C)
     /* No combination rule used */
-    real      *nbfp_ptr = (4 == nbfp_stride) ? nbat->nbfp_s4 : nbat->nbfp;
+    real      *nbfp_ptr = (4 == nbfp_stride) ? nbat_r->nbfp_s4 : nbat_r->nbfp;
     const int *type     = nbat->type;
 #endif
 
     /* Load j-i for the first i */
-    diagonal_jmi_S    = gmx_simd_load_r(nbat->simd_2xnn_diagonal_j_minus_i);
+    diagonal_jmi_S    = gmx_simd_load_r(nbat_r->simd_2xnn_diagonal_j_minus_i);
     /* Generate all the diagonal masks as comparison results */
 #if UNROLLI == UNROLLJ
     diagonal_mask_S0  = gmx_simd_cmplt_r(zero_S, diagonal_jmi_S);
@@ -275,12 +299,24 @@
     beta_S  = gmx_simd_set1_r(ic->ewaldcoeff_q);
 #endif
 
+#ifdef CALC_COUL_CSTAB
+    tabcs_scale_S   = gmx_simd_set1_r(ic->tabcs_scale);
+    tab_cs          = ic->tabcs_data;
+    tabcs_stride    = ic->tabcs_stride;
+    tabcs_buf       = gmx_simd_align_r(tabcs_array);
+    /* With user electrostatics excluded pairs do not interact */
+    tabcs_excl_B    = gmx_simd_cmplt_r(zero_S, gmx_simd_set1_r(ic->eeltype == eelUSER ? 0 : 1));
+#ifdef CALC_ENERGIES
+    tabcs_sh_excl_S = gmx_simd_set1_r(ic->tabcs_sh_excl);
+#endif
+#endif
+
 #if (defined CALC_COUL_TAB || defined CALC_COUL_EWALD) && defined CALC_ENERGIES
     sh_ewald_S = gmx_simd_set1_r(ic->sh_ewald);
 #endif
 
     /* LJ function constants */
-#if defined CALC_ENERGIES || defined LJ_POT_SWITCH
+#if (defined CALC_ENERGIES || defined LJ_POT_SWITCH) && !defined LJ_CSTAB
     gmx_simd_real_t sixth_S      = gmx_simd_set1_r(1.0/6.0);
     gmx_simd_real_t twelveth_S   = gmx_simd_set1_r(1.0/12.0);
 #endif
@@ -340,10 +376,9 @@
 
     avoid_sing_S = gmx_simd_set1_r(NBNXN_AVOID_SING_R2_INC);
 
-    q                   = nbat->q;
+    q                   = nbat_r->q;
     facel               = ic->epsfac;
-    shiftvec            = shift_vec[0];
-    x                   = nbat->x;
+    x                   = nbat_r->x;
 
 #ifdef FIX_LJ_C
     pvdw_c6  = gmx_simd_align_r(pvdw_array);
@@ -382,12 +417,14 @@
     Vstride_i    = nbat->nenergrp*(1<<nbat->neg_2log)*egps_jstride;
 #endif
 
-    l_cj = nbl->cj;
+    l_cjc      = nbl->cjc;
+    l_cjc_excl = nbl->cjc_excl;
 
     ninner = 0;
     for (n = 0; n < nbl->nci; n++)
     {
         nbln = &nbl->ci[n];
+        nblc = &nbl->cic[n];
 
         ish              = (nbln->shift & NBNXN_CI_SHIFT);
         ish3             = ish*3;
@@ -396,9 +433,9 @@
         ci               = nbln->ci;
         ci_sh            = (ish == CENTRAL ? ci : -1);
 
-        shX_S = gmx_simd_load1_r(shiftvec+ish3);
-        shY_S = gmx_simd_load1_r(shiftvec+ish3+1);
-        shZ_S = gmx_simd_load1_r(shiftvec+ish3+2);
+        shX_S = gmx_simd_set1_r(shift_vec[ish][XX]);
+        shY_S = gmx_simd_set1_r(shift_vec[ish][YY]);
+        shZ_S = gmx_simd_set1_r(shift_vec[ish][ZZ]);
 
 #if UNROLLJ <= 4
         int sci              = ci*STRIDE;
@@ -446,10 +483,10 @@
         gmx_bool do_self = do_coul;
 #endif
 #if UNROLLJ == 4
-        if (do_self && l_cj[nbln->cj_ind_start].cj == ci_sh)
+        if (do_self && nblc->cj0 == ci_sh)
 #endif
 #if UNROLLJ == 8
-        if (do_self && l_cj[nbln->cj_ind_start].cj == (ci_sh>>1))
+        if (do_self && nblc->cj0 == (ci_sh>>1))
 #endif
         {
             if (do_coul)
@@ -471,6 +508,21 @@
                 /* beta/sqrt(pi) */
                 Vc_sub_self = 0.5*ic->ewaldcoeff_q*M_2_SQRTPI;
 #endif
+#ifdef CALC_COUL_CSTAB
+                /* Half the exclusion correction at r=0 */
+                if (ic->eeltype == eelUSER)
+                {
+                    Vc_sub_self = 0;
+                }
+                else if (EEL_PME_EWALD(ic->eeltype))
+                {
+                    Vc_sub_self = 0.5*ic->ewaldcoeff_q*M_2_SQRTPI;
+                }
+                else
+                {
+                    Vc_sub_self = 0.5*ic->c_rf;
+                }
+#endif
 
                 for (ia = 0; ia < UNROLLI; ia++)
                 {
@@ -590,7 +642,10 @@
         fiz_S0           = gmx_simd_setzero_r();
         fiz_S2           = gmx_simd_setzero_r();
 
-        cjind = cjind0;
+        cjc_ind  = nblc->cjc_ind_start;
+        cjc_ind1 = nblc->cjc_ind_end;
+        excl_ind = nblc->excl_ind_start;
+        cj_dec   = nblc->cj0;
 
         /* Currently all kernels use (at least half) LJ */
 #define CALC_LJ
@@ -600,14 +655,16 @@
 #define CALC_COULOMB
 #define HALF_LJ
 #define CHECK_EXCLS
-            while (cjind < cjind1 && nbl->cj[cjind].excl != NBNXN_INTERACTION_MASK_ALL)
+            while (cjc_ind < cjc_ind1 && (l_cjc[cjc_ind] & NBNXN_CJC_EXCL))
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn_inner.h"
-                cjind++;
+                excl_ind++;
             }
 #undef CHECK_EXCLS
-            for (; (cjind < cjind1); cjind++)
+            while (cjc_ind < cjc_ind1)
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn_inner.h"
             }
 #undef HALF_LJ
@@ -618,14 +675,16 @@
             /* Coulomb: all i-atoms, LJ: all i-atoms */
 #define CALC_COULOMB
 #define CHECK_EXCLS
-            while (cjind < cjind1 && nbl->cj[cjind].excl != NBNXN_INTERACTION_MASK_ALL)
+            while (cjc_ind < cjc_ind1 && (l_cjc[cjc_ind] & NBNXN_CJC_EXCL))
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn_inner.h"
-                cjind++;
+                excl_ind++;
             }
 #undef CHECK_EXCLS
-            for (; (cjind < cjind1); cjind++)
+            while (cjc_ind < cjc_ind1)
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn_inner.h"
             }
 #undef CALC_COULOMB
@@ -634,14 +693,16 @@
         {
             /* Coulomb: none, LJ: all i-atoms */
 #define CHECK_EXCLS
-            while (cjind < cjind1 && nbl->cj[cjind].excl != NBNXN_INTERACTION_MASK_ALL)
+            while (cjc_ind < cjc_ind1 && (l_cjc[cjc_ind] & NBNXN_CJC_EXCL))
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn_inner.h"
-                cjind++;
+                excl_ind++;
             }
 #undef CHECK_EXCLS
-            for (; (cjind < cjind1); cjind++)
+            while (cjc_ind < cjc_ind1)
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn_inner.h"
             }
         }
@@ -650,13 +711,17 @@
 
         /* Add accumulated i-forces to the force array */
         fix_S = gmx_mm_transpose_sum4h_pr(fix_S0, fix_S2);
-        gmx_simd4_store_r(f+scix, gmx_simd4_add_r(fix_S, gmx_simd4_load_r(f+scix)));
-
         fiy_S = gmx_mm_transpose_sum4h_pr(fiy_S0, fiy_S2);
-        gmx_simd4_store_r(f+sciy, gmx_simd4_add_r(fiy_S, gmx_simd4_load_r(f+sciy)));
-
         fiz_S = gmx_mm_transpose_sum4h_pr(fiz_S0, fiz_S2);
+#ifdef MIXED_PRECISION
+        gmx_add_hpr_to_double(f+scix, fix_S);
+        gmx_add_hpr_to_double(f+sciy, fiy_S);
+        gmx_add_hpr_to_double(f+sciz, fiz_S);
+#else
+        gmx_simd4_store_r(f+scix, gmx_simd4_add_r(fix_S, gmx_simd4_load_r(f+scix)));
+        gmx_simd4_store_r(f+sciy, gmx_simd4_add_r(fiy_S, gmx_simd4_load_r(f+sciy)));
         gmx_simd4_store_r(f+sciz, gmx_simd4_add_r(fiz_S, gmx_simd4_load_r(f+sciz)));
+#endif
 
 #ifdef CALC_SHIFTFORCES
         fshift[ish3+0] += gmx_simd4_reduce_r(fix_S);
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2012,2013,2014,2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*
+ * Note: this file was generated by the Verlet kernel generator for
+ * kernel type 2xnn_mixed.
+ */
+
+/* The mixed-precision kernels are only compiled in double precision
+ * builds with GMX_NBNXN_SIMD_2XNN_MIXED, otherwise this file is empty.
+ */
+#include "gmxpre.h"
+
+#include "gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed.h"
+
+#define CALC_COUL_EWALD
+#define VDW_CUTOFF_CHECK /* Use twin-range cut-off */
+#define LJ_CUT
+#define LJ_COMB_LB
+#define CALC_ENERGIES
+
+#define GMX_SIMD_J_UNROLL_SIZE 2
+#include "gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed_common.h"
+
+#ifdef GMX_NBNXN_SIMD_2XNN_MIXED
+/* The kernel computes in float, the output buffers are double */
+#ifdef CALC_ENERGIES
+void
+nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn_mixed(const nbnxn_pairlist_t    gmx_unused *nbl,
+                                                     const nbnxn_atomdata_t    gmx_unused *nbat,
+                                                     const interaction_const_t gmx_unused *ic,
+                                                     rvec                      gmx_unused *shift_vec,
+                                                     double                    gmx_unused *f,
+                                                     double                    gmx_unused *fshift,
+                                                     double                    gmx_unused *Vvdw,
+                                                     double                    gmx_unused *Vc)
+#else /* CALC_ENERGIES */
+void
+nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn_mixed(const nbnxn_pairlist_t    gmx_unused *nbl,
+                                                     const nbnxn_atomdata_t    gmx_unused *nbat,
+                                                     const interaction_const_t gmx_unused *ic,
+                                                     rvec                      gmx_unused *shift_vec,
+                                                     double                    gmx_unused *f,
+                                                     double                    gmx_unused *fshift)
+#endif /* CALC_ENERGIES */
+#include "gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed_outer.h"
+
+#endif /* GMX_NBNXN_SIMD_2XNN_MIXED */
@@ -0,0 +1,309 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2012,2013,2014,2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*
+ * Note: this file was generated by the Verlet kernel generator for
+ * kernel type 2xnn_mixed.
+ */
+
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include "gromacs/legacyheaders/typedefs.h"
+#include "gromacs/mdlib/nb_verlet.h"
+#include "gromacs/mdlib/nbnxn_simd.h"
+#include "nbnxn_kernel_simd_2xnn_mixed.h"
+
+#ifdef GMX_NBNXN_SIMD_2XNN_MIXED
+
+/* The kernels compute in single precision, see
+ * nbnxn_kernel_simd_2xnn_mixed_common.h, but this dispatcher
+ * only deals with double precision data.
+ */
+#include "gromacs/legacyheaders/gmx_omp_nthreads.h"
+#include "gromacs/legacyheaders/types/force_flags.h"
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_common.h"
+#include "gromacs/utility/fatalerror.h"
+
+/*! \brief Kinds of electrostatic treatments in mixed-precision SIMD Verlet kernels
+ *
+ * Only the analytical Ewald exclusion correction is supported,
+ * as we do not keep single precision copies of the tables.
+ */
+enum {
+    coulktRF, coulktEWALD, coulktEWALD_TWIN, coulktNR
+};
+
+/*! \brief Kinds of Van der Waals treatments in SIMD Verlet kernels
+ */
+enum {
+    vdwktLJCUT_COMBGEOM, vdwktLJCUT_COMBLB, vdwktLJCUT_COMBNONE, vdwktLJFORCESWITCH, vdwktLJPOTSWITCH, vdwktLJEWALDCOMBGEOM, vdwktNR
+};
+
+/* Declare and define the kernel function pointer lookup tables.
+ * The minor index of the array goes over both the LJ combination rules,
+ * which is only supported by plain cut-off, and the LJ switch/PME functions.
+ */
+static p_nbk_func_noener p_nbk_noener[coulktNR][vdwktNR] =
+{
+    {
+        nbnxn_kernel_ElecRF_VdwLJCombGeom_F_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJCombLB_F_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJ_F_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJFSw_F_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJPSw_F_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJEwCombGeom_F_2xnn_mixed,
+    },
+    {
+        nbnxn_kernel_ElecEw_VdwLJCombGeom_F_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJCombLB_F_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJ_F_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJFSw_F_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJPSw_F_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJEwCombGeom_F_2xnn_mixed,
+    },
+    {
+        nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_F_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_F_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_2xnn_mixed,
+    },
+};
+
+static p_nbk_func_ener p_nbk_ener[coulktNR][vdwktNR] =
+{
+    {
+        nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJCombLB_VF_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJ_VF_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJFSw_VF_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJPSw_VF_2xnn_mixed,
+        nbnxn_kernel_ElecRF_VdwLJEwCombGeom_VF_2xnn_mixed,
+    },
+    {
+        nbnxn_kernel_ElecEw_VdwLJCombGeom_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJCombLB_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJ_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJFSw_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJPSw_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEw_VdwLJEwCombGeom_VF_2xnn_mixed,
+    },
+    {
+        nbnxn_kernel_ElecEwTwinCut_VdwLJCombGeom_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJCombLB_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_2xnn_mixed,
+        nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_2xnn_mixed,
+    },
+};
+
+#else /* GMX_NBNXN_SIMD_2XNN_MIXED */
+
+#include "gromacs/utility/fatalerror.h"
+
+#endif /* GMX_NBNXN_SIMD_2XNN_MIXED */
+
+void
+nbnxn_kernel_simd_2xnn_mixed(nbnxn_pairlist_set_t      gmx_unused *nbl_list,
+                             nbnxn_atomdata_t          gmx_unused *nbat,
+                             const interaction_const_t gmx_unused *ic,
+                             int                       gmx_unused  ewald_excl,
+                             rvec                      gmx_unused *shift_vec,
+                             int                       gmx_unused  force_flags,
+                             int                       gmx_unused  clearF,
+                             real                      gmx_unused *fshift,
+                             real                      gmx_unused *Vc,
+                             real                      gmx_unused *Vvdw)
+#ifdef GMX_NBNXN_SIMD_2XNN_MIXED
+{
+    int                nnbl;
+    int                coulkt, vdwkt = 0;
+    p_nbk_func_noener  nbk_noener;
+    p_nbk_func_ener    nbk_ener;
+    int                nb;
+    int                nthreads gmx_unused;
+
+    nnbl = nbl_list->nnbl;
+
+    /* use_nbnxn_mixed_precision() in forcerec.cpp only enables these
+     * kernels without energy groups and user tables.
+     */
+    if (nbat->mixed == NULL || nbat->nenergrp > 1 ||
+        ic->eeltype == eelUSER || ic->vdwtype == evdwUSER)
+    {
+        gmx_incons("Unsupported setup for the mixed-precision nbnxn SIMD kernels");
+    }
+
+    if (EEL_RF(ic->eeltype) || ic->eeltype == eelCUT)
+    {
+        coulkt = coulktRF;
+    }
+    else
+    {
+        if (ewald_excl == ewaldexclTable)
+        {
+            gmx_incons("The mixed-precision nbnxn SIMD kernels only support the analytical Ewald correction");
+        }
+        if (ic->rcoulomb == ic->rvdw)
+        {
+            coulkt = coulktEWALD;
+        }
+        else
+        {
+            coulkt = coulktEWALD_TWIN;
+        }
+    }
+
+    if (ic->vdwtype == evdwCUT)
+    {
+        switch (ic->vdw_modifier)
+        {
+            case eintmodNONE:
+            case eintmodPOTSHIFT:
+                switch (nbat->comb_rule)
+                {
+                    case ljcrGEOM: vdwkt = vdwktLJCUT_COMBGEOM; break;
+                    case ljcrLB:   vdwkt = vdwktLJCUT_COMBLB;   break;
+                    case ljcrNONE: vdwkt = vdwktLJCUT_COMBNONE; break;
+                    default:       gmx_incons("Unknown combination rule");
+                }
+                break;
+            case eintmodFORCESWITCH:
+                vdwkt = vdwktLJFORCESWITCH;
+                break;
+            case eintmodPOTSWITCH:
+                vdwkt = vdwktLJPOTSWITCH;
+                break;
+            default:
+                gmx_incons("Unsupported VdW interaction modifier");
+        }
+    }
+    else if (ic->vdwtype == evdwPME)
+    {
+        if (ic->ljpme_comb_rule == eljpmeLB)
+        {
+            gmx_incons("The nbnxn SIMD kernels don't suport LJ-PME with LB");
+        }
+        vdwkt = vdwktLJEWALDCOMBGEOM;
+    }
+    else
+    {
+        gmx_incons("Unsupported VdW interaction type");
+    }
+
+    nbk_noener  = p_nbk_noener[coulkt][vdwkt];
+    nbk_ener    = p_nbk_ener[coulkt][vdwkt];
+
+    nbnxn_kernel_steal_prepare(nbl_list, nbat);
+
+    nthreads = gmx_omp_nthreads_get(emntNonbonded);
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (nb = 0; nb < nnbl; nb++)
+    {
+        nbnxn_atomdata_output_t *out;
+        real                    *fshift_p;
+        nbnxn_chunk_iter_t       it;
+        const nbnxn_pairlist_t  *nbl_c;
+
+        out = &nbat->out[nb];
+
+        if (clearF == enbvClearFYes)
+        {
+            clear_f(nbat, nb, out->f);
+        }
+
+        if ((force_flags & GMX_FORCE_VIRIAL) && nnbl == 1)
+        {
+            fshift_p = fshift;
+        }
+        else
+        {
+            fshift_p = out->fshift;
+
+            if (clearF == enbvClearFYes)
+            {
+                clear_fshift(fshift_p);
+            }
+        }
+
+        /* The chunks we compute accumulate into our energy buffers */
+        if (force_flags & GMX_FORCE_ENERGY)
+        {
+            out->Vvdw[0] = 0;
+            out->Vc[0]   = 0;
+        }
+
+        /* The kernels accumulate into the double precision buffers */
+        nbnxn_kernel_chunk_iter_init(&it, nbl_list, nb);
+        while ((nbl_c = nbnxn_kernel_chunk_next(&it, nbl_list, nbat, out->f)) != NULL)
+        {
+            if (!(force_flags & GMX_FORCE_ENERGY))
+            {
+                /* Don't calculate energies */
+                nbk_noener(nbl_c, nbat,
+                           ic,
+                           shift_vec,
+                           out->f,
+                           fshift_p);
+            }
+            else
+            {
+                nbk_ener(nbl_c, nbat,
+                         ic,
+                         shift_vec,
+                         out->f,
+                         fshift_p,
+                         out->Vvdw,
+                         out->Vc);
+            }
+        }
+    }
+
+    nbnxn_kernel_steal_finish(nbl_list, nbat);
+
+    if (force_flags & GMX_FORCE_ENERGY)
+    {
+        reduce_energies_over_lists(nbat, nnbl, Vvdw, Vc);
+    }
+}
+#else
+{
+    gmx_incons("nbnxn_kernel_simd_2xnn_mixed called when such kernels "
+               " are not enabled.");
+}
+#endif
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015 by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/* Common setup for the mixed-precision 2xNN kernels.
+ *
+ * In double precision builds with 256-bit AVX these kernels run the
+ * 2xNN kernel loops in single precision: 8-wide float SIMD with a 4x4
+ * cluster setup, which is the setup of the double precision 4xN kernels.
+ * The pair lists and the atom data layout are thus the same, the kernels
+ * read the float copies in nbat->mixed and accumulate the forces, shift
+ * forces and energies into the double precision output buffers.
+ *
+ * The kernel loops and the AVX-256 utility functions are copies of the
+ * single precision ones with explicit float SIMD types, generated by
+ * make_verlet_simd_kernel_files.py.
+ */
+#include "config.h"
+
+#include "gromacs/legacyheaders/typedefs.h"
+#include "gromacs/mdlib/nbnxn_simd.h"
+
+#ifdef GMX_NBNXN_SIMD_2XNN_MIXED
+
+#include "gromacs/math/utilities.h"
+#include "gromacs/mdlib/nbnxn_consts.h"
+#include "gromacs/mdlib/nbnxn_pairlist.h"
+#include "gromacs/pbcutil/ishift.h"
+#include "gromacs/simd/simd.h"
+#include "gromacs/simd/simd_math.h"
+#include "gromacs/simd/vector_operations.h"
+
+#if !(GMX_SIMD_FLOAT_WIDTH == 8 && GMX_SIMD_DOUBLE_WIDTH == 4)
+#error "The mixed-precision kernels need 8-wide float and 4-wide double SIMD"
+#endif
+
+#ifndef GMX_SIMD_J_UNROLL_SIZE
+#error "Need to define GMX_SIMD_J_UNROLL_SIZE before including the 2xnn mixed kernel common header file"
+#endif
+
+#define UNROLLI    NBNXN_CPU_CLUSTER_I_SIZE
+#define UNROLLJ    (GMX_SIMD_FLOAT_WIDTH/GMX_SIMD_J_UNROLL_SIZE)
+
+/* The stride of all the atom data arrays is equal to half the SIMD width */
+#define STRIDE     UNROLLJ
+
+/* The float LJ parameters are read from nbat->mixed->nbfp_s4 */
+static const int nbfp_stride = 4;
+
+#include "gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed_utils.h"
+
+static gmx_inline void gmx_simdcall
+gmx_load_simd_2xnn_interactions(int                  excl,
+                                gmx_exclfilter       filter_S0,
+                                gmx_exclfilter       filter_S2,
+                                gmx_simd_fbool_t    *interact_S0,
+                                gmx_simd_fbool_t    *interact_S2)
+{
+    /* Load integer interaction mask */
+    gmx_exclfilter mask_pr_S = gmx_load1_exclfilter(excl);
+    *interact_S0  = gmx_checkbitmask_pb(mask_pr_S, filter_S0);
+    *interact_S2  = gmx_checkbitmask_pb(mask_pr_S, filter_S2);
+}
+
+/* We always calculate shift forces, because it's cheap anyhow */
+#define CALC_SHIFTFORCES
+
+/* Tells the 2xNN kernel loops to read nbat->mixed and to write double */
+#define MIXED_PRECISION
+
+/* Add the 4 floats in b to the 4 aligned doubles at a */
+static gmx_inline void gmx_simdcall
+gmx_add_hpr_to_double(double *a, gmx_mm_hpr b)
+{
+    _mm256_store_pd(a, _mm256_add_pd(_mm256_load_pd(a), _mm256_cvtps_pd(b)));
+}
+
+/* Subtract the 4 floats in b from the 4 aligned doubles at a */
+static gmx_inline void gmx_simdcall
+gmx_sub_hpr_from_double(double *a, gmx_mm_hpr b)
+{
+    _mm256_store_pd(a, _mm256_sub_pd(_mm256_load_pd(a), _mm256_cvtps_pd(b)));
+}
+
+#endif /* GMX_NBNXN_SIMD_2XNN_MIXED */
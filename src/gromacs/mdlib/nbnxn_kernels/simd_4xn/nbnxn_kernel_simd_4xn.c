@@ -259,7 +259,7 @@ reduce_group_energies(int ng, int ng_2log,
 
 void
 nbnxn_kernel_simd_4xn(nbnxn_pairlist_set_t      gmx_unused *nbl_list,
-                      const nbnxn_atomdata_t    gmx_unused *nbat,
+                      nbnxn_atomdata_t          gmx_unused *nbat,
                       const interaction_const_t gmx_unused *ic,
                       int                       gmx_unused  ewald_excl,
                       rvec                      gmx_unused *shift_vec,
@@ -271,87 +271,106 @@ nbnxn_kernel_simd_4xn(nbnxn_pairlist_set_t      gmx_unused *nbl_list,
 #ifdef GMX_NBNXN_SIMD_4XN
 {
     int                nnbl;
-    nbnxn_pairlist_t **nbl;
     int                coulkt, vdwkt = 0;
+    p_nbk_func_noener  nbk_noener;
+    p_nbk_func_ener    nbk_ener, nbk_energrp;
     int                nb;
     int                nthreads gmx_unused;
 
     nnbl = nbl_list->nnbl;
-    nbl  = nbl_list->nbl;
 
-    if (EEL_RF(ic->eeltype) || ic->eeltype == eelCUT)
+    if (ic->eeltype == eelUSER || ic->vdwtype == evdwUSER)
     {
-        coulkt = coulktRF;
+        /* With user tables all interactions use cubic spline tables */
+        nbk_noener  = nbnxn_kernel_ElecCSTab_VdwCSTab_F_4xn;
+        nbk_ener    = nbnxn_kernel_ElecCSTab_VdwCSTab_VF_4xn;
+        nbk_energrp = nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_4xn;
     }
     else
     {
-        if (ewald_excl == ewaldexclTable)
+        if (EEL_RF(ic->eeltype) || ic->eeltype == eelCUT)
         {
-            if (ic->rcoulomb == ic->rvdw)
-            {
-                coulkt = coulktTAB;
-            }
-            else
-            {
-                coulkt = coulktTAB_TWIN;
-            }
+            coulkt = coulktRF;
         }
         else
         {
-            if (ic->rcoulomb == ic->rvdw)
+            if (ewald_excl == ewaldexclTable)
             {
-                coulkt = coulktEWALD;
+                if (ic->rcoulomb == ic->rvdw)
+                {
+                    coulkt = coulktTAB;
+                }
+                else
+                {
+                    coulkt = coulktTAB_TWIN;
+                }
             }
             else
             {
-                coulkt = coulktEWALD_TWIN;
+                if (ic->rcoulomb == ic->rvdw)
+                {
+                    coulkt = coulktEWALD;
+                }
+                else
+                {
+                    coulkt = coulktEWALD_TWIN;
+                }
             }
         }
-    }
 
-    if (ic->vdwtype == evdwCUT)
-    {
-        switch (ic->vdw_modifier)
+        if (ic->vdwtype == evdwCUT)
         {
-            case eintmodNONE:
-            case eintmodPOTSHIFT:
-                switch (nbat->comb_rule)
-                {
-                    case ljcrGEOM: vdwkt = vdwktLJCUT_COMBGEOM; break;
-                    case ljcrLB:   vdwkt = vdwktLJCUT_COMBLB;   break;
-                    case ljcrNONE: vdwkt = vdwktLJCUT_COMBNONE; break;
-                    default:       gmx_incons("Unknown combination rule");
-                }
-                break;
-            case eintmodFORCESWITCH:
-                vdwkt = vdwktLJFORCESWITCH;
-                break;
-            case eintmodPOTSWITCH:
-                vdwkt = vdwktLJPOTSWITCH;
-                break;
-            default:
-                gmx_incons("Unsupported VdW interaction modifier");
+            switch (ic->vdw_modifier)
+            {
+                case eintmodNONE:
+                case eintmodPOTSHIFT:
+                    switch (nbat->comb_rule)
+                    {
+                        case ljcrGEOM: vdwkt = vdwktLJCUT_COMBGEOM; break;
+                        case ljcrLB:   vdwkt = vdwktLJCUT_COMBLB;   break;
+                        case ljcrNONE: vdwkt = vdwktLJCUT_COMBNONE; break;
+                        default:       gmx_incons("Unknown combination rule");
+                    }
+                    break;
+                case eintmodFORCESWITCH:
+                    vdwkt = vdwktLJFORCESWITCH;
+                    break;
+                case eintmodPOTSWITCH:
+                    vdwkt = vdwktLJPOTSWITCH;
+                    break;
+                default:
+                    gmx_incons("Unsupported VdW interaction modifier");
+            }
         }
-    }
-    else if (ic->vdwtype == evdwPME)
-    {
-        if (ic->ljpme_comb_rule == eljpmeLB)
+        else if (ic->vdwtype == evdwPME)
         {
-            gmx_incons("The nbnxn SIMD kernels don't suport LJ-PME with LB");
+            if (ic->ljpme_comb_rule == eljpmeLB)
+            {
+                gmx_incons("The nbnxn SIMD kernels don't suport LJ-PME with LB");
+            }
+            vdwkt = vdwktLJEWALDCOMBGEOM;
         }
-        vdwkt = vdwktLJEWALDCOMBGEOM;
-    }
-    else
-    {
-        gmx_incons("Unsupported VdW interaction type");
+        else
+        {
+            gmx_incons("Unsupported VdW interaction type");
+        }
+
+        nbk_noener  = p_nbk_noener[coulkt][vdwkt];
+        nbk_ener    = p_nbk_ener[coulkt][vdwkt];
+        nbk_energrp = p_nbk_energrp[coulkt][vdwkt];
     }
 
+    nbnxn_kernel_steal_prepare(nbl_list, nbat);
+
     nthreads = gmx_omp_nthreads_get(emntNonbonded);
 #pragma omp parallel for schedule(static) num_threads(nthreads)
     for (nb = 0; nb < nnbl; nb++)
     {
         nbnxn_atomdata_output_t *out;
         real                    *fshift_p;
+        nbnxn_chunk_iter_t       it;
+        const nbnxn_pairlist_t  *nbl_c;
+        int                      i;
 
         out = &nbat->out[nb];
 
@@ -374,57 +393,73 @@ nbnxn_kernel_simd_4xn(nbnxn_pairlist_set_t      gmx_unused *nbl_list,
             }
         }
 
-        if (!(force_flags & GMX_FORCE_ENERGY))
-        {
-            /* Don't calculate energies */
-            p_nbk_noener[coulkt][vdwkt](nbl[nb], nbat,
-                                        ic,
-                                        shift_vec,
-                                        out->f,
-                                        fshift_p);
-        }
-        else if (out->nV == 1)
+        /* The chunks we compute accumulate into our energy buffers */
+        if (force_flags & GMX_FORCE_ENERGY)
         {
-            /* No energy groups */
-            out->Vvdw[0] = 0;
-            out->Vc[0]   = 0;
-
-            p_nbk_ener[coulkt][vdwkt](nbl[nb], nbat,
-                                      ic,
-                                      shift_vec,
-                                      out->f,
-                                      fshift_p,
-                                      out->Vvdw,
-                                      out->Vc);
+            if (out->nV == 1)
+            {
+                out->Vvdw[0] = 0;
+                out->Vc[0]   = 0;
+            }
+            else
+            {
+                for (i = 0; i < out->nVS; i++)
+                {
+                    out->VSvdw[i] = 0;
+                }
+                for (i = 0; i < out->nVS; i++)
+                {
+                    out->VSc[i] = 0;
+                }
+            }
         }
-        else
-        {
-            /* Calculate energy group contributions */
-            int i;
 
-            for (i = 0; i < out->nVS; i++)
+        nbnxn_kernel_chunk_iter_init(&it, nbl_list, nb);
+        while ((nbl_c = nbnxn_kernel_chunk_next(&it, nbl_list, nbat, out->f)) != NULL)
+        {
+            if (!(force_flags & GMX_FORCE_ENERGY))
             {
-                out->VSvdw[i] = 0;
+                /* Don't calculate energies */
+                nbk_noener(nbl_c, nbat,
+                           ic,
+                           shift_vec,
+                           out->f,
+                           fshift_p);
             }
-            for (i = 0; i < out->nVS; i++)
+            else if (out->nV == 1)
             {
-                out->VSc[i] = 0;
+                /* No energy groups */
+                nbk_ener(nbl_c, nbat,
+                         ic,
+                         shift_vec,
+                         out->f,
+                         fshift_p,
+                         out->Vvdw,
+                         out->Vc);
             }
+            else
+            {
+                /* Calculate energy group contributions */
+                nbk_energrp(nbl_c, nbat,
+                            ic,
+                            shift_vec,
+                            out->f,
+                            fshift_p,
+                            out->VSvdw,
+                            out->VSc);
+            }
+        }
 
-            p_nbk_energrp[coulkt][vdwkt](nbl[nb], nbat,
-                                         ic,
-                                         shift_vec,
-                                         out->f,
-                                         fshift_p,
-                                         out->VSvdw,
-                                         out->VSc);
-
+        if ((force_flags & GMX_FORCE_ENERGY) && out->nV > 1)
+        {
             reduce_group_energies(nbat->nenergrp, nbat->neg_2log,
                                   out->VSvdw, out->VSc,
                                   out->Vvdw, out->Vc);
         }
     }
 
+    nbnxn_kernel_steal_finish(nbl_list, nbat);
+
     if (force_flags & GMX_FORCE_ENERGY)
     {
         reduce_energies_over_lists(nbat, nnbl, Vvdw, Vc);
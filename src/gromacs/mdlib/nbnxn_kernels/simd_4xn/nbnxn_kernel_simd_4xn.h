@@ -48,9 +48,9 @@ extern "C" {
 #endif
 
 /*! \brief Run-time dispatcher for nbnxn kernel functions. */
-void
+gmx_offload void
 nbnxn_kernel_simd_4xn(nbnxn_pairlist_set_t       *nbl_list,
-                      const nbnxn_atomdata_t     *nbat,
+                      nbnxn_atomdata_t           *nbat,
                       const interaction_const_t  *ic,
                       int                         ewald_excl,
                       rvec                       *shift_vec,
@@ -65,22 +65,22 @@ nbnxn_kernel_simd_4xn(nbnxn_pairlist_set_t       *nbl_list,
 #ifndef _nbnxn_kernel_simd_include_h
 #define _nbnxn_kernel_simd_include_h
 /*! \brief Typedefs for declaring kernel functions. */
-typedef void (nbk_func_ener)(const nbnxn_pairlist_t     *nbl,
-                             const nbnxn_atomdata_t     *nbat,
-                             const interaction_const_t  *ic,
-                             rvec                       *shift_vec,
-                             real                       *f,
-                             real                       *fshift,
-                             real                       *Vvdw,
-                             real                       *Vc);
+typedef gmx_offload void (nbk_func_ener)(const nbnxn_pairlist_t     *nbl,
+                                         const nbnxn_atomdata_t     *nbat,
+                                         const interaction_const_t  *ic,
+                                         rvec                       *shift_vec,
+                                         real                       *f,
+                                         real                       *fshift,
+                                         real                       *Vvdw,
+                                         real                       *Vc);
 typedef nbk_func_ener *p_nbk_func_ener;
 
-typedef void (nbk_func_noener)(const nbnxn_pairlist_t     *nbl,
-                               const nbnxn_atomdata_t     *nbat,
-                               const interaction_const_t  *ic,
-                               rvec                       *shift_vec,
-                               real                       *f,
-                               real                       *fshift);
+typedef gmx_offload void (nbk_func_noener)(const nbnxn_pairlist_t     *nbl,
+                                           const nbnxn_atomdata_t     *nbat,
+                                           const interaction_const_t  *ic,
+                                           rvec                       *shift_vec,
+                                           real                       *f,
+                                           real                       *fshift);
 typedef nbk_func_noener *p_nbk_func_noener;
 #endif
 
@@ -114,6 +114,7 @@ nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJ_VgrpF_4xn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VgrpF_4xn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VgrpF_4xn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VgrpF_4xn;
+nbk_func_ener         nbnxn_kernel_ElecCSTab_VdwCSTab_VgrpF_4xn;
 
 nbk_func_ener         nbnxn_kernel_ElecRF_VdwLJCombGeom_VF_4xn;
 nbk_func_ener         nbnxn_kernel_ElecRF_VdwLJCombLB_VF_4xn;
@@ -145,6 +146,7 @@ nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJ_VF_4xn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_VF_4xn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_VF_4xn;
 nbk_func_ener         nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_VF_4xn;
+nbk_func_ener         nbnxn_kernel_ElecCSTab_VdwCSTab_VF_4xn;
 
 nbk_func_noener       nbnxn_kernel_ElecRF_VdwLJCombGeom_F_4xn;
 nbk_func_noener       nbnxn_kernel_ElecRF_VdwLJCombLB_F_4xn;
@@ -176,6 +178,7 @@ nbk_func_noener       nbnxn_kernel_ElecEwTwinCut_VdwLJ_F_4xn;
 nbk_func_noener       nbnxn_kernel_ElecEwTwinCut_VdwLJFSw_F_4xn;
 nbk_func_noener       nbnxn_kernel_ElecEwTwinCut_VdwLJPSw_F_4xn;
 nbk_func_noener       nbnxn_kernel_ElecEwTwinCut_VdwLJEwCombGeom_F_4xn;
+nbk_func_noener       nbnxn_kernel_ElecCSTab_VdwCSTab_F_4xn;
 
 
 
@@ -71,7 +71,7 @@ gmx_load_simd_4xn_interactions(int                        excl,
                                gmx_simd_bool_t           *interact_S2,
                                gmx_simd_bool_t           *interact_S3)
 {
-#if defined GMX_SIMD_X86_SSE2_OR_HIGHER || defined GMX_SIMD_REFERENCE
+#if defined GMX_SIMD_X86_SSE2_OR_HIGHER || defined GMX_SIMD_X86_AVX_512F || defined GMX_SIMD_X86_AVX_512ER || defined GMX_SIMD_REFERENCE
     /* Load integer interaction mask */
     gmx_exclfilter mask_pr_S = gmx_load1_exclfilter(excl);
     *interact_S0  = gmx_checkbitmask_pb(mask_pr_S, filter_S0);
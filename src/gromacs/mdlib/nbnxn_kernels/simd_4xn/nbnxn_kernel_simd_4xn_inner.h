@@ -203,6 +203,33 @@
     gmx_simd_real_t  fscal_S2;
     gmx_simd_real_t  fscal_S3;
 
+#ifdef CALC_COUL_CSTAB
+    /* For cubic spline tables: trs=r*scale, teps=trs-floor(trs) */
+    gmx_simd_real_t  trs_S0, teps_S0;
+    gmx_simd_real_t  trs_S1, teps_S1;
+    gmx_simd_real_t  trs_S2, teps_S2;
+    gmx_simd_real_t  trs_S3, teps_S3;
+#ifdef CALC_COULOMB
+    /* Coulomb table potential and its derivative to teps */
+    gmx_simd_real_t  vctab_S0, fctab_S0;
+    gmx_simd_real_t  vctab_S1, fctab_S1;
+    gmx_simd_real_t  vctab_S2, fctab_S2;
+    gmx_simd_real_t  vctab_S3, fctab_S3;
+#ifdef EXCL_FORCES
+    /* Mask for pairs with tabulated Coulomb, minus 1/r for excluded pairs */
+    gmx_simd_bool_t  ctab_int_S0, ctab_int_S1, ctab_int_S2, ctab_int_S3;
+    gmx_simd_real_t  ctab_ex_S0, ctab_ex_S1, ctab_ex_S2, ctab_ex_S3;
+#endif
+#endif
+    /* Dispersion and repulsion table potentials and derivatives to teps */
+    gmx_simd_real_t  vdtab_S0, fdtab_S0, vrtab_S0, frtab_S0;
+    gmx_simd_real_t  vdtab_S1, fdtab_S1, vrtab_S1, frtab_S1;
+#ifndef HALF_LJ
+    gmx_simd_real_t  vdtab_S2, fdtab_S2, vrtab_S2, frtab_S2;
+    gmx_simd_real_t  vdtab_S3, fdtab_S3, vrtab_S3, frtab_S3;
+#endif
+#endif
+
 #ifdef CALC_LJ
 #ifdef LJ_COMB_LB
     /* LJ sigma_j/2 and sqrt(epsilon_j) */
@@ -244,7 +271,7 @@
 #endif
 
     /* Intermediate variables for LJ calculation */
-#ifndef LJ_COMB_LB
+#if !(defined LJ_COMB_LB || defined LJ_CSTAB)
     gmx_simd_real_t  rinvsix_S0;
     gmx_simd_real_t  rinvsix_S1;
 #ifndef HALF_LJ
@@ -278,7 +305,7 @@
 #endif /* CALC_LJ */
 
     /* j-cluster index */
-    cj            = l_cj[cjind].cj;
+    cj            = cj_dec;
 
     /* Atom indices (of the first atom in the cluster) */
     aj            = cj*UNROLLJ;
@@ -298,7 +325,7 @@
     ajz           = ajy + STRIDE;
 
 #ifdef CHECK_EXCLS
-    gmx_load_simd_4xn_interactions(l_cj[cjind].excl,
+    gmx_load_simd_4xn_interactions(l_cjc_excl[excl_ind],
                                    filter_S0, filter_S1,
                                    filter_S2, filter_S3,
                                    nbat->simd_interaction_array,
@@ -502,6 +529,49 @@
     rinvsq_S2   = gmx_simd_mul_r(rinv_S2, rinv_S2);
     rinvsq_S3   = gmx_simd_mul_r(rinv_S3, rinv_S3);
 
+#ifdef CALC_COUL_CSTAB
+    /* Convert r to scaled table units, this is 0 for masked pairs */
+    trs_S0      = gmx_simd_mul_r(gmx_simd_mul_r(rsq_S0, rinv_S0), tabcs_scale_S);
+    trs_S1      = gmx_simd_mul_r(gmx_simd_mul_r(rsq_S1, rinv_S1), tabcs_scale_S);
+    trs_S2      = gmx_simd_mul_r(gmx_simd_mul_r(rsq_S2, rinv_S2), tabcs_scale_S);
+    trs_S3      = gmx_simd_mul_r(gmx_simd_mul_r(rsq_S3, rinv_S3), tabcs_scale_S);
+    /* Gather the Coulomb, dispersion and repulsion spline coefficients
+     * per i-atom and interpolate them, the buffer is reused.
+     */
+    teps_S0     = load_table_cs(tab_cs, tabcs_stride, 12, trs_S0, tabcs_buf);
+#ifdef CALC_COULOMB
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S0, &vctab_S0, &fctab_S0);
+#endif
+    interpolate_table_cs(tabcs_buf + 4*GMX_SIMD_REAL_WIDTH, teps_S0, &vdtab_S0, &fdtab_S0);
+    interpolate_table_cs(tabcs_buf + 8*GMX_SIMD_REAL_WIDTH, teps_S0, &vrtab_S0, &frtab_S0);
+    teps_S1     = load_table_cs(tab_cs, tabcs_stride, 12, trs_S1, tabcs_buf);
+#ifdef CALC_COULOMB
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S1, &vctab_S1, &fctab_S1);
+#endif
+    interpolate_table_cs(tabcs_buf + 4*GMX_SIMD_REAL_WIDTH, teps_S1, &vdtab_S1, &fdtab_S1);
+    interpolate_table_cs(tabcs_buf + 8*GMX_SIMD_REAL_WIDTH, teps_S1, &vrtab_S1, &frtab_S1);
+#ifdef HALF_LJ
+    /* Only Coulomb for the second half of the i-atoms */
+    teps_S2     = load_table_cs(tab_cs, tabcs_stride, 4, trs_S2, tabcs_buf);
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S2, &vctab_S2, &fctab_S2);
+    teps_S3     = load_table_cs(tab_cs, tabcs_stride, 4, trs_S3, tabcs_buf);
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S3, &vctab_S3, &fctab_S3);
+#else
+    teps_S2     = load_table_cs(tab_cs, tabcs_stride, 12, trs_S2, tabcs_buf);
+#ifdef CALC_COULOMB
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S2, &vctab_S2, &fctab_S2);
+#endif
+    interpolate_table_cs(tabcs_buf + 4*GMX_SIMD_REAL_WIDTH, teps_S2, &vdtab_S2, &fdtab_S2);
+    interpolate_table_cs(tabcs_buf + 8*GMX_SIMD_REAL_WIDTH, teps_S2, &vrtab_S2, &frtab_S2);
+    teps_S3     = load_table_cs(tab_cs, tabcs_stride, 12, trs_S3, tabcs_buf);
+#ifdef CALC_COULOMB
+    interpolate_table_cs(tabcs_buf + 0*GMX_SIMD_REAL_WIDTH, teps_S3, &vctab_S3, &fctab_S3);
+#endif
+    interpolate_table_cs(tabcs_buf + 4*GMX_SIMD_REAL_WIDTH, teps_S3, &vdtab_S3, &fdtab_S3);
+    interpolate_table_cs(tabcs_buf + 8*GMX_SIMD_REAL_WIDTH, teps_S3, &vrtab_S3, &frtab_S3);
+#endif
+#endif /* CALC_COUL_CSTAB */
+
 #ifdef CALC_COULOMB
     /* Note that here we calculate force*r, not the usual force/r.
      * This allows avoiding masking the reaction-field contribution,
@@ -645,6 +715,58 @@
 #endif
 #endif /* CALC_COUL_TAB */
 
+#ifdef CALC_COUL_CSTAB
+    /* Electrostatic interactions, frcoul = -qq*dV/dr*r */
+#ifdef EXCL_FORCES
+    /* The table contains 1/r plus a long-range correction, for excluded
+     * pairs we keep only the correction by subtracting 1/r.
+     * With user tables excluded pairs do not interact at all.
+     */
+    ctab_int_S0 = gmx_simd_or_b(interact_S0, tabcs_excl_B);
+    ctab_int_S1 = gmx_simd_or_b(interact_S1, tabcs_excl_B);
+    ctab_int_S2 = gmx_simd_or_b(interact_S2, tabcs_excl_B);
+    ctab_int_S3 = gmx_simd_or_b(interact_S3, tabcs_excl_B);
+    ctab_ex_S0  = gmx_simd_blendzero_r(gmx_simd_sub_r(rinv_ex_S0, rinv_S0), tabcs_excl_B);
+    ctab_ex_S1  = gmx_simd_blendzero_r(gmx_simd_sub_r(rinv_ex_S1, rinv_S1), tabcs_excl_B);
+    ctab_ex_S2  = gmx_simd_blendzero_r(gmx_simd_sub_r(rinv_ex_S2, rinv_S2), tabcs_excl_B);
+    ctab_ex_S3  = gmx_simd_blendzero_r(gmx_simd_sub_r(rinv_ex_S3, rinv_S3), tabcs_excl_B);
+    fctab_S0    = gmx_simd_blendzero_r(fctab_S0, ctab_int_S0);
+    fctab_S1    = gmx_simd_blendzero_r(fctab_S1, ctab_int_S1);
+    fctab_S2    = gmx_simd_blendzero_r(fctab_S2, ctab_int_S2);
+    fctab_S3    = gmx_simd_blendzero_r(fctab_S3, ctab_int_S3);
+    frcoul_S0   = gmx_simd_mul_r(qq_S0, gmx_simd_fnmadd_r(fctab_S0, trs_S0, ctab_ex_S0));
+    frcoul_S1   = gmx_simd_mul_r(qq_S1, gmx_simd_fnmadd_r(fctab_S1, trs_S1, ctab_ex_S1));
+    frcoul_S2   = gmx_simd_mul_r(qq_S2, gmx_simd_fnmadd_r(fctab_S2, trs_S2, ctab_ex_S2));
+    frcoul_S3   = gmx_simd_mul_r(qq_S3, gmx_simd_fnmadd_r(fctab_S3, trs_S3, ctab_ex_S3));
+#ifdef CALC_ENERGIES
+    /* Excluded pairs do not have the potential shift of the table */
+    vctab_S0    = gmx_simd_blendzero_r(vctab_S0, ctab_int_S0);
+    vctab_S1    = gmx_simd_blendzero_r(vctab_S1, ctab_int_S1);
+    vctab_S2    = gmx_simd_blendzero_r(vctab_S2, ctab_int_S2);
+    vctab_S3    = gmx_simd_blendzero_r(vctab_S3, ctab_int_S3);
+    ctab_ex_S0  = gmx_simd_add_r(ctab_ex_S0, gmx_simd_blendnotzero_r(tabcs_sh_excl_S, interact_S0));
+    ctab_ex_S1  = gmx_simd_add_r(ctab_ex_S1, gmx_simd_blendnotzero_r(tabcs_sh_excl_S, interact_S1));
+    ctab_ex_S2  = gmx_simd_add_r(ctab_ex_S2, gmx_simd_blendnotzero_r(tabcs_sh_excl_S, interact_S2));
+    ctab_ex_S3  = gmx_simd_add_r(ctab_ex_S3, gmx_simd_blendnotzero_r(tabcs_sh_excl_S, interact_S3));
+    vcoul_S0    = gmx_simd_mul_r(qq_S0, gmx_simd_add_r(vctab_S0, ctab_ex_S0));
+    vcoul_S1    = gmx_simd_mul_r(qq_S1, gmx_simd_add_r(vctab_S1, ctab_ex_S1));
+    vcoul_S2    = gmx_simd_mul_r(qq_S2, gmx_simd_add_r(vctab_S2, ctab_ex_S2));
+    vcoul_S3    = gmx_simd_mul_r(qq_S3, gmx_simd_add_r(vctab_S3, ctab_ex_S3));
+#endif
+#else  /* EXCL_FORCES */
+    frcoul_S0   = gmx_simd_fneg_r(gmx_simd_mul_r(qq_S0, gmx_simd_mul_r(fctab_S0, trs_S0)));
+    frcoul_S1   = gmx_simd_fneg_r(gmx_simd_mul_r(qq_S1, gmx_simd_mul_r(fctab_S1, trs_S1)));
+    frcoul_S2   = gmx_simd_fneg_r(gmx_simd_mul_r(qq_S2, gmx_simd_mul_r(fctab_S2, trs_S2)));
+    frcoul_S3   = gmx_simd_fneg_r(gmx_simd_mul_r(qq_S3, gmx_simd_mul_r(fctab_S3, trs_S3)));
+#ifdef CALC_ENERGIES
+    vcoul_S0    = gmx_simd_mul_r(qq_S0, vctab_S0);
+    vcoul_S1    = gmx_simd_mul_r(qq_S1, vctab_S1);
+    vcoul_S2    = gmx_simd_mul_r(qq_S2, vctab_S2);
+    vcoul_S3    = gmx_simd_mul_r(qq_S3, vctab_S3);
+#endif
+#endif /* EXCL_FORCES */
+#endif /* CALC_COUL_CSTAB */
+
 #if defined CALC_ENERGIES && (defined CALC_COUL_EWALD || defined CALC_COUL_TAB)
 #ifndef NO_SHIFT_EWALD
     /* Add Ewald potential shift to vc_sub for convenience */
@@ -697,6 +819,7 @@
 #endif
 
 #ifndef LJ_COMB_LB
+#ifndef LJ_CSTAB
     rinvsix_S0  = gmx_simd_mul_r(rinvsq_S0, gmx_simd_mul_r(rinvsq_S0, rinvsq_S0));
     rinvsix_S1  = gmx_simd_mul_r(rinvsq_S1, gmx_simd_mul_r(rinvsq_S1, rinvsq_S1));
 #ifdef EXCL_FORCES
@@ -711,6 +834,7 @@
     rinvsix_S3  = gmx_simd_blendzero_r(rinvsix_S3, interact_S3);
 #endif
 #endif
+#endif
 
 #if defined LJ_CUT || defined LJ_POT_SWITCH
     /* We have plain LJ or LJ-PME with simple C6/6 C12/12 coefficients */
@@ -847,6 +971,42 @@
 #endif
 #endif /* LJ_COMB_LB */
 
+#ifdef LJ_CSTAB
+    /* Tabulated dispersion and repulsion, FrLJ = -dV/dr*r */
+#ifdef EXCL_FORCES
+    fdtab_S0    = gmx_simd_blendzero_r(fdtab_S0, interact_S0);
+    frtab_S0    = gmx_simd_blendzero_r(frtab_S0, interact_S0);
+    fdtab_S1    = gmx_simd_blendzero_r(fdtab_S1, interact_S1);
+    frtab_S1    = gmx_simd_blendzero_r(frtab_S1, interact_S1);
+#ifndef HALF_LJ
+    fdtab_S2    = gmx_simd_blendzero_r(fdtab_S2, interact_S2);
+    frtab_S2    = gmx_simd_blendzero_r(frtab_S2, interact_S2);
+    fdtab_S3    = gmx_simd_blendzero_r(fdtab_S3, interact_S3);
+    frtab_S3    = gmx_simd_blendzero_r(frtab_S3, interact_S3);
+#endif
+#endif
+    FrLJ6_S0    = gmx_simd_mul_r(c6_S0, gmx_simd_mul_r(fdtab_S0, trs_S0));
+    FrLJ6_S1    = gmx_simd_mul_r(c6_S1, gmx_simd_mul_r(fdtab_S1, trs_S1));
+#ifndef HALF_LJ
+    FrLJ6_S2    = gmx_simd_mul_r(c6_S2, gmx_simd_mul_r(fdtab_S2, trs_S2));
+    FrLJ6_S3    = gmx_simd_mul_r(c6_S3, gmx_simd_mul_r(fdtab_S3, trs_S3));
+#endif
+    FrLJ12_S0   = gmx_simd_fneg_r(gmx_simd_mul_r(c12_S0, gmx_simd_mul_r(frtab_S0, trs_S0)));
+    FrLJ12_S1   = gmx_simd_fneg_r(gmx_simd_mul_r(c12_S1, gmx_simd_mul_r(frtab_S1, trs_S1)));
+#ifndef HALF_LJ
+    FrLJ12_S2   = gmx_simd_fneg_r(gmx_simd_mul_r(c12_S2, gmx_simd_mul_r(frtab_S2, trs_S2)));
+    FrLJ12_S3   = gmx_simd_fneg_r(gmx_simd_mul_r(c12_S3, gmx_simd_mul_r(frtab_S3, trs_S3)));
+#endif
+#ifdef CALC_ENERGIES
+    VLJ_S0      = gmx_simd_fmadd_r(c6_S0, vdtab_S0, gmx_simd_mul_r(c12_S0, vrtab_S0));
+    VLJ_S1      = gmx_simd_fmadd_r(c6_S1, vdtab_S1, gmx_simd_mul_r(c12_S1, vrtab_S1));
+#ifndef HALF_LJ
+    VLJ_S2      = gmx_simd_fmadd_r(c6_S2, vdtab_S2, gmx_simd_mul_r(c12_S2, vrtab_S2));
+    VLJ_S3      = gmx_simd_fmadd_r(c6_S3, vdtab_S3, gmx_simd_mul_r(c12_S3, vrtab_S3));
+#endif
+#endif
+#endif /* LJ_CSTAB */
+
     /* Determine the total scalar LJ force*r */
     frLJ_S0     = gmx_simd_sub_r(FrLJ12_S0, FrLJ6_S0);
     frLJ_S1     = gmx_simd_sub_r(FrLJ12_S1, FrLJ6_S1);
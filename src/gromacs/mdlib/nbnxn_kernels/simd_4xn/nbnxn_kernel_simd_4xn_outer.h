@@ -36,7 +36,9 @@
 
 {
     const nbnxn_ci_t   *nbln;
-    const nbnxn_cj_t   *l_cj;
+    const nbnxn_cic_t  *nblc;
+    const unsigned short *l_cjc;
+    const unsigned int *l_cjc_excl;
     const int *         type;
     const real *        q;
     const real         *shiftvec;
@@ -48,7 +50,8 @@
     int                 ish, ish3;
     gmx_bool            do_LJ, half_LJ, do_coul, do_self;
     int                 sci, scix, sciy, sciz, sci2;
-    int                 cjind0, cjind1, cjind;
+    int                 cjind0, cjind1;
+    int                 cjc_ind, cjc_ind1, excl_ind, cj_dec;
     int                 ip, jp;
 
 #ifdef ENERGY_GROUPS
@@ -127,6 +130,22 @@
     gmx_simd_real_t beta2_S, beta_S;
 #endif
 
+#ifdef CALC_COUL_CSTAB
+    /* Cubic spline table variables */
+    gmx_simd_real_t   tabcs_scale_S;
+    const real       *tab_cs;
+    int               tabcs_stride;
+    /* Thread-local working buffer for gathering the 12 table coefficients,
+     * with space for the table distances and alignment
+     */
+    real              tabcs_array[(12 + 2)*GMX_SIMD_REAL_WIDTH], *tabcs_buf;
+    /* Whether we compute the long-range correction for excluded pairs */
+    gmx_simd_bool_t   tabcs_excl_B;
+#ifdef CALC_ENERGIES
+    gmx_simd_real_t   tabcs_sh_excl_S;
+#endif
+#endif
+
 #if defined CALC_ENERGIES && (defined CALC_COUL_EWALD || defined CALC_COUL_TAB)
     gmx_simd_real_t  sh_ewald_S;
 #endif
@@ -297,6 +316,18 @@
     beta_S  = gmx_simd_set1_r(ic->ewaldcoeff_q);
 #endif
 
+#ifdef CALC_COUL_CSTAB
+    tabcs_scale_S   = gmx_simd_set1_r(ic->tabcs_scale);
+    tab_cs          = ic->tabcs_data;
+    tabcs_stride    = ic->tabcs_stride;
+    tabcs_buf       = gmx_simd_align_r(tabcs_array);
+    /* With user electrostatics excluded pairs do not interact */
+    tabcs_excl_B    = gmx_simd_cmplt_r(zero_S, gmx_simd_set1_r(ic->eeltype == eelUSER ? 0 : 1));
+#ifdef CALC_ENERGIES
+    tabcs_sh_excl_S = gmx_simd_set1_r(ic->tabcs_sh_excl);
+#endif
+#endif
+
 #if (defined CALC_COUL_TAB || defined CALC_COUL_EWALD) && defined CALC_ENERGIES
     sh_ewald_S = gmx_simd_set1_r(ic->sh_ewald);
 #endif
@@ -403,12 +434,14 @@
     Vstride_i    = nbat->nenergrp*(1<<nbat->neg_2log)*egps_jstride;
 #endif
 
-    l_cj = nbl->cj;
+    l_cjc      = nbl->cjc;
+    l_cjc_excl = nbl->cjc_excl;
 
     ninner = 0;
     for (n = 0; n < nbl->nci; n++)
     {
         nbln = &nbl->ci[n];
+        nblc = &nbl->cic[n];
 
         ish              = (nbln->shift & NBNXN_CI_SHIFT);
         ish3             = ish*3;
@@ -463,13 +496,13 @@
 
 #ifdef CALC_ENERGIES
 #if UNROLLJ == 4
-        if (do_self && l_cj[nbln->cj_ind_start].cj == ci_sh)
+        if (do_self && nblc->cj0 == ci_sh)
 #endif
 #if UNROLLJ == 2
-        if (do_self && l_cj[nbln->cj_ind_start].cj == (ci_sh<<1))
+        if (do_self && nblc->cj0 == (ci_sh<<1))
 #endif
 #if UNROLLJ == 8
-        if (do_self && l_cj[nbln->cj_ind_start].cj == (ci_sh>>1))
+        if (do_self && nblc->cj0 == (ci_sh>>1))
 #endif
         {
             if (do_coul)
@@ -491,6 +524,21 @@
                 /* beta/sqrt(pi) */
                 Vc_sub_self = 0.5*ic->ewaldcoeff_q*M_2_SQRTPI;
 #endif
+#ifdef CALC_COUL_CSTAB
+                /* Half the exclusion correction at r=0 */
+                if (ic->eeltype == eelUSER)
+                {
+                    Vc_sub_self = 0;
+                }
+                else if (EEL_PME_EWALD(ic->eeltype))
+                {
+                    Vc_sub_self = 0.5*ic->ewaldcoeff_q*M_2_SQRTPI;
+                }
+                else
+                {
+                    Vc_sub_self = 0.5*ic->c_rf;
+                }
+#endif
 
                 for (ia = 0; ia < UNROLLI; ia++)
                 {
@@ -615,7 +663,10 @@
         fiz_S2           = gmx_simd_setzero_r();
         fiz_S3           = gmx_simd_setzero_r();
 
-        cjind = cjind0;
+        cjc_ind  = nblc->cjc_ind_start;
+        cjc_ind1 = nblc->cjc_ind_end;
+        excl_ind = nblc->excl_ind_start;
+        cj_dec   = nblc->cj0;
 
         /* Currently all kernels use (at least half) LJ */
 #define CALC_LJ
@@ -625,14 +676,16 @@
 #define CALC_COULOMB
 #define HALF_LJ
 #define CHECK_EXCLS
-            while (cjind < cjind1 && nbl->cj[cjind].excl != NBNXN_INTERACTION_MASK_ALL)
+            while (cjc_ind < cjc_ind1 && (l_cjc[cjc_ind] & NBNXN_CJC_EXCL))
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_inner.h"
-                cjind++;
+                excl_ind++;
             }
 #undef CHECK_EXCLS
-            for (; (cjind < cjind1); cjind++)
+            while (cjc_ind < cjc_ind1)
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_inner.h"
             }
 #undef HALF_LJ
@@ -643,14 +696,16 @@
             /* Coulomb: all i-atoms, LJ: all i-atoms */
 #define CALC_COULOMB
 #define CHECK_EXCLS
-            while (cjind < cjind1 && nbl->cj[cjind].excl != NBNXN_INTERACTION_MASK_ALL)
+            while (cjc_ind < cjc_ind1 && (l_cjc[cjc_ind] & NBNXN_CJC_EXCL))
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_inner.h"
-                cjind++;
+                excl_ind++;
             }
 #undef CHECK_EXCLS
-            for (; (cjind < cjind1); cjind++)
+            while (cjc_ind < cjc_ind1)
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_inner.h"
             }
 #undef CALC_COULOMB
@@ -659,14 +714,16 @@
         {
             /* Coulomb: none, LJ: all i-atoms */
 #define CHECK_EXCLS
-            while (cjind < cjind1 && nbl->cj[cjind].excl != NBNXN_INTERACTION_MASK_ALL)
+            while (cjc_ind < cjc_ind1 && (l_cjc[cjc_ind] & NBNXN_CJC_EXCL))
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_inner.h"
-                cjind++;
+                excl_ind++;
             }
 #undef CHECK_EXCLS
-            for (; (cjind < cjind1); cjind++)
+            while (cjc_ind < cjc_ind1)
             {
+                cj_dec = nbnxn_cjc_decode(l_cjc, &cjc_ind, cj_dec);
 #include "gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_inner.h"
             }
         }
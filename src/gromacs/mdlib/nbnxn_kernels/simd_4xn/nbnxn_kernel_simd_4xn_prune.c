@@ -0,0 +1,157 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include "gromacs/mdlib/nbnxn_simd.h"
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_prune.h"
+
+#ifdef GMX_NBNXN_SIMD_4XN
+#define GMX_SIMD_J_UNROLL_SIZE 1
+#include "gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn_common.h"
+#endif /* GMX_NBNXN_SIMD_4XN */
+
+#include "gromacs/utility/fatalerror.h"
+
+void
+nbnxn_kernel_prune_4xn(nbnxn_pairlist_t gmx_unused       *nbl,
+                       const nbnxn_atomdata_t gmx_unused *nbat,
+                       rvec gmx_unused                   *shift_vec,
+                       real gmx_unused                    rlist_inner)
+#ifdef GMX_NBNXN_SIMD_4XN
+{
+    const real      *x        = nbat->x;
+    const real      *shiftvec = shift_vec[0];
+    gmx_simd_real_t  rlist2_S;
+    int              cio, cjind;
+
+    rlist2_S = gmx_simd_set1_r(rlist_inner*rlist_inner);
+
+    for (cio = 0; cio < nbl->nci_outer; cio++)
+    {
+        const nbnxn_ci_t *ci_outer = &nbl->ci_outer[cio];
+        int               ci, ish3, scix, sciy, sciz, cj_ind_start;
+        gmx_simd_real_t   shX_S, shY_S, shZ_S;
+        gmx_simd_real_t   ix_S0, iy_S0, iz_S0;
+        gmx_simd_real_t   ix_S1, iy_S1, iz_S1;
+        gmx_simd_real_t   ix_S2, iy_S2, iz_S2;
+        gmx_simd_real_t   ix_S3, iy_S3, iz_S3;
+
+        ci    = ci_outer->ci;
+        ish3  = (ci_outer->shift & NBNXN_CI_SHIFT)*3;
+        shX_S = gmx_simd_load1_r(shiftvec+ish3);
+        shY_S = gmx_simd_load1_r(shiftvec+ish3+1);
+        shZ_S = gmx_simd_load1_r(shiftvec+ish3+2);
+
+        /* The same i-atom layout as in the 4xN kernel outer loop */
+#if UNROLLJ <= 4
+        scix             = ci*STRIDE*DIM;
+#else
+        scix             = (ci>>1)*STRIDE*DIM + (ci & 1)*(STRIDE>>1);
+#endif
+        sciy             = scix + STRIDE;
+        sciz             = sciy + STRIDE;
+        ix_S0            = gmx_simd_add_r(gmx_simd_load1_r(x+scix), shX_S);
+        ix_S1            = gmx_simd_add_r(gmx_simd_load1_r(x+scix+1), shX_S);
+        ix_S2            = gmx_simd_add_r(gmx_simd_load1_r(x+scix+2), shX_S);
+        ix_S3            = gmx_simd_add_r(gmx_simd_load1_r(x+scix+3), shX_S);
+        iy_S0            = gmx_simd_add_r(gmx_simd_load1_r(x+sciy), shY_S);
+        iy_S1            = gmx_simd_add_r(gmx_simd_load1_r(x+sciy+1), shY_S);
+        iy_S2            = gmx_simd_add_r(gmx_simd_load1_r(x+sciy+2), shY_S);
+        iy_S3            = gmx_simd_add_r(gmx_simd_load1_r(x+sciy+3), shY_S);
+        iz_S0            = gmx_simd_add_r(gmx_simd_load1_r(x+sciz), shZ_S);
+        iz_S1            = gmx_simd_add_r(gmx_simd_load1_r(x+sciz+1), shZ_S);
+        iz_S2            = gmx_simd_add_r(gmx_simd_load1_r(x+sciz+2), shZ_S);
+        iz_S3            = gmx_simd_add_r(gmx_simd_load1_r(x+sciz+3), shZ_S);
+
+        cj_ind_start = nbl->ncj;
+        for (cjind = ci_outer->cj_ind_start; cjind < ci_outer->cj_ind_end; cjind++)
+        {
+            const nbnxn_cj_t *cj = &nbl->cj_outer[cjind];
+            int               ajx, ajy, ajz;
+            gmx_simd_real_t   jx_S, jy_S, jz_S;
+            gmx_simd_real_t   rsq_S0, rsq_S1, rsq_S2, rsq_S3;
+            gmx_simd_bool_t   wco_S0, wco_S1, wco_S2, wco_S3;
+
+            /* The same j-atom layout as in the 4xN kernel inner loop */
+#if UNROLLJ == STRIDE
+            ajx           = cj->cj*UNROLLJ*DIM;
+#else
+            ajx           = (cj->cj>>1)*DIM*STRIDE + (cj->cj & 1)*UNROLLJ;
+#endif
+            ajy           = ajx + STRIDE;
+            ajz           = ajy + STRIDE;
+
+            jx_S          = gmx_simd_load_r(x+ajx);
+            jy_S          = gmx_simd_load_r(x+ajy);
+            jz_S          = gmx_simd_load_r(x+ajz);
+
+            rsq_S0        = gmx_simd_calc_rsq_r(gmx_simd_sub_r(ix_S0, jx_S),
+                                                gmx_simd_sub_r(iy_S0, jy_S),
+                                                gmx_simd_sub_r(iz_S0, jz_S));
+            rsq_S1        = gmx_simd_calc_rsq_r(gmx_simd_sub_r(ix_S1, jx_S),
+                                                gmx_simd_sub_r(iy_S1, jy_S),
+                                                gmx_simd_sub_r(iz_S1, jz_S));
+            rsq_S2        = gmx_simd_calc_rsq_r(gmx_simd_sub_r(ix_S2, jx_S),
+                                                gmx_simd_sub_r(iy_S2, jy_S),
+                                                gmx_simd_sub_r(iz_S2, jz_S));
+            rsq_S3        = gmx_simd_calc_rsq_r(gmx_simd_sub_r(ix_S3, jx_S),
+                                                gmx_simd_sub_r(iy_S3, jy_S),
+                                                gmx_simd_sub_r(iz_S3, jz_S));
+
+            wco_S0        = gmx_simd_cmplt_r(rsq_S0, rlist2_S);
+            wco_S1        = gmx_simd_cmplt_r(rsq_S1, rlist2_S);
+            wco_S2        = gmx_simd_cmplt_r(rsq_S2, rlist2_S);
+            wco_S3        = gmx_simd_cmplt_r(rsq_S3, rlist2_S);
+
+            wco_S0        = gmx_simd_or_b(wco_S0, wco_S1);
+            wco_S2        = gmx_simd_or_b(wco_S2, wco_S3);
+            wco_S0        = gmx_simd_or_b(wco_S0, wco_S2);
+
+            if (gmx_simd_anytrue_b(wco_S0))
+            {
+                nbl->cj[nbl->ncj++] = *cj;
+            }
+        }
+        nbnxn_prune_close_ci_entry(nbl, ci_outer, cj_ind_start);
+    }
+}
+#else
+{
+    gmx_incons("nbnxn_kernel_prune_4xn called when such kernels "
+               "are not enabled.");
+}
+#endif
@@ -106,6 +106,50 @@ typedef struct {
     int cj_ind_end;     /* End index into cj     */
 } nbnxn_ci_t;
 
+/* The j-lists of simple lists are also stored in compressed form,
+ * which is what the SIMD kernels read. Each j-cluster is stored as
+ * a 16-bit word with the increase of the j-cluster index with respect
+ * to the previous j-cluster of the i-entry in the lower 15 bits.
+ * The previous index of the first j-cluster is nbnxn_cic_t.cj0.
+ * Increases that do not fit, or decreases, are stored as the escape value
+ * followed by two words with the lower and upper half of the index.
+ * The highest bit is set for j-clusters with an interaction mask other
+ * than NBNXN_INTERACTION_MASK_ALL, these masks are stored consecutively
+ * in cjc_excl. As for nbnxn_cj_t, the masked j-clusters come first.
+ */
+#define NBNXN_CJC_EXCL    0x8000
+#define NBNXN_CJC_DELTA   0x7fff
+#define NBNXN_CJC_ESCAPE  0x7fff
+
+/* Compressed j-list data for an i-entry of a simple list */
+typedef struct {
+    int cj0;            /* The index the first j-cluster is relative to */
+    int cjc_ind_start;  /* Start index into cjc                         */
+    int cjc_ind_end;    /* End index into cjc                           */
+    int excl_ind_start; /* Start index into cjc_excl                    */
+} nbnxn_cic_t;
+
+/* Decodes the j-cluster index at position *ind in the compressed
+ * j-list cjc, given the previous index cj_prev, and advances *ind
+ * to the next j-cluster. See nbnxn_cic_t for the format.
+ */
+static gmx_inline int
+nbnxn_cjc_decode(const unsigned short *cjc, int *ind, int cj_prev)
+{
+    int d;
+
+    d = (cjc[*ind] & NBNXN_CJC_DELTA);
+    if (d != NBNXN_CJC_ESCAPE)
+    {
+        *ind += 1;
+
+        return cj_prev + d;
+    }
+    *ind += 3;
+
+    return cjc[*ind - 2] | (cjc[*ind - 1] << 16);
+}
+
 /* Grouped pair-list i-unit */
 typedef struct {
     int sci;            /* i-super-cluster       */
@@ -150,10 +194,24 @@ typedef struct nbnxn_pairlist_t {
     nbnxn_sci_t            *sci;         /* The i-super-cluster list                 */
     int                     sci_nalloc;  /* The allocation size of sci               */
 
-    int                     ncj;         /* The number of j-clusters in the list     */
+    int                     ncj;         /* The number of j-clusters in cj           */
     nbnxn_cj_t             *cj;          /* The j-cluster list, size ncj             */
     int                     cj_nalloc;   /* The allocation size of cj                */
 
+    /* With bCompressed, each i-entry is compressed when it is closed and
+     * cj only holds the j-list of the i-entry being built. The ranges
+     * of the i-entries then index the, not stored, full j-list.
+     */
+    gmx_bool                bCompressed; /* The j-lists are stored in cic and cjc    */
+    nbnxn_cic_t            *cic;         /* Compressed j-list data, size nci         */
+    int                     cic_nalloc;  /* The allocation size of cic               */
+    int                     ncjc;        /* The number of words in cjc               */
+    unsigned short         *cjc;         /* The compressed j-cluster list            */
+    int                     cjc_nalloc;  /* The allocation size of cjc               */
+    int                     ncjc_excl;   /* The number of masks in cjc_excl          */
+    unsigned int           *cjc_excl;    /* The masks of the masked j-clusters       */
+    int                     cjc_excl_nalloc; /* The allocation size of cjc_excl      */
+
     int                     ncj4;        /* The total number of 4*j clusters         */
     nbnxn_cj4_t            *cj4;         /* The 4*j cluster list, size ncj4          */
     int                     cj4_nalloc;  /* The allocation size of cj4               */
@@ -162,21 +220,55 @@ typedef struct nbnxn_pairlist_t {
     int                     excl_nalloc; /* The allocation size for excl             */
     int                     nci_tot;     /* The total number of i clusters           */
 
+    /* With dynamic pruning, the list built by the search, the lists above
+     * then hold the part of it within the inner radius, see
+     * nbnxn_kernel_prune.h
+     */
+    int                     nci_outer;       /* The number of outer i-clusters       */
+    nbnxn_ci_t             *ci_outer;        /* The outer i-cluster list             */
+    int                     ci_outer_nalloc; /* The allocation size of ci_outer      */
+    int                     ncj_outer;       /* The number of outer j-clusters       */
+    nbnxn_cj_t             *cj_outer;        /* The outer j-cluster list             */
+    int                     cj_outer_nalloc; /* The allocation size of cj_outer      */
+
     struct nbnxn_list_work *work;
 
     gmx_cache_protect_t     cp1;
 } nbnxn_pairlist_t;
 
+/* Returns the number of j-clusters in the simple list nbl */
+static gmx_inline int
+nbnxn_pairlist_ncj(const nbnxn_pairlist_t *nbl)
+{
+    if (!nbl->bCompressed)
+    {
+        return nbl->ncj;
+    }
+
+    return (nbl->nci > 0) ? nbl->ci[nbl->nci - 1].cj_ind_end : 0;
+}
+
+/* Abstract type for the work-stealing state of the CPU kernels,
+ * see nbnxn_kernels/nbnxn_kernel_common.h
+ */
+typedef struct nbnxn_steal * nbnxn_steal_t;
+
 typedef struct {
     int                nnbl;        /* number of lists */
     nbnxn_pairlist_t **nbl;         /* lists */
     gmx_bool           bCombined;   /* TRUE if lists get combined into one (the 1st) */
     gmx_bool           bSimple;     /* TRUE if the list of of type "simple"
                                        (na_sc=na_s, no super-clusters used) */
+    gmx_bool           bCompressed; /* TRUE if the kernels use the compressed
+                                       j-lists, see nbnxn_cic_t */
+    gmx_bool           bPrune;      /* TRUE if the lists are pruned after the
+                                       search, see nbnxn_kernel_prune.h */
     int                natpair_ljq; /* Total number of atom pairs for LJ+Q kernel */
     int                natpair_lj;  /* Total number of atom pairs for LJ kernel   */
     int                natpair_q;   /* Total number of atom pairs for Q kernel    */
     t_nblist         **nbl_fep;
+    nbnxn_steal_t      steal;       /* Chunked work stealing over the lists in
+                                       the CPU kernels, NULL when not used */
 } nbnxn_pairlist_set_t;
 
 enum {
@@ -223,8 +315,21 @@ enum {
     ljcrGEOM, ljcrLB, ljcrNONE, ljcrNR
 };
 
+/* Single precision copies of the real valued atom data in a double
+ * precision nbnxn_atomdata_t, used by the mixed-precision SIMD kernels.
+ * The layouts are those of the double precision arrays.
+ */
+typedef struct {
+    float *nbfp;                         /* As nbfp                            */
+    float *nbfp_s4;                      /* As nbfp_s4                         */
+    float *lj_comb;                      /* As lj_comb                         */
+    float *q;                            /* As q                               */
+    float *x;                            /* As x                               */
+    float *simd_2xnn_diagonal_j_minus_i; /* As simd_2xnn_diagonal_j_minus_i,
+                                          * for the single precision SIMD width */
+} nbnxn_atomdata_mixed_t;
+
 typedef struct nbnxn_atomdata_t {
-    int                      id;              /* Unique id */
     nbnxn_alloc_t           *alloc;
     nbnxn_free_t            *free;
     int                      ntype;           /* The number of different atom types                 */
@@ -268,6 +373,8 @@ typedef struct nbnxn_atomdata_t {
     gmx_bool                 bUseBufferFlags;        /* Use the flags or operate on all atoms     */
     nbnxn_buffer_flags_t     buffer_flags;           /* Flags for buffer zeroing+reduc.  */
     gmx_bool                 bUseTreeReduce;         /* Use tree for force reduction */
+    nbnxn_atomdata_mixed_t  *mixed;                  /* Float copies for the mixed-precision
+                                                        kernels, NULL when not used */
 } nbnxn_atomdata_t;
 
 #ifdef __cplusplus
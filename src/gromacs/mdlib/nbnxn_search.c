@@ -37,8 +37,11 @@
 
 #include "nbnxn_search.h"
 
+#include "config.h"
+
 #include <assert.h>
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "gromacs/legacyheaders/gmx_omp_nthreads.h"
@@ -52,12 +55,14 @@
 #include "gromacs/mdlib/nbnxn_atomdata.h"
 #include "gromacs/mdlib/nbnxn_consts.h"
 #include "gromacs/mdlib/nbnxn_internal.h"
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_common.h"
 #include "gromacs/mdlib/nbnxn_simd.h"
 #include "gromacs/pbcutil/ishift.h"
 #include "gromacs/pbcutil/pbc.h"
 #include "gromacs/simd/simd.h"
 #include "gromacs/mdlib/nb_verlet_simd_offload.h"
 #include "gromacs/simd/vector_operations.h"
+#include "gromacs/utility/cstringutil.h"
 #include "gromacs/utility/smalloc.h"
 
 #ifdef NBNXN_SEARCH_BB_SIMD4
@@ -106,8 +111,24 @@
 #define X_IND_CI_J8(ci)  (((ci)>>1)*STRIDE_P8 + ((ci) & 1)*(PACK_X8>>1))
 #define X_IND_CJ_J8(cj)  ((cj)*STRIDE_P8)
 
+/* The 2xNN search loads j-atom coordinates with half of the host SIMD
+ * width. With offload the j-cluster can be larger than this and is then
+ * loaded in multiple parts.
+ */
+#if GMX_SIMD_REAL_WIDTH == 16
+#define NBNXN_SEARCH_HPR_WIDTH  8
+#else
+#define NBNXN_SEARCH_HPR_WIDTH  4
+#endif
+
+#ifdef GMX_OFFLOAD
+/* The pair lists are set up for the 2xNN kernel on the 16-wide SIMD
+ * of the Xeon Phi offload target, not for the SIMD width of the host.
+ */
+#undef GMX_SIMD_REAL_WIDTH
 #define GMX_SIMD_REAL_WIDTH 16
 #undef GMX_NBNXN_SIMD_4XN
+#endif
 
 /* The j-cluster size is matched to the SIMD width */
 #if GMX_SIMD_REAL_WIDTH == 2
@@ -179,7 +200,8 @@ static double Mcyc_av(const nbnxn_cycle_t *cc)
     return (double)cc->c*1e-6/cc->count;
 }
 
-static void nbs_cycle_print(FILE *fp, const nbnxn_search_t nbs)
+static void nbs_cycle_print(FILE *fp, const nbnxn_search_t nbs,
+                            const nbnxn_pairlist_set_t *nbl_list)
 {
     int n;
     int t;
@@ -206,16 +228,24 @@ static void nbs_cycle_print(FILE *fp, const nbnxn_search_t nbs)
         }
     }
     fprintf(fp, "\n");
+
+    nbnxn_kernel_steal_print(fp, nbl_list);
 }
 
 static void nbnxn_grid_init(nbnxn_grid_t * grid)
 {
-    grid->cxy_na      = NULL;
-    grid->cxy_ind     = NULL;
-    grid->cxy_nalloc  = 0;
-    grid->bb          = NULL;
-    grid->bbj         = NULL;
-    grid->nc_nalloc   = 0;
+    grid->cxy_na        = NULL;
+    grid->cxy_ind       = NULL;
+    grid->cxy_na_prev   = NULL;
+    grid->cxy_ind_prev  = NULL;
+    grid->col_order     = enbsColOrderXMajor;
+    grid->cxy_xy        = NULL;
+    grid->xy_cxy        = NULL;
+    grid->cxy_nalloc    = 0;
+    grid->natoms_sorted = -1;
+    grid->bb            = NULL;
+    grid->bbj           = NULL;
+    grid->nc_nalloc     = 0;
 }
 
 static int get_2log(int n)
@@ -358,6 +388,7 @@ void nbnxn_init_search(nbnxn_search_t    * nbs_ptr,
 {
     nbnxn_search_t nbs;
     int            d, g, t;
+    char          *env;
 
     snew(nbs, 1);
     *nbs_ptr = nbs;
@@ -391,8 +422,37 @@ void nbnxn_init_search(nbnxn_search_t    * nbs_ptr,
     nbs->cell        = NULL;
     nbs->cell_nalloc = 0;
     nbs->a           = NULL;
+    nbs->a_prev      = NULL;
     nbs->a_nalloc    = 0;
 
+    /* Without DD the home atoms are the same at every search, so we can
+     * update the atom order of the previous search instead of sorting.
+     */
+    nbs->bIncrementalGrid = (!nbs->DomDec &&
+                             getenv("GMX_NBNXN_FULL_GRID_SORT") == NULL);
+
+    nbs->col_order = enbsColOrderXMajor;
+    env            = getenv("GMX_NBNXN_COLUMN_ORDER");
+    if (env != NULL)
+    {
+        if (gmx_strcasecmp(env, "xmajor") == 0)
+        {
+            nbs->col_order = enbsColOrderXMajor;
+        }
+        else if (gmx_strcasecmp(env, "morton") == 0)
+        {
+            nbs->col_order = enbsColOrderMorton;
+        }
+        else if (gmx_strcasecmp(env, "hilbert") == 0)
+        {
+            nbs->col_order = enbsColOrderHilbert;
+        }
+        else
+        {
+            gmx_fatal(FARGS, "Invalid value '%s' for GMX_NBNXN_COLUMN_ORDER, should be xmajor, morton or hilbert", env);
+        }
+    }
+
     nbs->nthread_max = max(nbs->nthread_max, gmx_omp_nthreads_get(emntNonbonded));
 
     /* Initialize the work data structures for each thread */
@@ -402,6 +462,7 @@ void nbnxn_init_search(nbnxn_search_t    * nbs_ptr,
         nbs->work[t].cxy_na           = NULL;
         nbs->work[t].cxy_na_nalloc    = 0;
         nbs->work[t].sort_work        = NULL;
+        nbs->work[t].sort_coord       = NULL;
         nbs->work[t].sort_work_nalloc = 0;
 
         snew(nbs->work[t].nbl_fep, 1);
@@ -433,6 +494,118 @@ static real grid_atom_density(int n, rvec corner0, rvec corner1)
     return n/(size[XX]*size[YY]*size[ZZ]);
 }
 
+/* Returns the index of location x,y along a Morton curve */
+static int morton_index(int x, int y)
+{
+    int d, b;
+
+    d = 0;
+    for (b = 0; (x >> b) > 0 || (y >> b) > 0; b++)
+    {
+        d |= (((x >> b) & 1) << (2*b)) | (((y >> b) & 1) << (2*b + 1));
+    }
+
+    return d;
+}
+
+/* Returns the index of location x,y along a Hilbert curve
+ * filling an n x n square, n should be a power of 2.
+ */
+static int hilbert_index(int n, int x, int y)
+{
+    int s, rx, ry, d, t;
+
+    d = 0;
+    for (s = n/2; s > 0; s /= 2)
+    {
+        rx = ((x & s) > 0);
+        ry = ((y & s) > 0);
+        d += s*s*((3*rx) ^ ry);
+        /* Rotate the quadrant, so the sub-curve connects */
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            t = x;
+            x = y;
+            y = t;
+        }
+    }
+
+    return d;
+}
+
+static int int_pair_comp(const void *a, const void *b)
+{
+    const int *pa = (const int *)a;
+    const int *pb = (const int *)b;
+
+    return (pa[0] < pb[0] ? -1 : (pa[0] > pb[0] ? 1 : 0));
+}
+
+/* Sets the order of the grid columns in memory, grid->cxy_xy and
+ * its inverse grid->xy_cxy. Ordering the columns along a space-filling
+ * curve keeps neighboring columns close in memory also along y, which
+ * improves the locality of the j-clusters for an i-cluster and of the
+ * force buffer blocks that each thread touches.
+ */
+static void set_column_order(nbnxn_grid_t *grid, int col_order)
+{
+    int  ncxy, n, x, y, xy, c;
+    int *key;
+
+    ncxy = grid->ncx*grid->ncy;
+
+    grid->col_order = col_order;
+
+    if (col_order == enbsColOrderXMajor)
+    {
+        for (xy = 0; xy < ncxy; xy++)
+        {
+            grid->cxy_xy[xy] = xy;
+        }
+    }
+    else
+    {
+        /* The curve covers a power of 2 square that fits the grid */
+        n = 1;
+        while (n < grid->ncx || n < grid->ncy)
+        {
+            n *= 2;
+        }
+
+        snew(key, 2*ncxy);
+        for (x = 0; x < grid->ncx; x++)
+        {
+            for (y = 0; y < grid->ncy; y++)
+            {
+                xy         = x*grid->ncy + y;
+                key[2*xy]  = (col_order == enbsColOrderMorton ?
+                              morton_index(x, y) :
+                              hilbert_index(n, x, y));
+                key[2*xy+1] = xy;
+            }
+        }
+        qsort(key, ncxy, 2*sizeof(int), int_pair_comp);
+        for (c = 0; c < ncxy; c++)
+        {
+            grid->cxy_xy[c] = key[2*c+1];
+        }
+        sfree(key);
+    }
+
+    for (c = 0; c < ncxy; c++)
+    {
+        grid->xy_cxy[grid->cxy_xy[c]] = c;
+    }
+    /* The extra column for particles moved by DD stays at the end */
+    grid->cxy_xy[ncxy] = ncxy;
+    grid->xy_cxy[ncxy] = ncxy;
+}
+
 static int set_grid_size_xy(const nbnxn_search_t nbs,
                             nbnxn_grid_t *grid,
                             int dd_zone,
@@ -443,9 +616,13 @@ static int set_grid_size_xy(const nbnxn_search_t nbs,
     int  na_c;
     real adens, tlen, tlen_x, tlen_y, nc_max;
     int  t;
+    int  ncx_prev, ncy_prev, col_order;
 
     rvec_sub(corner1, corner0, size);
 
+    ncx_prev = grid->ncx;
+    ncy_prev = grid->ncy;
+
     if (n > grid->na_sc)
     {
         assert(atom_density > 0);
@@ -506,6 +683,19 @@ static int set_grid_size_xy(const nbnxn_search_t nbs,
         grid->cxy_nalloc = over_alloc_large(grid->ncx*grid->ncy+1);
         srenew(grid->cxy_na, grid->cxy_nalloc);
         srenew(grid->cxy_ind, grid->cxy_nalloc+1);
+        srenew(grid->cxy_na_prev, grid->cxy_nalloc);
+        srenew(grid->cxy_ind_prev, grid->cxy_nalloc+1);
+        srenew(grid->cxy_xy, grid->cxy_nalloc);
+        srenew(grid->xy_cxy, grid->cxy_nalloc);
+        /* Force setting the column order below */
+        ncx_prev = -1;
+    }
+    /* The super/sub-cell list setup relies on x-major j-cluster order */
+    col_order = (grid->bSimple ? nbs->col_order : enbsColOrderXMajor);
+    if (grid->ncx != ncx_prev || grid->ncy != ncy_prev ||
+        grid->col_order != col_order)
+    {
+        set_column_order(grid, col_order);
     }
     for (t = 0; t < nbs->nthread_max; t++)
     {
@@ -741,6 +931,93 @@ static void sort_atoms(int dim, gmx_bool Backwards,
     }
 }
 
+/* Returns if the particle with coordinate xi and index ai goes before
+ * the particle with xj and aj, this gives the same order as sort_atoms.
+ */
+static gmx_inline gmx_bool sorts_before(real xi, int ai, real xj, int aj)
+{
+    return (xi < xj || (xi == xj && ai < aj));
+}
+
+/* Insertion sort of particle index a and coordinates xa,
+ * efficient when a is nearly sorted.
+ */
+static void insertion_sort_atoms(int *a, real *xa, int n)
+{
+    int  i, j, ai;
+    real xi;
+
+    for (i = 1; i < n; i++)
+    {
+        ai = a[i];
+        xi = xa[i];
+        for (j = i; j > 0 && sorts_before(xi, ai, xa[j-1], a[j-1]); j--)
+        {
+            a[j]  = a[j-1];
+            xa[j] = xa[j-1];
+        }
+        a[j]  = ai;
+        xa[j] = xi;
+    }
+}
+
+/* Sort particle index a on coordinates x along dim, with the same result
+ * as sort_atoms with Backwards=FALSE, for an index that consists of
+ * the n_stay particles of the previous, sorted order, which have only
+ * moved a bit, followed by a few particles which are new to this index.
+ * Both parts are sorted with insertion sort and then merged.
+ * sort is a work array of size n with all elements -1, as for sort_atoms,
+ * xa is a work array of size n.
+ */
+static void sort_atoms_incremental(int dim,
+                                   int *a, int n, int n_stay,
+                                   const rvec *x,
+                                   int *sort, real *xa)
+{
+    int i, j, c;
+
+    /* Copy the coordinates, so we sort contiguous data */
+    for (i = 0; i < n; i++)
+    {
+        xa[i] = x[a[i]][dim];
+    }
+
+    insertion_sort_atoms(a, xa, n_stay);
+    insertion_sort_atoms(a + n_stay, xa + n_stay, n - n_stay);
+
+    if (n_stay == 0 || n_stay == n ||
+        sorts_before(xa[n_stay-1], a[n_stay-1], xa[n_stay], a[n_stay]))
+    {
+        /* The two parts are already in order */
+        return;
+    }
+
+    i = 0;
+    j = n_stay;
+    c = 0;
+    while (i < n_stay && j < n)
+    {
+        if (sorts_before(xa[j], a[j], xa[i], a[i]))
+        {
+            sort[c++] = a[j++];
+        }
+        else
+        {
+            sort[c++] = a[i++];
+        }
+    }
+    while (i < n_stay)
+    {
+        sort[c++] = a[i++];
+    }
+    /* The remaining elements j to n are already in place */
+    for (i = 0; i < c; i++)
+    {
+        a[i]    = sort[i];
+        sort[i] = -1;
+    }
+}
+
 #ifdef GMX_DOUBLE
 #define R2F_D(x) ((float)((x) >= 0 ? ((1-GMX_FLOAT_EPS)*(x)) : ((1+GMX_FLOAT_EPS)*(x))))
 #define R2F_U(x) ((float)((x) >= 0 ? ((1+GMX_FLOAT_EPS)*(x)) : ((1-GMX_FLOAT_EPS)*(x))))
@@ -1218,6 +1495,10 @@ void fill_cell(const nbnxn_search_t nbs,
     copy_rvec_to_nbat_real(nbs->a+a0, a1-a0, grid->na_c, x,
                            nbat->XFormat, nbat->x, a0,
                            sx, sy, sz);
+    if (nbat->mixed != NULL)
+    {
+        nbnxn_atomdata_copy_x_to_mixed(nbat, a0, grid->na_c);
+    }
 
     if (nbat->XFormat == nbatX4)
     {
@@ -1311,7 +1592,9 @@ static void sort_columns_simple(const nbnxn_search_t nbs,
                                 rvec *x,
                                 nbnxn_atomdata_t *nbat,
                                 int cxy_start, int cxy_end,
-                                int *sort_work)
+                                const int *cxy_nstay,
+                                int *sort_work,
+                                real *sort_coord)
 {
     int  cxy;
     int  cx, cy, cz, ncz, cfilled, c;
@@ -1327,19 +1610,27 @@ static void sort_columns_simple(const nbnxn_search_t nbs,
     /* Sort the atoms within each x,y column in 3 dimensions */
     for (cxy = cxy_start; cxy < cxy_end; cxy++)
     {
-        cx = cxy/grid->ncy;
-        cy = cxy - cx*grid->ncy;
+        cx = grid->cxy_xy[cxy]/grid->ncy;
+        cy = grid->cxy_xy[cxy] - cx*grid->ncy;
 
         na  = grid->cxy_na[cxy];
         ncz = grid->cxy_ind[cxy+1] - grid->cxy_ind[cxy];
         ash = (grid->cell0 + grid->cxy_ind[cxy])*grid->na_sc;
 
         /* Sort the atoms within each x,y column on z coordinate */
-        sort_atoms(ZZ, FALSE, dd_zone,
-                   nbs->a+ash, na, x,
-                   grid->c0[ZZ],
-                   1.0/grid->size[ZZ], ncz*grid->na_sc,
-                   sort_work);
+        if (cxy_nstay != NULL)
+        {
+            sort_atoms_incremental(ZZ, nbs->a+ash, na, cxy_nstay[cxy], x,
+                                   sort_work, sort_coord);
+        }
+        else
+        {
+            sort_atoms(ZZ, FALSE, dd_zone,
+                       nbs->a+ash, na, x,
+                       grid->c0[ZZ],
+                       1.0/grid->size[ZZ], ncz*grid->na_sc,
+                       sort_work);
+        }
 
         /* Fill the ncz cells in this column */
         cfilled = grid->cxy_ind[cxy];
@@ -1412,8 +1703,8 @@ static void sort_columns_supersub(const nbnxn_search_t nbs,
     /* Sort the atoms within each x,y column in 3 dimensions */
     for (cxy = cxy_start; cxy < cxy_end; cxy++)
     {
-        cx = cxy/grid->ncy;
-        cy = cxy - cx*grid->ncy;
+        cx = grid->cxy_xy[cxy]/grid->ncy;
+        cy = grid->cxy_xy[cxy] - cx*grid->ncy;
 
         na  = grid->cxy_na[cxy];
         ncz = grid->cxy_ind[cxy+1] - grid->cxy_ind[cxy];
@@ -1546,9 +1837,9 @@ static void calc_column_indices(nbnxn_grid_t *grid,
                 cy = min(cy, grid->ncy - 1);
 
                 /* For the moment cell will contain only the, grid local,
-                 * x and y indices, not z.
+                 * column index, not z.
                  */
-                cell[i] = cx*grid->ncy + cy;
+                cell[i] = grid->xy_cxy[cx*grid->ncy + cy];
             }
             else
             {
@@ -1581,16 +1872,66 @@ static void calc_column_indices(nbnxn_grid_t *grid,
             cy = min(cy, grid->ncy - 1);
 
             /* For the moment cell will contain only the, grid local,
-             * x and y indices, not z.
+             * column index, not z.
              */
-            cell[i] = cx*grid->ncy + cy;
+            cell[i] = grid->xy_cxy[cx*grid->ncy + cy];
 
             cxy_na[cell[i]]++;
         }
     }
 }
 
-/* Determine in which grid cells the atoms should go */
+/* Fill the grid columns with the atoms in the order of the previous
+ * grid setup, stored in nbs->a_prev. In each column the atoms that were
+ * in the same column before go first, followed by the atoms that moved
+ * in from other columns. The number of the former is returned in cxy_nstay.
+ */
+static void fill_columns_from_previous(const nbnxn_search_t nbs,
+                                       nbnxn_grid_t *grid,
+                                       int *cxy_nstay)
+{
+    int cxy_prev, cxy, ash, i, a, nmoved;
+
+    /* At this point nbs->cell contains the local grid x,y indices.
+     * We store the atoms that changed column at the start of nbs->a_prev,
+     * which we can do in place as we have already read those elements.
+     */
+    nmoved = 0;
+    for (cxy_prev = 0; cxy_prev < grid->ncx*grid->ncy; cxy_prev++)
+    {
+        ash = (grid->cell0 + grid->cxy_ind_prev[cxy_prev])*grid->na_sc;
+        for (i = ash; i < ash + grid->cxy_na_prev[cxy_prev]; i++)
+        {
+            a   = nbs->a_prev[i];
+            cxy = nbs->cell[a];
+            if (cxy == cxy_prev)
+            {
+                nbs->a[(grid->cell0 + grid->cxy_ind[cxy])*grid->na_sc + grid->cxy_na[cxy]++] = a;
+            }
+            else
+            {
+                nbs->a_prev[nmoved++] = a;
+            }
+        }
+    }
+
+    for (cxy = 0; cxy < grid->ncx*grid->ncy; cxy++)
+    {
+        cxy_nstay[cxy] = grid->cxy_na[cxy];
+    }
+
+    for (i = 0; i < nmoved; i++)
+    {
+        a   = nbs->a_prev[i];
+        cxy = nbs->cell[a];
+        nbs->a[(grid->cell0 + grid->cxy_ind[cxy])*grid->na_sc + grid->cxy_na[cxy]++] = a;
+    }
+}
+
+/* Determine in which grid cells the atoms should go.
+ * With bIncremental the atom order of the previous call is updated,
+ * which requires the same atoms and the same column setup.
+ */
 static void calc_cell_indices(const nbnxn_search_t nbs,
                               int dd_zone,
                               nbnxn_grid_t *grid,
@@ -1598,15 +1939,31 @@ static void calc_cell_indices(const nbnxn_search_t nbs,
                               const int *atinfo,
                               rvec *x,
                               const int *move,
+                              gmx_bool bIncremental,
                               nbnxn_atomdata_t *nbat)
 {
     int   n0, n1, i;
     int   cx, cy, cxy, ncz_max, ncz;
     int   nthread, thread;
     int  *cxy_na, cxy_na_i;
+    int  *cxy_nstay, *tmp;
 
     nthread = gmx_omp_nthreads_get(emntPairsearch);
 
+    if (bIncremental)
+    {
+        /* Keep the previous setup, we start from its atom order */
+        tmp                = grid->cxy_na;
+        grid->cxy_na       = grid->cxy_na_prev;
+        grid->cxy_na_prev  = tmp;
+        tmp                = grid->cxy_ind;
+        grid->cxy_ind      = grid->cxy_ind_prev;
+        grid->cxy_ind_prev = tmp;
+        tmp                = nbs->a;
+        nbs->a             = nbs->a_prev;
+        nbs->a_prev        = tmp;
+    }
+
 #pragma omp parallel for num_threads(nthread) schedule(static)
     for (thread = 0; thread < nthread; thread++)
     {
@@ -1677,6 +2034,8 @@ static void calc_cell_indices(const nbnxn_search_t nbs,
                 over_alloc_large(ncz_max*grid->na_sc*SGSF);
             srenew(nbs->work[thread].sort_work,
                    nbs->work[thread].sort_work_nalloc);
+            srenew(nbs->work[thread].sort_coord,
+                   nbs->work[thread].sort_work_nalloc);
             /* When not in use, all elements should be -1 */
             for (i = 0; i < nbs->work[thread].sort_work_nalloc; i++)
             {
@@ -1688,11 +2047,23 @@ static void calc_cell_indices(const nbnxn_search_t nbs,
     /* Now we know the dimensions we can fill the grid.
      * This is the first, unsorted fill. We sort the columns after this.
      */
-    for (i = a0; i < a1; i++)
+    if (bIncremental)
     {
-        /* At this point nbs->cell contains the local grid x,y indices */
-        cxy = nbs->cell[i];
-        nbs->a[(grid->cell0 + grid->cxy_ind[cxy])*grid->na_sc + grid->cxy_na[cxy]++] = i;
+        /* The per thread column counts are no longer needed */
+        cxy_nstay = nbs->work[0].cxy_na;
+
+        fill_columns_from_previous(nbs, grid, cxy_nstay);
+    }
+    else
+    {
+        cxy_nstay = NULL;
+
+        for (i = a0; i < a1; i++)
+        {
+            /* At this point nbs->cell contains the local grid x,y indices */
+            cxy = nbs->cell[i];
+            nbs->a[(grid->cell0 + grid->cxy_ind[cxy])*grid->na_sc + grid->cxy_na[cxy]++] = i;
+        }
     }
 
     if (dd_zone == 0)
@@ -1718,7 +2089,9 @@ static void calc_cell_indices(const nbnxn_search_t nbs,
             sort_columns_simple(nbs, dd_zone, grid, a0, a1, atinfo, x, nbat,
                                 ((thread+0)*grid->ncx*grid->ncy)/nthread,
                                 ((thread+1)*grid->ncx*grid->ncy)/nthread,
-                                nbs->work[thread].sort_work);
+                                cxy_nstay,
+                                nbs->work[thread].sort_work,
+                                nbs->work[thread].sort_coord);
         }
         else
         {
@@ -1795,11 +2168,17 @@ void nbnxn_put_on_grid(nbnxn_search_t nbs,
     nbnxn_grid_t *grid;
     int           n;
     int           nc_max_grid, nc_max;
+    int           ncx_prev, ncy_prev, na_sc_prev;
+    gmx_bool      bIncremental;
 
     grid = &nbs->grid[dd_zone];
 
     nbs_cycle_start(&nbs->cc[enbsCCgrid]);
 
+    ncx_prev   = grid->ncx;
+    ncy_prev   = grid->ncy;
+    na_sc_prev = grid->na_sc;
+
     grid->bSimple = nbnxn_kernel_pairlist_simple(nb_kernel_type);
 
     grid->na_c      = nbnxn_kernel_to_ci_size(nb_kernel_type);
@@ -1878,6 +2257,10 @@ void nbnxn_put_on_grid(nbnxn_search_t nbs,
     {
         nbs->a_nalloc = over_alloc_large(nc_max*grid->na_sc + nmoved);
         srenew(nbs->a, nbs->a_nalloc);
+        if (nbs->bIncrementalGrid)
+        {
+            srenew(nbs->a_prev, nbs->a_nalloc);
+        }
     }
 
     /* We need padding up to a multiple of the buffer flag size: simply add */
@@ -1886,7 +2269,22 @@ void nbnxn_put_on_grid(nbnxn_search_t nbs,
         nbnxn_atomdata_realloc(nbat, nc_max*grid->na_sc+NBNXN_BUFFERFLAG_SIZE, nb_kernel_type);
     }
 
-    calc_cell_indices(nbs, dd_zone, grid, a0, a1, atinfo, x, move, nbat);
+    /* Most atoms stay in their column between searches and move little
+     * along z, so with the same atoms and column setup as the previous
+     * search we update the previous order instead of sorting from scratch.
+     * This gives the same order, so the same results, as a full sort.
+     * The supersub grid also sorts along x and y, there we always sort.
+     */
+    bIncremental = (nbs->bIncrementalGrid && dd_zone == 0 && nmoved == 0 &&
+                    grid->bSimple &&
+                    grid->natoms_sorted == n &&
+                    grid->ncx == ncx_prev && grid->ncy == ncy_prev &&
+                    grid->na_sc == na_sc_prev);
+
+    calc_cell_indices(nbs, dd_zone, grid, a0, a1, atinfo, x, move,
+                      bIncremental, nbat);
+
+    grid->natoms_sorted = ((nbs->bIncrementalGrid && dd_zone == 0) ? n : -1);
 
     if (dd_zone == 0)
     {
@@ -2040,25 +2438,22 @@ void nbnxn_get_atomorder(nbnxn_search_t nbs, int **a, int *n)
 void nbnxn_set_atomorder(nbnxn_search_t nbs)
 {
     nbnxn_grid_t *grid;
-    int           ao, cx, cy, cxy, cz, j;
+    int           ao, cxy, cz, j;
 
     /* Set the atom order for the home cell (index 0) */
     grid = &nbs->grid[0];
 
+    /* The atoms are ordered as the columns in memory */
     ao = 0;
-    for (cx = 0; cx < grid->ncx; cx++)
+    for (cxy = 0; cxy < grid->ncx*grid->ncy; cxy++)
     {
-        for (cy = 0; cy < grid->ncy; cy++)
+        j   = grid->cxy_ind[cxy]*grid->na_sc;
+        for (cz = 0; cz < grid->cxy_na[cxy]; cz++)
         {
-            cxy = cx*grid->ncy + cy;
-            j   = grid->cxy_ind[cxy]*grid->na_sc;
-            for (cz = 0; cz < grid->cxy_na[cxy]; cz++)
-            {
-                nbs->a[j]     = ao;
-                nbs->cell[ao] = j;
-                ao++;
-                j++;
-            }
+            nbs->a[j]     = ao;
+            nbs->cell[ao] = j;
+            ao++;
+            j++;
         }
     }
 }
@@ -2524,12 +2919,28 @@ static void nbnxn_init_pairlist(nbnxn_pairlist_t *nbl,
     nbl->ncj         = 0;
     nbl->cj          = NULL;
     nbl->cj_nalloc   = 0;
+    nbl->bCompressed = FALSE;
+    nbl->cic         = NULL;
+    nbl->cic_nalloc  = 0;
+    nbl->ncjc        = 0;
+    nbl->cjc         = NULL;
+    nbl->cjc_nalloc  = 0;
+    nbl->ncjc_excl   = 0;
+    nbl->cjc_excl    = NULL;
+    nbl->cjc_excl_nalloc = 0;
     nbl->ncj4        = 0;
     /* We need one element extra in sj, so alloc initially with 1 */
     nbl->cj4_nalloc  = 0;
     nbl->cj4         = NULL;
     nbl->nci_tot     = 0;
 
+    nbl->nci_outer       = 0;
+    nbl->ci_outer        = NULL;
+    nbl->ci_outer_nalloc = 0;
+    nbl->ncj_outer       = 0;
+    nbl->cj_outer        = NULL;
+    nbl->cj_outer_nalloc = 0;
+
     if (!nbl->bSimple)
     {
         nbl->excl        = NULL;
@@ -2570,13 +2981,20 @@ void nbnxn_init_pairlist_set(nbnxn_pairlist_set_t *nbl_list,
                              gmx_bool bSimple, gmx_bool bCombined,
                              nbnxn_alloc_t *alloc,
                              nbnxn_free_t  *free,
-							 int nb_kernel_type)
+							 int nb_kernel_type,
+                             gmx_bool bWorkStealing)
 {
     int i;
 
     nbl_list->bSimple   = bSimple;
     nbl_list->bCombined = bCombined;
 
+    /* The SIMD kernels read the compressed j-lists */
+    nbl_list->bCompressed = (bSimple &&
+                             (nb_kernel_type == nbnxnk4xN_SIMD_4xN ||
+                              nb_kernel_type == nbnxnk4xN_SIMD_2xNN));
+    nbl_list->bPrune      = FALSE;
+
     nbl_list->nnbl = gmx_omp_nthreads_get(emntNonbonded);
 
     if (!nbl_list->bCombined && !offloadedKernelEnabled(nb_kernel_type) &&
@@ -2586,6 +3004,18 @@ void nbnxn_init_pairlist_set(nbnxn_pairlist_set_t *nbl_list,
                   nbl_list->nnbl, NBNXN_BUFFERFLAG_MAX_THREADS, NBNXN_BUFFERFLAG_MAX_THREADS);
     }
 
+    /* Distribute the i-entries of the thread lists dynamically over
+     * the threads in the CPU kernels, unless disabled or not applicable.
+     */
+    nbl_list->steal = NULL;
+    if (bWorkStealing &&
+        nbl_list->bSimple && !nbl_list->bCombined && nbl_list->nnbl > 1 &&
+        !offloadedKernelEnabled(nb_kernel_type) &&
+        getenv("GMX_NBNXN_NO_WORK_STEALING") == NULL)
+    {
+        nbnxn_kernel_steal_init(nbl_list);
+    }
+
     snew(nbl_list->nbl, nbl_list->nnbl);
     snew(nbl_list->nbl_fep, nbl_list->nnbl);
     /* Execute in order to avoid memory interleaving between threads */
@@ -2597,8 +3027,10 @@ void nbnxn_init_pairlist_set(nbnxn_pairlist_set_t *nbl_list,
          */
         snew(nbl_list->nbl[i], 1);
 
-        /* Only list 0 is used on the GPU, use normal allocation for i>0 */
-        if (i == 0)
+        /* Only list 0 is used on the GPU, use normal allocation for i>0.
+         * With offloading all lists are used on the target.
+         */
+        if (i == 0 || offloadedKernelEnabled(nb_kernel_type))
         {
             nbnxn_init_pairlist(nbl_list->nbl[i], nbl_list->bSimple, alloc, free);
         }
@@ -2619,20 +3051,21 @@ static void print_nblist_statistics_simple(FILE *fp, const nbnxn_pairlist_t *nbl
     const nbnxn_grid_t *grid;
     int                 cs[SHIFTS];
     int                 s, i, j;
-    int                 npexcl;
+    int                 ncj, npexcl;
 
     /* This code only produces correct statistics with domain decomposition */
     grid = &nbs->grid[0];
 
+    ncj = nbnxn_pairlist_ncj(nbl);
     fprintf(fp, "nbl nci %d ncj %d\n",
-            nbl->nci, nbl->ncj);
+            nbl->nci, ncj);
     fprintf(fp, "nbl na_sc %d rl %g ncp %d per cell %.1f atoms %.1f ratio %.2f\n",
-            nbl->na_sc, rl, nbl->ncj, nbl->ncj/(double)grid->nc,
-            nbl->ncj/(double)grid->nc*grid->na_sc,
-            nbl->ncj/(double)grid->nc*grid->na_sc/(0.5*4.0/3.0*M_PI*rl*rl*rl*grid->nc*grid->na_sc/(grid->size[XX]*grid->size[YY]*grid->size[ZZ])));
+            nbl->na_sc, rl, ncj, ncj/(double)grid->nc,
+            ncj/(double)grid->nc*grid->na_sc,
+            ncj/(double)grid->nc*grid->na_sc/(0.5*4.0/3.0*M_PI*rl*rl*rl*grid->nc*grid->na_sc/(grid->size[XX]*grid->size[YY]*grid->size[ZZ])));
 
     fprintf(fp, "nbl average j cell list length %.1f\n",
-            0.25*nbl->ncj/(double)max(nbl->nci, 1));
+            0.25*ncj/(double)max(nbl->nci, 1));
 
     for (s = 0; s < SHIFTS; s++)
     {
@@ -2644,16 +3077,24 @@ static void print_nblist_statistics_simple(FILE *fp, const nbnxn_pairlist_t *nbl
         cs[nbl->ci[i].shift & NBNXN_CI_SHIFT] +=
             nbl->ci[i].cj_ind_end - nbl->ci[i].cj_ind_start;
 
-        j = nbl->ci[i].cj_ind_start;
-        while (j < nbl->ci[i].cj_ind_end &&
-               nbl->cj[j].excl != NBNXN_INTERACTION_MASK_ALL)
+        if (!nbl->bCompressed)
         {
-            npexcl++;
-            j++;
+            j = nbl->ci[i].cj_ind_start;
+            while (j < nbl->ci[i].cj_ind_end &&
+                   nbl->cj[j].excl != NBNXN_INTERACTION_MASK_ALL)
+            {
+                npexcl++;
+                j++;
+            }
         }
     }
+    if (nbl->bCompressed)
+    {
+        /* Only the masked j-clusters store a mask */
+        npexcl = nbl->ncjc_excl;
+    }
     fprintf(fp, "nbl cell pairs, total: %d excl: %d %.1f%%\n",
-            nbl->ncj, npexcl, 100*npexcl/(double)max(nbl->ncj, 1));
+            ncj, npexcl, 100*npexcl/(double)max(ncj, 1));
     for (s = 0; s < SHIFTS; s++)
     {
         if (cs[s] > 0)
@@ -3842,6 +4283,80 @@ static void nb_realloc_ci(nbnxn_pairlist_t *nbl, int n)
                        nbl->alloc, nbl->free);
 }
 
+void nbnxn_compress_ci_entry(nbnxn_pairlist_t *nbl)
+{
+    nbnxn_ci_t   *nbl_ci;
+    nbnxn_cic_t  *cic;
+    unsigned int  excl;
+    int           jlen, j, cj, cj_prev, d, w;
+
+    nbl_ci = &nbl->ci[nbl->nci];
+    jlen   = nbl_ci->cj_ind_end - nbl_ci->cj_ind_start;
+
+    /* A j-cluster takes at most three words and one mask */
+    if (nbl->nci + 1 > nbl->cic_nalloc)
+    {
+        nbl->cic_nalloc = over_alloc_small(nbl->nci + 1);
+        nbnxn_realloc_void((void **)&nbl->cic,
+                           nbl->nci*sizeof(*nbl->cic),
+                           nbl->cic_nalloc*sizeof(*nbl->cic),
+                           nbl->alloc, nbl->free);
+    }
+    if (nbl->ncjc + 3*jlen > nbl->cjc_nalloc)
+    {
+        nbl->cjc_nalloc = over_alloc_small(nbl->ncjc + 3*jlen);
+        nbnxn_realloc_void((void **)&nbl->cjc,
+                           nbl->ncjc*sizeof(*nbl->cjc),
+                           nbl->cjc_nalloc*sizeof(*nbl->cjc),
+                           nbl->alloc, nbl->free);
+    }
+    if (nbl->ncjc_excl + jlen > nbl->cjc_excl_nalloc)
+    {
+        nbl->cjc_excl_nalloc = over_alloc_small(nbl->ncjc_excl + jlen);
+        nbnxn_realloc_void((void **)&nbl->cjc_excl,
+                           nbl->ncjc_excl*sizeof(*nbl->cjc_excl),
+                           nbl->cjc_excl_nalloc*sizeof(*nbl->cjc_excl),
+                           nbl->alloc, nbl->free);
+    }
+
+    cic                 = &nbl->cic[nbl->nci];
+    cj_prev             = (jlen > 0 ? nbl->cj[nbl_ci->cj_ind_start].cj : 0);
+    cic->cj0            = cj_prev;
+    cic->cjc_ind_start  = nbl->ncjc;
+    cic->excl_ind_start = nbl->ncjc_excl;
+    for (j = nbl_ci->cj_ind_start; j < nbl_ci->cj_ind_end; j++)
+    {
+        cj   = nbl->cj[j].cj;
+        excl = nbl->cj[j].excl;
+        d    = cj - cj_prev;
+        w    = nbl->ncjc;
+        if (d >= 0 && d < NBNXN_CJC_ESCAPE)
+        {
+            nbl->cjc[nbl->ncjc++] = d;
+        }
+        else
+        {
+            nbl->cjc[nbl->ncjc++] = NBNXN_CJC_ESCAPE;
+            nbl->cjc[nbl->ncjc++] = (cj & 0xffff);
+            nbl->cjc[nbl->ncjc++] = (cj >> 16);
+        }
+        if (excl != NBNXN_INTERACTION_MASK_ALL)
+        {
+            nbl->cjc[w]                     |= NBNXN_CJC_EXCL;
+            nbl->cjc_excl[nbl->ncjc_excl++]  = excl;
+        }
+        cj_prev = cj;
+    }
+    cic->cjc_ind_end = nbl->ncjc;
+
+    /* The kernels and the flop counts use the ranges in the full j-list */
+    nbl_ci->cj_ind_start = (nbl->nci > 0 ? nbl->ci[nbl->nci - 1].cj_ind_end : 0);
+    nbl_ci->cj_ind_end   = nbl_ci->cj_ind_start + jlen;
+
+    /* The next i-entry is staged at the start of cj */
+    nbl->ncj = 0;
+}
+
 /* Reallocate the super-cell sci list for at least n entries */
 static void nb_realloc_sci(nbnxn_pairlist_t *nbl, int n)
 {
@@ -3921,6 +4436,32 @@ static void sort_cj_excl(nbnxn_cj_t *cj, int ncj,
     }
 }
 
+/* Sorts the j-clusters of ci entry nbl_ci on cluster index.
+ * With a non x-major column order the j-columns are not visited
+ * in storage order, so the j-clusters can be out of order.
+ */
+static void sort_cj_index(nbnxn_pairlist_t *nbl, const nbnxn_ci_t *nbl_ci)
+{
+    nbnxn_cj_t *cj, tmp;
+    int         ncj, i, j;
+
+    cj  = nbl->cj + nbl_ci->cj_ind_start;
+    ncj = nbl_ci->cj_ind_end - nbl_ci->cj_ind_start;
+
+    /* The list consists of a few sorted runs, insertion sort is fast */
+    for (i = 1; i < ncj; i++)
+    {
+        tmp = cj[i];
+        j   = i - 1;
+        while (j >= 0 && cj[j].cj > tmp.cj)
+        {
+            cj[j + 1] = cj[j];
+            j--;
+        }
+        cj[j + 1] = tmp;
+    }
+}
+
 /* Close this simple list i entry */
 static void close_ci_entry_simple(nbnxn_pairlist_t *nbl)
 {
@@ -3947,6 +4488,11 @@ static void close_ci_entry_simple(nbnxn_pairlist_t *nbl)
             nbl->work->ncj_hlj += jlen;
         }
 
+        if (nbl->bCompressed)
+        {
+            nbnxn_compress_ci_entry(nbl);
+        }
+
         nbl->nci++;
     }
 }
@@ -4110,11 +4656,31 @@ static void clear_pairlist(nbnxn_pairlist_t *nbl)
     nbl->ncj4          = 0;
     nbl->nci_tot       = 0;
     nbl->nexcl         = 1;
+    nbl->ncjc          = 0;
+    nbl->ncjc_excl     = 0;
 
     nbl->work->ncj_noq = 0;
     nbl->work->ncj_hlj = 0;
 }
 
+/* Lets the search of a pruned list write its j-list to the buffer
+ * of the outer list it replaces. nbnxn_set_outer_pairlists swaps
+ * the buffers back, so only the outer list takes the full j-list
+ * and cj only has to stage the i-entries of a compressed inner list.
+ */
+static void reuse_outer_cj(nbnxn_pairlist_t *nbl)
+{
+    nbnxn_cj_t *cj;
+    int         nalloc;
+
+    cj                   = nbl->cj_outer;
+    nbl->cj_outer        = nbl->cj;
+    nbl->cj              = cj;
+    nalloc               = nbl->cj_outer_nalloc;
+    nbl->cj_outer_nalloc = nbl->cj_nalloc;
+    nbl->cj_nalloc       = nalloc;
+}
+
 /* Clears a group scheme pair list */
 static void clear_pairlist_fep(t_nblist *nl)
 {
@@ -4465,7 +5031,8 @@ static void get_nsubpair_target(const nbnxn_search_t  nbs,
 /* Debug list print function */
 static void print_nblist_ci_cj(FILE *fp, const nbnxn_pairlist_t *nbl)
 {
-    int i, j;
+    unsigned int excl;
+    int          i, j, ind, excl_ind, cj;
 
     for (i = 0; i < nbl->nci; i++)
     {
@@ -4473,11 +5040,27 @@ static void print_nblist_ci_cj(FILE *fp, const nbnxn_pairlist_t *nbl)
                 nbl->ci[i].ci, nbl->ci[i].shift,
                 nbl->ci[i].cj_ind_end - nbl->ci[i].cj_ind_start);
 
-        for (j = nbl->ci[i].cj_ind_start; j < nbl->ci[i].cj_ind_end; j++)
+        if (nbl->bCompressed)
+        {
+            ind      = nbl->cic[i].cjc_ind_start;
+            excl_ind = nbl->cic[i].excl_ind_start;
+            cj       = nbl->cic[i].cj0;
+            while (ind < nbl->cic[i].cjc_ind_end)
+            {
+                excl = ((nbl->cjc[ind] & NBNXN_CJC_EXCL) ?
+                        nbl->cjc_excl[excl_ind++] : NBNXN_INTERACTION_MASK_ALL);
+                cj   = nbnxn_cjc_decode(nbl->cjc, &ind, cj);
+                fprintf(fp, "  cj %5d  imask %x\n", cj, excl);
+            }
+        }
+        else
         {
-            fprintf(fp, "  cj %5d  imask %x\n",
-                    nbl->cj[j].cj,
-                    nbl->cj[j].excl);
+            for (j = nbl->ci[i].cj_ind_start; j < nbl->ci[i].cj_ind_end; j++)
+            {
+                fprintf(fp, "  cj %5d  imask %x\n",
+                        nbl->cj[j].cj,
+                        nbl->cj[j].excl);
+            }
         }
     }
 }
@@ -4739,7 +5322,7 @@ static void balance_fep_lists(const nbnxn_search_t  nbs,
 static gmx_bool next_ci(const nbnxn_grid_t *grid,
                         int conv,
                         int nth, int ci_block,
-                        int *ci_x, int *ci_y,
+                        int *ci_xy,
                         int *ci_b, int *ci)
 {
     (*ci_b)++;
@@ -4757,14 +5340,9 @@ static gmx_bool next_ci(const nbnxn_grid_t *grid,
         return FALSE;
     }
 
-    while (*ci >= grid->cxy_ind[*ci_x*grid->ncy + *ci_y + 1]*conv)
+    while (*ci >= grid->cxy_ind[*ci_xy + 1]*conv)
     {
-        *ci_y += 1;
-        if (*ci_y == grid->ncy)
-        {
-            *ci_x += 1;
-            *ci_y  = 0;
-        }
+        (*ci_xy)++;
     }
 
     return TRUE;
@@ -4902,13 +5480,14 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
     real              bz1_frac;
     real              d2cx, d2z, d2z_cx, d2z_cy, d2zx, d2zxy, d2xy;
     int               cxf, cxl, cyf, cyf_x, cyl;
-    int               cx, cy;
+    int               cx, cy, cxy;
+    gmx_bool          bXMajor;
     int               c0, c1, cs, cf, cl;
     int               ndistc;
     int               ncpcheck;
     int               gridi_flag_shift = 0, gridj_flag_shift = 0;
     gmx_bitmask_t    *gridj_flag       = NULL;
-    int               ncj_old_i, ncj_old_j;
+    int               nci_old_i, ncj_old_j;
 
     nbs_cycle_start(&work->cc[enbsCCsearch]);
 
@@ -5046,16 +5625,24 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
      */
     ci_b = -1;
     ci   = th*ci_block - 1;
-    ci_x = 0;
-    ci_y = 0;
-    while (next_ci(gridi, conv_i, nth, ci_block, &ci_x, &ci_y, &ci_b, &ci))
+    ci_xy = 0;
+    /* With x-major column order we can skip half of the j-columns
+     * of the home grid based on the column x and y indices.
+     * With other orders we only use the cell index, which is slower.
+     */
+    bXMajor = (gridi->col_order == enbsColOrderXMajor);
+
+    while (next_ci(gridi, conv_i, nth, ci_block, &ci_xy, &ci_b, &ci))
     {
         if (nbl->bSimple && flags_i[ci] == 0)
         {
             continue;
         }
 
-        ncj_old_i = nbl->ncj;
+        ci_x = gridi->cxy_xy[ci_xy]/gridi->ncy;
+        ci_y = gridi->cxy_xy[ci_xy] - ci_x*gridi->ncy;
+
+        nci_old_i = nbl->nci;
 
         d2cx = 0;
         if (gridj != gridi && shp[XX] == 0)
@@ -5079,8 +5666,6 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
             }
         }
 
-        ci_xy = ci_x*gridi->ncy + ci_y;
-
         /* Loop over shift vectors in three dimensions */
         for (tz = -shp[ZZ]; tz <= shp[ZZ]; tz++)
         {
@@ -5196,9 +5781,9 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
                     }
 
 #ifndef NBNXN_SHIFT_BACKWARD
-                    if (cxf < ci_x)
+                    if (bXMajor && cxf < ci_x)
 #else
-                    if (shift == CENTRAL && gridi == gridj &&
+                    if (bXMajor && shift == CENTRAL && gridi == gridj &&
                         cxf < ci_x)
 #endif
                     {
@@ -5241,10 +5826,10 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
                         }
 
 #ifndef NBNXN_SHIFT_BACKWARD
-                        if (gridi == gridj &&
+                        if (bXMajor && gridi == gridj &&
                             cx == 0 && cyf < ci_y)
 #else
-                        if (gridi == gridj &&
+                        if (bXMajor && gridi == gridj &&
                             cx == 0 && shift == CENTRAL && cyf < ci_y)
 #endif
                         {
@@ -5260,8 +5845,9 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
 
                         for (cy = cyf_x; cy <= cyl; cy++)
                         {
-                            c0 = gridj->cxy_ind[cx*gridj->ncy+cy];
-                            c1 = gridj->cxy_ind[cx*gridj->ncy+cy+1];
+                            cxy = gridj->xy_cxy[cx*gridj->ncy+cy];
+                            c0  = gridj->cxy_ind[cxy];
+                            c1  = gridj->cxy_ind[cxy+1];
 #ifdef NBNXN_SHIFT_BACKWARD
                             if (gridi == gridj &&
                                 shift == CENTRAL && c0 < ci)
@@ -5424,6 +6010,11 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
                     /* Set the exclusions for this ci list */
                     if (nbl->bSimple)
                     {
+                        if (!bXMajor)
+                        {
+                            /* The exclusion search needs ascending cj */
+                            sort_cj_index(nbl, &(nbl->ci[nbl->nci]));
+                        }
                         set_ci_top_excls(nbs,
                                          nbl,
                                          shift == CENTRAL && gridi == gridj,
@@ -5476,7 +6067,7 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
             }
         }
 
-        if (bFBufferFlag && nbl->ncj > ncj_old_i)
+        if (bFBufferFlag && nbl->nci > nci_old_i)
         {
             bitmask_init_bit(&(work->buffer_flags.flag[(gridi->cell0+ci)>>gridi_flag_shift]), th);
         }
@@ -5747,6 +6338,13 @@ void nbnxn_make_pairlist(const nbnxn_search_t  nbs,
     {
         clear_pairlist(nbl[th]);
 
+        /* Lists that are pruned are compressed after pruning */
+        nbl[th]->bCompressed = (nbl_list->bCompressed && !nbl_list->bPrune);
+        if (nbl_list->bPrune)
+        {
+            reuse_outer_cj(nbl[th]);
+        }
+
         if (nbs->bFEP)
         {
             clear_pairlist_fep(nbl_list->nbl_fep[th]);
@@ -5833,7 +6431,7 @@ void nbnxn_make_pairlist(const nbnxn_search_t  nbs,
 
                 if (nbl_list->bSimple)
                 {
-                    np_tot += nbl[th]->ncj;
+                    np_tot += nbnxn_pairlist_ncj(nbl[th]);
                     np_noq += nbl[th]->work->ncj_noq;
                     np_hlj += nbl[th]->work->ncj_hlj;
                 }
@@ -5896,7 +6494,7 @@ void nbnxn_make_pairlist(const nbnxn_search_t  nbs,
         (!nbs->DomDec || (nbs->DomDec && !LOCAL_I(iloc))) &&
         nbs->search_count % 100 == 0)
     {
-        nbs_cycle_print(stderr, nbs);
+        nbs_cycle_print(stderr, nbs, nbl_list);
     }
 
     if (debug && (CombineNBLists && nnbl > 1))
@@ -62,6 +62,7 @@ gmx_bool nbnxn_kernel_pairlist_simple(int nb_kernel_type);
 real nbnxn_get_rlist_effective_inc(int cluster_size, real atom_density);
 
 /* Allocates and initializes a pair search data structure */
+gmx_offload
 void nbnxn_init_search(nbnxn_search_t    * nbs_ptr,
                        ivec               *n_dd_cells,
                        gmx_domdec_zones_t *zones,
@@ -113,12 +114,26 @@ void nbnxn_get_atomorder(nbnxn_search_t nbs, int **a, int *n);
 /* Renumber the atom indices on the grid to consecutive order */
 void nbnxn_set_atomorder(nbnxn_search_t nbs);
 
-/* Initializes a set of pair lists stored in nbnxn_pairlist_set_t */
+/* Initializes a set of pair lists stored in nbnxn_pairlist_set_t.
+ * With bWorkStealing the CPU kernels distribute the i-entries of the lists
+ * dynamically over the threads, which makes the force summation order
+ * vary between runs.
+ */
+gmx_offload
 void nbnxn_init_pairlist_set(nbnxn_pairlist_set_t *nbl_list,
                              gmx_bool simple, gmx_bool combined,
                              nbnxn_alloc_t *alloc,
                              nbnxn_free_t  *free,
-							 int nb_kernel_type);
+							 int nb_kernel_type,
+                             gmx_bool bWorkStealing);
+
+/* Appends the j-list of the i-entry being closed, nbl->ci[nbl->nci],
+ * which is staged in nbl->cj, to the compressed j-lists of nbl read by
+ * the SIMD kernels, see nbnxn_cic_t. The range of the i-entry is then
+ * set to its range in the full j-list and nbl->cj is emptied.
+ */
+gmx_offload
+void nbnxn_compress_ci_entry(nbnxn_pairlist_t *nbl);
 
 /* Make a apir-list with radius rlist, store it in nbl.
  * The parameter min_ci_balanced sets the minimum required
@@ -127,6 +142,7 @@ void nbnxn_init_pairlist_set(nbnxn_pairlist_set_t *nbl_list,
  * for the number of equally sized lists is below min_ci_balanced.
  * With perturbed particles, also a group scheme style nbl_fep list is made.
  */
+gmx_offload
 void nbnxn_make_pairlist(const nbnxn_search_t  nbs,
                          nbnxn_atomdata_t     *nbat,
                          const t_blocka       *excl,
@@ -157,9 +157,9 @@ make_cluster_list_simd_2xnn(const nbnxn_grid_t *gridj,
         else if (d2 < rl2)
         {
             int part;
-            for (part = 0; part < 2; part++)
+            for (part = 0; part < STRIDE_S/NBNXN_SEARCH_HPR_WIDTH; part++)
             {
-                xind_f  = X_IND_CJ_SIMD_2XNN(CI_TO_CJ_SIMD_2XNN(gridj->cell0) + cjf) + 4*part;
+                xind_f  = X_IND_CJ_SIMD_2XNN(CI_TO_CJ_SIMD_2XNN(gridj->cell0) + cjf) + part*NBNXN_SEARCH_HPR_WIDTH;
 
                 jx_S  = gmx_load_hpr_hilo_pr(x_j+xind_f+0*STRIDE_S);
                 jy_S  = gmx_load_hpr_hilo_pr(x_j+xind_f+1*STRIDE_S);
@@ -218,9 +218,9 @@ make_cluster_list_simd_2xnn(const nbnxn_grid_t *gridj,
         else if (d2 < rl2)
         {
             int part;
-            for (part = 0; part < 2; part++)
+            for (part = 0; part < STRIDE_S/NBNXN_SEARCH_HPR_WIDTH; part++)
             {
-                xind_l  = X_IND_CJ_SIMD_2XNN(CI_TO_CJ_SIMD_2XNN(gridj->cell0) + cjl) + 4*part;
+                xind_l  = X_IND_CJ_SIMD_2XNN(CI_TO_CJ_SIMD_2XNN(gridj->cell0) + cjl) + part*NBNXN_SEARCH_HPR_WIDTH;
 
                 jx_S  = gmx_load_hpr_hilo_pr(x_j+xind_l+0*STRIDE_S);
                 jy_S  = gmx_load_hpr_hilo_pr(x_j+xind_l+1*STRIDE_S);
@@ -52,7 +52,8 @@
  */
 #if (defined GMX_SIMD_X86_SSE2) || (defined GMX_SIMD_X86_SSE4_1) || \
     (defined GMX_SIMD_X86_AVX_128_FMA) || (defined GMX_SIMD_X86_AVX_256) || \
-    (defined GMX_SIMD_X86_AVX2_256) || (defined GMX_SIMD_IBM_QPX)
+    (defined GMX_SIMD_X86_AVX2_256) || (defined GMX_SIMD_X86_AVX_512F) || \
+    (defined GMX_SIMD_X86_AVX_512ER) || (defined GMX_SIMD_IBM_QPX)
 /* Use SIMD accelerated nbnxn search and kernels */
 #define GMX_NBNXN_SIMD
 #endif
@@ -67,7 +68,8 @@
 /* The nbnxn SIMD 4xN and 2x(N+N) kernels can be added independently.
  * Currently the 2xNN SIMD kernels only make sense with:
  *  8-way SIMD: 4x4 setup, works with AVX-256 in single precision
- * 16-way SIMD: 4x8 setup, works with Intel MIC in single precision
+ *              and AVX-512 in double precision
+ * 16-way SIMD: 4x8 setup, works with Intel MIC and AVX-512 in single precision
  */
 #if GMX_SIMD_REAL_WIDTH == 2 || GMX_SIMD_REAL_WIDTH == 4 || GMX_SIMD_REAL_WIDTH == 8
 #define GMX_NBNXN_SIMD_4XN
@@ -80,6 +82,16 @@
 #error "No SIMD kernel type defined"
 #endif
 
+/* In double precision with 256-bit AVX the 4xN kernels use a 4x4 setup,
+ * which is also the setup of the single precision 2xNN kernels.
+ * These can then compute the pair interactions in single precision
+ * on a float copy of the atom data, see nbnxn_atomdata_init_mixed().
+ */
+#if defined GMX_DOUBLE && defined GMX_NBNXN_SIMD_4XN && \
+    (defined GMX_SIMD_X86_AVX_256 || defined GMX_SIMD_X86_AVX2_256)
+#define GMX_NBNXN_SIMD_2XNN_MIXED
+#endif
+
 #endif /* GMX_NBNXN_SIMD */
 
 #endif /* _nbnxn_simd_h */
@@ -69,7 +69,10 @@ void packdata(void *packet, packet_buffer *buffers, int num_buffers)
         size_t ptr_offset = (size_t)(data_ptr - (char *)packet);
         memcpy(header_ptr, &ptr_offset, sizeof(size_t));
         header_ptr += sizeof(size_t);
-        memcpy(data_ptr, buffers[i].p, buffers[i].s);
+        if (buffers[i].p != NULL)
+        {
+            memcpy(data_ptr, buffers[i].p, buffers[i].s);
+        }
         data_ptr = roundup_ptr(data_ptr + buffers[i].s);
     }
 }
@@ -100,6 +103,17 @@ size_t compute_required_size(packet_buffer *buffers, int num_buffers)
     return size;
 }
 
+size_t compute_buffer_offset(packet_buffer *buffers, int num_buffers, int buffer_num)
+{
+    int    i;
+    size_t offset = roundup_size(compute_header_size(num_buffers));
+    for (i = 0; i < buffer_num; i++)
+    {
+        offset += roundup_size(buffers[i].s);
+    }
+    return offset;
+}
+
 packet_buffer get_buffer(void *packet, int buffer_num)
 {
     int           i;
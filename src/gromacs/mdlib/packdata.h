@@ -50,12 +50,17 @@ typedef struct packet_buffer_struct
 } packet_buffer;
 
 // Packet-level operations
+// A buffer with p NULL only reserves its space in the packet, to be
+// filled in later, e.g. through get_buffer.
 gmx_offload void packdata  (void *packet, packet_buffer *buffers, int num_buffers);
 
 gmx_offload void unpackdata(void *packet, void **buffers,         int num_buffers);
 
 gmx_offload size_t compute_required_size(packet_buffer *buffers,  int num_buffers);
 
+// The offset of the data of buffer_num in a packet packed from buffers
+gmx_offload size_t compute_buffer_offset(packet_buffer *buffers, int num_buffers, int buffer_num);
+
 gmx_offload packet_buffer get_buffer(void *packet, int buffer_num);
 
 // Buffer-level operations
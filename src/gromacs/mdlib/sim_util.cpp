@@ -79,9 +79,12 @@
 #include "gromacs/mdlib/nbnxn_gpu_data_mgmt.h"
 #include "gromacs/mdlib/nbnxn_search.h"
 #include "gromacs/mdlib/nb_verlet_simd_offload.h"
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_fep.h"
 #include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.h"
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_prune.h"
 #include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_ref.h"
 #include "gromacs/mdlib/nbnxn_kernels/simd_2xnn/nbnxn_kernel_simd_2xnn.h"
+#include "gromacs/mdlib/nbnxn_kernels/simd_2xnn_mixed/nbnxn_kernel_simd_2xnn_mixed.h"
 #include "gromacs/mdlib/nbnxn_kernels/simd_4xn/nbnxn_kernel_simd_4xn.h"
 #include "gromacs/pbcutil/ishift.h"
 #include "gromacs/pbcutil/mshift.h"
@@ -342,7 +345,8 @@ static void pull_potential_wrapper(t_commrec *cr,
 static void pme_receive_force_ener(t_commrec      *cr,
                                    gmx_wallcycle_t wcycle,
                                    gmx_enerdata_t *enerd,
-                                   t_forcerec     *fr)
+                                   t_forcerec     *fr,
+                                   rvec            f_mesh[])
 {
     real   e_q, e_lj, dvdl_q, dvdl_lj;
     float  cycles_ppdpme, cycles_seppme;
@@ -356,7 +360,7 @@ static void pme_receive_force_ener(t_commrec      *cr,
     wallcycle_start(wcycle, ewcPP_PMEWAITRECVF);
     dvdl_q  = 0;
     dvdl_lj = 0;
-    gmx_pme_receive_f(cr, fr->f_novirsum, fr->vir_el_recip, &e_q,
+    gmx_pme_receive_f(cr, f_mesh, fr->vir_el_recip, &e_q,
                       fr->vir_lj_recip, &e_lj, &dvdl_q, &dvdl_lj,
                       &cycles_seppme);
     enerd->term[F_COUL_RECIP] += e_q;
@@ -371,6 +375,69 @@ static void pme_receive_force_ener(t_commrec      *cr,
     wallcycle_stop(wcycle, ewcPP_PMEWAITRECVF);
 }
 
+static void pme_task_launch(t_commrec *cr, t_inputrec *ir, t_forcerec *fr,
+                            t_mdatoms *mdatoms, matrix box, rvec x[],
+                            real *lambda, int flags)
+{
+    matrix boxs;
+    int    pme_flags;
+
+    copy_mat(box, boxs);
+    if (ir->nwall == 2)
+    {
+        svmul(ir->wall_ewald_zfac, boxs[ZZ], boxs[ZZ]);
+    }
+
+    pme_flags = GMX_PME_SPREAD | GMX_PME_SOLVE;
+    if (EEL_PME(fr->eeltype))
+    {
+        pme_flags |= GMX_PME_DO_COULOMB;
+    }
+    if (EVDW_PME(fr->vdwtype))
+    {
+        pme_flags |= GMX_PME_DO_LJ;
+    }
+    if (flags & GMX_FORCE_FORCES)
+    {
+        pme_flags |= GMX_PME_CALC_F;
+    }
+    if (flags & GMX_FORCE_VIRIAL)
+    {
+        pme_flags |= GMX_PME_CALC_ENER_VIR;
+    }
+
+    gmx_pme_task_launch(fr->pme_task, fr->pmedata, cr,
+                        mdatoms->homenr, x,
+                        mdatoms->chargeA, mdatoms->chargeB,
+                        mdatoms->sqrt_c6A, mdatoms->sqrt_c6B,
+                        mdatoms->sigmaA, mdatoms->sigmaB,
+                        boxs, fr->ewaldcoeff_q, fr->ewaldcoeff_lj,
+                        lambda[efptCOUL], lambda[efptVDW], pme_flags);
+}
+
+static void pme_task_receive_force_ener(gmx_wallcycle_t wcycle,
+                                        gmx_enerdata_t *enerd,
+                                        t_forcerec     *fr,
+                                        t_nrnb         *nrnb,
+                                        rvec            f_mesh[])
+{
+    real e_q, e_lj, dvdl_q, dvdl_lj;
+
+    wallcycle_start(wcycle, ewcPP_PMEWAITRECVF);
+    e_q     = 0;
+    e_lj    = 0;
+    dvdl_q  = 0;
+    dvdl_lj = 0;
+    gmx_pme_task_receive_f(fr->pme_task, f_mesh, fr->vir_el_recip, &e_q,
+                           fr->vir_lj_recip, &e_lj, &dvdl_q, &dvdl_lj,
+                           nrnb);
+    enerd->term[F_COUL_RECIP] += e_q;
+    enerd->term[F_LJ_RECIP]   += e_lj;
+    enerd->dvdl_lin[efptCOUL] += dvdl_q;
+    enerd->dvdl_lin[efptVDW]  += dvdl_lj;
+    wallcycle_stop(wcycle, ewcPP_PMEWAITRECVF);
+}
+
 static void print_large_forces(FILE *fp, t_mdatoms *md, t_commrec *cr,
                                gmx_int64_t step, real pforce, rvec *x, rvec *f)
 {
@@ -454,6 +521,68 @@ static void post_process_forces(t_commrec *cr,
     }
 }
 
+/* With multiple time stepping of the mesh part the mesh forces are stored
+ * in fr->f_twin. They are added once to f here at steps where they are
+ * applied; update_coords adds the remaining nstcalcpme-1 impulse factors.
+ */
+static void post_process_mesh_forces(t_commrec *cr,
+                                     t_nrnb *nrnb, gmx_wallcycle_t wcycle,
+                                     gmx_localtop_t *top,
+                                     matrix box, rvec x[],
+                                     rvec f[],
+                                     t_mdatoms *mdatoms,
+                                     t_graph *graph,
+                                     t_forcerec *fr, gmx_vsite_t *vsite,
+                                     gmx_bool bApplyMesh,
+                                     int flags)
+{
+    if (vsite)
+    {
+        wallcycle_start(wcycle, ewcVSITESPREAD);
+        spread_vsite_f(vsite, x, fr->f_twin, NULL,
+                       (flags & GMX_FORCE_VIRIAL), fr->vir_el_recip,
+                       nrnb,
+                       &top->idef, fr->ePBC, fr->bMolPBC, graph, box, cr);
+        wallcycle_stop(wcycle, ewcVSITESPREAD);
+    }
+    if (bApplyMesh)
+    {
+        if (fr->bDomDec)
+        {
+            sum_forces(0, fr->f_novirsum_n, f, fr->f_twin);
+        }
+        else
+        {
+            sum_forces(0, mdatoms->homenr, f, fr->f_twin);
+        }
+    }
+}
+
+static void do_nb_verlet_prune(nonbonded_verlet_t        *nbv,
+                               const interaction_const_t *ic,
+                               const t_inputrec          *ir,
+                               int                        ilocality,
+                               gmx_bool                   bNewList,
+                               gmx_wallcycle_t            wcycle)
+{
+    nonbonded_verlet_group_t *nbvg = &nbv->grp[ilocality];
+    real                      rlist_inner;
+
+    /* PME tuning can shift the cut-off, the inner buffer stays the same */
+    rlist_inner = nbv->rlist_inner + ic->rlist - ir->rlist;
+
+    wallcycle_sub_start(wcycle, ewcsNONBONDED_PRUNING);
+    if (bNewList)
+    {
+        /* The search produced the outer list, keep it and prune from it */
+        nbnxn_set_outer_pairlists(&nbvg->nbl_lists);
+    }
+    nbnxn_kernel_cpu_prune(&nbvg->nbl_lists, nbvg->nbat,
+                           nbvg->nbat->shift_vec,
+                           rlist_inner, nbvg->kernel_type);
+    wallcycle_sub_stop(wcycle, ewcsNONBONDED_PRUNING);
+}
+
 static void do_nb_verlet(t_forcerec *fr,
                          interaction_const_t *ic,
                          gmx_enerdata_t *enerd,
@@ -502,22 +631,45 @@ static void do_nb_verlet(t_forcerec *fr,
             break;
 
         case nbnxnk4xN_SIMD_4xN:
-            nbnxn_kernel_simd_4xn(&nbvg->nbl_lists,
-                                  nbvg->nbat, ic,
-                                  nbvg->ewald_excl,
-                                  fr->shift_vec,
-                                  flags,
-                                  clearF,
-                                  fr->fshift[0],
-                                  enerd->grpp.ener[egCOULSR],
-                                  fr->bBHAM ?
-                                  enerd->grpp.ener[egBHAMSR] :
-                                  enerd->grpp.ener[egLJSR]);
+            if (offloadedKernelEnabled(nbvg->kernel_type))
+            {
+                nbnxn_kernel_simd_offload(fr, ic, enerd, flags, ilocality, clearF, nrnb,
+                                          wcycle);
+            }
+            else if (nbvg->nbat->mixed != NULL)
+            {
+                nbnxn_kernel_simd_2xnn_mixed(&nbvg->nbl_lists,
+                                             nbvg->nbat, ic,
+                                             nbvg->ewald_excl,
+                                             fr->shift_vec,
+                                             flags,
+                                             clearF,
+                                             fr->fshift[0],
+                                             enerd->grpp.ener[egCOULSR],
+                                             fr->bBHAM ?
+                                             enerd->grpp.ener[egBHAMSR] :
+                                             enerd->grpp.ener[egLJSR]);
+            }
+            else
+            {
+                nbnxn_kernel_simd_4xn(&nbvg->nbl_lists,
+                                      nbvg->nbat, ic,
+                                      nbvg->ewald_excl,
+                                      fr->shift_vec,
+                                      flags,
+                                      clearF,
+                                      fr->fshift[0],
+                                      enerd->grpp.ener[egCOULSR],
+                                      fr->bBHAM ?
+                                      enerd->grpp.ener[egBHAMSR] :
+                                      enerd->grpp.ener[egLJSR]);
+            }
             break;
         case nbnxnk4xN_SIMD_2xNN:
             if (offloadedKernelEnabled(nbvg->kernel_type))
             {
-                nbnxn_kernel_simd_2xnn_offload(fr, ic, enerd, flags, ilocality, clearF, nrnb);
+                nbnxn_kernel_simd_offload(fr, ic, enerd, flags, ilocality, clearF, nrnb,
+                                          wcycle);
             }
             else
             {
@@ -629,6 +781,7 @@ static void do_nb_verlet_fep(nbnxn_pairlist_set_t *nbl_lists,
     real             dvdl_nb[efptNR];
     int              th;
     int              i, j;
+    gmx_bool         bForeign;
 
     donb_flags = 0;
     /* Add short-range interactions */
@@ -667,12 +820,33 @@ static void do_nb_verlet_fep(nbnxn_pairlist_set_t *nbl_lists,
 
     assert(gmx_omp_nthreads_get(emntNonbonded) == nbl_lists->nnbl);
 
+    /* If we do foreign lambda and we have soft-core interactions
+     * we have to recalculate the (non-linear) energies contributions.
+     */
+    bForeign = (fepvals->n_lambda > 0 && (flags & GMX_FORCE_DHDL) && fepvals->sc_alpha != 0);
+
     wallcycle_sub_start(wcycle, ewcsNONBONDED);
+    if (fr->nbv->bUseFEPSimdKernel)
+    {
+        /* The SIMD kernel computes the foreign energies in the same pass */
 #pragma omp parallel for schedule(static) num_threads(nbl_lists->nnbl)
-    for (th = 0; th < nbl_lists->nnbl; th++)
+        for (th = 0; th < nbl_lists->nnbl; th++)
+        {
+            nbnxn_kernel_fep_simd(nbl_lists->nbl_fep[th],
+                                  x, f, fr, mdatoms, &kernel_data,
+                                  fepvals->n_lambda, fepvals->all_lambda,
+                                  bForeign ? enerd->enerpart_lambda : NULL,
+                                  nrnb);
+        }
+    }
+    else
     {
-        gmx_nb_free_energy_kernel(nbl_lists->nbl_fep[th],
-                                  x, f, fr, mdatoms, &kernel_data, nrnb);
+#pragma omp parallel for schedule(static) num_threads(nbl_lists->nnbl)
+        for (th = 0; th < nbl_lists->nnbl; th++)
+        {
+            gmx_nb_free_energy_kernel(nbl_lists->nbl_fep[th],
+                                      x, f, fr, mdatoms, &kernel_data, nrnb);
+        }
     }
 
     if (fepvals->sc_alpha != 0)
@@ -686,10 +860,7 @@ static void do_nb_verlet_fep(nbnxn_pairlist_set_t *nbl_lists,
         enerd->dvdl_lin[efptCOUL] += dvdl_nb[efptCOUL];
     }
 
-    /* If we do foreign lambda and we have soft-core interactions
-     * we have to recalculate the (non-linear) energies contributions.
-     */
-    if (fepvals->n_lambda > 0 && (flags & GMX_FORCE_DHDL) && fepvals->sc_alpha != 0)
+    if (bForeign && !fr->nbv->bUseFEPSimdKernel)
     {
         kernel_data.flags          = (donb_flags & ~(GMX_NONBONDED_DO_FORCE | GMX_NONBONDED_DO_SHIFTFORCE)) | GMX_NONBONDED_DO_FOREIGNLAMBDA;
         kernel_data.lambda         = lam_i;
@@ -745,8 +916,10 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
     int                 start, homenr;
     double              mu[2*DIM];
     gmx_bool            bStateChanged, bNS, bFillGrid, bCalcCGCM;
-    gmx_bool            bDoLongRange, bDoForces, bSepLRF, bUseGPU, bUseOrEmulGPU;
+    gmx_bool            bDoForces, bDoMesh, bApplyMesh, bSepLRF;
+    gmx_bool            bUseGPU, bUseOrEmulGPU;
     gmx_bool            bUseOffloadedKernel;
+    gmx_bool            bPrune;
     gmx_bool            bDiffKernels = FALSE;
     rvec                vzero, box_diag;
     float               cycles_pme, cycles_force, cycles_wait_gpu;
@@ -778,12 +951,28 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
     bNS           = (flags & GMX_FORCE_NS) && (fr->bAllvsAll == FALSE);
     bFillGrid     = (bNS && bStateChanged);
     bCalcCGCM     = (bFillGrid && !DOMAINDECOMP(cr));
-    bDoLongRange  = (fr->bTwinRange && bNS && (flags & GMX_FORCE_DO_LR));
     bDoForces     = (flags & GMX_FORCE_FORCES);
-    bSepLRF       = (bDoLongRange && bDoForces && (flags & GMX_FORCE_SEPLRF));
+    /* With multiple time stepping of the mesh part, the mesh forces are
+     * only applied at steps with GMX_FORCE_DO_LR set. At other steps
+     * the mesh part is only computed when energies, the virial or dH/dl
+     * are requested. The mesh forces are then stored separately in f_twin.
+     */
+    bApplyMesh    = (fr->nstcalcpme == 1 || (flags & GMX_FORCE_DO_LR));
+    bDoMesh       = (bApplyMesh ||
+                     (flags & (GMX_FORCE_ENERGY | GMX_FORCE_VIRIAL | GMX_FORCE_DHDL)));
+    bSepLRF       = (fr->nstcalcpme > 1 && bDoMesh && bDoForces);
     bUseGPU       = fr->nbv->bUseGPU;
     bUseOrEmulGPU = bUseGPU || (nbv->grp[0].kernel_type == nbnxnk8x8x8_PlainC);
     bUseOffloadedKernel = offloadedKernelEnabled(nbv->grp[0].kernel_type);
+    /* The CPU lists are pruned right after the search and then every
+     * nstlist_prune steps, as soon as the coordinates are in place.
+     */
+    bPrune        = (nbv->nstlist_prune > 0 &&
+                     (bNS || (step - nbv->search_step) % nbv->nstlist_prune == 0));
+    if (bNS)
+    {
+        nbv->search_step = step;
+    }
 
     if (bStateChanged)
     {
@@ -825,7 +1014,7 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
                                  fr->shift_vec, nbv->grp[0].nbat);
 
 #ifdef GMX_MPI
-    if (!(cr->duty & DUTY_PME))
+    if (!(cr->duty & DUTY_PME) && bDoMesh)
     {
         gmx_bool bBS;
         matrix   boxs;
@@ -866,6 +1055,14 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
     }
 #endif /* GMX_MPI */
 
+    if (fr->pme_task != NULL && bDoMesh)
+    {
+        /* Start the mesh part on the PME task thread, it runs concurrently
+         * with the rest of the force calculation and reads x in place.
+         */
+        pme_task_launch(cr, inputrec, fr, mdatoms, box, x, lambda, flags);
+    }
+
     /* do gridding for pair search */
     if (bNS)
     {
@@ -936,18 +1133,35 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
     /* do local pair search */
     if (bNS)
     {
-        setRefreshNblForOffload();
+        if (bUseOffloadedKernel)
+        {
+            setRefreshNblForOffload(nbv->offload);
+        }
         wallcycle_start_nocount(wcycle, ewcNS);
         wallcycle_sub_start(wcycle, ewcsNBS_SEARCH_LOCAL);
-        nbnxn_make_pairlist(nbv->nbs, nbv->grp[eintLocal].nbat,
-                            &top->excls,
-                            ic->rlist,
-                            nbv->min_ci_balanced,
-                            &nbv->grp[eintLocal].nbl_lists,
-                            eintLocal,
-                            nbv->grp[eintLocal].kernel_type,
-                            nrnb);
+        if (nbnxn_offload_search_on_target(nbv->offload))
+        {
+            /* The pair list is built by the local launch on the target */
+            nbnxn_offload_make_pairlist(nbv->offload, nbv->nbs, &top->excls,
+                                        ic->rlist, nbv->min_ci_balanced,
+                                        eintLocal);
+        }
+        else
+        {
+            nbnxn_make_pairlist(nbv->nbs, nbv->grp[eintLocal].nbat,
+                                &top->excls,
+                                ic->rlist,
+                                nbv->min_ci_balanced,
+                                &nbv->grp[eintLocal].nbl_lists,
+                                eintLocal,
+                                nbv->grp[eintLocal].kernel_type,
+                                nrnb);
+        }
         wallcycle_sub_stop(wcycle, ewcsNBS_SEARCH_LOCAL);
+        if (bPrune)
+        {
+            do_nb_verlet_prune(nbv, ic, inputrec, eintLocal, TRUE, wcycle);
+        }
 
         if (bUseGPU)
         {
@@ -966,6 +1180,11 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
                                         nbv->grp[eintLocal].nbat);
         wallcycle_sub_stop(wcycle, ewcsNB_X_BUF_OPS);
         wallcycle_stop(wcycle, ewcNB_XF_BUF_OPS);
+
+        if (bPrune)
+        {
+            do_nb_verlet_prune(nbv, ic, inputrec, eintLocal, FALSE, wcycle);
+        }
     }
 
     if (bUseGPU)
@@ -976,6 +1195,16 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
                      nrnb, wcycle);
         wallcycle_stop(wcycle, ewcLAUNCH_GPU_NB);
     }
+    else if (bUseOffloadedKernel)
+    {
+        /* launch local nonbonded F on the offload target, this overlaps
+         * with the halo communication and the rest of the force work
+         */
+        wallcycle_start(wcycle, ewcLAUNCH_OFFLOAD_NB);
+        do_nb_verlet(fr, ic, enerd, flags, eintLocal, enbvClearFYes,
+                     nrnb, wcycle);
+        wallcycle_stop(wcycle, ewcLAUNCH_OFFLOAD_NB);
+    }
 
     /* Communicate coordinates and sum dipole if necessary +
        do non-local pair search */
@@ -1009,16 +1238,29 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
                 nbnxn_grid_add_simple(nbv->nbs, nbv->grp[eintNonlocal].nbat);
             }
 
-            nbnxn_make_pairlist(nbv->nbs, nbv->grp[eintNonlocal].nbat,
-                                &top->excls,
-                                ic->rlist,
-                                nbv->min_ci_balanced,
-                                &nbv->grp[eintNonlocal].nbl_lists,
-                                eintNonlocal,
-                                nbv->grp[eintNonlocal].kernel_type,
-                                nrnb);
+            if (nbnxn_offload_search_on_target(nbv->offload))
+            {
+                nbnxn_offload_make_pairlist(nbv->offload, nbv->nbs, &top->excls,
+                                            ic->rlist, nbv->min_ci_balanced,
+                                            eintNonlocal);
+            }
+            else
+            {
+                nbnxn_make_pairlist(nbv->nbs, nbv->grp[eintNonlocal].nbat,
+                                    &top->excls,
+                                    ic->rlist,
+                                    nbv->min_ci_balanced,
+                                    &nbv->grp[eintNonlocal].nbl_lists,
+                                    eintNonlocal,
+                                    nbv->grp[eintNonlocal].kernel_type,
+                                    nrnb);
+            }
 
             wallcycle_sub_stop(wcycle, ewcsNBS_SEARCH_NONLOCAL);
+            if (bPrune)
+            {
+                do_nb_verlet_prune(nbv, ic, inputrec, eintNonlocal, TRUE, wcycle);
+            }
 
             if (nbv->grp[eintNonlocal].kernel_type == nbnxnk8x8x8_GPU)
             {
@@ -1047,6 +1289,11 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
                                             nbv->grp[eintNonlocal].nbat);
             wallcycle_sub_stop(wcycle, ewcsNB_X_BUF_OPS);
             cycles_force += wallcycle_stop(wcycle, ewcNB_XF_BUF_OPS);
+
+            if (bPrune)
+            {
+                do_nb_verlet_prune(nbv, ic, inputrec, eintNonlocal, FALSE, wcycle);
+            }
         }
 
         if (bUseGPU && !bDiffKernels)
@@ -1057,6 +1304,16 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
                          nrnb, wcycle);
             cycles_force += wallcycle_stop(wcycle, ewcLAUNCH_GPU_NB);
         }
+        else if (bUseOffloadedKernel)
+        {
+            /* launch non-local nonbonded F on the offload target, it runs
+             * after the local work and accumulates in the same buffers
+             */
+            wallcycle_start(wcycle, ewcLAUNCH_OFFLOAD_NB);
+            do_nb_verlet(fr, ic, enerd, flags, eintNonlocal, enbvClearFNo,
+                         nrnb, wcycle);
+            cycles_force += wallcycle_stop(wcycle, ewcLAUNCH_OFFLOAD_NB);
+        }
     }
 
     if (bUseGPU)
@@ -1108,7 +1365,10 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
 
     if (DOMAINDECOMP(cr) && !(cr->duty & DUTY_PME))
     {
-        wallcycle_start(wcycle, ewcPPDURINGPME);
+        if (bDoMesh)
+        {
+            wallcycle_start(wcycle, ewcPPDURINGPME);
+        }
         dd_force_flop_start(cr->dd, nrnb);
     }
 
@@ -1156,9 +1416,9 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
             }
         }
 
-        /* Clear the short- and long-range forces */
+        /* Clear the short-range and mesh forces */
         clear_rvecs(fr->natoms_force_constr, f);
-        if (bSepLRF && do_per_step(step, inputrec->nstcalclr))
+        if (bSepLRF)
         {
             clear_rvecs(fr->natoms_force_constr, fr->f_twin);
         }
@@ -1209,12 +1469,6 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
         }
     }
 
-    if (bUseOffloadedKernel)
-    {
-        /* Maybe we should move this into do_force_lowlevel */
-        do_nb_verlet(fr, ic, enerd, flags, eintLocal, enbvClearFYes, nrnb, wcycle);
-    }
-
     if ((!bUseOrEmulGPU || bDiffKernels) && !bUseOffloadedKernel)
     {
         int aloc;
@@ -1269,22 +1523,12 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
     /* Compute the bonded and non-bonded energies and optionally forces */
     do_force_lowlevel(fr, inputrec, &(top->idef),
                       cr, nrnb, wcycle, mdatoms,
-                      x, hist, f, bSepLRF ? fr->f_twin : f, enerd, fcd, top, fr->born,
+                      x, hist, f, bSepLRF ? fr->f_twin : fr->f_novirsum,
+                      enerd, fcd, top, fr->born,
                       bBornRadii, box,
                       inputrec->fepvals, lambda, graph, &(top->excls), fr->mu_tot,
-                      flags, &cycles_pme);
-
-    if (bSepLRF)
-    {
-        if (do_per_step(step, inputrec->nstcalclr))
-        {
-            /* Add the long range forces to the short range forces */
-            for (i = 0; i < fr->natoms_force_constr; i++)
-            {
-                rvec_add(fr->f_twin[i], f[i], f[i]);
-            }
-        }
-    }
+                      bDoMesh ? (flags | GMX_FORCE_DO_LR) : (flags & ~GMX_FORCE_DO_LR),
+                      &cycles_pme);
 
     cycles_force += wallcycle_stop(wcycle, ewcFORCE);
 
@@ -1332,6 +1576,45 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
         }
     }
 
+    if (bUseOffloadedKernel && (flags & GMX_FORCE_NONBONDED))
+    {
+        /* The host threads compute their share of the pair lists
+         * while the target works on the rest.
+         */
+        wallcycle_start_nocount(wcycle, ewcFORCE);
+        wallcycle_sub_start(wcycle, ewcsNONBONDED);
+        nbnxn_offload_do_host_share(fr, ic, enerd, flags, eintLocal, enbvClearFYes);
+        if (DOMAINDECOMP(cr))
+        {
+            nbnxn_offload_do_host_share(fr, ic, enerd, flags, eintNonlocal, enbvClearFNo);
+        }
+        wallcycle_sub_stop(wcycle, ewcsNONBONDED);
+        cycles_force += wallcycle_stop(wcycle, ewcFORCE);
+
+        /* The launches run in order on the target, with domain decomposition
+         * the non-local one returns the forces of both localities, which we
+         * need before communicating the forces.
+         */
+        wait_for_offload(nbv->offload, eintLocal, wcycle);
+        if (DOMAINDECOMP(cr))
+        {
+            wait_for_offload(nbv->offload, eintNonlocal, wcycle);
+        }
+        nbnxn_offload_add_f(fr, f, wcycle);
+
+        wallcycle_start(wcycle, ewcNB_XF_BUF_OPS);
+        wallcycle_sub_start(wcycle, ewcsNB_F_BUF_OPS);
+        for (j = 0; j < DIM * SHIFTS; j++)
+        {
+            ((real *)fr->fshift)[j] += fr->nbv->grp[eintLocal].nbat->out[0].fshift[j];
+        }
+        nbnxn_offload_add_host_share_f(fr, flags, f);
+        wallcycle_sub_stop(wcycle, ewcsNB_F_BUF_OPS);
+        wallcycle_stop(wcycle, ewcNB_XF_BUF_OPS);
+
+        nbnxn_offload_step_done(nbv->offload, step);
+    }
+
     if (bDoForces && DOMAINDECOMP(cr))
     {
         if (bUseGPU)
@@ -1347,13 +1630,6 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
         /* Communicate the forces */
         wallcycle_start(wcycle, ewcMOVEF);
         dd_move_f(cr->dd, f, fr->fshift);
-        if (bSepLRF)
-        {
-            /* We should not update the shift forces here,
-             * since f_twin is already included in f.
-             */
-            dd_move_f(cr->dd, fr->f_twin, NULL);
-        }
         wallcycle_stop(wcycle, ewcMOVEF);
     }
 
@@ -1434,22 +1710,6 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
         wallcycle_stop(wcycle, ewcNB_XF_BUF_OPS);
     }
 
-    if (bUseOffloadedKernel)
-    {
-        wait_for_offload();
-        wallcycle_start(wcycle, ewcNB_XF_BUF_OPS);
-        wallcycle_sub_start(wcycle, ewcsNB_F_BUF_OPS);
-        nbnxn_atomdata_add_nbat_f_to_f_final(fr->nbv->nbs, eatAll,
-                                             fr->nbv->grp[eintLocal].nbat, f,
-                                             gmx_omp_nthreads_get(emntDefault));
-        for (j = 0; j < DIM * SHIFTS; j++)
-        {
-            ((real *)fr->fshift)[j] += fr->nbv->grp[eintLocal].nbat->out[0].fshift[j];
-        }
-        wallcycle_sub_stop(wcycle, ewcsNB_F_BUF_OPS);
-        wallcycle_stop(wcycle, ewcNB_XF_BUF_OPS);
-    }
-
     if (DOMAINDECOMP(cr))
     {
         dd_force_flop_stop(cr->dd, nrnb);
@@ -1482,15 +1742,6 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
             spread_vsite_f(vsite, x, f, fr->fshift, FALSE, NULL, nrnb,
                            &top->idef, fr->ePBC, fr->bMolPBC, graph, box, cr);
             wallcycle_stop(wcycle, ewcVSITESPREAD);
-
-            if (bSepLRF)
-            {
-                wallcycle_start(wcycle, ewcVSITESPREAD);
-                spread_vsite_f(vsite, x, fr->f_twin, NULL, FALSE, NULL,
-                               nrnb,
-                               &top->idef, fr->ePBC, fr->bMolPBC, graph, box, cr);
-                wallcycle_stop(wcycle, ewcVSITESPREAD);
-            }
         }
 
         if (flags & GMX_FORCE_VIRIAL)
@@ -1522,12 +1773,26 @@ void do_force_cutsVERLET(FILE *fplog, t_commrec *cr,
     /* Add forces from interactive molecular dynamics (IMD), if bIMD == TRUE. */
     IMD_apply_forces(inputrec->bIMD, inputrec->imd, cr, f, wcycle);
 
-    if (PAR(cr) && !(cr->duty & DUTY_PME))
+    if (PAR(cr) && !(cr->duty & DUTY_PME) && bDoMesh)
     {
         /* In case of node-splitting, the PP nodes receive the long-range
          * forces, virial and energy from the PME nodes here.
          */
-        pme_receive_force_ener(cr, wcycle, enerd, fr);
+        pme_receive_force_ener(cr, wcycle, enerd, fr,
+                               bSepLRF ? fr->f_twin : fr->f_novirsum);
+    }
+
+    if (fr->pme_task != NULL && bDoMesh)
+    {
+        /* Wait for the PME task thread and add its forces */
+        pme_task_receive_force_ener(wcycle, enerd, fr, nrnb,
+                                    bSepLRF ? fr->f_twin : fr->f_novirsum);
+    }
+
+    if (bSepLRF)
+    {
+        post_process_mesh_forces(cr, nrnb, wcycle, top, box, x, f,
+                                 mdatoms, graph, fr, vsite, bApplyMesh, flags);
     }
 
     if (bDoForces)
@@ -1988,7 +2253,7 @@ void do_force_cutsGROUP(FILE *fplog, t_commrec *cr,
         /* In case of node-splitting, the PP nodes receive the long-range
          * forces, virial and energy from the PME nodes here.
          */
-        pme_receive_force_ener(cr, wcycle, enerd, fr);
+        pme_receive_force_ener(cr, wcycle, enerd, fr, fr->f_novirsum);
     }
 
     if (bDoForces)
@@ -2668,10 +2933,11 @@ void finish_run(FILE *fplog, t_commrec *cr,
 
     if (SIMMASTER(cr))
     {
-        struct gmx_wallclock_gpu_t* gputimes = use_GPU(nbv) ? nbnxn_gpu_get_timings(nbv->gpu_nbv) : NULL;
+        struct gmx_wallclock_gpu_t    * gputimes     = use_GPU(nbv) ? nbnxn_gpu_get_timings(nbv->gpu_nbv) : NULL;
+        struct gmx_wallclock_offload_t* offloadtimes = (nbv != NULL) ? nbnxn_offload_get_timings(nbv->offload) : NULL;
         wallcycle_print(fplog, cr->nnodes, cr->npmenodes,
                         elapsed_time_over_all_ranks,
-                        wcycle, gputimes);
+                        wcycle, gputimes, offloadtimes);
 
         if (EI_DYNAMICS(inputrec->eI))
         {
@@ -0,0 +1,201 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests for the dynamic pruning of the non-bonded pair lists.
+ *
+ * \ingroup module_mdlib
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/legacyheaders/gmx_omp_nthreads.h"
+#include "gromacs/legacyheaders/nrnb.h"
+#include "gromacs/legacyheaders/types/forcerec.h"
+#include "gromacs/math/vec.h"
+#include "gromacs/mdlib/nb_verlet.h"
+#include "gromacs/mdlib/nbnxn_atomdata.h"
+#include "gromacs/mdlib/nbnxn_search.h"
+#include "gromacs/mdlib/nbnxn_simd.h"
+#include "gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_prune.h"
+#include "gromacs/pbcutil/ishift.h"
+#include "gromacs/pbcutil/pbc.h"
+#include "gromacs/random/random.h"
+#include "gromacs/utility/smalloc.h"
+
+namespace
+{
+
+#ifdef GMX_NBNXN_SIMD_4XN
+
+//! The number of atoms in the test system
+const int  c_numAtoms   = 1000;
+//! The edge of the cubic box, which gives roughly the atom density of water
+const real c_boxSize    = 2.2;
+//! The radius of the outer list, as built by the search
+const real c_rlistOuter = 1.0;
+//! The radius of the inner list, as pruned from the outer list
+const real c_rlistInner = 0.9;
+
+/*! \brief
+ * Checks that the reference and the 4xN SIMD prune kernels
+ * give the same inner list.
+ *
+ * The list is built for the 4xN SIMD kernels from random coordinates
+ * and pruned once with each prune kernel. The reference prune kernel
+ * handles any list layout and is selected with the plain-C kernel type.
+ */
+TEST(NbnxnPruneTest, SimdKernelGivesReferenceList)
+{
+    gmx_omp_nthreads_set(emntNonbonded, 1);
+    gmx_omp_nthreads_set(emntPairsearch, 1);
+
+    matrix                 box;
+    rvec                   corner0, corner1;
+    rvec                   shift_vec[SHIFTS];
+    std::vector<gmx::RVec> x(c_numAtoms);
+    std::vector<int>       atinfo(c_numAtoms, 0);
+    gmx_rng_t              rng = gmx_rng_init(1993);
+
+    clear_mat(box);
+    clear_rvec(corner0);
+    for (int d = 0; d < DIM; d++)
+    {
+        box[d][d]  = c_boxSize;
+        corner1[d] = c_boxSize;
+    }
+    calc_shifts(box, shift_vec);
+    for (int i = 0; i < c_numAtoms; i++)
+    {
+        for (int d = 0; d < DIM; d++)
+        {
+            x[i][d] = c_boxSize*gmx_rng_uniform_real(rng);
+        }
+        SET_CGINFO_HAS_VDW(atinfo[i]);
+        SET_CGINFO_HAS_Q(atinfo[i]);
+    }
+    gmx_rng_destroy(rng);
+
+    /* Each atom only excludes itself */
+    std::vector<atom_id> exclIndex(c_numAtoms + 1);
+    std::vector<atom_id> exclAtoms(c_numAtoms);
+    t_blocka             excl;
+    for (int i = 0; i < c_numAtoms; i++)
+    {
+        exclIndex[i] = i;
+        exclAtoms[i] = i;
+    }
+    exclIndex[c_numAtoms] = c_numAtoms;
+    excl.nr               = c_numAtoms;
+    excl.index            = &exclIndex[0];
+    excl.nra              = c_numAtoms;
+    excl.a                = &exclAtoms[0];
+
+    const int             kernelType = nbnxnk4xN_SIMD_4xN;
+    const real            nbfp[2]    = { 1e-3, 1e-6 };
+    nbnxn_search_t        nbs;
+    nbnxn_atomdata_t     *nbat;
+    nbnxn_pairlist_set_t  nbl_list;
+    t_nrnb                nrnb;
+
+    nbnxn_init_search(&nbs, NULL, NULL, FALSE, 1);
+    snew(nbat, 1);
+    nbnxn_atomdata_init(NULL, nbat, kernelType, enbnxninitcombruleNONE,
+                        1, nbfp, 1, 1, NULL, NULL);
+    nbnxn_init_pairlist_set(&nbl_list, TRUE, FALSE, NULL, NULL, kernelType, FALSE);
+    nbl_list.bPrune = TRUE;
+    init_nrnb(&nrnb);
+
+    nbnxn_put_on_grid(nbs, epbcXYZ, box, 0, corner0, corner1,
+                      0, c_numAtoms, -1, &atinfo[0], as_rvec_array(&x[0]),
+                      0, NULL, kernelType, nbat);
+    nbnxn_make_pairlist(nbs, nbat, &excl, c_rlistOuter, 0, &nbl_list,
+                        eintLocal, kernelType, &nrnb);
+    nbnxn_set_outer_pairlists(&nbl_list);
+
+    const nbnxn_pairlist_t *nbl = nbl_list.nbl[0];
+
+    nbnxn_kernel_cpu_prune(&nbl_list, nbat, shift_vec, c_rlistInner,
+                           nbnxnk4x4_PlainC);
+
+    /* Pruning should remove part of the list, but not all of it */
+    ASSERT_GT(nbnxn_pairlist_ncj(nbl), 0);
+    ASSERT_LT(nbnxn_pairlist_ncj(nbl), nbl->ncj_outer);
+
+    std::vector<nbnxn_ci_t>     refCi(nbl->ci, nbl->ci + nbl->nci);
+    std::vector<nbnxn_cic_t>    refCic(nbl->cic, nbl->cic + nbl->nci);
+    std::vector<unsigned short> refCjc(nbl->cjc, nbl->cjc + nbl->ncjc);
+    std::vector<unsigned int>   refExcl(nbl->cjc_excl,
+                                        nbl->cjc_excl + nbl->ncjc_excl);
+
+    nbnxn_kernel_cpu_prune(&nbl_list, nbat, shift_vec, c_rlistInner,
+                           kernelType);
+
+    ASSERT_EQ(refCi.size(), static_cast<size_t>(nbl->nci));
+    for (int i = 0; i < nbl->nci; i++)
+    {
+        EXPECT_EQ(refCi[i].ci, nbl->ci[i].ci) << "in i-entry " << i;
+        EXPECT_EQ(refCi[i].shift, nbl->ci[i].shift) << "in i-entry " << i;
+        EXPECT_EQ(refCi[i].cj_ind_start, nbl->ci[i].cj_ind_start) << "in i-entry " << i;
+        EXPECT_EQ(refCi[i].cj_ind_end, nbl->ci[i].cj_ind_end) << "in i-entry " << i;
+        EXPECT_EQ(refCic[i].cj0, nbl->cic[i].cj0) << "in i-entry " << i;
+        EXPECT_EQ(refCic[i].cjc_ind_start, nbl->cic[i].cjc_ind_start) << "in i-entry " << i;
+        EXPECT_EQ(refCic[i].cjc_ind_end, nbl->cic[i].cjc_ind_end) << "in i-entry " << i;
+        EXPECT_EQ(refCic[i].excl_ind_start, nbl->cic[i].excl_ind_start) << "in i-entry " << i;
+    }
+    /* The inner list is only stored in compressed form, the full
+     * j-list buffer only has to hold one i-entry.
+     */
+    EXPECT_LT(nbl->cj_nalloc, nbl->ncj_outer);
+    ASSERT_EQ(refCjc.size(), static_cast<size_t>(nbl->ncjc));
+    for (int j = 0; j < nbl->ncjc; j++)
+    {
+        EXPECT_EQ(refCjc[j], nbl->cjc[j]) << "in compressed j-list word " << j;
+    }
+    ASSERT_EQ(refExcl.size(), static_cast<size_t>(nbl->ncjc_excl));
+    for (int j = 0; j < nbl->ncjc_excl; j++)
+    {
+        EXPECT_EQ(refExcl[j], nbl->cjc_excl[j]) << "in exclusion mask " << j;
+    }
+}
+
+#endif
+
+} // namespace
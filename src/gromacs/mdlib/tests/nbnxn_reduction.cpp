@@ -0,0 +1,305 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests for the reduction of the non-bonded thread force buffers.
+ *
+ * \ingroup module_mdlib
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/legacyheaders/gmx_omp_nthreads.h"
+#include "gromacs/legacyheaders/nrnb.h"
+#include "gromacs/legacyheaders/types/forcerec.h"
+#include "gromacs/math/vec.h"
+#include "gromacs/mdlib/nb_verlet.h"
+#include "gromacs/mdlib/nbnxn_atomdata.h"
+#include "gromacs/mdlib/nbnxn_consts.h"
+#include "gromacs/mdlib/nbnxn_search.h"
+#include "gromacs/mdlib/nbnxn_simd.h"
+#include "gromacs/pbcutil/pbc.h"
+#include "gromacs/random/random.h"
+#include "gromacs/utility/smalloc.h"
+
+#include "testutils/testasserts.h"
+
+namespace
+{
+
+//! The number of atoms in the test system
+const int  c_numAtoms   = 1000;
+//! The edge of the cubic box, large enough that a thread list does not cover all atoms
+const real c_boxSize    = 3.0;
+//! The pair-list radius
+const real c_rlist      = 0.9;
+//! The number of thread output buffers
+const int  c_numThreads = 3;
+
+//! Returns the index of component \p d of grid atom \p i in a force buffer of \p nbat
+int forceIndex(const nbnxn_atomdata_t *nbat, int i, int d)
+{
+    switch (nbat->FFormat)
+    {
+        case nbatX4:
+            return X4_IND_A(i) + d*PACK_X4;
+        case nbatX8:
+            return X8_IND_A(i) + d*PACK_X8;
+        default:
+            return i*nbat->fstride + d;
+    }
+}
+
+/*! \brief
+ * Returns the sum of the thread force buffers of \p nbat
+ *
+ * The flagged buffers of each block are summed in the order of the
+ * buffers, as the reduction into buffer 0 does.
+ */
+std::vector<real> reduceForces(const nbnxn_atomdata_t *nbat)
+{
+    std::vector<real> fReduced(nbat->natoms*nbat->fstride, 0);
+
+    for (int i = 0; i < nbat->natoms; i++)
+    {
+        gmx_bitmask_t flag = nbat->buffer_flags.flag[i/NBNXN_BUFFERFLAG_SIZE];
+
+        for (int d = 0; d < DIM; d++)
+        {
+            int  j    = forceIndex(nbat, i, d);
+            bool bSet = false;
+            for (int out = 0; out < nbat->nout; out++)
+            {
+                if (bitmask_is_set(flag, out))
+                {
+                    fReduced[j] = (bSet ? fReduced[j] + nbat->out[out].f[j] : nbat->out[out].f[j]);
+                    bSet        = true;
+                }
+            }
+        }
+    }
+
+    return fReduced;
+}
+
+//! Adds \p fReduced, in the grid order of \p nbat, to \p f through the grid to atom index \p a
+void addReducedForces(const nbnxn_atomdata_t *nbat, const int *a,
+                      const std::vector<real> &fReduced,
+                      std::vector<gmx::RVec> *f)
+{
+    for (int i = 0; i < nbat->natoms; i++)
+    {
+        if (a[i] >= 0)
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                (*f)[a[i]][d] += fReduced[forceIndex(nbat, i, d)];
+            }
+        }
+    }
+}
+
+/*! \brief
+ * Checks that the fused and the tree reduction of three thread force
+ * buffers give bitwise the same forces as reducing before scattering.
+ *
+ * The pair list with one list per thread sets the buffer flags for
+ * random coordinates, the buffers are filled with random forces.
+ */
+void checkReduction(int kernelType)
+{
+    gmx_omp_nthreads_set(emntNonbonded, c_numThreads);
+    gmx_omp_nthreads_set(emntPairsearch, c_numThreads);
+
+    matrix                 box;
+    rvec                   corner0, corner1;
+    std::vector<gmx::RVec> x(c_numAtoms);
+    std::vector<int>       atinfo(c_numAtoms, 0);
+    gmx_rng_t              rng = gmx_rng_init(1993);
+
+    clear_mat(box);
+    clear_rvec(corner0);
+    for (int d = 0; d < DIM; d++)
+    {
+        box[d][d]  = c_boxSize;
+        corner1[d] = c_boxSize;
+    }
+    for (int i = 0; i < c_numAtoms; i++)
+    {
+        for (int d = 0; d < DIM; d++)
+        {
+            x[i][d] = c_boxSize*gmx_rng_uniform_real(rng);
+        }
+        SET_CGINFO_HAS_VDW(atinfo[i]);
+        SET_CGINFO_HAS_Q(atinfo[i]);
+    }
+
+    /* Each atom only excludes itself */
+    std::vector<atom_id> exclIndex(c_numAtoms + 1);
+    std::vector<atom_id> exclAtoms(c_numAtoms);
+    t_blocka             excl;
+    for (int i = 0; i < c_numAtoms; i++)
+    {
+        exclIndex[i] = i;
+        exclAtoms[i] = i;
+    }
+    exclIndex[c_numAtoms] = c_numAtoms;
+    excl.nr               = c_numAtoms;
+    excl.index            = &exclIndex[0];
+    excl.nra              = c_numAtoms;
+    excl.a                = &exclAtoms[0];
+
+    const real            nbfp[2] = { 1e-3, 1e-6 };
+    nbnxn_search_t        nbs;
+    nbnxn_atomdata_t     *nbat;
+    nbnxn_pairlist_set_t  nbl_list;
+    t_nrnb                nrnb;
+
+    nbnxn_init_search(&nbs, NULL, NULL, FALSE, c_numThreads);
+    snew(nbat, 1);
+    nbnxn_atomdata_init(NULL, nbat, kernelType, enbnxninitcombruleNONE,
+                        1, nbfp, 1, c_numThreads, NULL, NULL);
+    nbnxn_init_pairlist_set(&nbl_list, TRUE, FALSE, NULL, NULL, kernelType, FALSE);
+    init_nrnb(&nrnb);
+
+    nbnxn_put_on_grid(nbs, epbcXYZ, box, 0, corner0, corner1,
+                      0, c_numAtoms, -1, &atinfo[0], as_rvec_array(&x[0]),
+                      0, NULL, kernelType, nbat);
+    nbnxn_make_pairlist(nbs, nbat, &excl, c_rlist, 0, &nbl_list,
+                        eintLocal, kernelType, &nrnb);
+
+    /* All buffers should contribute to some blocks, but not to all */
+    int numBlocksWithAll = 0;
+    for (int b = 0; b < nbat->buffer_flags.nflag; b++)
+    {
+        bool bAll = true;
+        for (int out = 0; out < nbat->nout; out++)
+        {
+            bAll = bAll && bitmask_is_set(nbat->buffer_flags.flag[b], out);
+        }
+        if (bAll)
+        {
+            numBlocksWithAll++;
+        }
+    }
+    ASSERT_GT(numBlocksWithAll, 0);
+    ASSERT_LT(numBlocksWithAll, nbat->buffer_flags.nflag);
+
+    for (int out = 0; out < nbat->nout; out++)
+    {
+        for (int j = 0; j < nbat->natoms*nbat->fstride; j++)
+        {
+            nbat->out[out].f[j] = gmx_rng_uniform_real(rng) - 0.5;
+        }
+    }
+    std::vector<gmx::RVec> fInitial(c_numAtoms);
+    for (int i = 0; i < c_numAtoms; i++)
+    {
+        for (int d = 0; d < DIM; d++)
+        {
+            fInitial[i][d] = gmx_rng_uniform_real(rng) - 0.5;
+        }
+    }
+    gmx_rng_destroy(rng);
+
+    int *a, na;
+    nbnxn_get_atomorder(nbs, &a, &na);
+
+    /* The reference reduces before scattering to f, as before the fusion */
+    std::vector<real>      fReduced = reduceForces(nbat);
+    std::vector<gmx::RVec> fReference(fInitial);
+    addReducedForces(nbat, a, fReduced, &fReference);
+
+    /* The fused reduction leaves the thread buffers intact */
+    nbat->bUseTreeReduce = FALSE;
+    std::vector<gmx::RVec> fFused(fInitial);
+    nbnxn_atomdata_add_nbat_f_to_f(nbs, eatAll, nbat, as_rvec_array(&fFused[0]));
+
+    /* With three buffers the tree reduction sums in the same order.
+     * It reduces into buffer 0, which shows that it was used.
+     */
+    nbat->bUseTreeReduce = TRUE;
+    std::vector<gmx::RVec> fTree(fInitial);
+    nbnxn_atomdata_add_nbat_f_to_f(nbs, eatAll, nbat, as_rvec_array(&fTree[0]));
+    for (int i = 0; i < nbat->natoms; i++)
+    {
+        gmx_bitmask_t flag = nbat->buffer_flags.flag[i/NBNXN_BUFFERFLAG_SIZE];
+
+        if (bitmask_is_set(flag, 1) || bitmask_is_set(flag, 2))
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                int j = forceIndex(nbat, i, d);
+                EXPECT_REAL_EQ_TOL(fReduced[j], nbat->out[0].f[j], gmx::test::ulpTolerance(0))
+                << "tree reduction into buffer 0, grid atom " << i << " dim " << d;
+            }
+        }
+    }
+
+    for (int i = 0; i < c_numAtoms; i++)
+    {
+        for (int d = 0; d < DIM; d++)
+        {
+            EXPECT_REAL_EQ_TOL(fReference[i][d], fFused[i][d], gmx::test::ulpTolerance(0))
+            << "fused reduction, atom " << i << " dim " << d;
+            EXPECT_REAL_EQ_TOL(fReference[i][d], fTree[i][d], gmx::test::ulpTolerance(0))
+            << "tree reduction, atom " << i << " dim " << d;
+        }
+    }
+
+    gmx_omp_nthreads_set(emntNonbonded, 1);
+    gmx_omp_nthreads_set(emntPairsearch, 1);
+}
+
+//! The plain-C kernel layout, with x, y, z and q interleaved
+TEST(NbnxnReductionTest, FusedGivesUnfusedForcesPlainC)
+{
+    checkReduction(nbnxnk4x4_PlainC);
+}
+
+#ifdef GMX_NBNXN_SIMD_4XN
+//! The 4xN SIMD kernel layout, with packed x, y and z
+TEST(NbnxnReductionTest, FusedGivesUnfusedForcesSimd4xN)
+{
+    checkReduction(nbnxnk4xN_SIMD_4xN);
+}
+#endif
+
+} // namespace
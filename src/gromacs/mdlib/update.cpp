@@ -107,6 +107,9 @@ typedef struct gmx_update
     /* xprime for constraint algorithms */
     rvec         *xp;
     int           xp_nalloc;
+    /* Combined forces for multiple time stepping */
+    rvec         *f_mts;
+    int           f_mts_nalloc;
 
     /* Variables for the deform algorithm */
     gmx_int64_t     deformref_step;
@@ -561,8 +564,10 @@ gmx_update_t init_update(t_inputrec *ir)
         upd->sd    = init_stochd(ir);
     }
 
-    upd->xp        = NULL;
-    upd->xp_nalloc = 0;
+    upd->xp           = NULL;
+    upd->xp_nalloc    = 0;
+    upd->f_mts        = NULL;
+    upd->f_mts_nalloc = 0;
 
     return upd;
 }
@@ -1431,17 +1436,17 @@ static rvec *get_xprime(const t_state *state, gmx_update_t upd)
     return upd->xp;
 }
 
-static void combine_forces(gmx_update_t upd,
-                           int nstcalclr,
-                           gmx_constr_t constr,
-                           t_inputrec *ir, t_mdatoms *md, t_idef *idef,
-                           t_commrec *cr,
-                           gmx_int64_t step,
-                           t_state *state, gmx_bool bMolPBC,
-                           int start, int nrend,
-                           rvec f[], rvec f_lr[],
-                           tensor *vir_lr_constr,
-                           t_nrnb *nrnb)
+static rvec *combine_forces(gmx_update_t upd,
+                            int nstcalclr,
+                            gmx_constr_t constr,
+                            t_inputrec *ir, t_mdatoms *md, t_idef *idef,
+                            t_commrec *cr,
+                            gmx_int64_t step,
+                            t_state *state, gmx_bool bMolPBC,
+                            int start, int nrend,
+                            rvec f[], rvec f_lr[],
+                            tensor *vir_lr_constr,
+                            t_nrnb *nrnb)
 {
     int  i, d;
 
@@ -1449,7 +1454,7 @@ static void combine_forces(gmx_update_t upd,
      * which are stored separately in f_lr.
      */
 
-    if (constr != NULL && vir_lr_constr != NULL &&
+    if (constr != NULL && vir_lr_constr != NULL && !EI_VV(ir->eI) &&
         !(ir->eConstrAlg == econtSHAKE && ir->epc == epcNO))
     {
         /* We need to constrain the LR forces separately,
@@ -1492,16 +1497,25 @@ static void combine_forces(gmx_update_t upd,
                   NULL, vir_lr_constr, nrnb, econqForce);
     }
 
+    if (state->nalloc > upd->f_mts_nalloc)
+    {
+        upd->f_mts_nalloc = state->nalloc;
+        srenew(upd->f_mts, upd->f_mts_nalloc);
+    }
+
     /* Add nstcalclr-1 times the LR force to the sum of both forces
-     * and store the result in forces_lr.
+     * and store the result in upd->f_mts. We do not overwrite f_lr,
+     * since the velocity Verlet integrators combine twice per step.
      */
     for (i = start; i < nrend; i++)
     {
         for (d = 0; d < DIM; d++)
         {
-            f_lr[i][d] = f[i][d] + (nstcalclr - 1)*f_lr[i][d];
+            upd->f_mts[i][d] = f[i][d] + (nstcalclr - 1)*f_lr[i][d];
         }
     }
+
+    return upd->f_mts;
 }
 
 void update_constraints(FILE             *fplog,
@@ -1882,6 +1896,7 @@ void update_coords(FILE             *fplog,
     int               start, homenr, nrend;
     rvec             *xprime;
     int               nth, th;
+    int               nstlr;
 
     bDoConstr = (NULL != constr);
 
@@ -1914,18 +1929,27 @@ void update_coords(FILE             *fplog,
     bNH = inputrec->etc == etcNOSEHOOVER;
     bPR = ((inputrec->epc == epcPARRINELLORAHMAN) || (inputrec->epc == epcMTTK));
 
-    if (bDoLR && inputrec->nstcalclr > 1 && !EI_VV(inputrec->eI))  /* get this working with VV? */
+    /* The long-range forces are the twin-range forces with the group scheme
+     * and the PME/Ewald mesh forces with the Verlet scheme.
+     */
+    nstlr = (inputrec->cutoff_scheme == ecutsVERLET ? inputrec->nstcalcpme : inputrec->nstcalclr);
+
+    /* Twin-range multiple time stepping is rejected by grompp with VV,
+     * so with VV we get here only for the mesh forces. The position
+     * half of VV does not use the forces.
+     */
+    if (bDoLR && nstlr > 1 &&
+        !(EI_VV(inputrec->eI) && UpdatePart == etrtPOSITION))
     {
-        /* Store the total force + nstcalclr-1 times the LR force
-         * in forces_lr, so it can be used in a normal update algorithm
+        /* Store the total force + nstlr-1 times the LR force
+         * in upd->f_mts, so it can be used in a normal update algorithm
          * to produce twin time stepping.
          */
         /* is this correct in the new construction? MRS */
-        combine_forces(upd,
-                       inputrec->nstcalclr, constr, inputrec, md, idef, cr,
-                       step, state, bMolPBC,
-                       start, nrend, f, f_lr, vir_lr_constr, nrnb);
-        force = f_lr;
+        force = combine_forces(upd,
+                               nstlr, constr, inputrec, md, idef, cr,
+                               step, state, bMolPBC,
+                               start, nrend, f, f_lr, vir_lr_constr, nrnb);
     }
     else
     {
@@ -410,7 +410,7 @@ gmx_simd_set_exponent_d_x86_avx_512f(__m512d a)
     const __m512i expbias      = _mm512_set1_epi32(1023);
     __m512i       iexp         = _mm512_castsi256_si512(gmx_simd_cvt_d2i(a));
 
-    iexp = _mm512_permutevar_epi32(_mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0), iexp);
+    iexp = _mm512_permutexvar_epi32(_mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0), iexp);
     iexp = _mm512_mask_slli_epi32(_mm512_setzero_epi32(), _mm512_int2mask(0xAAAA), _mm512_add_epi32(iexp, expbias), 20);
     return _mm512_castsi512_pd(iexp);
 }
@@ -429,15 +429,15 @@ gmx_simd_reduce_d_x86_avx_512f(__m512d a)
 static gmx_inline void
 gmx_simd_cvt_f2dd_x86_avx_512f(__m512 f, __m512d * d0, __m512d * d1)
 {
-    *d0 = _mm512_cvtpslo_pd(f);
-    *d1 = _mm512_cvtpslo_pd(_mm512_shuffle_f32x4(f, f, _MM_PERM_DCDC));
+    *d0 = _mm512_cvtps_pd(_mm512_castps512_ps256(f));
+    *d1 = _mm512_cvtps_pd(_mm512_castps512_ps256(_mm512_shuffle_f32x4(f, f, _MM_PERM_DCDC)));
 }
 
 static gmx_inline __m512
 gmx_simd_cvt_dd2f_x86_avx_512f(__m512d d0, __m512d d1)
 {
-    __m512 f0 = _mm512_cvtpd_pslo(d0);
-    __m512 f1 = _mm512_cvtpd_pslo(d1);
+    __m512 f0 = _mm512_castps256_ps512(_mm512_cvtpd_ps(d0));
+    __m512 f1 = _mm512_castps256_ps512(_mm512_cvtpd_ps(d1));
     return _mm512_shuffle_f32x4(f0, f1, _MM_PERM_BABA);
 }
 
@@ -46,6 +46,7 @@
 #include "gromacs/legacyheaders/types/commrec.h"
 #include "gromacs/timing/cyclecounter.h"
 #include "gromacs/timing/gpu_timing.h"
+#include "gromacs/timing/offload_timing.h"
 #include "gromacs/utility/cstringutil.h"
 #include "gromacs/utility/gmxassert.h"
 #include "gromacs/utility/gmxmpi.h"
@@ -94,6 +95,8 @@ typedef struct gmx_wallcycle
     wallcc_t         *wcsc;
 #endif
     double           *cycles_sum;
+    /* The counters of the PME task thread, NULL without the task */
+    struct gmx_wallcycle *wc_pme_task;
 } gmx_wallcycle_t_t;
 
 /* Each name should not exceed 19 printing characters
@@ -102,9 +105,9 @@ static const char *wcn[ewcNR] =
 {
     "Run", "Step", "PP during PME", "Domain decomp.", "DD comm. load",
     "DD comm. bounds", "Vsite constr.", "Send X to PME", "Neighbor search", "Launch GPU ops.",
-    "Comm. coord.", "Born radii", "Force", "Wait + Comm. F", "PME mesh",
+    "Launch offload NB", "Comm. coord.", "Born radii", "Force", "Wait + Comm. F", "PME mesh",
     "PME redist. X/F", "PME spread/gather", "PME 3D-FFT", "PME 3D-FFT Comm.", "PME solve LJ", "PME solve Elec",
-    "PME wait for PP", "Wait + Recv. PME F", "Wait GPU nonlocal", "Wait GPU local", "Wait GPU loc. est.", "NB X/F buffer ops.",
+    "PME wait for PP", "Wait + Recv. PME F", "Wait GPU nonlocal", "Wait GPU local", "Wait GPU loc. est.", "Wait offload NB", "NB X/F buffer ops.",
     "Vsite spread", "COM pull force",
     "Write traj.", "Update", "Constraints", "Comm. energies",
     "Enforced rotation", "Add rot. forces", "Coordinate swapping", "IMD", "Test"
@@ -121,9 +124,12 @@ static const char *wcsn[ewcsNR] =
     "Restraints F",
     "Listed buffer ops.",
     "Nonbonded F",
+    "Nonbonded pruning",
     "Ewald F correction",
     "NB X buffer ops.",
     "NB F buffer ops.",
+    "Offload pack",
+    "Offload unpack",
 };
 #endif
 
@@ -153,6 +159,7 @@ gmx_wallcycle_t wallcycle_init(FILE *fplog, int resetstep, t_commrec gmx_unused
     wc->nthreads_pp         = nthreads_pp;
     wc->nthreads_pme        = nthreads_pme;
     wc->cycles_sum          = NULL;
+    wc->wc_pme_task         = NULL;
 
 #ifdef GMX_MPI
     if (PAR(cr) && getenv("GMX_CYCLE_BARRIER") != NULL)
@@ -187,6 +194,41 @@ gmx_wallcycle_t wallcycle_init(FILE *fplog, int resetstep, t_commrec gmx_unused
     return wc;
 }
 
+gmx_wallcycle_t wallcycle_init_pme_task(gmx_wallcycle_t wc)
+{
+    gmx_wallcycle_t wc_task;
+
+    if (wc == NULL)
+    {
+        return NULL;
+    }
+
+    /* The task thread only uses the PME counters. No barriers or
+     * timing of all code, as these would interfere with the PP thread.
+     */
+    snew(wc_task, 1);
+    wc_task->wc_barrier     = FALSE;
+    wc_task->wcc_all        = NULL;
+    wc_task->wc_depth       = 0;
+    wc_task->ewc_prev       = -1;
+    wc_task->reset_counters = wc->reset_counters;
+    wc_task->nthreads_pp    = wc->nthreads_pp;
+    wc_task->nthreads_pme   = wc->nthreads_pme;
+    wc_task->cycles_sum     = NULL;
+    wc_task->wc_pme_task    = NULL;
+    snew(wc_task->wcc, ewcNR);
+#ifdef GMX_CYCLE_SUBCOUNTERS
+    snew(wc_task->wcsc, ewcsNR);
+#endif
+#ifdef DEBUG_WCYCLE
+    wc_task->count_depth = 0;
+#endif
+
+    wc->wc_pme_task = wc_task;
+
+    return wc_task;
+}
+
 void wallcycle_destroy(gmx_wallcycle_t wc)
 {
     if (wc == NULL)
@@ -194,6 +236,8 @@ void wallcycle_destroy(gmx_wallcycle_t wc)
         return;
     }
 
+    wallcycle_destroy(wc->wc_pme_task);
+
     if (wc->wcc != NULL)
     {
         sfree(wc->wcc);
@@ -378,6 +422,9 @@ void wallcycle_reset_all(gmx_wallcycle_t wc)
         wc->wcsc[i].c = 0;
     }
 #endif
+
+    /* The task thread is idle when the counters are reset */
+    wallcycle_reset_all(wc->wc_pme_task);
 }
 
 static gmx_bool is_pme_counter(int ewc)
@@ -428,6 +475,18 @@ void wallcycle_sum(t_commrec *cr, gmx_wallcycle_t wc)
     wcc[ewcWAIT_GPU_NB_L_EST].n = 0;
     wcc[ewcWAIT_GPU_NB_L_EST].c = 0;
 
+    if (wc->wc_pme_task != NULL)
+    {
+        /* The PME mesh part was timed on the task thread */
+        for (i = 0; i < ewcNR; i++)
+        {
+            if (is_pme_counter(i))
+            {
+                wcc[i] = wc->wc_pme_task->wcc[i];
+            }
+        }
+    }
+
     for (i = 0; i < ewcNR; i++)
     {
         if (is_pme_counter(i) || (i == ewcRUN && cr->duty == DUTY_PME))
@@ -463,8 +522,13 @@ void wallcycle_sum(t_commrec *cr, gmx_wallcycle_t wc)
 
     if (cr->npmenodes == 0)
     {
-        /* All nodes do PME (or no PME at all) */
-        subtract_cycles(wcc, ewcFORCE, ewcPMEMESH);
+        /* All nodes do PME (or no PME at all). The PME task thread
+         * runs the mesh part concurrently with, not within, Force.
+         */
+        if (wc->wc_pme_task == NULL)
+        {
+            subtract_cycles(wcc, ewcFORCE, ewcPMEMESH);
+        }
     }
     else
     {
@@ -653,7 +717,8 @@ static void print_header(FILE *fplog, int nrank_pp, int nth_pp, int nrank_pme, i
 }
 
 void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
-                     gmx_wallcycle_t wc, struct gmx_wallclock_gpu_t *gpu_t)
+                     gmx_wallcycle_t wc, struct gmx_wallclock_gpu_t *gpu_t,
+                     struct gmx_wallclock_offload_t *offload_t)
 {
     double     *cyc_sum;
     double      tot, tot_for_pp, tot_for_rest, tot_gpu, tot_cpu_overlap, gpu_cpu_ratio, tot_k;
@@ -709,6 +774,11 @@ void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
     {
         c2t_pme = c2t * nth_tot / static_cast<double>(npme*nth_pme);
     }
+    else if (wc->wc_pme_task != NULL)
+    {
+        /* The task threads are not part of nth_tot */
+        c2t_pme = c2t * nth_tot / static_cast<double>(npp*nth_pme);
+    }
     else
     {
         c2t_pme = 0;
@@ -725,16 +795,17 @@ void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
         {
             /* Do not count these at all */
         }
-        else if (npme > 0 && is_pme_counter(i))
+        else if ((npme > 0 || wc->wc_pme_task != NULL) && is_pme_counter(i))
         {
-            /* Print timing information for PME-only nodes, but add an
-             * asterisk so the reader of the table can know that the
-             * walltimes are not meant to add up. The asterisk still
-             * fits in the required maximum of 19 characters. */
+            /* Print timing information for PME-only nodes or the PME
+             * task thread, but add an asterisk so the reader of the
+             * table can know that the walltimes are not meant to add
+             * up. The asterisk still fits in the required maximum of
+             * 19 characters. */
             char buffer[STRLEN];
             snprintf(buffer, STRLEN, "%s *", wcn[i]);
             print_cycles(fplog, c2t_pme, buffer,
-                         npme, nth_pme,
+                         npme > 0 ? npme : npp, nth_pme,
                          wc->wcc[i].n, cyc_sum[i], tot);
         }
         else
@@ -779,6 +850,14 @@ void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
                 "    twice the total reported, but the cycle count total and %% are correct.\n"
                 "%s\n", hline);
     }
+    else if (wc->wc_pme_task != NULL)
+    {
+        fprintf(fplog,
+                "(*) Note that the PME mesh part ran on a task thread concurrently with\n"
+                "    the PP work, its time overlaps with the other rows and is not part\n"
+                "    of the total.\n"
+                "%s\n", hline);
+    }
 
     if (wc->wcc[ewcPMEMESH].n > 0)
     {
@@ -788,7 +867,7 @@ void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
         {
             if (is_pme_subcounter(i))
             {
-                print_cycles(fplog, npme > 0 ? c2t_pme : c2t_pp, wcn[i],
+                print_cycles(fplog, c2t_pme > 0 ? c2t_pme : c2t_pp, wcn[i],
                              npme > 0 ? npme : npp, nth_pme,
                              wc->wcc[i].n, cyc_sum[i], tot);
             }
@@ -911,6 +990,30 @@ void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
         }
     }
 
+    /* print offload target timing summary */
+    if (offload_t && offload_t->nb_c > 0)
+    {
+        double tot_offload;
+
+        tot_offload = (offload_t->xfer_in_t + offload_t->kernel_t +
+                       offload_t->reduce_t + offload_t->xfer_out_t);
+
+        fprintf(fplog, "\n Offload target timings\n%s\n", hline);
+        fprintf(fplog, " Computing:                         Count  Wall t (s)      ms/step       %c\n", '%');
+        fprintf(fplog, "%s\n", hline);
+        print_gputimes(fplog, "Transfer in",
+                       offload_t->nb_c, offload_t->xfer_in_t, tot_offload);
+        print_gputimes(fplog, "Nonbonded F kernel",
+                       offload_t->nb_c, offload_t->kernel_t, tot_offload);
+        print_gputimes(fplog, "Nonbonded F reduction",
+                       offload_t->nb_c, offload_t->reduce_t, tot_offload);
+        print_gputimes(fplog, "Transfer out",
+                       offload_t->nb_c, offload_t->xfer_out_t, tot_offload);
+        fprintf(fplog, "%s\n", hline);
+        print_gputimes(fplog, "Total ", offload_t->nb_c, tot_offload, tot_offload);
+        fprintf(fplog, "%s\n", hline);
+    }
+
     if (wc->wc_barrier)
     {
         md_print_warn(NULL, fplog,
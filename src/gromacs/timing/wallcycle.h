@@ -51,13 +51,14 @@ extern "C" {
 
 typedef struct gmx_wallcycle *gmx_wallcycle_t;
 struct gmx_wallclock_gpu_t;
+struct gmx_wallclock_offload_t;
 
 enum {
     ewcRUN, ewcSTEP, ewcPPDURINGPME, ewcDOMDEC, ewcDDCOMMLOAD,
     ewcDDCOMMBOUND, ewcVSITECONSTR, ewcPP_PMESENDX, ewcNS, ewcLAUNCH_GPU_NB,
-    ewcMOVEX, ewcGB, ewcFORCE, ewcMOVEF, ewcPMEMESH,
+    ewcLAUNCH_OFFLOAD_NB, ewcMOVEX, ewcGB, ewcFORCE, ewcMOVEF, ewcPMEMESH,
     ewcPME_REDISTXF, ewcPME_SPREADGATHER, ewcPME_FFT, ewcPME_FFTCOMM, ewcLJPME, ewcPME_SOLVE,
-    ewcPMEWAITCOMM, ewcPP_PMEWAITRECVF, ewcWAIT_GPU_NB_NL, ewcWAIT_GPU_NB_L, ewcWAIT_GPU_NB_L_EST, ewcNB_XF_BUF_OPS,
+    ewcPMEWAITCOMM, ewcPP_PMEWAITRECVF, ewcWAIT_GPU_NB_NL, ewcWAIT_GPU_NB_L, ewcWAIT_GPU_NB_L_EST, ewcWAIT_OFFLOAD_NB, ewcNB_XF_BUF_OPS,
     ewcVSITESPREAD, ewcPULLPOT,
     ewcTRAJ, ewcUPDATE, ewcCONSTR, ewcMoveE, ewcROT, ewcROTadd, ewcSWAP, ewcIMD,
     ewcTEST, ewcNR
@@ -74,9 +75,12 @@ enum {
     ewcsRESTRAINTS,
     ewcsLISTED_BUF_OPS,
     ewcsNONBONDED,
+    ewcsNONBONDED_PRUNING,
     ewcsEWALD_CORRECTION,
     ewcsNB_X_BUF_OPS,
     ewcsNB_F_BUF_OPS,
+    ewcsOFFLOAD_PACK,
+    ewcsOFFLOAD_UNPACK,
     ewcsNR
 };
 
@@ -89,6 +93,13 @@ gmx_wallcycle_t wallcycle_init(FILE *fplog, int resetstep, t_commrec *cr,
  * Returns NULL when cycle counting is not supported.
  */
 
+gmx_wallcycle_t wallcycle_init_pme_task(gmx_wallcycle_t wc);
+/* Returns separate counters for a PME task thread, which runs the PME
+ * mesh part concurrently with the PP work timed with wc.
+ * These are owned, reset and summed with wc.
+ * Returns NULL when wc is NULL.
+ */
+
 void wallcycle_start(gmx_wallcycle_t wc, int ewc);
 /* Starts the cycle counter (and increases the call count) */
 
@@ -108,8 +119,9 @@ void wallcycle_sum(t_commrec *cr, gmx_wallcycle_t wc);
 /* Sum the cycles over the nodes in cr->mpi_comm_mysim */
 
 void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
-                     gmx_wallcycle_t wc, struct gmx_wallclock_gpu_t *gpu_t);
-/* Print the cycle and time accounting */
+                     gmx_wallcycle_t wc, struct gmx_wallclock_gpu_t *gpu_t,
+                     struct gmx_wallclock_offload_t *offload_t);
+/* Print the cycle and time accounting, gpu_t and offload_t can be NULL */
 
 gmx_int64_t wcycle_get_reset_counters(gmx_wallcycle_t wc);
 /* Return reset_counters from wc struct */
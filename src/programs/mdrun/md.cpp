@@ -95,6 +95,7 @@
 #include "gromacs/mdlib/compute_io.h"
 #include "gromacs/mdlib/mdrun_signalling.h"
 #include "gromacs/mdlib/nb_verlet.h"
+#include "gromacs/mdlib/nb_verlet_simd_offload.h"
 #include "gromacs/mdlib/nbnxn_gpu_data_mgmt.h"
 #include "gromacs/pbcutil/mshift.h"
 #include "gromacs/pbcutil/pbc.h"
@@ -137,6 +138,10 @@ static void reset_all_counters(FILE *fplog, t_commrec *cr,
     {
         nbnxn_gpu_reset_timings(nbv);
     }
+    if (nbv != NULL && nbv->offload != NULL)
+    {
+        nbnxn_offload_reset_timings(nbv->offload);
+    }
 
     wallcycle_stop(wcycle, ewcRUN);
     wallcycle_reset_all(wcycle);
@@ -469,10 +474,12 @@ double do_md(FILE *fplog, t_commrec *cr, int nfile, const t_filenm fnm[],
     }
 
     /* PME tuning is only supported with PME for Coulomb. Is is not supported
-     * with only LJ PME, or for reruns.
+     * with only LJ PME, or for reruns. With the Verlet scheme it is also
+     * not supported with user tables, as the Ewald part is tabulated.
      */
     bPMETune = ((Flags & MD_TUNEPME) && EEL_PME(fr->eeltype) && !bRerunMD &&
-                !(Flags & MD_REPRODUCIBLE));
+                !(Flags & MD_REPRODUCIBLE) &&
+                !(fr->cutoff_scheme == ecutsVERLET && fr->vdwtype == evdwUSER));
     if (bPMETune)
     {
         pme_loadbal_init(&pme_loadbal, cr, fplog, ir, state->box,
@@ -1047,6 +1054,14 @@ double do_md(FILE *fplog, t_commrec *cr, int nfile, const t_filenm fnm[],
                 force_flags |= GMX_FORCE_DO_LR;
             }
         }
+        if (fr->nstcalcpme > 1)
+        {
+            /* With a rerun we want all forces for every frame */
+            if (bRerunMD || do_per_step(step, fr->nstcalcpme))
+            {
+                force_flags |= GMX_FORCE_DO_LR;
+            }
+        }
 
         if (shellfc)
         {
@@ -1115,7 +1130,7 @@ double do_md(FILE *fplog, t_commrec *cr, int nfile, const t_filenm fnm[],
              * branch, because VV integrators did not ever support
              * twin-range multiple time stepping with constraints.
              */
-            bUpdateDoLR = (fr->bTwinRange && do_per_step(step, ir->nstcalclr));
+            bUpdateDoLR = (force_flags & GMX_FORCE_DO_LR);
 
             update_coords(fplog, step, ir, mdatoms, state, fr->bMolPBC,
                           f, bUpdateDoLR, fr->f_twin, bCalcVir ? &fr->vir_twin_constr : NULL, fcd,
@@ -1403,7 +1418,7 @@ double do_md(FILE *fplog, t_commrec *cr, int nfile, const t_filenm fnm[],
 
             if (bVV)
             {
-                bUpdateDoLR = (fr->bTwinRange && do_per_step(step, ir->nstcalclr));
+                bUpdateDoLR = (force_flags & GMX_FORCE_DO_LR);
 
                 /* velocity half-step update */
                 update_coords(fplog, step, ir, mdatoms, state, fr->bMolPBC, f,
@@ -1427,7 +1442,7 @@ double do_md(FILE *fplog, t_commrec *cr, int nfile, const t_filenm fnm[],
                 }
                 copy_rvecn(state->x, cbuf, 0, state->natoms);
             }
-            bUpdateDoLR = (fr->bTwinRange && do_per_step(step, ir->nstcalclr));
+            bUpdateDoLR = (force_flags & GMX_FORCE_DO_LR);
 
             update_coords(fplog, step, ir, mdatoms, state, fr->bMolPBC, f,
                           bUpdateDoLR, fr->f_twin, bCalcVir ? &fr->vir_twin_constr : NULL, fcd,
@@ -1440,7 +1455,7 @@ double do_md(FILE *fplog, t_commrec *cr, int nfile, const t_filenm fnm[],
                                cr, nrnb, wcycle, upd, constr,
                                FALSE, bCalcVir);
 
-            if (bCalcVir && bUpdateDoLR && ir->nstcalclr > 1)
+            if (bCalcVir && bUpdateDoLR && (ir->nstcalclr > 1 || fr->nstcalcpme > 1))
             {
                 /* Correct the virial for multiple time stepping */
                 m_sub(shake_vir, fr->vir_twin_constr, shake_vir);
@@ -1461,7 +1476,7 @@ double do_md(FILE *fplog, t_commrec *cr, int nfile, const t_filenm fnm[],
                 /* now we know the scaling, we can compute the positions again again */
                 copy_rvecn(cbuf, state->x, 0, state->natoms);
 
-                bUpdateDoLR = (fr->bTwinRange && do_per_step(step, ir->nstcalclr));
+                bUpdateDoLR = (force_flags & GMX_FORCE_DO_LR);
 
                 update_coords(fplog, step, ir, mdatoms, state, fr->bMolPBC, f,
                               bUpdateDoLR, fr->f_twin, bCalcVir ? &fr->vir_twin_constr : NULL, fcd,
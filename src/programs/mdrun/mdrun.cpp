@@ -322,7 +322,10 @@ int gmx_mdrun(int argc, char *argv[])
         { "-ddorder", FALSE, etENUM, {ddno_opt},
           "DD rank order" },
         { "-npme",    FALSE, etINT, {&npme},
-          "Number of separate ranks to be used for PME, -1 is guess" },
+          "Number of separate ranks to be used for PME, -1 is guess. "
+          "Running PME on task threads inside the PP rank instead, with the "
+          "environment variable [TT]GMX_PME_TASK_THREADS[tt], is only supported "
+          "with a single rank" },
         { "-nt",      FALSE, etINT, {&hw_opt.nthreads_tot},
           "Total number of threads to start (0 is guess)" },
         { "-ntmpi",   FALSE, etINT, {&hw_opt.nthreads_tmpi},
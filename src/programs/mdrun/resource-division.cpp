@@ -43,14 +43,17 @@
 #include <string.h>
 
 #include <algorithm>
+#include <string>
 
 #include "gromacs/legacyheaders/gmx_detect_hardware.h"
 #include "gromacs/legacyheaders/gmx_omp_nthreads.h"
 #include "gromacs/legacyheaders/md_logging.h"
 #include "gromacs/legacyheaders/names.h"
 #include "gromacs/legacyheaders/types/commrec.h"
+#include "gromacs/mdlib/nb_verlet_simd_offload.h"
 #include "gromacs/utility/fatalerror.h"
 #include "gromacs/utility/gmxassert.h"
+#include "gromacs/utility/stringutil.h"
 
 
 /* DISCLAIMER: All the atom count and thread numbers below are heuristic.
@@ -174,7 +177,8 @@ static int nthreads_omp_efficient_max(int gmx_unused nrank,
 static int get_tmpi_omp_thread_division(const gmx_hw_info_t *hwinfo,
                                         const gmx_hw_opt_t  *hw_opt,
                                         int                  nthreads_tot,
-                                        int                  ngpu)
+                                        int                  ngpu,
+                                        int                  noffload)
 {
     int nrank;
 
@@ -218,6 +222,11 @@ static int get_tmpi_omp_thread_division(const gmx_hw_info_t *hwinfo,
                    (nthreads_tot/(ngpu*(nshare + 1)) >= nthreads_omp_mpi_ok_min_gpu && nthreads_tot % nrank != 0));
         }
     }
+    else if (noffload > 0)
+    {
+        /* Use one rank per offload device, so every device is driven */
+        nrank = std::min(noffload, nthreads_tot);
+    }
     else if (hw_opt->nthreads_omp > 0)
     {
         /* Here we could oversubscribe, when we do, we issue a warning later */
@@ -269,6 +278,22 @@ static int getMaxGpuUsable(FILE *fplog, const t_commrec *cr, const gmx_hw_info_t
 }
 
 
+/* Return the number of offload devices the non-bonded kernels can use,
+ * 0 when not offloading.
+ */
+static int getMaxOffloadDevicesUsable(int cutoff_scheme)
+{
+    if (cutoff_scheme == ecutsVERLET && offloadTarget() != eoffloadNONE)
+    {
+        return offloadNumDevices();
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+
 #ifdef GMX_THREAD_MPI
 /* Get the number of MPI ranks to use for thread-MPI based on how many
  * were requested, which algorithms we're using,
@@ -284,7 +309,7 @@ int get_nthreads_mpi(const gmx_hw_info_t *hwinfo,
                      const t_commrec     *cr,
                      FILE                *fplog)
 {
-    int      nthreads_hw, nthreads_tot_max, nrank, ngpu;
+    int      nthreads_hw, nthreads_tot_max, nrank, ngpu, noffload;
     int      min_atoms_per_mpi_rank;
 
     /* Check if an algorithm does not support parallel simulation.  */
@@ -324,7 +349,8 @@ int get_nthreads_mpi(const gmx_hw_info_t *hwinfo,
         nthreads_tot_max = nthreads_hw;
     }
 
-    ngpu = getMaxGpuUsable(fplog, cr, hwinfo, inputrec->cutoff_scheme);
+    ngpu     = getMaxGpuUsable(fplog, cr, hwinfo, inputrec->cutoff_scheme);
+    noffload = getMaxOffloadDevicesUsable(inputrec->cutoff_scheme);
 
     if (inputrec->cutoff_scheme == ecutsGROUP)
     {
@@ -333,7 +359,7 @@ int get_nthreads_mpi(const gmx_hw_info_t *hwinfo,
     }
 
     nrank =
-        get_tmpi_omp_thread_division(hwinfo, hw_opt, nthreads_tot_max, ngpu);
+        get_tmpi_omp_thread_division(hwinfo, hw_opt, nthreads_tot_max, ngpu, noffload);
 
     if (inputrec->eI == eiNM || EI_TPI(inputrec->eI))
     {
@@ -346,7 +372,7 @@ int get_nthreads_mpi(const gmx_hw_info_t *hwinfo,
     }
     else
     {
-        if (ngpu >= 1)
+        if (ngpu >= 1 || noffload >= 1)
         {
             min_atoms_per_mpi_rank = min_atoms_per_gpu;
         }
@@ -784,3 +810,38 @@ void check_and_update_hw_opt_3(gmx_hw_opt_t gmx_unused *hw_opt)
         print_hw_opt(debug, hw_opt);
     }
 }
+
+
+int select_offload_device(FILE *fplog, const t_commrec *cr)
+{
+    int         ndev, nrank, rank;
+    std::string mapping;
+
+    ndev  = offloadNumDevices();
+    nrank = cr->nrank_pp_intranode;
+    if (ndev <= 0)
+    {
+        gmx_fatal(FARGS, "Offloading of the non-bonded kernels was requested, but no offload devices were found");
+    }
+
+    /* The PP ranks in a node are divided in contiguous blocks over the
+     * devices, as ranks sharing a GPU are. With fewer ranks than devices
+     * some devices are idle.
+     */
+    for (rank = 0; rank < nrank; rank++)
+    {
+        mapping += gmx::formatString("%s%d", rank > 0 ? "," : "", (rank*ndev)/nrank);
+    }
+    md_print_info(cr, fplog, "%d offload device%s in this node. Mapping of offload devices to the %d PP rank%s in this node: %s\n",
+                  ndev, ndev > 1 ? "s" : "", nrank, nrank > 1 ? "s" : "",
+                  mapping.c_str());
+    if (nrank < ndev)
+    {
+        md_print_warn(cr, fplog, "NOTE: There are %d offload devices, but only %d PP rank%s in this node, so %d device%s will be idle.\n"
+                      "      Use at least as many PP ranks as offload devices to use all of them.\n",
+                      ndev, nrank, nrank > 1 ? "s" : "",
+                      ndev - nrank, ndev - nrank > 1 ? "s" : "");
+    }
+
+    return (cr->rank_pp_intranode*ndev)/nrank;
+}
@@ -54,6 +54,14 @@ int get_nthreads_mpi(const gmx_hw_info_t *hwinfo,
                      const t_commrec     *cr,
                      FILE                *fplog);
 
+/* Return the offload device that this PP rank uses for the non-bonded
+ * kernels. The PP ranks in a node are divided in contiguous blocks over
+ * the offload devices of the node. The mapping is printed to fplog.
+ * This function should be called after the intra-node rank counters
+ * are set up and only when offloading.
+ */
+int select_offload_device(FILE *fplog, const t_commrec *cr);
+
 /* Check if the number of OpenMP threads is within reasonable range
  * considering the hardware used. This is a crude check, but mainly
  * intended to catch cases where the user starts 1 MPI rank per hardware
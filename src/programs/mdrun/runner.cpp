@@ -45,10 +45,13 @@
 #include <string.h>
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 #include "gromacs/domdec/domdec.h"
 #include "gromacs/essentialdynamics/edsam.h"
 #include "gromacs/ewald/pme.h"
+#include "gromacs/fft/fft.h"
 #include "gromacs/fileio/tpxio.h"
 #include "gromacs/gmxlib/gpu_utils/gpu_utils.h"
 #include "gromacs/legacyheaders/checkpoint.h"
@@ -56,6 +59,7 @@
 #include "gromacs/legacyheaders/copyrite.h"
 #include "gromacs/legacyheaders/disre.h"
 #include "gromacs/legacyheaders/force.h"
+#include "gromacs/legacyheaders/gmx_cpuid.h"
 #include "gromacs/legacyheaders/gmx_detect_hardware.h"
 #include "gromacs/legacyheaders/gmx_omp_nthreads.h"
 #include "gromacs/legacyheaders/gmx_thread_affinity.h"
@@ -76,6 +80,7 @@
 #include "gromacs/math/calculate-ewald-splitting-coefficient.h"
 #include "gromacs/math/vec.h"
 #include "gromacs/mdlib/calc_verletbuf.h"
+#include "gromacs/mdlib/nb_verlet.h"
 #include "gromacs/mdlib/nbnxn_search.h"
 #include "gromacs/pbcutil/pbc.h"
 #include "gromacs/pulling/pull.h"
@@ -86,7 +91,9 @@
 #include "gromacs/utility/cstringutil.h"
 #include "gromacs/utility/gmxassert.h"
 #include "gromacs/utility/gmxmpi.h"
+#include "gromacs/utility/gmxomp.h"
 #include "gromacs/utility/smalloc.h"
+#include "gromacs/utility/stringutil.h"
 #include "gromacs/mdlib/nb_verlet_simd_offload.h"
 
 #include "deform.h"
@@ -592,6 +599,72 @@ static void override_nsteps_cmdline(FILE            *fplog,
     /* Do nothing if nsteps_cmdline == -2 */
 }
 
+/* Returns the name of the file for storing FFT planning information,
+ * the name is empty when GMX_FFTW_WISDOM is not set. The planning only
+ * applies to the same precision and SIMD flavour, so these are part of
+ * the name. Grid sizes, decomposition and thread counts are part of the
+ * stored information itself, so one file covers different systems,
+ * rank setups and the grids visited during PME tuning.
+ */
+static std::string fft_wisdom_filename()
+{
+    const char *dir = getenv("GMX_FFTW_WISDOM");
+
+    if (dir == NULL)
+    {
+        return std::string();
+    }
+
+    return gmx::formatString("%s/fftw_wisdom_%s_%s.txt",
+                             dir,
+#ifdef GMX_DOUBLE
+                             "double",
+#else
+                             "mixed",
+#endif
+                             gmx_cpuid_simd_string[gmx_compiled_simd()]);
+}
+
+#ifdef GMX_LIB_MPI
+/* Adds the FFT planning information of all ranks of the simulation to
+ * that of the master rank. Each rank only plans its own transforms, so
+ * e.g. with separate PME ranks the master has no PME plans.
+ */
+static void gather_fft_wisdom(const t_commrec *cr)
+{
+    char             *wisdom = gmx_fft_export_wisdom_string();
+    int               len    = (wisdom != NULL ? strlen(wisdom) + 1 : 0);
+    std::vector<int>  lens(cr->nnodes), displs(cr->nnodes);
+    std::vector<char> buf;
+    int               i;
+
+    MPI_Gather(&len, 1, MPI_INT, &lens[0], 1, MPI_INT,
+               MASTERRANK(cr), cr->mpi_comm_mysim);
+    if (MASTER(cr))
+    {
+        for (i = 1; i < cr->nnodes; i++)
+        {
+            displs[i] = displs[i - 1] + lens[i - 1];
+        }
+        buf.resize(displs[cr->nnodes - 1] + lens[cr->nnodes - 1] + 1);
+    }
+    MPI_Gatherv(wisdom, len, MPI_CHAR,
+                MASTER(cr) ? &buf[0] : NULL, &lens[0], &displs[0], MPI_CHAR,
+                MASTERRANK(cr), cr->mpi_comm_mysim);
+    if (MASTER(cr))
+    {
+        for (i = 0; i < cr->nnodes; i++)
+        {
+            if (i != MASTERRANK(cr) && lens[i] > 0)
+            {
+                gmx_fft_import_wisdom_string(&buf[displs[i]]);
+            }
+        }
+    }
+    free(wisdom);
+}
+#endif
+
 int mdrunner(gmx_hw_opt_t *hw_opt,
              FILE *fplog, t_commrec *cr, int nfile,
              const t_filenm fnm[], const output_env_t oenv, gmx_bool bVerbose,
@@ -630,6 +703,7 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
     gmx_edsam_t               ed           = NULL;
     int                       nthreads_pme = 1;
     int                       nthreads_pp  = 1;
+    int                       nthreads_pme_task;
     gmx_membed_t              membed       = NULL;
     gmx_hw_info_t            *hwinfo       = NULL;
     /* The master rank decides early on bUseGPU and broadcasts this later */
@@ -666,6 +740,23 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
 
     gmx_print_detected_hardware(fplog, cr, hwinfo);
 
+    /* Read FFT plans measured by earlier runs. FFT planning is not
+     * thread-safe, so this is done before any thread-MPI threads are
+     * started. The spawned threads, which enter here with PAR(cr) set,
+     * share the plans of the process and skip the reading.
+     */
+    const std::string wisdomFilename = fft_wisdom_filename();
+    gmx_bool          bReadWisdom    = !wisdomFilename.empty();
+#ifdef GMX_THREAD_MPI
+    bReadWisdom = bReadWisdom && !PAR(cr);
+#endif
+    if (bReadWisdom &&
+        gmx_fft_import_wisdom(wisdomFilename.c_str()) && fplog != NULL)
+    {
+        fprintf(fplog, "Read FFT planning information from %s\n\n",
+                wisdomFilename.c_str());
+    }
+
     if (fplog != NULL)
     {
         /* Print references after all software/hardware printing */
@@ -748,6 +839,17 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
     /* Check and update the hardware options for internal consistency */
     check_and_update_hw_opt_1(hw_opt, cr);
 
+    /* Select the offload target before the thread-MPI ranks are started,
+     * so the rank count can follow the number of offload devices.
+     * The spawned thread-MPI ranks use the target selected by the master.
+     */
+#ifdef GMX_THREAD_MPI
+    if (!PAR(cr))
+#endif
+    {
+        init_offload_target(fplog);
+    }
+
     /* Early check for externally set process affinity. */
     gmx_check_thread_affinity_set(fplog, cr,
                                   hw_opt, hwinfo->nthreads_hw_avail, FALSE);
@@ -1042,16 +1144,31 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
                           hw_opt->nthreads_omp_pme,
                           (cr->duty & DUTY_PP) == 0,
                           inputrec->cutoff_scheme == ecutsVERLET,
-						  /* TODO: This should depend on the runtime kernel type, but
-						   * that isn't computed until later. This hack means that running
-						   * a non-offloaded kernel when offloading support is available
-						   * will cause an excessive number of OpenMP threads for nonbonded.
-						   */
-#ifdef GMX_OFFLOAD
-                          TRUE);
-#else
-                          FALSE);
-#endif
+                          /* TODO: This should depend on the runtime kernel type, but
+                           * that isn't computed until later. This hack means that running
+                           * a non-offloaded kernel when offloading support is available
+                           * will cause an excessive number of OpenMP threads for nonbonded.
+                           */
+                          offloadTarget() != eoffloadNONE);
+
+    /* With PME on a task thread, PME gets nthreads_pme_task of the OpenMP
+     * threads of this rank and the PP work the remaining ones.
+     */
+    nthreads_pme_task = gmx_pme_task_nthreads(fplog, cr, inputrec);
+    if (nthreads_pme_task > 0)
+    {
+        int nth_pp = std::max(gmx_omp_nthreads_get(emntDefault) - nthreads_pme_task, 1);
+
+        for (int m = 0; m < emntNR; m++)
+        {
+            gmx_omp_nthreads_set(m, m == emntPME ? nthreads_pme_task : std::min(gmx_omp_nthreads_get(m), nth_pp));
+        }
+        gmx_omp_set_num_threads(nth_pp);
+
+        md_print_info(cr, fplog, "Running PME on a task thread with %d OpenMP thread%s, concurrently with %d PP thread%s\n\n",
+                      nthreads_pme_task, nthreads_pme_task > 1 ? "s" : "",
+                      nth_pp, nth_pp > 1 ? "s" : "");
+    }
 
 #ifndef NDEBUG
     if (integrator[inputrec->eI].func != do_tpi &&
@@ -1124,6 +1241,10 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
         fr          = mk_forcerec();
         fr->hwinfo  = hwinfo;
         fr->gpu_opt = &hw_opt->gpu_opt;
+        if (offloadTarget() != eoffloadNONE)
+        {
+            fr->offload_device = select_offload_device(fplog, cr);
+        }
         init_forcerec(fplog, oenv, fr, fcd, inputrec, mtop, cr, box,
                       opt2fn("-table", nfile, fnm),
                       opt2fn("-tabletf", nfile, fnm),
@@ -1131,6 +1252,7 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
                       opt2fn("-tableb", nfile, fnm),
                       nbpu_opt,
                       FALSE,
+                      (Flags & MD_REPRODUCIBLE),
                       pforce);
 
         /* version for PCA_NOT_READ_NODE (see md.c) */
@@ -1199,8 +1321,18 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
         snew(pmedata, 1);
     }
 
+    if (nthreads_pme_task > 0)
+    {
+        /* Create the PME task thread before setting the affinity,
+         * so it does not inherit the affinity of this thread.
+         */
+        fr->pme_task = gmx_pme_task_init(wcycle);
+    }
+
     if (hw_opt->thread_affinity != threadaffOFF)
     {
+        std::vector<int> pme_task_core(nthreads_pme_task);
+
         /* Before setting affinity, check whether the affinity has changed
          * - which indicates that probably the OpenMP library has changed it
          * since we first checked).
@@ -1208,8 +1340,15 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
         gmx_check_thread_affinity_set(fplog, cr,
                                       hw_opt, hwinfo->nthreads_hw_avail, TRUE);
 
-        /* Set the CPU affinity */
-        gmx_set_thread_affinity(fplog, cr, hw_opt, hwinfo);
+        /* Set the CPU affinity, the cores after those of the PP threads
+         * are reserved for the OpenMP threads of the PME task.
+         */
+        gmx_set_thread_affinity(fplog, cr, hw_opt, hwinfo,
+                                nthreads_pme_task, nthreads_pme_task > 0 ? &pme_task_core[0] : NULL);
+        if (nthreads_pme_task > 0)
+        {
+            gmx_pme_task_set_affinity(fr->pme_task, nthreads_pme_task, &pme_task_core[0]);
+        }
     }
 
     /* Initiate PME if necessary,
@@ -1343,6 +1482,16 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
     /* Free GPU memory and context */
     free_gpu_resources(fr, cr, &hwinfo->gpu_info, fr ? fr->gpu_opt : NULL);
 
+    if (fr)
+    {
+        gmx_pme_task_destroy(fr->pme_task);
+    }
+
+    if (fr != NULL && fr->nbv != NULL && fr->nbv->offload != NULL)
+    {
+        nbnxn_offload_finish(fr->nbv->offload);
+    }
+
     if (opt2bSet("-membed", nfile, fnm))
     {
         sfree(membed);
@@ -1374,5 +1523,20 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
     }
 #endif
 
+    /* All threads have joined, so no plans are being made. With thread-MPI
+     * all ranks share the plans of the process, with MPI the plans of
+     * the other ranks are first collected on the master.
+     */
+#ifdef GMX_LIB_MPI
+    if (PAR(cr) && !wisdomFilename.empty())
+    {
+        gather_fft_wisdom(cr);
+    }
+#endif
+    if (MASTER(cr) && !wisdomFilename.empty())
+    {
+        gmx_fft_export_wisdom(wisdomFilename.c_str());
+    }
+
     return rc;
 }
@@ -0,0 +1,150 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests the AVX-512 SIMD non-bonded kernels against the plain-C kernels.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/mdlib/nbnxn_simd.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+#if defined GMX_NBNXN_SIMD && \
+    (defined GMX_SIMD_X86_AVX_512F || defined GMX_SIMD_X86_AVX_512ER)
+
+//! Energy terms compared between the SIMD and plain-C kernels
+const char *const c_energyTerms[] = {
+    "LJ (SR)", "Coulomb (SR)", "Potential",
+    "Coul-SR:FirstHalf-FirstHalf", "LJ-SR:FirstHalf-FirstHalf",
+    "Coul-SR:FirstHalf-SecondHalf", "LJ-SR:FirstHalf-SecondHalf",
+    "Coul-SR:SecondHalf-SecondHalf", "LJ-SR:SecondHalf-SecondHalf", NULL
+};
+
+/*! \brief Relative tolerance for the forces
+ *
+ * The plain-C kernels use a tabulated Ewald correction, the SIMD kernels
+ * by default an analytical one, both are accurate to single precision.
+ */
+const real c_forceTolerance = 1e-5;
+
+/*! \brief Relative tolerance for the energies
+ *
+ * The kernels sum tens of thousands of pair energies of both signs
+ * in float, in a different order. The rounding errors of these sums
+ * are a few times 1e-5 of the group energies.
+ */
+const real c_energyTolerance = 1e-4;
+
+/*! \brief Test fixture for the AVX-512 kernels
+ *
+ * The parameter is the environment setting that selects the 4xN
+ * or 2xNN kernels.
+ */
+class Avx512KernelTest : public gmx::test::MdrunTestFixture,
+                         public ::testing::WithParamInterface<const char *>
+{
+    public:
+        /*! \brief Checks that the SIMD kernels reproduce the plain-C kernels
+         *
+         * Runs spc216 with PME, two energy groups and \p extraMdp.
+         * The SIMD kernels run with \p environment in addition to the
+         * kernel setting.
+         */
+        void compareWithPlainC(const char *extraMdp,
+                               const char *environment = NULL);
+};
+
+void Avx512KernelTest::compareWithPlainC(const char *extraMdp,
+                                         const char *environment)
+{
+    gmx::test::MdrunComparison comparison(&runner_, &fileManager_);
+    comparison.prepare("spc216",
+                       (std::string("energygrps = FirstHalf SecondHalf\n") + extraMdp).c_str());
+    comparison.setThreads(1, 1);
+    comparison.setEnergyTerms(c_energyTerms);
+    comparison.setTolerances(c_energyTolerance, c_forceTolerance);
+
+    const char *const referenceEnvironment[] = { "GMX_DISABLE_SIMD_KERNELS=1", NULL };
+    const char *const testEnvironment[]      = { GetParam(), environment, NULL };
+    comparison.compareReruns(referenceEnvironment, testEnvironment);
+}
+
+/* With the analytical Ewald correction and the geometric combination
+ * rule of the water model, the LJ parameters are not gathered.
+ */
+TEST_P(Avx512KernelTest, ReproducesPlainCWithEwald)
+{
+    compareWithPlainC("");
+}
+
+/* The Ewald tables and, with force switching, the LJ parameter
+ * matrix are read with gathers.
+ */
+TEST_P(Avx512KernelTest, ReproducesPlainCWithEwaldTableAndForceSwitch)
+{
+    compareWithPlainC("vdw-modifier = force-switch\n"
+                      "rvdw-switch = 0.5\n",
+                      "GMX_NBNXN_EWALD_TABLE=1");
+}
+
+//! The kernel settings for Avx512KernelTest
+const char *const c_simdKernels[] = {
+#ifdef GMX_NBNXN_SIMD_4XN
+    "GMX_NBNXN_SIMD_4XN=1",
+#endif
+#ifdef GMX_NBNXN_SIMD_2XNN
+    "GMX_NBNXN_SIMD_2XNN=1",
+#endif
+};
+
+INSTANTIATE_TEST_CASE_P(WithKernel, Avx512KernelTest,
+                            ::testing::ValuesIn(c_simdKernels));
+
+#endif
+
+} // namespace
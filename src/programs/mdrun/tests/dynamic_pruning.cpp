@@ -0,0 +1,157 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests for dynamic pruning of the non-bonded pair lists in mdrun.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/mdlib/nbnxn_simd.h"
+#include "gromacs/utility/textreader.h"
+
+#include "testutils/cmdlinetest.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Energy terms compared between pruned and unpruned runs
+const char *const c_energyTerms[] = { "LJ (SR)", "Coulomb (SR)", "Potential", "Kinetic En.", NULL };
+
+//! Test fixture for mdrun with dynamic pair-list pruning
+class DynamicPruningTest : public gmx::test::MdrunTestFixture
+{
+    public:
+        /*! \brief Runs mdrun with output file names containing \p tag
+         *
+         * \p environment is a NULL-terminated list of NAME=value settings.
+         */
+        int runMdrun(const char *tag, const char *const environment[]);
+        /*! \brief Checks that a pruned run with \p environment reproduces
+         * an unpruned run
+         *
+         * Runs 20 steps of 216 waters with a thermostat, which pruning
+         * needs. The inner list has a buffer for the prune interval,
+         * so the energies should match closely. A pair that moves into
+         * the cut-off between prunes, which the buffer allows with
+         * the drift tolerance, changes forces by the force at the cut-off.
+         */
+        void compareWithUnprunedRun(const char *const environment[]);
+};
+
+int DynamicPruningTest::runMdrun(const char *tag, const char *const environment[])
+{
+    std::string name(tag);
+    runner_.edrFileName_                     = fileManager_.getTemporaryFilePath(name + ".edr");
+    runner_.logFileName_                     = fileManager_.getTemporaryFilePath(name + ".log");
+    runner_.fullPrecisionTrajectoryFileName_ = fileManager_.getTemporaryFilePath(name + ".trr");
+
+    gmx::test::ScopedEnvironment env(environment);
+    return runner_.callMdrun();
+}
+
+void DynamicPruningTest::compareWithUnprunedRun(const char *const environment[])
+{
+    runner_.useStringAsMdpFile("cutoff-scheme = Verlet\n"
+                               "coulombtype = PME\n"
+                               "rcoulomb = 0.7\n"
+                               "rvdw = 0.7\n"
+                               "nsteps = 20\n"
+                               "nstlist = 10\n"
+                               "nstcalcenergy = 5\n"
+                               "nstenergy = 5\n"
+                               "nstfout = 5\n"
+                               "tcoupl = berendsen\n"
+                               "tc-grps = System\n"
+                               "tau-t = 0.1\n"
+                               "ref-t = 298\n");
+    runner_.useTopGroAndNdxFromDatabase("spc216");
+    ASSERT_EQ(0, runner_.callGrompp());
+
+    const char *const unprunedEnvironment[] = { "GMX_DISABLE_DYNAMICPRUNING=1", NULL };
+    ASSERT_EQ(0, runMdrun("unpruned", unprunedEnvironment));
+    std::vector<gmx::test::EnergyFrame> referenceEnergies =
+        gmx::test::readEnergyFrames(runner_.edrFileName_);
+    std::vector<gmx::test::ForceFrame>  referenceForces   =
+        gmx::test::readForceFrames(runner_.fullPrecisionTrajectoryFileName_);
+
+    ASSERT_EQ(0, runMdrun("pruned", environment));
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    ASSERT_NE(std::string::npos, log.find("Using dynamic pair-list pruning"));
+
+    gmx::test::compareEnergyFrames(referenceEnergies,
+                                   gmx::test::readEnergyFrames(runner_.edrFileName_),
+                                   c_energyTerms, 1e-5);
+    gmx::test::compareForceFrames(referenceForces,
+                                  gmx::test::readForceFrames(runner_.fullPrecisionTrajectoryFileName_),
+                                  1e-4);
+}
+
+/* The default SIMD kernels, with the SIMD prune kernel for 4xN */
+TEST_F(DynamicPruningTest, ReproducesUnprunedRun)
+{
+    compareWithUnprunedRun(NULL);
+}
+
+#ifdef GMX_NBNXN_SIMD_2XNN
+/* The 2xNN lists are pruned by the reference prune kernel */
+TEST_F(DynamicPruningTest, ReproducesUnprunedRunWith2xNN)
+{
+    const char *const environment[] = { "GMX_NBNXN_SIMD_2XNN=1", NULL };
+
+    compareWithUnprunedRun(environment);
+}
+#endif
+
+/* A shorter prune interval than the default */
+TEST_F(DynamicPruningTest, ReproducesUnprunedRunWithPruneInterval)
+{
+    const char *const environment[] = { "GMX_NSTLIST_DYNAMICPRUNING=2", NULL };
+
+    compareWithUnprunedRun(environment);
+}
+
+} // namespace
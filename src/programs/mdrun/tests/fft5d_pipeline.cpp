@@ -0,0 +1,143 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests the pipelined transposes of the decomposed PME FFT.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <ostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/utility/stringutil.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Energy terms compared between the transpose modes
+const char *const c_energyTerms[] = { "Coul. recip.", "Potential", NULL };
+
+/*! \brief Relative tolerance for the comparison with MPI_Alltoall
+ *
+ * The pipelined transposes move the same data to the same place as
+ * MPI_Alltoall and the 1D FFTs of a chunk give the same results as
+ * those of all planes, so only rounding differences are allowed.
+ */
+const real c_tolerance = 1e-6;
+
+//! Rank setup and number of chunks for Fft5dPipelineTest
+struct Fft5dPipelineParameters
+{
+    //! The total number of ranks, used with thread-MPI
+    int numRanks;
+    //! The number of separate PME ranks, used with thread-MPI
+    int numPmeRanks;
+    //! The number of chunks each transpose is split into
+    int numChunks;
+};
+
+//! Prints \p parameters in the names of the test instances
+std::ostream &operator<<(std::ostream &out, const Fft5dPipelineParameters &parameters)
+{
+    return out << parameters.numRanks << " ranks, "
+           << parameters.numPmeRanks << " PME ranks, "
+           << parameters.numChunks << " chunks";
+}
+
+//! Test fixture for the pipelined fft5d transposes
+class Fft5dPipelineTest : public gmx::test::MdrunTestFixture,
+                          public ::testing::WithParamInterface<Fft5dPipelineParameters>
+{
+};
+
+/* The pipelined transposes should reproduce the MPI_Alltoall
+ * transposes. The grid sizes are not multiples of the number of ranks,
+ * so the ranks have unequal numbers of planes.
+ */
+TEST_P(Fft5dPipelineTest, ReproducesAlltoall)
+{
+    gmx::test::MdrunComparison comparison(&runner_, &fileManager_);
+    comparison.prepare("spc216",
+                       "fourier-nx = 19\n"
+                       "fourier-ny = 17\n"
+                       "fourier-nz = 23\n");
+    /* Decompose the PME grid over the PP ranks or over the separate
+     * PME ranks, with multiple OpenMP threads per transpose. With MPI
+     * the number of ranks is set when starting the test.
+     */
+    comparison.setThreads(GetParam().numRanks, 2);
+#ifdef GMX_THREAD_MPI
+    comparison.commandLine().addOption("-npme", GetParam().numPmeRanks);
+#else
+    comparison.commandLine().addOption("-npme", 0);
+#endif
+    comparison.setEnergyTerms(c_energyTerms);
+    comparison.setTolerances(c_tolerance, c_tolerance);
+
+    std::string       pipeline      = gmx::formatString("GMX_FFT5D_PIPELINE=%d", GetParam().numChunks);
+    const char *const environment[] = { pipeline.c_str(), NULL };
+    comparison.compareReruns(NULL, environment);
+}
+
+/*! \brief The rank setups and chunk counts to test
+ *
+ * With 1 chunk the pipelined path only replaces MPI_Alltoall, 3 gives
+ * chunks of unequal size and 8 gives chunks of about one plane. With 3
+ * and 4 ranks the planes are distributed unevenly, the last two cases
+ * decompose the grid over 3 and 4 separate PME ranks.
+ */
+const Fft5dPipelineParameters c_pipelineParameters[] = {
+    { 2, 0, 1 },
+    { 2, 0, 3 },
+    { 2, 0, 8 },
+    { 3, 0, 4 },
+    { 4, 0, 4 },
+    { 6, 3, 4 },
+    { 8, 4, 4 }
+};
+
+INSTANTIATE_TEST_CASE_P(RanksAndChunks, Fft5dPipelineTest,
+                            ::testing::ValuesIn(c_pipelineParameters));
+
+} // namespace
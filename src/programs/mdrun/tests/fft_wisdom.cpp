@@ -0,0 +1,165 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests storing the FFTW planning information between mdrun invocations.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <cstdio>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/utility/directoryenumerator.h"
+#include "gromacs/utility/path.h"
+#include "gromacs/utility/stringutil.h"
+#include "gromacs/utility/textreader.h"
+
+#include "testutils/cmdlinetest.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Test fixture for mdrun with GMX_FFTW_WISDOM
+class FftWisdomTest : public gmx::test::MdrunTestFixture
+{
+    public:
+        //! Runs grompp for 216 waters with PME
+        void prepare();
+        /*! \brief Runs mdrun with GMX_FFTW_WISDOM set to \p directory
+         *
+         * The directory is created first, output file names contain \p tag.
+         */
+        int runMdrun(const std::string &tag, const std::string &directory);
+        //! Returns the names of the files in \p directory
+        std::vector<std::string> listFiles(const std::string &directory);
+};
+
+void FftWisdomTest::prepare()
+{
+    runner_.useStringAsMdpFile("cutoff-scheme = Verlet\n"
+                               "coulombtype = PME\n"
+                               "rcoulomb = 0.7\n"
+                               "rvdw = 0.7\n"
+                               "nsteps = 2\n");
+    runner_.useTopGroAndNdxFromDatabase("spc216");
+    ASSERT_EQ(0, runner_.callGrompp());
+}
+
+int FftWisdomTest::runMdrun(const std::string &tag, const std::string &directory)
+{
+    runner_.edrFileName_ = fileManager_.getTemporaryFilePath(tag + ".edr");
+    runner_.logFileName_ = fileManager_.getTemporaryFilePath(tag + ".log");
+
+    gmx::Directory::create(directory);
+
+    ::gmx::test::CommandLine caller;
+    caller.append("mdrun");
+#ifdef GMX_THREAD_MPI
+    caller.addOption("-ntmpi", 1);
+#endif
+
+    std::string                  setting       = "GMX_FFTW_WISDOM=" + directory;
+    const char *const            environment[] = { setting.c_str(), NULL };
+    gmx::test::ScopedEnvironment env(environment);
+    return runner_.callMdrun(caller);
+}
+
+std::vector<std::string> FftWisdomTest::listFiles(const std::string &directory)
+{
+    std::vector<std::string> files;
+    gmx::DirectoryEnumerator dir(directory);
+    std::string              name;
+    while (dir.nextFile(&name))
+    {
+        if (name != "." && name != "..")
+        {
+            files.push_back(name);
+        }
+    }
+    return files;
+}
+
+#if GMX_FFT_FFTW3
+/* The wisdom file written by one run is read by the next run in the
+ * same process, which then writes it again.
+ */
+TEST_F(FftWisdomTest, WritesAndReadsWisdom)
+{
+    prepare();
+
+    std::string directory = fileManager_.getTemporaryFilePath("wisdom");
+    ASSERT_EQ(0, runMdrun("write", directory));
+    std::vector<std::string> files = listFiles(directory);
+    ASSERT_EQ(1U, files.size());
+    EXPECT_TRUE(gmx::startsWith(files[0], "fftw_wisdom_")) << files[0];
+    std::string wisdomFile = directory + "/" + files[0];
+    std::string wisdom     = gmx::TextReader::readFileToString(wisdomFile);
+    EXPECT_NE(std::string::npos, wisdom.find("fftw")) << wisdom;
+
+    std::string readMessage = "Read FFT planning information from " + wisdomFile;
+    for (int run = 0; run < 2; run++)
+    {
+        ASSERT_EQ(0, runMdrun(gmx::formatString("read%d", run), directory));
+        std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+        EXPECT_NE(std::string::npos, log.find(readMessage)) << "in run " << run;
+        EXPECT_EQ(1U, listFiles(directory).size()) << "in run " << run;
+    }
+
+    std::remove(wisdomFile.c_str());
+}
+#else
+//! Without FFTW the setting has no effect
+TEST_F(FftWisdomTest, IsIgnoredWithoutFftw)
+{
+    prepare();
+
+    std::string directory = fileManager_.getTemporaryFilePath("wisdom");
+    ASSERT_EQ(0, runMdrun("write", directory));
+    EXPECT_TRUE(listFiles(directory).empty());
+}
+#endif
+
+} // namespace
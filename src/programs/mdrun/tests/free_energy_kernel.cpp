@@ -0,0 +1,243 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests for the SIMD kernel for perturbed non-bonded pairs.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/fileio/xvgr.h"
+#include "gromacs/simd/simd.h"
+#include "gromacs/utility/smalloc.h"
+#include "gromacs/utility/textreader.h"
+
+#include "testutils/cmdlinetest.h"
+#include "testutils/testasserts.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Energy terms compared between the SIMD and plain-C kernel runs
+const char *const c_energyTerms[] = { "LJ (SR)", "Coulomb (SR)", "Potential", NULL };
+
+//! dV/dlambda terms compared between the SIMD and plain-C kernel runs
+const char *const c_dvdlTerms[] = { "dVcoul/dl", "dVvdw/dl", NULL };
+
+/*! \brief Relative tolerance for dH/dlambda and energy differences
+ *
+ * These sum contributions of both signs from the perturbed pairs only.
+ * The plain-C kernel tabulates the Ewald correction, whereas the SIMD
+ * kernel computes it analytically, which changes the sums by a few 1e-5.
+ */
+const real c_dhdlTolerance = 1e-4;
+
+/*! \brief Reads the dH/dlambda file \p fileName
+ *
+ * Returns the columns, time, dH/dlambda components and the energy
+ * differences to the foreign lambda states, for each row.
+ */
+std::vector<std::vector<double> > readDhdlFile(const std::string &fileName)
+{
+    double **columns;
+    int      numColumns;
+    int      numRows = read_xvg(fileName.c_str(), &columns, &numColumns);
+
+    std::vector<std::vector<double> > rows(numRows, std::vector<double>(numColumns));
+    for (int j = 0; j < numColumns; j++)
+    {
+        for (int i = 0; i < numRows; i++)
+        {
+            rows[i][j] = columns[j][i];
+        }
+        sfree(columns[j]);
+    }
+    sfree(columns);
+
+    return rows;
+}
+
+//! Test fixture for comparing the SIMD and plain-C free-energy kernels
+class FreeEnergyKernelTest : public gmx::test::MdrunTestFixture
+{
+    public:
+        /*! \brief Checks that the SIMD kernel reproduces the plain-C kernel
+         *
+         * 8 of 216 waters are decoupled with soft-core for Van der Waals
+         * and Coulomb, with separate lambda values for these. The
+         * electrostatics settings are given in \p coulombMdp. Reruns of
+         * the trajectory of a short SD run with the SIMD and the plain-C
+         * kernel should give the same energies, dH/dlambda, foreign
+         * lambda energy differences and forces.
+         */
+        void compareWithPlainCKernel(const char *coulombMdp);
+        //! Runs mdrun with output file names containing \p tag
+        int runMdrun(const char        *tag,
+                     const char *const  environment[],
+                     const char        *rerunFileName);
+        //! The name of the dH/dlambda output of the last mdrun call
+        std::string dhdlFileName_;
+};
+
+int FreeEnergyKernelTest::runMdrun(const char        *tag,
+                                   const char *const  environment[],
+                                   const char        *rerunFileName)
+{
+    std::string name(tag);
+    runner_.edrFileName_                     = fileManager_.getTemporaryFilePath(name + ".edr");
+    runner_.logFileName_                     = fileManager_.getTemporaryFilePath(name + ".log");
+    runner_.fullPrecisionTrajectoryFileName_ = fileManager_.getTemporaryFilePath(name + ".trr");
+    dhdlFileName_                            = fileManager_.getTemporaryFilePath(name + ".xvg");
+
+    ::gmx::test::CommandLine caller;
+    caller.append("mdrun");
+    caller.addOption("-dhdl", dhdlFileName_);
+    if (rerunFileName != NULL)
+    {
+        caller.addOption("-rerun", rerunFileName);
+    }
+
+    gmx::test::ScopedEnvironment env(environment);
+    return runner_.callMdrun(caller);
+}
+
+void FreeEnergyKernelTest::compareWithPlainCKernel(const char *coulombMdp)
+{
+    std::string mdp("integrator = sd\n"
+                    "tc-grps = System\n"
+                    "tau-t = 1\n"
+                    "ref-t = 298\n"
+                    "ld-seed = 1993\n"
+                    "cutoff-scheme = Verlet\n"
+                    "rcoulomb = 0.7\n"
+                    "rvdw = 0.7\n"
+                    "nsteps = 20\n"
+                    "nstcalcenergy = 5\n"
+                    "nstenergy = 5\n"
+                    "nstxout = 5\n"
+                    "nstfout = 5\n"
+                    "free-energy = yes\n"
+                    "couple-moltype = SOLB\n"
+                    "couple-lambda0 = vdw-q\n"
+                    "couple-lambda1 = none\n"
+                    "couple-intramol = no\n"
+                    "coul-lambdas = 0 0.3 0.6 1 1\n"
+                    "vdw-lambdas = 0 0.2 0.5 0.8 1\n"
+                    "init-lambda-state = 2\n"
+                    "calc-lambda-neighbors = -1\n"
+                    "sc-alpha = 0.5\n"
+                    "sc-power = 1\n"
+                    "sc-sigma = 0.3\n"
+                    "sc-coul = yes\n"
+                    "nstdhdl = 5\n");
+    runner_.useStringAsMdpFile(mdp + coulombMdp);
+    runner_.useTopGroAndNdxFromDatabase("spc216");
+    runner_.topFileName_ = fileManager_.getInputFilePath("spc216-perturbed.top");
+    ASSERT_EQ(0, runner_.callGrompp());
+
+    ASSERT_EQ(0, runMdrun("md", NULL, NULL));
+    std::string trajectory = runner_.fullPrecisionTrajectoryFileName_;
+
+    const char *const plainCEnvironment[] = { "GMX_DISABLE_SIMD_FEP_KERNEL=1", NULL };
+    ASSERT_EQ(0, runMdrun("plainc", plainCEnvironment, trajectory.c_str()));
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    ASSERT_NE(std::string::npos,
+              log.find("Using plain-C kernel for the perturbed non-bonded interactions"));
+    std::vector<gmx::test::EnergyFrame> referenceEnergies =
+        gmx::test::readEnergyFrames(runner_.edrFileName_);
+    std::vector<gmx::test::ForceFrame>  referenceForces   =
+        gmx::test::readForceFrames(runner_.fullPrecisionTrajectoryFileName_);
+    std::vector<std::vector<double> >   referenceDhdl     = readDhdlFile(dhdlFileName_);
+    /* Time, two dH/dlambda components and five lambda states */
+    ASSERT_FALSE(referenceDhdl.empty());
+    ASSERT_EQ(8U, referenceDhdl[0].size());
+
+    ASSERT_EQ(0, runMdrun("simd", NULL, trajectory.c_str()));
+    log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    ASSERT_NE(std::string::npos,
+              log.find("Using SIMD kernel for the perturbed non-bonded interactions"));
+
+    std::vector<gmx::test::EnergyFrame> energies =
+        gmx::test::readEnergyFrames(runner_.edrFileName_);
+    gmx::test::compareEnergyFrames(referenceEnergies, energies, c_energyTerms, 1e-5);
+    gmx::test::compareEnergyFrames(referenceEnergies, energies, c_dvdlTerms, c_dhdlTolerance);
+    gmx::test::compareForceFrames(referenceForces,
+                                  gmx::test::readForceFrames(runner_.fullPrecisionTrajectoryFileName_),
+                                  1e-5);
+
+    std::vector<std::vector<double> > dhdl = readDhdlFile(dhdlFileName_);
+    ASSERT_EQ(referenceDhdl.size(), dhdl.size());
+    for (size_t i = 0; i < dhdl.size(); i++)
+    {
+        ASSERT_EQ(referenceDhdl[i].size(), dhdl[i].size());
+        for (size_t j = 1; j < dhdl[i].size(); j++)
+        {
+            double magnitude = std::max(std::fabs(referenceDhdl[i][j]), 1.0);
+            EXPECT_REAL_EQ_TOL(referenceDhdl[i][j], dhdl[i][j],
+                               gmx::test::relativeToleranceAsFloatingPoint(magnitude, c_dhdlTolerance))
+            << "column " << j << " in dH/dlambda frame " << i;
+        }
+    }
+}
+
+#ifdef GMX_SIMD_HAVE_REAL
+
+TEST_F(FreeEnergyKernelTest, SimdKernelReproducesPlainCKernelWithEwald)
+{
+    compareWithPlainCKernel("coulombtype = PME\n");
+}
+
+TEST_F(FreeEnergyKernelTest, SimdKernelReproducesPlainCKernelWithReactionField)
+{
+    compareWithPlainCKernel("coulombtype = reaction-field\n"
+                            "epsilon-rf = 62\n");
+}
+
+#endif
+
+} // namespace
@@ -0,0 +1,111 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests the space-filling curve orders of the pair-search grid columns.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/utility/stringutil.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Energy terms compared between the column orders
+const char *const c_energyTerms[] = { "LJ (SR)", "Coulomb (SR)", "Potential", "Pressure", NULL };
+
+/*! \brief Relative tolerance for the comparison with x-major order
+ *
+ * The pair lists contain the same pairs, but in a different order,
+ * so the forces are summed in a different order.
+ */
+const real c_tolerance = 1e-5;
+
+/*! \brief Test fixture for the grid column orders
+ *
+ * The parameter is the column order.
+ */
+class GridColumnOrderTest : public gmx::test::ParameterizedMdrunTestFixture
+{
+    public:
+        /*! \brief Checks that the column order of the test parameter
+         * reproduces x-major order
+         *
+         * With thread-MPI mdrun uses \p numRanks ranks, more than one
+         * gives domain decomposition.
+         */
+        void compareWithXMajorOrder(int numRanks);
+};
+
+void GridColumnOrderTest::compareWithXMajorOrder(int numRanks)
+{
+    gmx::test::MdrunComparison comparison(&runner_, &fileManager_);
+    comparison.prepare("spc216");
+    comparison.commandLine().addOption("-npme", 0);
+    comparison.setThreads(numRanks, 1);
+    comparison.setEnergyTerms(c_energyTerms);
+    comparison.setTolerances(c_tolerance, c_tolerance);
+
+    const char *const xMajorEnvironment[] = { "GMX_NBNXN_COLUMN_ORDER=xmajor", NULL };
+    std::string       columnOrder         = gmx::formatString("GMX_NBNXN_COLUMN_ORDER=%s", GetParam());
+    const char *const environment[]       = { columnOrder.c_str(), NULL };
+    comparison.compareReruns(xMajorEnvironment, environment);
+}
+
+//! The curve covers all columns of the single grid
+TEST_P(GridColumnOrderTest, ReproducesXMajorOrder)
+{
+    compareWithXMajorOrder(1);
+}
+
+//! With a 2x1x1 domain decomposition the local and non-local grids use the curve
+TEST_P(GridColumnOrderTest, ReproducesXMajorOrderWithDomainDecomposition)
+{
+    compareWithXMajorOrder(2);
+}
+
+INSTANTIATE_TEST_CASE_P(CurveOrders, GridColumnOrderTest,
+                            ::testing::Values("morton", "hilbert"));
+
+} // namespace
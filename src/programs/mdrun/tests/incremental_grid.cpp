@@ -0,0 +1,88 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests for the incremental update of the pair-search grid in mdrun.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include <gtest/gtest.h>
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Test fixture for mdrun with the incremental pair-search grid update
+typedef gmx::test::MdrunTestFixture IncrementalGridTest;
+
+/* In 500 steps of 2 fs the waters move several times the 0.3 nm
+ * width of a grid column, so many atoms change column between searches.
+ * The incremental update should give the same atom order as the full
+ * sort, so the trajectories should be bitwise identical. Work stealing
+ * in the non-bonded kernels changes the summation order between runs,
+ * so we use -reprod.
+ */
+TEST_F(IncrementalGridTest, ReproducesFullSortBitwise)
+{
+    runner_.useStringAsMdpFile("cutoff-scheme = Verlet\n"
+                               "coulombtype = PME\n"
+                               "rcoulomb = 0.7\n"
+                               "rvdw = 0.7\n"
+                               "dt = 0.002\n"
+                               "nsteps = 500\n"
+                               "nstlist = 10\n"
+                               "nstcalcenergy = 100\n"
+                               "nstenergy = 100\n"
+                               "nstxout = 100\n"
+                               "nstfout = 100\n"
+                               "gen-vel = yes\n"
+                               "gen-temp = 300\n"
+                               "gen-seed = 1993\n");
+    runner_.useTopGroAndNdxFromDatabase("spc216");
+    ASSERT_EQ(0, runner_.callGrompp());
+
+    gmx::test::MdrunComparison comparison(&runner_, &fileManager_);
+    comparison.commandLine().append("-reprod");
+    comparison.setThreads(1, 2);
+
+    const char *const fullSortEnvironment[] = { "GMX_NBNXN_FULL_GRID_SORT=1", NULL };
+    comparison.compareRunsBitwise(fullSortEnvironment, NULL);
+}
+
+} // namespace
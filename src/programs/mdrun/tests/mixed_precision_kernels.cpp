@@ -0,0 +1,149 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests the mixed-precision non-bonded kernels of double precision builds.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/mdlib/nbnxn_simd.h"
+#include "gromacs/utility/textreader.h"
+
+#include "testutils/cmdlinetest.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+#ifdef GMX_NBNXN_SIMD_2XNN_MIXED
+
+//! Energy terms compared between the double and mixed-precision kernels
+const char *const c_energyTerms[] = { "LJ (SR)", "Coulomb (SR)", "Potential", "Pressure", NULL };
+
+/*! \brief Relative tolerance for the comparison with the double kernels
+ *
+ * The pair interactions are computed in single precision, but summed
+ * in double precision, so the accumulated error stays close to single
+ * precision rounding of the individual pair terms.
+ */
+const real c_tolerance = 1e-5;
+
+//! Test fixture for the mixed-precision non-bonded kernels
+class MixedPrecisionKernelTest : public gmx::test::MdrunTestFixture
+{
+    public:
+        /*! \brief Checks that the mixed-precision kernels reproduce the
+         * double precision kernels for spc216 with PME and \p extraMdp
+         */
+        void compareWithDoubleKernels(const char *extraMdp);
+};
+
+void MixedPrecisionKernelTest::compareWithDoubleKernels(const char *extraMdp)
+{
+    gmx::test::MdrunComparison comparison(&runner_, &fileManager_);
+    comparison.prepare("spc216", extraMdp);
+    comparison.setThreads(1, 2);
+    comparison.setEnergyTerms(c_energyTerms);
+    comparison.setTolerances(c_tolerance, c_tolerance);
+
+    /* The mixed-precision kernels only have the analytical Ewald
+     * correction, use it in the reference as well.
+     */
+    const char *const referenceEnvironment[] = { "GMX_NBNXN_EWALD_ANALYTICAL=1", NULL };
+    const char *const environment[]          = { "GMX_NBNXN_MIXED_PRECISION=1", NULL };
+    comparison.compareReruns(referenceEnvironment, environment);
+
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    EXPECT_NE(std::string::npos, log.find("Using mixed-precision non-bonded kernels"));
+}
+
+TEST_F(MixedPrecisionKernelTest, ReproducesDoubleKernelsWithEwald)
+{
+    compareWithDoubleKernels("");
+}
+
+TEST_F(MixedPrecisionKernelTest, ReproducesDoubleKernelsWithForceSwitch)
+{
+    compareWithDoubleKernels("vdw-modifier = force-switch\n"
+                             "rvdw-switch = 0.5\n");
+}
+
+/* User tables are not supported by the mixed-precision kernels,
+ * mdrun should note this and use the double kernels.
+ */
+TEST_F(MixedPrecisionKernelTest, FallsBackToDoubleKernelsWithUserTables)
+{
+    const char *const            environment[] = { "GMX_NBNXN_MIXED_PRECISION=1", NULL };
+    gmx::test::ScopedEnvironment env(environment);
+
+    std::string                  tableFileName = fileManager_.getTemporaryFilePath("table.xvg");
+    gmx::test::writeUserTable(tableFileName);
+    /* The warning about combination rules with user potentials */
+    runner_.maxWarnings_ = 1;
+    runner_.useStringAsMdpFile("cutoff-scheme = Verlet\n"
+                               "coulombtype = user\n"
+                               "vdwtype = user\n"
+                               "rcoulomb = 0.7\n"
+                               "rvdw = 0.7\n"
+                               "verlet-buffer-tolerance = -1\n"
+                               "rlist = 0.8\n"
+                               "nsteps = 0\n");
+    runner_.useTopGroAndNdxFromDatabase("spc216");
+    ASSERT_EQ(0, runner_.callGrompp());
+
+    ::gmx::test::CommandLine caller;
+    caller.append("mdrun");
+    caller.addOption("-table", tableFileName);
+#ifdef GMX_THREAD_MPI
+    caller.addOption("-ntmpi", 1);
+#endif
+    ASSERT_EQ(0, runner_.callMdrun(caller));
+
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    EXPECT_NE(std::string::npos, log.find("user tables are not supported"));
+    EXPECT_EQ(std::string::npos, log.find("Using mixed-precision non-bonded kernels"));
+}
+
+#endif
+
+} // namespace
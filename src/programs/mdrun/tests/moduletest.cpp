@@ -45,6 +45,8 @@
 
 #include "config.h"
 
+#include <cstring>
+
 #include "gromacs/gmxpreprocess/grompp.h"
 #include "gromacs/options/basicoptions.h"
 #include "gromacs/options/ioptionscontainer.h"
@@ -93,6 +95,19 @@ GMX_TEST_OPTIONS(MdrunTestOptions, options)
 }
 //! \endcond
 
+//! Returns whether the command line in \p caller contains \p option
+bool containsOption(const CommandLine &caller, const char *option)
+{
+    for (int i = 0; i < caller.argc(); i++)
+    {
+        if (std::strcmp(caller.arg(i), option) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 }
 
 SimulationRunner::SimulationRunner(IntegrationTestFixture *fixture) :
@@ -106,7 +121,8 @@ SimulationRunner::SimulationRunner(IntegrationTestFixture *fixture) :
     tprFileName_(fixture_->fileManager_.getTemporaryFilePath(".tpr")),
     logFileName_(fixture_->fileManager_.getTemporaryFilePath(".log")),
     edrFileName_(fixture_->fileManager_.getTemporaryFilePath(".edr")),
-    nsteps_(-2)
+    nsteps_(-2),
+    maxWarnings_(0)
 {
 #ifdef GMX_LIB_MPI
     GMX_RELEASE_ASSERT(gmx_mpi_initialized(), "MPI system not initialized for mdrun tests");
@@ -168,6 +184,10 @@ SimulationRunner::callGromppOnThisRank()
 
     caller.addOption("-po", mdpOutputFileName_);
     caller.addOption("-o", tprFileName_);
+    if (maxWarnings_ > 0)
+    {
+        caller.addOption("-maxwarn", maxWarnings_);
+    }
 
     return gmx_grompp(caller.argc(), caller.argv());
 }
@@ -229,12 +249,19 @@ SimulationRunner::callMdrun(const CommandLine &callerRef)
 #  endif
 #endif
 
+    /* Tests that need a specific number of ranks or threads set these */
 #ifdef GMX_THREAD_MPI
-    caller.addOption("-nt", g_numThreads);
+    if (!containsOption(caller, "-nt") && !containsOption(caller, "-ntmpi"))
+    {
+        caller.addOption("-nt", g_numThreads);
+    }
 #endif
 
 #ifdef GMX_OPENMP
-    caller.addOption("-ntomp", g_numOpenMPThreads);
+    if (!containsOption(caller, "-ntomp"))
+    {
+        caller.addOption("-ntomp", g_numOpenMPThreads);
+    }
 #endif
 
     return gmx_mdrun(caller.argc(), caller.argv());
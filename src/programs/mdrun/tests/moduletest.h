@@ -93,7 +93,11 @@ class SimulationRunner
         int callGrompp();
         //! Calls grompp (on this rank) to prepare for the mdrun test
         int callGromppOnThisRank();
-        //! Calls mdrun for testing with a customized command line
+        /*! \brief Calls mdrun for testing with a customized command line
+         *
+         * The numbers of ranks and OpenMP threads given to the test
+         * binary are used, unless \p callerRef sets -nt, -ntmpi or -ntomp.
+         */
         int callMdrun(const CommandLine &callerRef);
         /*! \brief Convenience wrapper for calling mdrun for testing
          * with default command line */
@@ -128,6 +132,7 @@ class SimulationRunner
         std::string cptFileName_;
         std::string swapFileName_;
         int         nsteps_;
+        int         maxWarnings_;
         //@}
 };
 
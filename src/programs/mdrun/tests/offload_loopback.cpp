@@ -0,0 +1,340 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+
+/*! \internal \file
+ * \brief
+ * Tests for running the offloaded non-bonded kernels on the loopback
+ * offload target
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/mdlib/nbnxn_simd.h"
+#include "gromacs/utility/stringutil.h"
+#include "gromacs/utility/textreader.h"
+
+#include "testutils/cmdlinetest.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Energy terms compared between offloaded and host runs
+const char *const c_energyTerms[] = { "LJ (SR)", "Coulomb (SR)", "Potential", NULL };
+
+//! Test fixture for mdrun with the loopback offload target
+class OffloadLoopbackTest : public gmx::test::MdrunTestFixture
+{
+    public:
+        /*! \brief Runs grompp for 216 waters
+         *
+         * Energies, coordinates and forces are written every 5 steps,
+         * \p extraMdp is appended to the mdp settings. The interactions
+         * are set by \p interactionMdp, PME by default.
+         */
+        void prepare(const char *extraMdp       = "",
+                     const char *interactionMdp = "coulombtype = PME\n");
+        /*! \brief Runs mdrun with output file names containing \p tag
+         *
+         * \p environment is a NULL-terminated list of NAME=value
+         * settings. With \p rerunFileName != NULL, reruns that trajectory.
+         */
+        int runMdrun(const char        *tag,
+                     const char *const  environment[],
+                     const char        *rerunFileName = NULL,
+                     int                numRanks = 1);
+        /*! \brief Checks that offloading with \p environment reproduces a host run
+         *
+         * The single-rank reference run does not offload. The energies of
+         * an MD run with offload should match within the divergence over
+         * 20 steps. A rerun of the reference trajectory with offload should
+         * reproduce the reference energies and forces closely.
+         */
+        void compareWithHostRun(const char *const environment[],
+                                int               numRanks   = 1,
+                                const char *const extraTerms[] = NULL);
+        //! The table file for user potentials passed to mdrun, when not empty
+        std::string tableFileName_;
+};
+
+void OffloadLoopbackTest::prepare(const char *extraMdp,
+                                  const char *interactionMdp)
+{
+    std::string mdp("cutoff-scheme = Verlet\n"
+                    "rcoulomb = 0.7\n"
+                    "rvdw = 0.7\n"
+                    "nsteps = 20\n"
+                    "nstlist = 10\n"
+                    "nstcalcenergy = 5\n"
+                    "nstenergy = 5\n"
+                    "nstxout = 5\n"
+                    "nstfout = 5\n");
+    runner_.useStringAsMdpFile(mdp + interactionMdp + extraMdp);
+    runner_.useTopGroAndNdxFromDatabase("spc216");
+    ASSERT_EQ(0, runner_.callGrompp());
+}
+
+int OffloadLoopbackTest::runMdrun(const char        *tag,
+                                  const char *const  environment[],
+                                  const char        *rerunFileName,
+                                  int                numRanks)
+{
+    std::string name(tag);
+    runner_.edrFileName_                     = fileManager_.getTemporaryFilePath(name + ".edr");
+    runner_.logFileName_                     = fileManager_.getTemporaryFilePath(name + ".log");
+    runner_.fullPrecisionTrajectoryFileName_ = fileManager_.getTemporaryFilePath(name + ".trr");
+
+    ::gmx::test::CommandLine caller;
+    caller.append("mdrun");
+    if (rerunFileName != NULL)
+    {
+        caller.addOption("-rerun", rerunFileName);
+    }
+    if (!tableFileName_.empty())
+    {
+        caller.addOption("-table", tableFileName_);
+    }
+#ifdef GMX_THREAD_MPI
+    caller.addOption("-ntmpi", numRanks);
+#else
+    GMX_UNUSED_VALUE(numRanks);
+#endif
+
+    gmx::test::ScopedEnvironment env(environment);
+    return runner_.callMdrun(caller);
+}
+
+void OffloadLoopbackTest::compareWithHostRun(const char *const environment[],
+                                             int               numRanks,
+                                             const char *const extraTerms[])
+{
+    std::vector<const char *> terms(c_energyTerms, c_energyTerms + 3);
+    for (int i = 0; extraTerms != NULL && extraTerms[i] != NULL; i++)
+    {
+        terms.push_back(extraTerms[i]);
+    }
+    terms.push_back(NULL);
+
+    ASSERT_EQ(0, runMdrun("reference", NULL));
+    std::string referenceTrajectory = runner_.fullPrecisionTrajectoryFileName_;
+    std::vector<gmx::test::EnergyFrame> referenceEnergies =
+        gmx::test::readEnergyFrames(runner_.edrFileName_);
+    std::vector<gmx::test::ForceFrame>  referenceForces   =
+        gmx::test::readForceFrames(referenceTrajectory);
+
+    ASSERT_EQ(0, runMdrun("offload", environment, NULL, numRanks));
+    gmx::test::compareEnergyFrames(referenceEnergies,
+                                   gmx::test::readEnergyFrames(runner_.edrFileName_),
+                                   &terms[0], 1e-4);
+
+    ASSERT_EQ(0, runMdrun("rerun", environment, referenceTrajectory.c_str(), numRanks));
+    gmx::test::compareEnergyFrames(referenceEnergies,
+                                   gmx::test::readEnergyFrames(runner_.edrFileName_),
+                                   &terms[0], 1e-5);
+    gmx::test::compareForceFrames(referenceForces,
+                                  gmx::test::readForceFrames(runner_.fullPrecisionTrajectoryFileName_),
+                                  1e-5);
+}
+
+#if !defined GMX_OFFLOAD && !defined GMX_NATIVE_WINDOWS
+/* Runs the whole offload path, including pair-list refreshes and
+ * energy steps, with the offload target emulated on the host.
+ */
+TEST_F(OffloadLoopbackTest, ReproducesHostRun)
+{
+    const char *const environment[] = { "GMX_OFFLOAD_LOOPBACK=1", NULL };
+
+    prepare();
+    compareWithHostRun(environment);
+}
+
+#ifdef GMX_THREAD_MPI
+/* With domain decomposition the halo interactions are offloaded on the
+ * non-local stream, the results should match a single-rank host run.
+ */
+TEST_F(OffloadLoopbackTest, ReproducesHostRunWithDomainDecomposition)
+{
+    const char *const environment[] = { "GMX_OFFLOAD_LOOPBACK=1", NULL };
+
+    prepare();
+    compareWithHostRun(environment, 2);
+}
+#endif
+
+#ifdef GMX_THREAD_MPI
+/* With several devices in the node the ranks are mapped over them and
+ * each rank creates its own offload context and device state.
+ */
+TEST_F(OffloadLoopbackTest, ReproducesHostRunWithSeveralDevices)
+{
+    const char *const environment[] = { "GMX_OFFLOAD_LOOPBACK=2", NULL };
+
+    prepare();
+    compareWithHostRun(environment, 2);
+
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    EXPECT_NE(std::string::npos,
+              log.find("Mapping of offload devices to the 2 PP ranks in this node: 0,1"));
+}
+#endif
+
+/* The host computes a fixed share of the pair lists next to the target */
+TEST_F(OffloadLoopbackTest, ReproducesHostRunWithHostShare)
+{
+    const char *const environment[] = {
+        "GMX_OFFLOAD_LOOPBACK=1", "GMX_OFFLOAD_HOST_FRACTION=0.5", NULL
+    };
+
+    prepare();
+    compareWithHostRun(environment);
+
+#ifdef GMX_NBNXN_SIMD_2XNN
+    /* The host share needs pair lists for the host SIMD width */
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    EXPECT_NE(std::string::npos, log.find("The host computes 50% of the non-bonded work"));
+#endif
+}
+
+#ifdef GMX_NBNXN_SIMD_4XN
+/* The 4xN kernels with energy groups run on the target as well.
+ * The host share is fixed, since balancing it at run time changes
+ * the summation order of the small energy-group terms.
+ */
+TEST_F(OffloadLoopbackTest, ReproducesHostRunWith4xNAndEnergyGroups)
+{
+    const char *const environment[] = {
+        "GMX_OFFLOAD_LOOPBACK=1", "GMX_NBNXN_SIMD_4XN=1",
+        "GMX_OFFLOAD_HOST_FRACTION=0", NULL
+    };
+    const char *const groupTerms[] = {
+        "Coul-SR:FirstHalf-FirstHalf", "LJ-SR:FirstHalf-FirstHalf",
+        "Coul-SR:FirstHalf-SecondHalf", "LJ-SR:FirstHalf-SecondHalf",
+        "Coul-SR:SecondHalf-SecondHalf", "LJ-SR:SecondHalf-SecondHalf", NULL
+    };
+
+    prepare("energygrps = FirstHalf SecondHalf\n");
+    compareWithHostRun(environment, 1, groupTerms);
+
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    EXPECT_NE(std::string::npos,
+              log.find(gmx::formatString("4x%d non-bonded kernels", GMX_SIMD_REAL_WIDTH)));
+}
+#endif
+
+/* The pair lists are built on the target from the host search grid */
+TEST_F(OffloadLoopbackTest, ReproducesHostRunWithSearchOnTarget)
+{
+    const char *const environment[] = {
+        "GMX_OFFLOAD_LOOPBACK=1", "GMX_OFFLOAD_SEARCH=1", NULL
+    };
+
+    prepare();
+    compareWithHostRun(environment);
+
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    EXPECT_NE(std::string::npos,
+              log.find("The non-bonded pair lists are built on the offload target"));
+}
+
+/* The tabulated Ewald correction is sent to the target */
+TEST_F(OffloadLoopbackTest, ReproducesHostRunWithEwaldTable)
+{
+    const char *const           tableEnvironment[] = { "GMX_NBNXN_EWALD_TABLE=1", NULL };
+    const char *const           environment[]      = { "GMX_OFFLOAD_LOOPBACK=1", NULL };
+    gmx::test::ScopedEnvironment env(tableEnvironment);
+
+    prepare();
+    compareWithHostRun(environment);
+}
+
+/* The cubic spline table for user potentials is sent to the target */
+TEST_F(OffloadLoopbackTest, ReproducesHostRunWithUserTables)
+{
+    const char *const environment[] = { "GMX_OFFLOAD_LOOPBACK=1", NULL };
+
+    tableFileName_ = fileManager_.getTemporaryFilePath("table.xvg");
+    gmx::test::writeUserTable(tableFileName_);
+    /* The warning about combination rules with user potentials */
+    runner_.maxWarnings_ = 1;
+    prepare("", "coulombtype = user\n"
+            "vdwtype = user\n"
+            "verlet-buffer-tolerance = -1\n"
+            "rlist = 0.8\n");
+    compareWithHostRun(environment);
+}
+
+/* The per-step offload timings are written as JSON lines */
+TEST_F(OffloadLoopbackTest, WritesTrace)
+{
+    prepare();
+
+    std::string       traceFileName = fileManager_.getTemporaryFilePath(".json");
+    std::string       traceSetting  = "GMX_OFFLOAD_TRACE=" + traceFileName;
+    const char *const environment[] = { "GMX_OFFLOAD_LOOPBACK=1", traceSetting.c_str(), NULL };
+    ASSERT_EQ(0, runMdrun("trace", environment));
+
+    /* One line per step, with the step and the kernel time */
+    gmx::TextReader          reader(traceFileName);
+    std::vector<std::string> lines;
+    std::string              line;
+    while (reader.readLineTrimmed(&line))
+    {
+        if (!line.empty())
+        {
+            lines.push_back(line);
+        }
+    }
+    ASSERT_EQ(21U, lines.size());
+    for (size_t step = 0; step < lines.size(); step++)
+    {
+        std::string start = gmx::formatString("{\"step\": %d,", static_cast<int>(step));
+        EXPECT_TRUE(gmx::startsWith(lines[step], start)) << lines[step];
+        EXPECT_NE(std::string::npos, lines[step].find("\"kernel\": ")) << lines[step];
+        EXPECT_TRUE(gmx::endsWith(lines[step], "}")) << lines[step];
+    }
+}
+#endif
+
+} // namespace
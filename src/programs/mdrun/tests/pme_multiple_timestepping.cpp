@@ -0,0 +1,220 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests for applying the PME mesh forces with multiple time stepping.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <cmath>
+#include <cstdlib>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/utility/stringutil.h"
+#include "gromacs/utility/textreader.h"
+
+#include "testutils/cmdlinetest.h"
+#include "testutils/testasserts.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! The number of steps of each run
+const int c_numSteps = 400;
+
+//! Test fixture for mdrun with the PME mesh forces applied every nstcalcpme steps
+class PmeMultipleTimeSteppingTest : public gmx::test::MdrunTestFixture
+{
+    public:
+        /*! \brief Checks that nstcalcpme = 2 conserves energy like nstcalcpme = 1
+         *
+         * Runs c_numSteps steps of 216 flexible waters without coupling
+         * with \p integrator and nstcalcpme 1 and 2, from the same
+         * generated velocities. With the mesh forces applied as an
+         * impulse every other step, the conserved energy should drift
+         * and fluctuate about as little as when they are applied every
+         * step. The mesh part should only be computed at \p numMeshSteps
+         * steps.
+         */
+        void compareWithSingleTimeStepping(const char *integrator,
+                                           int         numMeshSteps);
+        //! Runs grompp and mdrun with \p nstcalcpme, returns the energy frames
+        std::vector<gmx::test::EnergyFrame> runWithInterval(const char *integrator,
+                                                            int         nstcalcpme);
+};
+
+std::vector<gmx::test::EnergyFrame>
+PmeMultipleTimeSteppingTest::runWithInterval(const char *integrator,
+                                             int         nstcalcpme)
+{
+    std::string mdp = gmx::formatString("integrator = %s\n"
+                                        "define = -DFLEXIBLE\n"
+                                        "dt = 0.0005\n"
+                                        "nsteps = %d\n"
+                                        "cutoff-scheme = Verlet\n"
+                                        "verlet-buffer-tolerance = 0.0001\n"
+                                        "coulombtype = PME\n"
+                                        "rcoulomb = 0.7\n"
+                                        "rvdw = 0.7\n"
+                                        "fourierspacing = 0.12\n"
+                                        "nstcalcenergy = 10\n"
+                                        "nstenergy = 10\n"
+                                        "gen-vel = yes\n"
+                                        "gen-temp = 300\n"
+                                        "gen-seed = 1993\n"
+                                        "nstcalcpme = %d\n",
+                                        integrator, c_numSteps, nstcalcpme);
+    std::string tag = gmx::formatString("nstcalcpme%d", nstcalcpme);
+
+    runner_.useStringAsMdpFile(mdp);
+    runner_.useTopGroAndNdxFromDatabase("spc216");
+    runner_.tprFileName_ = fileManager_.getTemporaryFilePath(tag + ".tpr");
+    runner_.edrFileName_ = fileManager_.getTemporaryFilePath(tag + ".edr");
+    runner_.logFileName_ = fileManager_.getTemporaryFilePath(tag + ".log");
+    EXPECT_EQ(0, runner_.callGrompp());
+    EXPECT_EQ(0, runner_.callMdrun());
+
+    return gmx::test::readEnergyFrames(runner_.edrFileName_);
+}
+
+//! Returns the drift per step of \p name in \p frames from a linear fit
+double energyDrift(const std::vector<gmx::test::EnergyFrame> &frames,
+                   const char                                *name)
+{
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    int    n  = frames.size();
+
+    for (int i = 0; i < n; i++)
+    {
+        double y = frames[i].find(name)->second;
+
+        sx  += i;
+        sy  += y;
+        sxx += i*i;
+        sxy += i*y;
+    }
+
+    return (n*sxy - sx*sy)/(n*sxx - sx*sx);
+}
+
+//! Returns the root mean square deviation of \p name in \p frames from its average
+double energyFluctuation(const std::vector<gmx::test::EnergyFrame> &frames,
+                         const char                                *name)
+{
+    double sum = 0, sum2 = 0;
+    int    n   = frames.size();
+
+    for (int i = 0; i < n; i++)
+    {
+        double y = frames[i].find(name)->second;
+
+        sum  += y;
+        sum2 += y*y;
+    }
+
+    return std::sqrt(std::max(sum2/n - (sum/n)*(sum/n), 0.0));
+}
+
+//! Returns the number of PME mesh calls in the cycle accounting of the log file \p logFileName
+int pmeMeshCalls(const std::string &logFileName)
+{
+    gmx::TextReader reader(logFileName);
+    std::string     line;
+
+    while (reader.readLine(&line))
+    {
+        if (gmx::startsWith(line, " PME mesh "))
+        {
+            std::vector<std::string> fields = gmx::splitString(line);
+
+            return std::atoi(fields[4].c_str());
+        }
+    }
+
+    return -1;
+}
+
+void PmeMultipleTimeSteppingTest::compareWithSingleTimeStepping(const char *integrator,
+                                                                int         numMeshSteps)
+{
+    std::vector<gmx::test::EnergyFrame> reference = runWithInterval(integrator, 1);
+    std::vector<gmx::test::EnergyFrame> test      = runWithInterval(integrator, 2);
+
+    ASSERT_EQ(c_numSteps/10 + 1, static_cast<int>(reference.size()));
+    ASSERT_EQ(reference.size(), test.size());
+    EXPECT_EQ(numMeshSteps, pmeMeshCalls(runner_.logFileName_));
+
+    /* Both runs apply the full mesh forces at the first step */
+    EXPECT_REAL_EQ_TOL(reference[0].find("Potential")->second,
+                       test[0].find("Potential")->second,
+                       gmx::test::relativeToleranceAsFloatingPoint(reference[0].find("Potential")->second, 1e-6));
+
+    /* The drift per frame is 0.03 to 0.07 kJ/mol, the fluctuation 5 to 11 kJ/mol */
+    double referenceDrift = std::fabs(energyDrift(reference, "Total Energy"));
+    double drift          = std::fabs(energyDrift(test, "Total Energy"));
+    EXPECT_LT(drift, 1.5*referenceDrift + 0.01)
+    << "nstcalcpme = 1 drifts " << referenceDrift << " kJ/mol per frame";
+    double referenceFluctuation = energyFluctuation(reference, "Total Energy");
+    double fluctuation          = energyFluctuation(test, "Total Energy");
+    EXPECT_LT(fluctuation, 1.2*referenceFluctuation)
+    << "nstcalcpme = 1 fluctuates " << referenceFluctuation << " kJ/mol";
+}
+
+TEST_F(PmeMultipleTimeSteppingTest, ConservesEnergyWithMd)
+{
+    /* Every even step, which includes all energy steps */
+    compareWithSingleTimeStepping("md", c_numSteps/2 + 1);
+}
+
+/* With VV the mesh forces are reused by both velocity half-steps */
+TEST_F(PmeMultipleTimeSteppingTest, ConservesEnergyWithMdVv)
+{
+    /* VV also computes the virial at the step before an energy step */
+    compareWithSingleTimeStepping("md-vv", c_numSteps/2 + 1 + c_numSteps/10);
+}
+
+} // namespace
@@ -0,0 +1,97 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests exchanging coordinates and forces between PP and PME ranks
+ * through shared memory.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <gtest/gtest.h>
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+#ifdef GMX_THREAD_MPI
+
+//! Energy terms compared between the shared memory and copying runs
+const char *const c_energyTerms[] = { "Coul. recip.", "Potential", "Pressure", NULL };
+
+/*! \brief Relative tolerance for the comparison with copying
+ *
+ * The PME rank receives the same coordinates and the PP ranks add the
+ * same forces, only read in place, so the results should be identical.
+ */
+const real c_tolerance = 1e-6;
+
+/*! \brief Test fixture for exchanging PP-PME data through shared memory
+ *
+ * The parameter is the number of thread-MPI ranks, one of which is
+ * a PME rank.
+ */
+class PmePpSharedMemoryTest : public gmx::test::MdrunTestFixture,
+                              public ::testing::WithParamInterface<int>
+{
+};
+
+//! Reading coordinates and forces in place should reproduce copying them
+TEST_P(PmePpSharedMemoryTest, ReproducesCopying)
+{
+    gmx::test::MdrunComparison comparison(&runner_, &fileManager_);
+    comparison.prepare("spc216");
+    comparison.commandLine().addOption("-ntmpi", GetParam());
+    comparison.commandLine().addOption("-npme", 1);
+    comparison.setEnergyTerms(c_energyTerms);
+    comparison.setTolerances(c_tolerance, c_tolerance);
+
+    const char *const copyEnvironment[] = { "GMX_NO_PME_PP_SHARED=1", NULL };
+    comparison.compareReruns(copyEnvironment, NULL);
+}
+
+/* With two ranks the PME rank reads the coordinates of its single PP
+ * rank in place, with three it gathers those of two PP ranks.
+ */
+INSTANTIATE_TEST_CASE_P(NumberOfRanks, PmePpSharedMemoryTest, ::testing::Values(2, 3));
+
+#endif
+
+} // namespace
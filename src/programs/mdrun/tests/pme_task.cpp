@@ -0,0 +1,86 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests running the PME mesh part on a task thread within the PP rank.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/utility/textreader.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Energy terms compared between the runs with and without the task thread
+const char *const c_energyTerms[] = { "Coul. recip.", "Potential", "Pressure", NULL };
+
+/*! \brief Relative tolerance for the comparison with PME in the PP thread
+ *
+ * The task computes the same mesh forces, but they are added to the
+ * other forces in a different order.
+ */
+const real c_tolerance = 1e-5;
+
+//! Test fixture for running PME on a task thread
+typedef gmx::test::MdrunTestFixture PmeTaskTest;
+
+//! PME on a task thread should reproduce PME in the PP thread
+TEST_F(PmeTaskTest, ReproducesPmeInPpThread)
+{
+    gmx::test::MdrunComparison comparison(&runner_, &fileManager_);
+    comparison.prepare("spc216");
+    comparison.setThreads(1, 2);
+    comparison.setEnergyTerms(c_energyTerms);
+    comparison.setTolerances(c_tolerance, c_tolerance);
+
+    const char *const environment[] = { "GMX_PME_TASK_THREADS=1", NULL };
+    comparison.compareReruns(NULL, environment);
+
+    std::string log = gmx::TextReader::readFileToString(runner_.logFileName_);
+    EXPECT_NE(std::string::npos, log.find("Running PME on a task thread"));
+    /* The mesh time is accounted separately from the force time */
+    EXPECT_NE(std::string::npos, log.find("the PME mesh part ran on a task thread"));
+}
+
+} // namespace
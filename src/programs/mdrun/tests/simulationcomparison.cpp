@@ -0,0 +1,389 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Implements helpers in simulationcomparison.h.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "simulationcomparison.h"
+
+#include "config.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/fileio/enxio.h"
+#include "gromacs/fileio/trrio.h"
+#include "gromacs/utility/basedefinitions.h"
+#include "gromacs/utility/gmxassert.h"
+#include "gromacs/utility/smalloc.h"
+#include "gromacs/utility/stringutil.h"
+#include "gromacs/utility/textwriter.h"
+
+#include "testutils/testasserts.h"
+#include "testutils/testfilemanager.h"
+
+#include "moduletest.h"
+
+namespace gmx
+{
+
+namespace test
+{
+
+std::vector<EnergyFrame> readEnergyFrames(const std::string &fileName)
+{
+    std::vector<EnergyFrame> frames;
+    ener_file_t              fp;
+    int                      nre;
+    gmx_enxnm_t             *enm = NULL;
+    t_enxframe              *fr;
+
+    fp = open_enx(fileName.c_str(), "r");
+    do_enxnms(fp, &nre, &enm);
+    snew(fr, 1);
+    while (do_enx(fp, fr))
+    {
+        EnergyFrame frame;
+        for (int i = 0; i < fr->nre; i++)
+        {
+            frame[enm[i].name] = fr->ener[i].e;
+        }
+        frames.push_back(frame);
+    }
+    free_enxframe(fr);
+    sfree(fr);
+    free_enxnms(nre, enm);
+    close_enx(fp);
+
+    return frames;
+}
+
+/*! \brief Reads the coordinates, or with \p bForces the forces, of all
+ * frames of the .trr file \p fileName that contain them */
+static std::vector< std::vector<RVec> >
+readTrajectoryFrames(const std::string &fileName, bool bForces)
+{
+    std::vector< std::vector<RVec> > frames;
+    struct t_fileio                 *fio;
+    gmx_trr_header_t                 header;
+    gmx_bool                         bOK;
+
+    fio = gmx_trr_open(fileName.c_str(), "r");
+    while (gmx_trr_read_frame_header(fio, &header, &bOK))
+    {
+        rvec  box[DIM];
+        rvec *x = NULL, *v = NULL, *f = NULL;
+
+        if (header.x_size)
+        {
+            snew(x, header.natoms);
+        }
+        if (header.v_size)
+        {
+            snew(v, header.natoms);
+        }
+        if (header.f_size)
+        {
+            snew(f, header.natoms);
+        }
+        gmx_trr_read_frame_data(fio, &header, box, x, v, f);
+        rvec *data = (bForces ? f : x);
+        if (data != NULL)
+        {
+            frames.push_back(std::vector<RVec>(data, data + header.natoms));
+        }
+        sfree(x);
+        sfree(v);
+        sfree(f);
+    }
+    gmx_trr_close(fio);
+
+    return frames;
+}
+
+std::vector<CoordinateFrame> readCoordinateFrames(const std::string &fileName)
+{
+    return readTrajectoryFrames(fileName, false);
+}
+
+std::vector<ForceFrame> readForceFrames(const std::string &fileName)
+{
+    return readTrajectoryFrames(fileName, true);
+}
+
+void compareEnergyFrames(const std::vector<EnergyFrame> &reference,
+                         const std::vector<EnergyFrame> &test,
+                         const char *const               names[],
+                         real                            relativeTolerance)
+{
+    ASSERT_EQ(reference.size(), test.size()) << "Different number of energy frames";
+    for (size_t frame = 0; frame < reference.size(); frame++)
+    {
+        for (int i = 0; names[i] != NULL; i++)
+        {
+            EnergyFrame::const_iterator ref = reference[frame].find(names[i]);
+            EnergyFrame::const_iterator tst = test[frame].find(names[i]);
+            ASSERT_TRUE(ref != reference[frame].end()) << "No term " << names[i] << " in the reference";
+            ASSERT_TRUE(tst != test[frame].end()) << "No term " << names[i];
+
+            double magnitude = std::max(std::abs(ref->second), static_cast<real>(1));
+            EXPECT_REAL_EQ_TOL(ref->second, tst->second,
+                               relativeToleranceAsFloatingPoint(magnitude, relativeTolerance))
+            << names[i] << " in energy frame " << frame;
+        }
+    }
+}
+
+void compareForceFrames(const std::vector<ForceFrame> &reference,
+                        const std::vector<ForceFrame> &test,
+                        real                           relativeTolerance)
+{
+    ASSERT_EQ(reference.size(), test.size()) << "Different number of force frames";
+    for (size_t frame = 0; frame < reference.size(); frame++)
+    {
+        ASSERT_EQ(reference[frame].size(), test[frame].size());
+
+        real fmax = 0;
+        for (size_t a = 0; a < reference[frame].size(); a++)
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                fmax = std::max(fmax, std::abs(reference[frame][a][d]));
+            }
+        }
+        FloatingPointTolerance tolerance =
+            relativeToleranceAsFloatingPoint(fmax, relativeTolerance);
+        for (size_t a = 0; a < reference[frame].size(); a++)
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                EXPECT_REAL_EQ_TOL(reference[frame][a][d], test[frame][a][d], tolerance)
+                << "Force on atom " << a << " dim " << d << " in frame " << frame;
+            }
+        }
+    }
+}
+
+void compareFramesBitwise(const std::vector< std::vector<RVec> > &reference,
+                          const std::vector< std::vector<RVec> > &test,
+                          const char                             *quantity)
+{
+    ASSERT_EQ(reference.size(), test.size()) << "Different number of frames with " << quantity;
+    for (size_t frame = 0; frame < reference.size(); frame++)
+    {
+        ASSERT_EQ(reference[frame].size(), test[frame].size());
+        for (size_t a = 0; a < reference[frame].size(); a++)
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                EXPECT_REAL_EQ_TOL(reference[frame][a][d], test[frame][a][d], ulpTolerance(0))
+                << quantity << " of atom " << a << " dim " << d << " in frame " << frame;
+            }
+        }
+    }
+}
+
+void writeUserTable(const std::string &fileName)
+{
+    const double spacing   = 0.002;
+    const int    numPoints = 1001;
+    std::string  table;
+
+    for (int i = 0; i < numPoints; i++)
+    {
+        double r = i*spacing;
+        double f = 0, g = 0, h = 0;
+        double df = 0, dg = 0, dh = 0;
+
+        /* As in the distributed tables, the potentials are zero at short distance */
+        if (r >= 0.04)
+        {
+            f  = 1/r;
+            df = f/r;
+            g  = -std::pow(r, -6.0);
+            dg = 6*g/r;
+            h  = std::pow(r, -12.0);
+            dh = 12*h/r;
+        }
+        table += formatString("%.10e %.10e %.10e %.10e %.10e %.10e %.10e\n",
+                              r, f, df, g, dg, h, dh);
+    }
+    TextWriter::writeFileFromString(fileName, table);
+}
+
+ScopedEnvironment::ScopedEnvironment(const char *const variables[])
+{
+    for (int i = 0; variables != NULL && variables[i] != NULL; i++)
+    {
+        std::string            variable(variables[i]);
+        std::string::size_type pos = variable.find('=');
+
+        GMX_RELEASE_ASSERT(pos != std::string::npos, "Environment variables should be set as NAME=value");
+        names_.push_back(variable.substr(0, pos));
+        setenv(names_.back().c_str(), variable.substr(pos + 1).c_str(), 1);
+    }
+}
+
+ScopedEnvironment::~ScopedEnvironment()
+{
+    for (size_t i = 0; i < names_.size(); i++)
+    {
+        unsetenv(names_[i].c_str());
+    }
+}
+
+//! Energy terms compared by default by MdrunComparison
+static const char *const c_defaultEnergyTerms[] = { "Potential", "Pressure", NULL };
+
+MdrunComparison::MdrunComparison(SimulationRunner *runner,
+                                 TestFileManager  *fileManager)
+    : runner_(runner), fileManager_(fileManager),
+      energyTerms_(c_defaultEnergyTerms),
+      energyTolerance_(1e-5), forceTolerance_(1e-5)
+{
+    commandLine_.append("mdrun");
+}
+
+void MdrunComparison::prepare(const char *system, const char *extraMdp)
+{
+    std::string mdp("cutoff-scheme = Verlet\n"
+                    "coulombtype = PME\n"
+                    "rcoulomb = 0.7\n"
+                    "rvdw = 0.7\n"
+                    "nsteps = 20\n"
+                    "nstcalcenergy = 5\n"
+                    "nstenergy = 5\n"
+                    "nstxout = 5\n"
+                    "nstfout = 5\n");
+    runner_->useStringAsMdpFile(mdp + extraMdp);
+    runner_->useTopGroAndNdxFromDatabase(system);
+    ASSERT_EQ(0, runner_->callGrompp());
+}
+
+void MdrunComparison::setThreads(int numRanks, int numOpenMPThreads)
+{
+#ifdef GMX_THREAD_MPI
+    commandLine_.addOption("-ntmpi", numRanks);
+#else
+    GMX_UNUSED_VALUE(numRanks);
+#endif
+#ifdef GMX_OPENMP
+    commandLine_.addOption("-ntomp", numOpenMPThreads);
+#else
+    GMX_UNUSED_VALUE(numOpenMPThreads);
+#endif
+}
+
+void MdrunComparison::setTolerances(real energyTolerance, real forceTolerance)
+{
+    energyTolerance_ = energyTolerance;
+    forceTolerance_  = forceTolerance;
+}
+
+int MdrunComparison::runMdrun(const char        *tag,
+                              const char *const  environment[],
+                              const char        *rerunFileName)
+{
+    std::string name(tag);
+    runner_->edrFileName_                     = fileManager_->getTemporaryFilePath(name + ".edr");
+    runner_->logFileName_                     = fileManager_->getTemporaryFilePath(name + ".log");
+    runner_->fullPrecisionTrajectoryFileName_ = fileManager_->getTemporaryFilePath(name + ".trr");
+
+    CommandLine caller(commandLine_);
+    if (rerunFileName != NULL)
+    {
+        caller.addOption("-rerun", rerunFileName);
+    }
+
+    ScopedEnvironment env(environment);
+    return runner_->callMdrun(caller);
+}
+
+void MdrunComparison::compareReruns(const char *const referenceEnvironment[],
+                                    const char *const testEnvironment[])
+{
+    ASSERT_EQ(0, runMdrun("md", NULL, NULL));
+    trajectoryFileName_ = runner_->fullPrecisionTrajectoryFileName_;
+
+    ASSERT_EQ(0, runMdrun("reference", referenceEnvironment, trajectoryFileName_.c_str()));
+    std::vector<EnergyFrame> referenceEnergies = readEnergyFrames(runner_->edrFileName_);
+    referenceForces_ = readForceFrames(runner_->fullPrecisionTrajectoryFileName_);
+    ASSERT_FALSE(referenceForces_.empty()) << "No force frames in the reference run";
+
+    ASSERT_EQ(0, runMdrun("test", testEnvironment, trajectoryFileName_.c_str()));
+    compareEnergyFrames(referenceEnergies, readEnergyFrames(runner_->edrFileName_),
+                        energyTerms_, energyTolerance_);
+    compareForceFrames(referenceForces_, readForceFrames(runner_->fullPrecisionTrajectoryFileName_),
+                       forceTolerance_);
+}
+
+void MdrunComparison::compareRerunBitwise(const char *const environment[])
+{
+    GMX_RELEASE_ASSERT(!trajectoryFileName_.empty(), "compareReruns() should be called first");
+
+    ASSERT_EQ(0, runMdrun("bitwise", environment, trajectoryFileName_.c_str()));
+    compareFramesBitwise(referenceForces_, readForceFrames(runner_->fullPrecisionTrajectoryFileName_),
+                         "Force");
+}
+
+void MdrunComparison::compareRunsBitwise(const char *const referenceEnvironment[],
+                                         const char *const testEnvironment[])
+{
+    ASSERT_EQ(0, runMdrun("reference", referenceEnvironment, NULL));
+    std::vector<CoordinateFrame> referenceCoordinates =
+        readCoordinateFrames(runner_->fullPrecisionTrajectoryFileName_);
+    std::vector<ForceFrame>      referenceForces =
+        readForceFrames(runner_->fullPrecisionTrajectoryFileName_);
+    ASSERT_FALSE(referenceCoordinates.empty()) << "No coordinate frames in the reference run";
+
+    ASSERT_EQ(0, runMdrun("test", testEnvironment, NULL));
+    compareFramesBitwise(referenceCoordinates,
+                         readCoordinateFrames(runner_->fullPrecisionTrajectoryFileName_),
+                         "Coordinate");
+    compareFramesBitwise(referenceForces,
+                         readForceFrames(runner_->fullPrecisionTrajectoryFileName_),
+                         "Force");
+}
+
+} // namespace test
+} // namespace gmx
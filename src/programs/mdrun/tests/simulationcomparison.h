@@ -0,0 +1,226 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Declares helpers for comparing the output of mdrun runs.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#ifndef GMX_MDRUN_TESTS_SIMULATIONCOMPARISON_H
+#define GMX_MDRUN_TESTS_SIMULATIONCOMPARISON_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gromacs/math/vectypes.h"
+#include "gromacs/utility/real.h"
+
+#include "testutils/cmdlinetest.h"
+
+namespace gmx
+{
+
+namespace test
+{
+
+class SimulationRunner;
+class TestFileManager;
+
+//! Energy terms of one energy-file frame, indexed by name
+typedef std::map<std::string, real> EnergyFrame;
+
+//! Coordinates of all atoms in one trajectory frame
+typedef std::vector<RVec> CoordinateFrame;
+
+//! Forces of all atoms in one trajectory frame
+typedef std::vector<RVec> ForceFrame;
+
+//! Reads all frames of the energy file \p fileName
+std::vector<EnergyFrame> readEnergyFrames(const std::string &fileName);
+
+//! Reads the forces of all frames with forces in the .trr file \p fileName
+std::vector<ForceFrame> readForceFrames(const std::string &fileName);
+
+//! Reads the coordinates of all frames with coordinates in the .trr file \p fileName
+std::vector<CoordinateFrame> readCoordinateFrames(const std::string &fileName);
+
+/*! \brief
+ * Expects the energy terms \p names to match in all frames of two runs
+ *
+ * \p names is a NULL-terminated list of energy term names, which should
+ * be present in both files. The tolerance is relative to the magnitude of
+ * the reference value, with at least 1 kJ/mol as magnitude.
+ */
+void compareEnergyFrames(const std::vector<EnergyFrame> &reference,
+                         const std::vector<EnergyFrame> &test,
+                         const char *const               names[],
+                         real                            relativeTolerance);
+
+/*! \brief
+ * Expects the forces to match in all frames of two runs
+ *
+ * The tolerance is relative to the largest reference force component
+ * in each frame.
+ */
+void compareForceFrames(const std::vector<ForceFrame> &reference,
+                        const std::vector<ForceFrame> &test,
+                        real                           relativeTolerance);
+
+/*! \brief
+ * Expects the coordinates or forces of two runs to be bitwise identical
+ *
+ * \p quantity names the compared vectors in failure messages.
+ */
+void compareFramesBitwise(const std::vector< std::vector<RVec> > &reference,
+                          const std::vector< std::vector<RVec> > &test,
+                          const char                             *quantity);
+
+/*! \brief
+ * Writes a table for user potentials to \p fileName
+ *
+ * The table holds the plain Coulomb and Lennard-Jones potentials,
+ * f = 1/r, g = -1/r^6 and h = 1/r^12, with the columns r, f, -f', g,
+ * -g', h and -h' up to 2 nm.
+ */
+void writeUserTable(const std::string &fileName);
+
+/*! \internal \brief
+ * Sets environment variables for mdrun for the lifetime of the object
+ */
+class ScopedEnvironment
+{
+    public:
+        /*! \brief Sets the variables in \p variables
+         *
+         * \p variables is a NULL-terminated list of "NAME=value" strings,
+         * NULL is accepted for no variables.
+         */
+        explicit ScopedEnvironment(const char *const variables[]);
+        //! Unsets the variables set in the constructor
+        ~ScopedEnvironment();
+
+    private:
+        std::vector<std::string> names_;
+};
+
+/*! \internal \brief
+ * Compares mdrun runs that should give the same results
+ *
+ * The runs of a comparison differ only in their environment variables,
+ * all use the same command line.
+ *
+ * Any method in this class may throw std::bad_alloc if out of memory.
+ */
+class MdrunComparison
+{
+    public:
+        /*! \brief Prepares mdrun calls through \p runner
+         *
+         * The output files are temporary files of \p fileManager.
+         */
+        MdrunComparison(SimulationRunner *runner, TestFileManager *fileManager);
+
+        /*! \brief Runs grompp for 20 steps of \p system with PME
+         *
+         * The cut-offs are 0.7 nm, energies, coordinates and forces are
+         * written every 5 steps. \p extraMdp is appended to these settings.
+         */
+        void prepare(const char *system, const char *extraMdp = "");
+        /*! \brief Sets the numbers of ranks and OpenMP threads per rank
+         *
+         * The number of ranks is only used with thread-MPI, with MPI it
+         * is set when starting the test. The number of threads is only
+         * used with OpenMP.
+         */
+        void setThreads(int numRanks, int numOpenMPThreads);
+        //! Returns the command line for all mdrun calls, for adding options
+        CommandLine &commandLine() { return commandLine_; }
+        //! Sets the NULL-terminated list of energy terms that are compared
+        void setEnergyTerms(const char *const names[]) { energyTerms_ = names; }
+        //! Sets the relative tolerances, see compareEnergyFrames() and compareForceFrames()
+        void setTolerances(real energyTolerance, real forceTolerance);
+
+        /*! \brief Expects a test run to reproduce a reference run
+         *
+         * A first run writes a trajectory. The reference and the test
+         * run, with \p referenceEnvironment and \p testEnvironment,
+         * recompute its frames, so differences in rounding can not grow
+         * over the steps. Their energies and forces are compared.
+         * Afterwards the log file name of the runner is that of the
+         * test run.
+         */
+        void compareReruns(const char *const referenceEnvironment[],
+                           const char *const testEnvironment[]);
+        /*! \brief Expects another rerun to give bitwise the reference forces
+         *
+         * Recomputes the frames of the trajectory of the last
+         * compareReruns() call with \p environment and the current
+         * command line.
+         */
+        void compareRerunBitwise(const char *const environment[]);
+        /*! \brief Expects a test run to reproduce a reference run bitwise
+         *
+         * Runs mdrun with \p referenceEnvironment and with
+         * \p testEnvironment, the coordinates and forces should be
+         * bitwise identical in all frames.
+         */
+        void compareRunsBitwise(const char *const referenceEnvironment[],
+                                const char *const testEnvironment[]);
+
+    private:
+        /*! \brief Runs mdrun with output file names containing \p tag
+         *
+         * With \p rerunFileName the frames of that trajectory are
+         * recomputed.
+         */
+        int runMdrun(const char        *tag,
+                     const char *const  environment[],
+                     const char        *rerunFileName);
+
+        SimulationRunner        *runner_;
+        TestFileManager         *fileManager_;
+        CommandLine              commandLine_;
+        const char *const       *energyTerms_;
+        real                     energyTolerance_;
+        real                     forceTolerance_;
+        std::string              trajectoryFileName_;
+        std::vector<ForceFrame>  referenceForces_;
+};
+
+} // namespace test
+} // namespace gmx
+
+#endif
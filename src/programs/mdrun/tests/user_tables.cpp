@@ -0,0 +1,176 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+
+/*! \internal \file
+ * \brief
+ * Tests for the user-table non-bonded kernels of the Verlet scheme
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include "config.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gromacs/mdlib/nbnxn_simd.h"
+#include "gromacs/utility/stringutil.h"
+
+#include "testutils/cmdlinetest.h"
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Energy terms compared between tabulated and analytical runs
+const char *const c_energyTerms[] = { "LJ (SR)", "Coulomb (SR)", "Potential", NULL };
+
+//! Test fixture for the user-table kernels, parametrized by the kernel setting
+class UserTableTest : public gmx::test::MdrunTestFixture,
+                      public ::testing::WithParamInterface<const char *>
+{
+    public:
+        /*! \brief Runs grompp for 20 steps of 216 waters
+         *
+         * Energies, coordinates and forces are written every 5 steps.
+         * The interactions are set by \p interactionMdp, the pair list
+         * has a fixed buffer.
+         */
+        void prepare(const char *interactionMdp);
+        /*! \brief Runs mdrun with output file names containing \p tag
+         *
+         * With \p rerunFileName != NULL, reruns that trajectory.
+         */
+        int runMdrun(const char *tag, const char *rerunFileName = NULL);
+        //! The table file for user potentials passed to mdrun, when not empty
+        std::string tableFileName_;
+};
+
+void UserTableTest::prepare(const char *interactionMdp)
+{
+    std::string mdp("cutoff-scheme = Verlet\n"
+                    "rcoulomb = 0.7\n"
+                    "rvdw = 0.7\n"
+                    "verlet-buffer-tolerance = -1\n"
+                    "rlist = 0.8\n"
+                    "nsteps = 20\n"
+                    "nstlist = 10\n"
+                    "nstcalcenergy = 5\n"
+                    "nstenergy = 5\n"
+                    "nstxout = 5\n"
+                    "nstfout = 5\n");
+    runner_.useStringAsMdpFile(mdp + interactionMdp);
+    runner_.useTopGroAndNdxFromDatabase("spc216");
+    ASSERT_EQ(0, runner_.callGrompp());
+}
+
+int UserTableTest::runMdrun(const char *tag, const char *rerunFileName)
+{
+    std::string name(tag);
+    runner_.edrFileName_                     = fileManager_.getTemporaryFilePath(name + ".edr");
+    runner_.logFileName_                     = fileManager_.getTemporaryFilePath(name + ".log");
+    runner_.fullPrecisionTrajectoryFileName_ = fileManager_.getTemporaryFilePath(name + ".trr");
+
+    ::gmx::test::CommandLine caller;
+    caller.append("mdrun");
+    if (rerunFileName != NULL)
+    {
+        caller.addOption("-rerun", rerunFileName);
+    }
+    if (!tableFileName_.empty())
+    {
+        caller.addOption("-table", tableFileName_);
+    }
+#ifdef GMX_THREAD_MPI
+    caller.addOption("-ntmpi", 1);
+#endif
+
+    return runner_.callMdrun(caller);
+}
+
+/* The tabulated 1/r and Lennard-Jones potentials of writeUserTable
+ * should reproduce the analytical plain cut-off kernels without
+ * potential modifiers.
+ */
+TEST_P(UserTableTest, ReproducesPlainCutOff)
+{
+    const char *const            environment[] = { GetParam(), NULL };
+    gmx::test::ScopedEnvironment env(environment);
+
+    prepare("coulombtype = Cut-off\n"
+            "coulomb-modifier = None\n"
+            "vdw-modifier = None\n");
+    ASSERT_EQ(0, runMdrun("cutoff"));
+    std::string referenceTrajectory = runner_.fullPrecisionTrajectoryFileName_;
+    std::vector<gmx::test::EnergyFrame> referenceEnergies =
+        gmx::test::readEnergyFrames(runner_.edrFileName_);
+    std::vector<gmx::test::ForceFrame>  referenceForces   =
+        gmx::test::readForceFrames(referenceTrajectory);
+
+    tableFileName_ = fileManager_.getTemporaryFilePath("table.xvg");
+    gmx::test::writeUserTable(tableFileName_);
+    /* The warning about combination rules with user potentials */
+    runner_.maxWarnings_ = 1;
+    prepare("coulombtype = user\n"
+            "vdwtype = user\n");
+    ASSERT_EQ(0, runMdrun("table", referenceTrajectory.c_str()));
+    gmx::test::compareEnergyFrames(referenceEnergies,
+                                   gmx::test::readEnergyFrames(runner_.edrFileName_),
+                                   c_energyTerms, 1e-5);
+    gmx::test::compareForceFrames(referenceForces,
+                                  gmx::test::readForceFrames(runner_.fullPrecisionTrajectoryFileName_),
+                                  1e-5);
+}
+
+//! The kernel settings for UserTableTest, the plain-C kernel and the SIMD kernels
+const char *const c_userTableKernels[] = {
+    "GMX_DISABLE_SIMD_KERNELS=1",
+#ifdef GMX_NBNXN_SIMD_4XN
+    "GMX_NBNXN_SIMD_4XN=1",
+#endif
+#ifdef GMX_NBNXN_SIMD_2XNN
+    "GMX_NBNXN_SIMD_2XNN=1",
+#endif
+};
+
+INSTANTIATE_TEST_CASE_P(WithKernel, UserTableTest,
+                            ::testing::ValuesIn(c_userTableKernels));
+
+} // namespace
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the GROMACS molecular simulation package.
+ *
+ * Copyright (c) 2015, by the GROMACS development team, led by
+ * Mark Abraham, David van der Spoel, Berk Hess, and Erik Lindahl,
+ * and including many others, as listed in the AUTHORS file in the
+ * top-level source directory and at http://www.gromacs.org.
+ *
+ * GROMACS is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2.1
+ * of the License, or (at your option) any later version.
+ *
+ * GROMACS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with GROMACS; if not, see
+ * http://www.gnu.org/licenses, or write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA.
+ *
+ * If you want to redistribute modifications to GROMACS, please
+ * consider that scientific software is very special. Version
+ * control is crucial - bugs must be traceable. We will be happy to
+ * consider code for inclusion in the official distribution, but
+ * derived work must not be called official GROMACS. Details are found
+ * in the README & COPYING files - if they are missing, get the
+ * official version at http://www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org.
+ */
+/*! \internal \file
+ * \brief
+ * Tests the distribution of the non-bonded work over the OpenMP
+ * threads with work stealing.
+ *
+ * \ingroup module_mdrun_integration_tests
+ */
+#include "gmxpre.h"
+
+#include <gtest/gtest.h>
+
+#include "moduletest.h"
+#include "simulationcomparison.h"
+
+namespace
+{
+
+//! Energy terms compared between the runs with and without work stealing
+const char *const c_energyTerms[] = { "LJ (SR)", "Coulomb (SR)", "Potential", "Pressure", NULL };
+
+/*! \brief Relative tolerance for the forces in the comparison without
+ * work stealing
+ *
+ * A stolen chunk of i-entries is computed into the force buffer of
+ * another thread, so the forces are summed in a different order.
+ */
+const real c_forceTolerance = 1e-5;
+
+/*! \brief Relative tolerance for the energies
+ *
+ * The energies are accumulated per thread in single precision. Already
+ * without work stealing, changing the number of threads changes the
+ * short-range Coulomb energy of this system by 3e-5.
+ */
+const real c_energyTolerance = 1e-4;
+
+/*! \brief Test fixture for the non-bonded work stealing
+ *
+ * The parameter is the number of ranks used with thread-MPI, more than
+ * one gives domain decomposition and separate local and non-local
+ * kernel calls.
+ */
+class WorkStealingTest : public gmx::test::MdrunTestFixture,
+                         public ::testing::WithParamInterface<int>
+{
+};
+
+/* Runs with work stealing should reproduce runs without it, and with
+ * -reprod there should be no work stealing at all. The octane slab in
+ * water gives threads lists of different cost. The system is large
+ * enough that a stolen chunk uses force buffer blocks the stealing
+ * thread did not flag itself.
+ */
+TEST_P(WorkStealingTest, ReproducesRunWithoutWorkStealing)
+{
+    gmx::test::MdrunComparison comparison(&runner_, &fileManager_);
+    comparison.prepare("OctaneSandwich", "constraints = h-bonds\n");
+    comparison.commandLine().addOption("-npme", 0);
+    comparison.setThreads(GetParam(), 2);
+    comparison.setEnergyTerms(c_energyTerms);
+    comparison.setTolerances(c_energyTolerance, c_forceTolerance);
+
+    const char *const noStealingEnvironment[] = { "GMX_NBNXN_NO_WORK_STEALING=1", NULL };
+    comparison.compareReruns(noStealingEnvironment, NULL);
+
+    comparison.commandLine().append("-reprod");
+    comparison.compareRerunBitwise(NULL);
+}
+
+INSTANTIATE_TEST_CASE_P(NumberOfRanks, WorkStealingTest, ::testing::Values(1, 2));
+
+} // namespace